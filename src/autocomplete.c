@@ -33,6 +33,7 @@
 #include "literals.h"
 #include "options.h"
 #include "set_options.h"
+#include "sink.h"
 #include "strbuf.h"
 #include "util.h"
 
@@ -0,0 +1,300 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/bk_tree.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for manipulating a _BK-Tree_ of strings.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "bk_tree.h"
+#include "dam_lev.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <stdint.h>                     /* for SIZE_MAX */
+#include <stdlib.h>
+#include <string.h>
+
+/// @endcond
+
+/**
+ * @addtogroup bk-tree-group
+ * @{
+ */
+
+/**
+ * A BK-tree node.
+ *
+ * @remarks Every child of a node has a different edit distance from the node:
+ * a child at distance _d_ is the root of the subtree of all literals at
+ * distance _d_ from the node.
+ */
+struct bk_node {
+  bk_node_t    *child;                  ///< First child, if any.
+  bk_node_t    *sibling;                ///< Next sibling, if any.
+  size_t        dist;                   ///< Edit distance from parent.
+  size_t        max_child_dist;         ///< Greatest \ref dist of children.
+  user_data_t   data;                   ///< User data.
+  bool          is_removed;             ///< Removed via bk_tree_remove()?
+  size_t        len;                    ///< Length of \ref literal.
+  char          literal[];              ///< The literal.
+};
+
+/**
+ * Data passed to bk_node_search().
+ */
+struct bk_search {
+  char const     *source;               ///< String to search for.
+  size_t          source_len;           ///< Length of \ref source.
+  void           *dam_lev_mem;          ///< Memory for dam_lev_dist().
+  bk_visit_fn_t   visit_fn;             ///< Visitor function.
+  void           *v_data;               ///< Visitor data.
+};
+typedef struct bk_search bk_search_t;
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Frees \a node, its children, and its siblings.
+ *
+ * @param node The \ref bk_node to free.  If NULL, does nothing.
+ */
+static void bk_node_free( bk_node_t *node ) {
+  while ( node != NULL ) {
+    bk_node_t *const sibling = node->sibling;
+    bk_node_free( node->child );
+    free( node );
+    node = sibling;
+  } // while
+}
+
+/**
+ * Searches \a node and its descendants for every literal whose edit distance
+ * from \ref bk_search::source "source" is within \a max_dist.
+ *
+ * @param node The \ref bk_node to search.
+ * @param bs The \ref bk_search to use.
+ * @param max_dist The maximum edit distance.
+ * @return Returns the maximum edit distance as last returned by \ref
+ * bk_search::visit_fn "visit_fn".
+ */
+NODISCARD
+static size_t bk_node_search( bk_node_t const *node, bk_search_t const *bs,
+                              size_t max_dist ) {
+  assert( node != NULL );
+  assert( bs != NULL );
+
+  //
+  // If the distance is more than max_dist + max_child_dist, neither node nor
+  // any of its children can be within max_dist (below), so there's no need to
+  // calculate the exact distance.
+  //
+  size_t const bound_dist = max_dist > SIZE_MAX - node->max_child_dist ?
+    SIZE_MAX : max_dist + node->max_child_dist;
+  size_t const dist = dam_lev_dist_max(
+    bs->dam_lev_mem, bs->source, bs->source_len, node->literal, node->len,
+    bound_dist
+  );
+  if ( dist <= max_dist && !node->is_removed )
+    max_dist = (*bs->visit_fn)( node->literal, dist, node->data, bs->v_data );
+
+  for ( bk_node_t const *child = node->child; child != NULL;
+        child = child->sibling ) {
+    //
+    // By the triangle inequality, only a child whose distance from node is
+    // within max_dist of dist can have literals within max_dist of source.
+    //
+    size_t const diff = child->dist > dist ?
+      child->dist - dist : dist - child->dist;
+    if ( diff <= max_dist )
+      max_dist = bk_node_search( child, bs, max_dist );
+  } // for
+
+  return max_dist;
+}
+
+/**
+ * Inserts \a new_node into \a tree.
+ *
+ * @param tree A pointer to the BK-tree to insert into.
+ * @param new_node The \ref bk_node to insert.
+ */
+static void bk_tree_insert_node( bk_tree_t *tree, bk_node_t *new_node ) {
+  assert( tree != NULL );
+  assert( new_node != NULL );
+
+  new_node->child = new_node->sibling = NULL;
+  new_node->dist = new_node->max_child_dist = 0;
+  if ( new_node->len > tree->max_literal_len )
+    tree->max_literal_len = new_node->len;
+  ++tree->len;
+
+  if ( tree->root == NULL ) {
+    tree->root = new_node;
+    return;
+  }
+
+  void *const dam_lev_mem =
+    dam_lev_new( new_node->len, tree->max_literal_len );
+
+  for ( bk_node_t *node = tree->root; ; ) {
+    size_t const dist = dam_lev_dist(
+      dam_lev_mem, new_node->literal, new_node->len, node->literal, node->len
+    );
+    bk_node_t **pchild = &node->child;
+    while ( *pchild != NULL && (*pchild)->dist != dist )
+      pchild = &(*pchild)->sibling;
+    if ( *pchild == NULL ) {
+      new_node->dist = dist;
+      if ( dist > node->max_child_dist )
+        node->max_child_dist = dist;
+      *pchild = new_node;
+      break;
+    }
+    node = *pchild;
+  } // for
+
+  free( dam_lev_mem );
+}
+
+/**
+ * Reinserts \a node, its children, and its siblings into \a tree, freeing
+ * those that were removed.
+ *
+ * @param tree A pointer to the BK-tree to reinsert into.
+ * @param node The \ref bk_node to reinsert.  If NULL, does nothing.
+ */
+static void bk_tree_reinsert( bk_tree_t *tree, bk_node_t *node ) {
+  while ( node != NULL ) {
+    bk_node_t *const child = node->child;
+    bk_node_t *const sibling = node->sibling;
+    if ( node->is_removed )
+      free( node );
+    else
+      bk_tree_insert_node( tree, node );
+    bk_tree_reinsert( tree, child );
+    node = sibling;
+  } // while
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+void bk_tree_cleanup( bk_tree_t *tree ) {
+  if ( tree == NULL )
+    return;
+  bk_node_free( tree->root );
+  bk_tree_init( tree );
+}
+
+void bk_tree_init( bk_tree_t *tree ) {
+  assert( tree != NULL );
+  MEM_ZERO( tree );
+}
+
+void bk_tree_insert( bk_tree_t *tree, char const *literal, user_data_t data ) {
+  assert( tree != NULL );
+  assert( literal != NULL );
+
+  size_t const len = strlen( literal );
+  bk_node_t *const new_node =
+    check_realloc( NULL, sizeof( bk_node_t ) + len + 1 );
+  new_node->data = data;
+  new_node->is_removed = false;
+  new_node->len = len;
+  strcpy( new_node->literal, literal );
+
+  bk_tree_insert_node( tree, new_node );
+}
+
+bool bk_tree_remove( bk_tree_t *tree, char const *literal ) {
+  assert( tree != NULL );
+  assert( literal != NULL );
+
+  if ( tree->root == NULL )
+    return false;
+
+  size_t const len = strlen( literal );
+  void *const dam_lev_mem = dam_lev_new( len, tree->max_literal_len );
+  bk_node_t *node = tree->root;
+
+  do {
+    size_t const dist = dam_lev_dist(
+      dam_lev_mem, literal, len, node->literal, node->len
+    );
+    if ( dist == 0 && !node->is_removed )
+      break;
+    for ( node = node->child; node != NULL && node->dist != dist;
+          node = node->sibling )
+      ;
+  } while ( node != NULL );
+
+  free( dam_lev_mem );
+  if ( node == NULL )
+    return false;
+
+  node->is_removed = true;
+  --tree->len;
+  if ( ++tree->removed_len > tree->len ) {
+    //
+    // Removed nodes are still searched through, so rebuild the tree when
+    // they're the majority.
+    //
+    bk_node_t *const old_root = tree->root;
+    size_t const max_literal_len = tree->max_literal_len;
+    bk_tree_init( tree );
+    tree->max_literal_len = max_literal_len;
+    bk_tree_reinsert( tree, old_root );
+  }
+  return true;
+}
+
+size_t bk_tree_search( bk_tree_t const *tree, char const *source,
+                       size_t max_dist, bk_visit_fn_t visit_fn,
+                       void *v_data ) {
+  assert( tree != NULL );
+  assert( source != NULL );
+  assert( visit_fn != NULL );
+
+  if ( tree->root == NULL )
+    return max_dist;
+
+  size_t const source_len = strlen( source );
+  bk_search_t const bs = {
+    .source = source,
+    .source_len = source_len,
+    .dam_lev_mem = dam_lev_new( source_len, tree->max_literal_len ),
+    .visit_fn = visit_fn,
+    .v_data = v_data
+  };
+  max_dist = bk_node_search( tree->root, &bs, max_dist );
+  free( bs.dam_lev_mem );
+  return max_dist;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
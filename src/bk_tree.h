@@ -0,0 +1,164 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/bk_tree.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_bk_tree_H
+#define cdecl_bk_tree_H
+
+/**
+ * @file
+ * Declares types to represent a _BK-Tree_ of strings as well as functions for
+ * manipulating said trees.
+ *
+ * @sa [BK-tree](https://en.wikipedia.org/wiki/BK-tree)
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdbool.h>
+#include <stddef.h>                     /* for size_t */
+
+/// @endcond
+
+/**
+ * @defgroup bk-tree-group BK-Tree
+ * Types for defining and functions for manipulating BK-trees of strings.
+ *
+ * @remarks A BK-tree indexes strings by their Damerau-Levenshtein edit
+ * distance from one another.  Because that distance is a metric, a search for
+ * all strings within some distance of a given string needs to calculate the
+ * distance to only a small fraction of the strings in the tree.
+ *
+ * @sa [BK-tree](https://en.wikipedia.org/wiki/BK-tree)
+ *
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+typedef struct bk_node  bk_node_t;
+typedef struct bk_tree  bk_tree_t;
+
+/**
+ * The signature for a function passed to bk_tree_search().
+ *
+ * @param literal The literal of a node within the current maximum distance.
+ * @param dist The edit distance between \a literal and the search string.
+ * @param data The user data of the node.
+ * @param v_data Optional data passed to the visitor.
+ * @return Returns the maximum edit distance for the remainder of the search.
+ * Returning a lower distance than the current one prunes the search.
+ */
+typedef size_t (*bk_visit_fn_t)( char const *literal, size_t dist,
+                                 user_data_t data, void *v_data );
+
+/**
+ * A BK-tree of strings.
+ *
+ * @note Literals are copied into the tree.  More than one node may have the
+ * same literal.
+ *
+ * @sa bk_tree_init()
+ */
+struct bk_tree {
+  bk_node_t  *root;                     ///< Root node or NULL if empty.
+  size_t      len;                      ///< Number of nodes not removed.
+  size_t      removed_len;              ///< Number of nodes removed.
+  size_t      max_literal_len;          ///< Length of longest literal.
+};
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Cleans-up all memory associated with \a tree but does _not_ free \a tree
+ * itself.
+ *
+ * @param tree The BK-tree to clean up.  If NULL, does nothing; otherwise,
+ * reinitializes \a tree upon completion.
+ *
+ * @sa bk_tree_init()
+ */
+void bk_tree_cleanup( bk_tree_t *tree );
+
+/**
+ * Initializes a BK-tree.
+ *
+ * @param tree The BK-tree to initialize.
+ *
+ * @sa bk_tree_cleanup()
+ */
+void bk_tree_init( bk_tree_t *tree );
+
+/**
+ * Inserts \a literal into \a tree.
+ *
+ * @param tree A pointer to the BK-tree to insert into.
+ * @param literal The literal to insert.  It is copied.
+ * @param data The user data to associate with \a literal.
+ *
+ * @sa bk_tree_remove()
+ */
+void bk_tree_insert( bk_tree_t *tree, char const *literal, user_data_t data );
+
+/**
+ * Removes a node having \a literal from \a tree.
+ *
+ * @remarks Because the positions of a node's descendants depend on the node's
+ * literal, the node is only marked as removed.  When the number of removed
+ * nodes exceeds the number of remaining nodes, the tree is rebuilt.
+ *
+ * @param tree A pointer to the BK-tree to remove from.
+ * @param literal The literal to remove.
+ * @return Returns `true` only if a node having \a literal was removed.
+ *
+ * @sa bk_tree_insert()
+ */
+PJL_DISCARD
+bool bk_tree_remove( bk_tree_t *tree, char const *literal );
+
+/**
+ * Searches \a tree for every literal whose edit distance from \a source is
+ * less than or equal to a maximum distance.
+ *
+ * @param tree A pointer to the BK-tree to search.
+ * @param source The string to search for.
+ * @param max_dist The initial maximum edit distance.
+ * @param visit_fn The visitor function called for every literal found that is
+ * within the current maximum edit distance.  The order in which literals are
+ * visited is unspecified.
+ * @param v_data Optional data passed to \a visit_fn.
+ * @return Returns the maximum edit distance as last returned by \a visit_fn
+ * or \a max_dist if \a visit_fn was never called.
+ */
+PJL_DISCARD
+size_t bk_tree_search( bk_tree_t const *tree, char const *source,
+                       size_t max_dist, bk_visit_fn_t visit_fn,
+                       void *v_data );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_bk_tree_H */
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,192 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/bk_tree_test.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "bk_tree.h"
+#include "dam_lev.h"
+#include "sink.h"
+#include "util.h"
+#include "unit_test.h"
+
+// standard
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Data passed to test_bk_visitor().
+ */
+struct test_bk_visit_data {
+  unsigned  found_mask;                 ///< Bitmask of WORDS found.
+  size_t    max_dist;                   ///< Maximum distance.
+  bool      is_shrinking;               ///< Shrink \ref max_dist?
+};
+typedef struct test_bk_visit_data test_bk_visit_data_t;
+
+// extern variables
+char const         *me;                 ///< Program name.
+
+// local variables
+static unsigned     test_failures;
+
+static char const *const WORDS[] = {
+  "auto", "bool", "break", "case", "char", "const", "continue", "default",
+  "do", "double", "else", "enum", "extern", "float", "for", "goto", "if",
+  "inline", "int", "long", "register", "restrict", "return", "short",
+  "signed", "sizeof", "static", "struct", "switch", "typedef", "union",
+  "unsigned"
+};
+
+static char const *const QUERIES[] = {
+  "", "a", "autp", "chra", "cnost", "dobule", "fro", "it", "lnog", "sigend",
+  "strcut", "unoin", "xyzzy"
+};
+
+////////// local functions ////////////////////////////////////////////////////
+
+static size_t test_bk_visitor( char const *literal, size_t dist,
+                               user_data_t data, void *v_data ) {
+  test_bk_visit_data_t *const tbvd = v_data;
+  TEST( strcmp( literal, WORDS[ data.ui ] ) == 0 );
+  TEST( dist <= tbvd->max_dist );
+  tbvd->found_mask |= 1u << data.ui;
+  if ( tbvd->is_shrinking && dist < tbvd->max_dist )
+    tbvd->max_dist = dist;
+  return tbvd->max_dist;
+}
+
+/**
+ * Tests that searching \a tree finds exactly the WORDS in \a present_mask
+ * that are within each of several distances of each of QUERIES.
+ */
+static void test_bk_search( bk_tree_t const *tree, unsigned present_mask ) {
+  void *const dam_lev_mem = dam_lev_new( 16, 16 );
+
+  FOREACH_ARRAY_ELEMENT( char const*, query, QUERIES ) {
+    size_t const query_len = strlen( *query );
+    size_t dists[ ARRAY_SIZE( WORDS ) ];
+    size_t least_dist = SIZE_MAX;
+    for ( unsigned i = 0; i < ARRAY_SIZE( WORDS ); ++i ) {
+      dists[i] = dam_lev_dist(
+        dam_lev_mem, *query, query_len, WORDS[i], strlen( WORDS[i] )
+      );
+      if ( (present_mask & (1u << i)) != 0 && dists[i] < least_dist )
+        least_dist = dists[i];
+    } // for
+
+    for ( size_t max_dist = 0; max_dist <= 3; ++max_dist ) {
+      unsigned expected_mask = 0;
+      for ( unsigned i = 0; i < ARRAY_SIZE( WORDS ); ++i ) {
+        if ( dists[i] <= max_dist )
+          expected_mask |= 1u << i;
+      } // for
+      expected_mask &= present_mask;
+
+      test_bk_visit_data_t tbvd = { 0, max_dist, false };
+      TEST( bk_tree_search( tree, *query, max_dist, &test_bk_visitor,
+                            &tbvd ) == max_dist );
+      TEST( tbvd.found_mask == expected_mask );
+    } // for
+
+    // test that a shrinking distance still finds all the least ones
+    if ( least_dist > 0 && least_dist != SIZE_MAX ) {
+      test_bk_visit_data_t tbvd = { 0, SIZE_MAX, true };
+      TEST( bk_tree_search( tree, *query, SIZE_MAX, &test_bk_visitor,
+                            &tbvd ) == least_dist );
+      for ( unsigned i = 0; i < ARRAY_SIZE( WORDS ); ++i ) {
+        if ( (present_mask & (1u << i)) != 0 && dists[i] == least_dist )
+          TEST( (tbvd.found_mask & (1u << i)) != 0 );
+      } // for
+    }
+  } // for
+
+  free( dam_lev_mem );
+}
+
+// LCOV_EXCL_START
+_Noreturn
+static void usage( void ) {
+  EPRINTF( "usage: %s\n", me );
+  exit( EX_USAGE );
+}
+// LCOV_EXCL_STOP
+
+////////// main ///////////////////////////////////////////////////////////////
+
+int main( int argc, char const *argv[const] ) {
+  me = base_name( argv[0] );
+  if ( --argc != 0 )
+    usage();                            // LCOV_EXCL_LINE
+
+  bk_tree_t tree;
+  bk_tree_init( &tree );
+
+  // test empty tree
+  test_bk_search( &tree, 0 );
+  TEST( !bk_tree_remove( &tree, "int" ) );
+
+  // test insertion
+  unsigned present_mask = 0;
+  for ( unsigned i = 0; i < ARRAY_SIZE( WORDS ); ++i ) {
+    bk_tree_insert( &tree, WORDS[i], (user_data_t){ .ui = i } );
+    present_mask |= 1u << i;
+  } // for
+  TEST( tree.len == ARRAY_SIZE( WORDS ) );
+  test_bk_search( &tree, present_mask );
+
+  // test removal
+  TEST( !bk_tree_remove( &tree, "itn" ) );
+  for ( unsigned i = 0; i < ARRAY_SIZE( WORDS ); i += 3 ) {
+    if ( TEST( bk_tree_remove( &tree, WORDS[i] ) ) )
+      present_mask &= ~(1u << i);
+    TEST( !bk_tree_remove( &tree, WORDS[i] ) );
+  } // for
+  test_bk_search( &tree, present_mask );
+
+  // test removal that rebuilds the tree
+  for ( unsigned i = 1; i < ARRAY_SIZE( WORDS ); i += 3 ) {
+    if ( TEST( bk_tree_remove( &tree, WORDS[i] ) ) )
+      present_mask &= ~(1u << i);
+  } // for
+  TEST( tree.removed_len < tree.len );
+  test_bk_search( &tree, present_mask );
+
+  // test reinsertion
+  for ( unsigned i = 0; i < ARRAY_SIZE( WORDS ); i += 3 ) {
+    bk_tree_insert( &tree, WORDS[i], (user_data_t){ .ui = i } );
+    present_mask |= 1u << i;
+  } // for
+  test_bk_search( &tree, present_mask );
+
+  bk_tree_cleanup( &tree );
+  TEST( tree.root == NULL );
+
+  printf( "%u failures\n", test_failures );
+  exit( test_failures > 0 ? EX_SOFTWARE : EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
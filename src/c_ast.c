@@ -36,11 +36,45 @@
 
 // standard
 #include <assert.h>
+#include <stdalign.h>
+#include <stdatomic.h>
 #include <stdbool.h>
 #include <stddef.h>                     /* for offsetof() */
+#include <stdlib.h>                     /* for aligned_alloc(3), free(3) */
+#include <string.h>                     /* for memcpy(3), memset(3) */
+#include <sysexits.h>
 
 /// @endcond
 
+/**
+ * The size of the debug-only members of \ref c_ast.
+ */
+#ifdef ENABLE_CDECL_DEBUG
+# define C_AST_HEADER_DEBUG_SIZE  (2 * sizeof(c_ast_id_t))
+#else
+# define C_AST_HEADER_DEBUG_SIZE  0
+#endif /* ENABLE_CDECL_DEBUG */
+
+/**
+ * The size budget of the kind-independent members of \ref c_ast that precede
+ * its kind-specific union: the sum of their sizes, i.e., no padding.
+ */
+#define C_AST_HEADER_SIZE_BUDGET                                \
+  ( sizeof(c_ast_kind_t) + sizeof(unsigned) + sizeof(c_type_t)  \
+  + 2 * sizeof(c_ast_t*) + sizeof(c_sname_t) + sizeof(c_loc_t)  \
+  + C_AST_HEADER_DEBUG_SIZE )
+
+static_assert(
+  offsetof( c_ast_t, parent ) <= C_AST_HEADER_SIZE_BUDGET,
+  "c_ast members before the union exceed their size budget"
+);
+
+static_assert(
+  sizeof(c_ast_t) <= offsetof( c_ast_t, parent ) + sizeof(c_csu_ast_t) +
+                     alignof(c_ast_t) - 1,
+  "c_ast union member other than csu, enum_, or ptr_mbr is the largest"
+);
+
 static_assert(
   offsetof( c_builtin_ast_t, bit_width ) ==
   offsetof( c_bit_field_ast_t, bit_width ),
@@ -109,9 +143,93 @@ static_assert(
 
 ///////////////////////////////////////////////////////////////////////////////
 
+/**
+ * The \ref c_ast union members that share `csu_sname` so nodes of any of
+ * their kinds need the size of the largest of them.
+ *
+ * @sa c_ast_sizeof()
+ */
+union c_ast_ecsu_union {
+  c_csu_ast_t         csu;              ///< #K_CLASS_STRUCT_UNION members.
+  c_enum_ast_t        enum_;            ///< #K_ENUM members.
+  c_ptr_mbr_ast_t     ptr_mbr;          ///< #K_POINTER_TO_MEMBER members.
+};
+typedef union c_ast_ecsu_union c_ast_ecsu_union_t;
+
+/**
+ * The \ref c_ast union members of function-like kinds.  They're accessed
+ * interchangeably via `func`, so nodes of any of their kinds need the size of
+ * the largest of them.
+ *
+ * @sa c_ast_sizeof()
+ */
+union c_ast_func_like_union {
+  c_apple_block_ast_t block;            ///< #K_APPLE_BLOCK members.
+  c_constructor_ast_t ctor;             ///< #K_CONSTRUCTOR members.
+  c_function_ast_t    func;             ///< #K_FUNCTION members.
+  c_lambda_ast_t      lambda;           ///< #K_LAMBDA members.
+  c_operator_ast_t    oper;             ///< #K_OPERATOR members.
+  c_udef_conv_ast_t   udef_conv;        ///< #K_UDEF_CONV members.
+  c_udef_lit_ast_t    udef_lit;         ///< #K_UDEF_LIT members.
+};
+typedef union c_ast_func_like_union c_ast_func_like_union_t;
+
+/**
+ * A chunk of AST nodes of a \ref c_ast_arena.  It's aligned on, and exactly,
+ * #C_AST_ARENA_CHUNK_BYTES in size.
+ *
+ * @sa c_ast_arena_chunk_of()
+ */
+struct c_ast_arena_chunk {
+  c_ast_arena_chunk_t  *next;           ///< Next chunk, if any.
+  c_ast_arena_t        *arena;          ///< The arena this chunk is part of.
+  size_t                used;           ///< Number of bytes used.
+
+  /**
+   * Storage for nodes.  It's declared as an array of \ref c_ast only so it's
+   * suitably aligned; nodes are packed at their c_ast_sizeof() sizes.
+   */
+  c_ast_t               ast[];
+};
+
+/**
+ * The number of bytes of a \ref c_ast_arena_chunk available for nodes.
+ */
+#define C_AST_ARENA_CHUNK_AVAIL \
+  (C_AST_ARENA_CHUNK_BYTES - offsetof( c_ast_arena_chunk_t, ast ))
+
+static_assert(
+  (C_AST_ARENA_CHUNK_BYTES & (C_AST_ARENA_CHUNK_BYTES - 1)) == 0,
+  "C_AST_ARENA_CHUNK_BYTES must be a power of 2"
+);
+
+static_assert(
+  C_AST_ARENA_CHUNK_AVAIL >= 32 * sizeof(c_ast_t),
+  "C_AST_ARENA_CHUNK_BYTES is too small"
+);
+
+/**
+ * An entry in the alignment side table of a \ref c_ast_arena.
+ *
+ * @sa c_ast_align()
+ * @sa c_ast_set_align()
+ */
+struct c_ast_align {
+  c_ast_t const  *ast;                  ///< The aligned AST.
+  c_alignas_t     align;                ///< Its alignment.
+};
+typedef struct c_ast_align c_ast_align_t;
+
 #ifndef NDEBUG
 // local variable definitions
-static size_t c_ast_count;              ///< ASTs allocated but not yet freed.
+
+/**
+ * ASTs allocated but not yet freed by all threads.
+ *
+ * @remarks It's atomic rather than per-thread since a session, hence its
+ * ASTs, may be used by one thread, then freed by another.
+ */
+static _Atomic size_t c_ast_count;
 #endif /* NDEBUG */
 
 ////////// local functions ////////////////////////////////////////////////////
@@ -124,18 +242,17 @@ static size_t c_ast_count;              ///< ASTs allocated but not yet freed.
 /**
  * Checks whether two alignments are equal.
  *
- * @param i_align The first alignment.
- * @param j_align The second alignment.
+ * @param i_align The first alignment; may be NULL for none.
+ * @param j_align The second alignment; may be NULL for none.
  * @return Returns `true` only if the two alignments are equal.
  */
 NODISCARD
 static bool c_alignas_equal( c_alignas_t const *i_align,
                              c_alignas_t const *j_align ) {
-  assert( i_align != NULL );
-  assert( j_align != NULL );
-
   if ( i_align == j_align )
     return true;
+  if ( i_align == NULL || j_align == NULL )
+    return false;
   if ( i_align->kind != j_align->kind )
     return false;
 
@@ -170,11 +287,147 @@ static bool c_ast_has_cycle( c_ast_t const *ast ) {
 }
 #endif /* NDEBUG */
 
+/**
+ * Allocates an AST node from \a arena.
+ *
+ * @param arena The \ref c_ast_arena to allocate from.
+ * @param size The number of bytes to allocate as returned by c_ast_sizeof().
+ * @return Returns a pointer to the new, uninitialized, AST node.
+ */
+NODISCARD
+static c_ast_t* c_ast_arena_alloc( c_ast_arena_t *arena, size_t size ) {
+  assert( arena != NULL );
+  assert( size <= sizeof(c_ast_t) );
+
+  c_ast_arena_chunk_t *chunk = arena->cur;
+  if ( chunk == NULL || chunk->used + size > C_AST_ARENA_CHUNK_AVAIL ) {
+    c_ast_arena_chunk_t *next = chunk == NULL ? arena->head : chunk->next;
+    if ( next == NULL ) {
+      next = aligned_alloc( C_AST_ARENA_CHUNK_BYTES, C_AST_ARENA_CHUNK_BYTES );
+      PERROR_EXIT_IF( next == NULL, EX_OSERR );
+      next->next = NULL;
+      next->arena = arena;
+      if ( chunk == NULL )
+        arena->head = next;
+      else
+        chunk->next = next;
+    }
+    next->used = 0;
+    arena->cur = chunk = next;
+  }
+
+  c_ast_t *const ast =
+    POINTER_CAST( c_ast_t*, POINTER_CAST( char*, chunk->ast ) + chunk->used );
+  chunk->used += size;
+  return ast;
+}
+
+/**
+ * Gets the \ref c_ast_arena_chunk that \a ast was allocated from.
+ *
+ * @param ast The AST to get the chunk of.  It must have been allocated from
+ * a \ref c_ast_arena.
+ * @return Returns said chunk.
+ */
+NODISCARD
+static c_ast_arena_chunk_t* c_ast_arena_chunk_of( c_ast_t const *ast ) {
+  assert( ast != NULL );
+  return POINTER_CAST( c_ast_arena_chunk_t*,
+    POINTER_CAST( uintptr_t, ast ) &
+    ~STATIC_CAST( uintptr_t, C_AST_ARENA_CHUNK_BYTES - 1 )
+  );
+}
+
+/**
+ * Gets the alignment side table entry of \a ast.
+ *
+ * @param ast The AST to get the entry of.  It must have been allocated from a
+ * \ref c_ast_arena and have \ref c_ast::is_aligned "is_aligned" set.
+ * @return Returns said entry.
+ */
+NODISCARD
+static c_ast_align_t* c_ast_align_entry( c_ast_t const *ast ) {
+  assert( ast != NULL );
+  assert( ast->is_aligned );
+  c_ast_arena_t const *const arena = c_ast_arena_chunk_of( ast )->arena;
+  FOREACH_SLIST_NODE( node, &arena->align_list ) {
+    c_ast_align_t *const entry = node->data;
+    if ( entry->ast == ast )
+      return entry;
+  } // for
+  unreachable();
+}
+
+/**
+ * Gets the AST node at \a offset bytes within \a chunk.
+ *
+ * @param chunk The \ref c_ast_arena_chunk to get the node from.
+ * @param offset The offset of the node; must be &lt; \a chunk&ndash;>used.
+ * @return Returns said node.
+ */
+NODISCARD
+static c_ast_t* c_ast_arena_chunk_at( c_ast_arena_chunk_t *chunk,
+                                      size_t offset ) {
+  assert( chunk != NULL );
+  assert( offset < chunk->used );
+  return POINTER_CAST( c_ast_t*, POINTER_CAST( char*, chunk->ast ) + offset );
+}
+
+/**
+ * Frees all memory used by \a ast _except_ \a ast itself.
+ *
+ * @param ast The AST to release.
+ *
+ * @note Even though \a ast invariably is part of a larger abstract syntax
+ * tree, this function releases _only_ \a ast and _not_ any child AST node \a
+ * ast may have.
+ *
+ * @sa c_ast_arena_reset()
+ */
+static void c_ast_release( c_ast_t *ast ) {
+  assert( ast != NULL );
+  assert( c_ast_count-- > 0 );          // side-effect is OK here
+
+  c_sname_cleanup( &ast->sname );
+  switch ( ast->kind ) {
+    case K_LAMBDA:
+      c_ast_list_cleanup( &ast->lambda.capture_ast_list );
+      FALLTHROUGH;
+    case K_APPLE_BLOCK:
+    case K_CONSTRUCTOR:
+    case K_FUNCTION:
+    case K_OPERATOR:
+    case K_UDEF_LIT:
+      c_ast_list_cleanup( &ast->func.param_ast_list );
+      break;
+    case K_CLASS_STRUCT_UNION:
+    case K_ENUM:
+    case K_POINTER_TO_MEMBER:
+      c_sname_cleanup( &ast->csu.csu_sname );
+      break;
+    case K_ARRAY:                       // size_name is interned
+    case K_BUILTIN:
+    case K_CAPTURE:
+    case K_CAST:
+    case K_DESTRUCTOR:
+    case K_NAME:
+    case K_PLACEHOLDER:
+    case K_POINTER:
+    case K_REFERENCE:
+    case K_RVALUE_REFERENCE:
+    case K_TYPEDEF:
+    case K_UDEF_CONV:
+    case K_VARIADIC:
+      // nothing to do
+      break;
+  } // switch
+}
+
 /**
  * Duplicates \a src_list.
  *
  * @param src_list The AST list to duplicate; may be NULL.
- * @param node_list The list to append the duplicated AST nodes onto.
+ * @param arena The \ref c_ast_arena to allocate the duplicated AST nodes from.
  * @return Returns the duplicated AST list or an empty list only if \a src_list
  * is NULL.
  *
@@ -183,14 +436,14 @@ static bool c_ast_has_cycle( c_ast_t const *ast ) {
  */
 NODISCARD
 static c_ast_list_t c_ast_list_dup( c_ast_list_t const *src_list,
-                                    c_ast_list_t *node_list ) {
+                                    c_ast_arena_t *arena ) {
   slist_t dup_list;
   slist_init( &dup_list );
 
   if ( src_list != NULL ) {
     FOREACH_SLIST_NODE( src_node, src_list ) {
       c_ast_t const *const src_ast = src_node->data;
-      c_ast_t *const dup_ast = c_ast_dup( src_ast, node_list );
+      c_ast_t *const dup_ast = c_ast_dup( src_ast, arena );
       slist_push_back( &dup_list, dup_ast );
     } // for
   }
@@ -233,17 +486,89 @@ static bool c_ast_list_equal( c_ast_list_t const *i_list,
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+c_alignas_t const* c_ast_align( c_ast_t const *ast ) {
+  assert( ast != NULL );
+  return ast->is_aligned ? &c_ast_align_entry( ast )->align : NULL;
+}
+
+void c_ast_arena_cleanup( c_ast_arena_t *arena ) {
+  assert( arena != NULL );
+  c_ast_arena_reset( arena );
+  for ( c_ast_arena_chunk_t *chunk = arena->head; chunk != NULL; ) {
+    c_ast_arena_chunk_t *const next = chunk->next;
+    free( chunk );
+    chunk = next;
+  } // for
+  arena->head = arena->cur = NULL;
+}
+
+void c_ast_arena_reset( c_ast_arena_t *arena ) {
+  assert( arena != NULL );
+  //
+  // Chunks past cur, if any, have used == 0 since they're either new or were
+  // reset previously.
+  //
+  for ( c_ast_arena_chunk_t *chunk = arena->head; chunk != NULL;
+        chunk = chunk->next ) {
+    for ( size_t offset = 0; offset < chunk->used; ) {
+      c_ast_t *const ast = c_ast_arena_chunk_at( chunk, offset );
+      offset += c_ast_sizeof( ast->kind );
+      c_ast_release( ast );
+    } // for
+    chunk->used = 0;
+  } // for
+  arena->cur = NULL;
+  slist_cleanup( &arena->align_list, &free );
+}
+
+void c_ast_arena_stats( c_ast_arena_t const *arena,
+                        c_ast_arena_stats_t *rv_stats ) {
+  assert( arena != NULL );
+  assert( rv_stats != NULL );
+
+  *rv_stats = (c_ast_arena_stats_t){ 0, 0, 0 };
+  for ( c_ast_arena_chunk_t *chunk = arena->head; chunk != NULL;
+        chunk = chunk->next ) {
+    for ( size_t offset = 0; offset < chunk->used; ) {
+      size_t const size =
+        c_ast_sizeof( c_ast_arena_chunk_at( chunk, offset )->kind );
+      ++rv_stats->node_count;
+      rv_stats->node_bytes += size;
+      offset += size;
+    } // for
+  } // for
+
+  rv_stats->node_bytes +=
+    slist_len( &arena->align_list ) * sizeof(c_ast_align_t);
+  rv_stats->full_bytes = rv_stats->node_count * sizeof(c_ast_t);
+}
+
 void c_ast_cleanup( void ) {
   assert( c_ast_count == 0 );
 }
 
-c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *node_list ) {
+c_ast_t c_ast_copy( c_ast_t const *ast ) {
+  assert( ast != NULL );
+  c_ast_t rv_ast;
+  MEM_ZERO( &rv_ast );
+  memcpy( &rv_ast, ast, c_ast_sizeof( ast->kind ) );
+  rv_ast.is_aligned = false;            // not in an arena
+  return rv_ast;
+}
+
+c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_arena_t *arena ) {
   if ( ast == NULL )
     return NULL;                        // LCOV_EXCL_LINE
   c_ast_t *const dup_ast =
-    c_ast_new( ast->kind, ast->depth, &ast->loc, node_list );
-
-  dup_ast->align = ast->align;
+    c_ast_new( ast->kind, ast->depth, &ast->loc, arena );
+
+  if ( ast->is_aligned ) {
+    // The duplicate may outlive ast's arena, so it needs its own copy.
+    c_alignas_t align = c_ast_align_entry( ast )->align;
+    if ( align.kind == C_ALIGNAS_TYPE )
+      align.type_ast = c_ast_dup( align.type_ast, arena );
+    c_ast_set_align( dup_ast, &align );
+  }
 #ifdef ENABLE_CDECL_DEBUG
   dup_ast->dup_from_id = ast->unique_id;
 #endif /* ENABLE_CDECL_DEBUG */
@@ -258,7 +583,7 @@ c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *node_list ) {
           dup_ast->array.size_int = ast->array.size_int;
           break;
         case C_ARRAY_NAMED_SIZE:
-          dup_ast->array.size_name = check_strdup( ast->array.size_name );
+          dup_ast->array.size_name = ast->array.size_name;  // interned
           break;
         case C_ARRAY_EMPTY_SIZE:
         case C_ARRAY_VLA_STAR:
@@ -299,15 +624,18 @@ c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *node_list ) {
     case K_CONSTRUCTOR:
     case K_UDEF_LIT:
       dup_ast->func.param_ast_list =
-        c_ast_list_dup( &ast->func.param_ast_list, node_list );
+        c_ast_list_dup( &ast->func.param_ast_list, arena );
+      c_ast_list_set_param_of( &dup_ast->func.param_ast_list, dup_ast );
       break;
 
     case K_LAMBDA:
       // ret_ast duplicated by referrer code below
       dup_ast->func.param_ast_list =
-        c_ast_list_dup( &ast->func.param_ast_list, node_list );
+        c_ast_list_dup( &ast->func.param_ast_list, arena );
+      c_ast_list_set_param_of( &dup_ast->func.param_ast_list, dup_ast );
       dup_ast->lambda.capture_ast_list =
-        c_ast_list_dup( &ast->lambda.capture_ast_list, node_list );
+        c_ast_list_dup( &ast->lambda.capture_ast_list, arena );
+      c_ast_list_set_param_of( &dup_ast->lambda.capture_ast_list, dup_ast );
       break;
 
     case K_CAPTURE:
@@ -326,7 +654,7 @@ c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *node_list ) {
 
   if ( c_ast_is_referrer( ast ) ) {
     c_ast_t *const child_ast = ast->parent.of_ast;
-    c_ast_set_parent( c_ast_dup( child_ast, node_list ), dup_ast );
+    c_ast_set_parent( c_ast_dup( child_ast, arena ), dup_ast );
   }
 
   return dup_ast;
@@ -339,7 +667,7 @@ bool c_ast_equal( c_ast_t const *i_ast, c_ast_t const *j_ast ) {
     return false;
   if ( i_ast->kind != j_ast->kind )
     return false;
-  if ( !c_alignas_equal( &i_ast->align, &j_ast->align ) )
+  if ( !c_alignas_equal( c_ast_align( i_ast ), c_ast_align( j_ast ) ) )
     return false;
   if ( !c_type_equiv( &i_ast->type, &j_ast->type ) )
     return false;
@@ -442,54 +770,9 @@ bool c_ast_equal( c_ast_t const *i_ast, c_ast_t const *j_ast ) {
   return c_ast_equal( i_ast->parent.of_ast, j_ast->parent.of_ast );
 }
 
-void c_ast_free( c_ast_t *ast ) {
-  if ( ast != NULL ) {
-    assert( c_ast_count-- > 0 );        // side-effect is OK here
-
-    c_sname_cleanup( &ast->sname );
-    switch ( ast->kind ) {
-      case K_ARRAY:
-        if ( ast->array.kind == C_ARRAY_NAMED_SIZE )
-          FREE( ast->array.size_name );
-        break;
-      case K_LAMBDA:
-        c_ast_list_cleanup( &ast->lambda.capture_ast_list );
-        FALLTHROUGH;
-      case K_APPLE_BLOCK:
-      case K_CONSTRUCTOR:
-      case K_FUNCTION:
-      case K_OPERATOR:
-      case K_UDEF_LIT:
-        c_ast_list_cleanup( &ast->func.param_ast_list );
-        break;
-      case K_CLASS_STRUCT_UNION:
-      case K_ENUM:
-      case K_POINTER_TO_MEMBER:
-        c_sname_cleanup( &ast->csu.csu_sname );
-        break;
-      case K_BUILTIN:
-      case K_CAPTURE:
-      case K_CAST:
-      case K_DESTRUCTOR:
-      case K_NAME:
-      case K_PLACEHOLDER:
-      case K_POINTER:
-      case K_REFERENCE:
-      case K_RVALUE_REFERENCE:
-      case K_TYPEDEF:
-      case K_UDEF_CONV:
-      case K_VARIADIC:
-        // nothing to do
-        break;
-    } // switch
-
-    FREE( ast );
-  }
-}
-
 void c_ast_list_cleanup( c_ast_list_t *list ) {
-  // Do not pass &c_ast_free as the second argument since all ASTs are free'd
-  // independently. Just free the list nodes.
+  // Do not free the ASTs themselves since they're freed only via their arena.
+  // Just free the list nodes.
   slist_cleanup( list, /*free_fn=*/NULL );
 }
 
@@ -506,32 +789,99 @@ void c_ast_list_set_param_of( c_ast_list_t *param_ast_list,
   } // for
 }
 
+size_t c_ast_sizeof( c_ast_kind_t kind ) {
+  size_t union_size = 0;
+
+  switch ( kind ) {
+    case K_ARRAY:
+      union_size = sizeof(c_array_ast_t);
+      break;
+    case K_BUILTIN:
+      union_size = sizeof(c_builtin_ast_t);
+      break;
+    case K_CAPTURE:
+      union_size = sizeof(c_capture_ast_t);
+      break;
+    case K_CAST:
+      union_size = sizeof(c_cast_ast_t);
+      break;
+    case K_CLASS_STRUCT_UNION:
+    case K_ENUM:
+    case K_POINTER_TO_MEMBER:
+      union_size = sizeof(c_ast_ecsu_union_t);
+      break;
+    case K_APPLE_BLOCK:
+    case K_CONSTRUCTOR:
+    case K_DESTRUCTOR:
+    case K_FUNCTION:
+    case K_LAMBDA:
+    case K_OPERATOR:
+    case K_UDEF_CONV:
+    case K_UDEF_LIT:
+      union_size = sizeof(c_ast_func_like_union_t);
+      break;
+    case K_POINTER:
+    case K_REFERENCE:
+    case K_RVALUE_REFERENCE:
+      union_size = sizeof(c_ptr_ref_ast_t);
+      break;
+    case K_TYPEDEF:
+      union_size = sizeof(c_typedef_ast_t);
+      break;
+    case K_NAME:
+    case K_PLACEHOLDER:
+    case K_VARIADIC:
+      // nothing needed
+      break;
+  } // switch
+
+  size_t const size = offsetof( c_ast_t, parent ) + union_size;
+  // Round up so the next node in a chunk is suitably aligned.
+  return (size + alignof(c_ast_t) - 1) & ~(alignof(c_ast_t) - 1);
+}
+
 c_ast_t* c_ast_new( c_ast_kind_t kind, unsigned depth, c_loc_t const *loc,
-                    c_ast_list_t *node_list ) {
+                    c_ast_arena_t *arena ) {
   assert( is_1_bit( kind ) );
   assert( loc != NULL );
-  assert( node_list != NULL );
 
-  c_ast_t *const ast = MALLOC( c_ast_t, 1 );
-  MEM_ZERO( ast );
+  size_t const size = c_ast_sizeof( kind );
+  c_ast_t *const ast = c_ast_arena_alloc( arena, size );
+  memset( ast, 0, size );
 
-  ast->depth = depth;
+  assert( depth <= C_AST_DEPTH_MAX );
+  ast->depth = depth & C_AST_DEPTH_MAX;
   ast->kind = kind;
   ast->loc = *loc;
   ast->type = T_NONE;
 
 #ifdef ENABLE_CDECL_DEBUG
-  static c_ast_id_t next_id;
+  static _Atomic c_ast_id_t next_id;    // unique across all threads
   ast->unique_id = ++next_id;
 #endif /* ENABLE_CDECL_DEBUG */
 
 #ifndef NDEBUG
   ++c_ast_count;
 #endif /* NDEBUG */
-  slist_push_back( node_list, ast );
   return ast;
 }
 
+void c_ast_set_align( c_ast_t *ast, c_alignas_t const *align ) {
+  assert( ast != NULL );
+  assert( align != NULL );
+  assert( align->kind != C_ALIGNAS_NONE );
+
+  if ( ast->is_aligned ) {
+    c_ast_align_entry( ast )->align = *align;
+    return;
+  }
+
+  c_ast_align_t *const entry = MALLOC( c_ast_align_t, 1 );
+  *entry = (c_ast_align_t){ .ast = ast, .align = *align };
+  slist_push_back( &c_ast_arena_chunk_of( ast )->arena->align_list, entry );
+  ast->is_aligned = true;
+}
+
 void c_ast_set_parent( c_ast_t *child_ast, c_ast_t *parent_ast ) {
   if ( parent_ast != NULL ) {
     assert( c_ast_is_referrer( parent_ast ) );
@@ -175,16 +175,25 @@ typedef bool (*c_ast_visit_fn_t)( c_ast_t *ast, user_data_t user_data );
  * Typically, nodes of a tree data structure are freed by freeing the root node
  * followed by its child nodes in turn, recursively.  This is _not_ done for
  * AST nodes.  Instead, AST nodes created via c_ast_new() or c_ast_dup() are
- * appended to a \ref c_ast_list_t.  Nodes are later freed by traversing the
- * list and calling c_ast_free() on each node individually.  It's done this way
- * to simplify node memory management.
+ * allocated from a \ref c_ast_arena.  Nodes are never freed individually;
+ * instead, all nodes of an arena are freed together via either
+ * c_ast_arena_reset() or c_ast_arena_cleanup().  It's done this way to
+ * simplify node memory management and to avoid a **malloc**(3) and **free**(3)
+ * per node.
+ *
+ * However, freeing an arena is _not_ a constant-time operation.  Some nodes
+ * own memory allocated separately from the arena, e.g., the \ref slist_node
+ * of parameter lists and the scopes of a \ref c_sname having more than
+ * #C_SNAME_INLINE_SIZE of them.  Hence, freeing an arena visits every node in
+ * it to free that memory; only the memory of the nodes themselves is freed a
+ * chunk at a time.
  *
  * As an AST is being built, sometimes #K_PLACEHOLDER nodes are created
  * temporarily.  Later, once an actual node is created, the #K_PLACEHOLDER node
  * is replaced.  Rather than freeing a #K_PLACEHOLDER node immediately (and,
  * for a parent node, set its "of" node to NULL just prior to being freed so as
- * not to free its child node also), it's simply left on the list.  Once
- * parsing is complete, the entire list is freed effectively "garbage
+ * not to free its child node also), it's simply left in the arena.  Once
+ * parsing is complete, the entire arena is reset effectively "garbage
  * collecting" all nodes.
  * @{
  */
@@ -207,7 +216,7 @@ struct c_array_ast {
   c_array_kind_t  kind;                 ///< Kind.
   union {
     unsigned      size_int;             ///< For #C_ARRAY_INT_SIZE.
-    char const   *size_name;            ///< For #C_ARRAY_NAMED_SIZE.
+    char const   *size_name;            ///< For #C_ARRAY_NAMED_SIZE; interned.
   };
 };
 
@@ -447,23 +456,39 @@ struct c_udef_lit_ast {
 
 /**
  * AST node for a parsed C/C++ declaration.
+ *
+ * @remarks The members most often accessed when traversing an AST are first
+ * followed by less often accessed members.  Alignment is rare, so it's kept
+ * in a side table of the node's \ref c_ast_arena rather than in every node:
+ * only the \ref is_aligned bit says whether there's an entry; use
+ * c_ast_align() to get it.
+ *
+ * @remarks Nodes allocated from a \ref c_ast_arena are sized to their \ref
+ * kind, i.e., only as many bytes of the kind-specific union as are needed by
+ * the node's kind are allocated (see c_ast_sizeof()).  Hence:
+ *  + The union must be the last member.
+ *  + A node's \ref kind must never change after creation.
+ *  + A node must never be copied via assignment (since that would read past
+ *    its end); use c_ast_copy() instead.
  */
 struct c_ast {
-  c_alignas_t     align;                ///< Alignment, if any.
-  unsigned        depth;                ///< How many `()` deep.
-  c_ast_kind_t    kind;                 ///< AST kind.
-  c_loc_t         loc;                  ///< Source location.
-  c_sname_t       sname;                ///< Scoped name, if any.
-  c_type_t        type;                 ///< Type, if any.
-  c_ast_t        *parent_ast;           ///< Parent AST node, if any.
-  c_ast_t const  *param_of_ast;         ///< Parameter of this AST node, if any.
+  c_ast_kind_t        kind;             ///< AST kind.
+  unsigned            depth      : 31;  ///< How many `()` deep.
+  unsigned            is_aligned : 1;   ///< Has an alignment side entry?
+  c_type_t            type;             ///< Type, if any.
+  c_ast_t            *parent_ast;       ///< Parent AST node, if any.
+  c_ast_t const      *param_of_ast;     ///< Parameter of this AST, if any.
+  c_sname_t           sname;            ///< Scoped name, if any.
+  c_loc_t             loc;              ///< Source location.
 #ifdef ENABLE_CDECL_DEBUG
-  c_ast_id_t      unique_id;            ///< Unique id (starts at 1).
-  c_ast_id_t      dup_from_id;          ///< ID of AST duplicated from, if any.
+  c_ast_id_t          unique_id;        ///< Unique id (starts at 1).
+  c_ast_id_t          dup_from_id;      ///< ID of AST duplicated from, if any.
 #endif /* ENABLE_CDECL_DEBUG */
 
   /**
    * Additional data for each \ref kind.
+   *
+   * @note This must be the last member.
    */
   union {
     c_parent_ast_t      parent;     ///< #K_ANY_PARENT members.
@@ -491,6 +516,47 @@ struct c_ast {
   };
 };
 
+/**
+ * The maximum value of \ref c_ast::depth "depth".
+ */
+#define C_AST_DEPTH_MAX           0x7FFFFFFFu
+
+/**
+ * The size in bytes of each chunk of a \ref c_ast_arena.  Chunks are aligned
+ * on their size so that the chunk, and hence the arena, of a node can be found
+ * from the node's address; hence it must be a power of 2.
+ */
+#define C_AST_ARENA_CHUNK_BYTES   (16u * 1024)
+
+/**
+ * An arena from which AST nodes are allocated.
+ *
+ * @remarks Nodes are allocated from fixed-size chunks.  Resetting an arena
+ * keeps all its chunks for reuse so, once an arena has grown to the size
+ * needed by a typical parse, subsequent parses allocate no memory for nodes.
+ *
+ * @note An arena that is all zeros is empty and ready for use.
+ *
+ * @sa c_ast_arena_cleanup()
+ * @sa c_ast_arena_reset()
+ */
+struct c_ast_arena {
+  c_ast_arena_chunk_t  *head;           ///< First chunk, if any.
+  c_ast_arena_chunk_t  *cur;            ///< Chunk being allocated from.
+  slist_t               align_list;     ///< Alignment side table.
+};
+
+/**
+ * Memory statistics of a \ref c_ast_arena.
+ *
+ * @sa c_ast_arena_stats()
+ */
+struct c_ast_arena_stats {
+  size_t  node_count;                   ///< Number of nodes allocated.
+  size_t  node_bytes;                   ///< Bytes used by nodes & alignments.
+  size_t  full_bytes;                   ///< Bytes if nodes were full-sized.
+};
+
 /** @} */
 
 ////////// extern functions ///////////////////////////////////////////////////
@@ -501,29 +567,91 @@ struct c_ast {
  * @{
  */
 
+/**
+ * Gets the alignment of \a ast, if any.
+ *
+ * @param ast The AST to get the alignment of.
+ * @return Returns said alignment or NULL if none.
+ *
+ * @sa c_ast_set_align()
+ */
+NODISCARD
+c_alignas_t const* c_ast_align( c_ast_t const *ast );
+
+/**
+ * Frees all AST nodes allocated from \a arena _and_ all the memory \a arena
+ * uses, but does _not_ free \a arena itself.
+ *
+ * @param arena The \ref c_ast_arena to clean up.  Upon return, it's empty and
+ * may be reused.
+ *
+ * @sa c_ast_arena_reset()
+ */
+void c_ast_arena_cleanup( c_ast_arena_t *arena );
+
+/**
+ * Frees all AST nodes allocated from \a arena, but keeps the memory \a arena
+ * uses for subsequent allocations.
+ *
+ * @param arena The \ref c_ast_arena to reset.
+ *
+ * @note This visits every node in \a arena to free the memory it owns, e.g.,
+ * its parameter list; hence it takes time linear in the number of nodes.
+ *
+ * @warning All pointers to AST nodes allocated from \a arena are invalid upon
+ * return.
+ *
+ * @sa c_ast_arena_cleanup()
+ */
+void c_ast_arena_reset( c_ast_arena_t *arena );
+
+/**
+ * Gets memory statistics of \a arena.
+ *
+ * @param arena The \ref c_ast_arena to get the statistics of.
+ * @param rv_stats The \ref c_ast_arena_stats to receive the statistics.
+ */
+void c_ast_arena_stats( c_ast_arena_t const *arena,
+                        c_ast_arena_stats_t *rv_stats );
+
 /**
  * Cleans up all AST data.
  *
  * @remarks Currently, this only checks that the number of AST nodes freed
- * equals the number allocated.
+ * equals the number allocated by all threads, hence all sessions must have
+ * been freed first.
  *
- * @sa c_ast_free()
+ * @sa c_ast_arena_cleanup()
  * @sa c_ast_new()
  */
 void c_ast_cleanup( void );
 
+/**
+ * Copies \a ast by value.
+ *
+ * @param ast The AST to copy.
+ * @return Returns a shallow copy of \a ast whose bytes past c_ast_sizeof() of
+ * its kind are zero.  Since the copy isn't in an arena, it has no alignment.
+ *
+ * @note Since nodes are sized to their kind, this must be used rather than
+ * simple assignment.
+ *
+ * @sa c_ast_dup()
+ */
+NODISCARD
+c_ast_t c_ast_copy( c_ast_t const *ast );
+
 /**
  * Duplicates \a ast.
  *
  * @param ast The AST to duplicate; may be NULL.
- * @param node_list The list to append the duplicated AST nodes onto.
+ * @param arena The \ref c_ast_arena to allocate the duplicated AST nodes from.
  * @return Returns the duplicated AST or NULL only if \a ast is NULL.
  *
- * @sa c_ast_free()
  * @sa c_ast_new()
  */
 NODISCARD
-c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *node_list );
+c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_arena_t *arena );
 
 /**
  * Checks whether two ASTs are equal _except_ for their names.
@@ -538,23 +666,6 @@ c_ast_t* c_ast_dup( c_ast_t const *ast, c_ast_list_t *node_list );
 NODISCARD
 bool c_ast_equal( c_ast_t const *i_ast, c_ast_t const *j_ast );
 
-/**
- * Frees all memory used by \a ast _including_ \a ast itself.
- *
- * @param ast The AST to free.  If NULL, does nothing.
- *
- * @note Even though \a ast invariably is part of a larger abstract syntax
- * tree, this function frees _only_ \a ast and _not_ any child AST node \a ast
- * may have.  Hence to free all AST nodes, they all be kept track of
- * independently via some other data structure, e.g., a \ref c_ast_list_t.
- *
- * @sa c_ast_cleanup()
- * @sa c_ast_dup()
- * @sa c_ast_list_cleanup()
- * @sa c_ast_new()
- */
-void c_ast_free( c_ast_t *ast );
-
 /**
  * Checks whether \a ast is an "orphan," that is:
  *
@@ -607,7 +718,7 @@ bool c_ast_is_referrer( c_ast_t const *ast ) {
  *
  * @param list The AST list to free the list nodes of.
  *
- * @sa c_ast_free()
+ * @note The AST nodes themselves are freed only via their \ref c_ast_arena.
  */
 void c_ast_list_cleanup( c_ast_list_t *list );
 
@@ -624,22 +735,35 @@ void c_ast_list_cleanup( c_ast_list_t *list );
  */
 void c_ast_list_set_param_of( c_ast_list_t *param_ast_list, c_ast_t *func_ast );
 
+/**
+ * Gets the number of bytes an AST node of \a kind occupies in a \ref
+ * c_ast_arena.
+ *
+ * @param kind The kind of AST.
+ * @return Returns said number of bytes.  It's never more than
+ * `sizeof(c_ast_t)`.
+ *
+ * @sa c_ast_new()
+ */
+NODISCARD
+size_t c_ast_sizeof( c_ast_kind_t kind );
+
 /**
  * Creates a new AST node.
  *
  * @param kind The kind of AST to create.
  * @param depth How deep within `()` it is.
  * @param loc A pointer to the token location data.
- * @param node_list The list to append the new AST node onto.
+ * @param arena The \ref c_ast_arena to allocate the new AST node from.
  * @return Returns a pointer to a new AST.
  *
+ * @sa c_ast_arena_reset()
  * @sa c_ast_cleanup()
  * @sa c_ast_dup()
- * @sa c_ast_free()
  */
 NODISCARD
 c_ast_t* c_ast_new( c_ast_kind_t kind, unsigned depth, c_loc_t const *loc,
-                    c_ast_list_t *node_list );
+                    c_ast_arena_t *arena );
 
 /**
  * Convenience function for getting the number of function-like parameters.
@@ -692,6 +816,18 @@ size_t c_ast_params_count( c_ast_t const *ast ) {
   return slist_len( &ast->func.param_ast_list );
 }
 
+/**
+ * Sets the alignment of \a ast.
+ *
+ * @param ast The AST to set the alignment of.  It must have been allocated from
+ * a \ref c_ast_arena.
+ * @param align The alignment to set.  Its kind must not be #C_ALIGNAS_NONE.
+ * It's copied into the side table of the arena \a ast was allocated from.
+ *
+ * @sa c_ast_align()
+ */
+void c_ast_set_align( c_ast_t *ast, c_alignas_t const *align );
+
 /**
  * Sets the two-way pointer links between parent/child AST nodes.
  *
@@ -34,10 +34,12 @@
 #include "c_type.h"
 #include "c_typedef.h"
 #include "cdecl.h"
+#include "cdecl_session.h"
 #include "gibberish.h"
 #include "literals.h"
 #include "options.h"
 #include "print.h"
+#include "sink.h"
 #include "util.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -93,7 +95,7 @@
  */
 #define error_kind_of_kind(AST1,AST2) BLOCK(                          \
   print_error( &(AST1)->loc, "%s of ", c_kind_name( (AST1)->kind ) ); \
-  print_ast_kind_aka( (AST2), stderr );                               \
+  print_ast_kind_aka( (AST2), cdecl_ferr );                               \
   EPUTS( " is illegal" ); )
 
 /**
@@ -243,16 +245,17 @@ NODISCARD
 static bool c_ast_check_alignas( c_ast_t const *ast ) {
   assert( ast != NULL );
 
-  if ( ast->align.kind == C_ALIGNAS_NONE )
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align == NULL )
     return true;
 
   if ( c_tid_is_any( ast->type.stids, TS_typedef ) ) {
-    print_error( &ast->align.loc, "types can not be aligned\n" );
+    print_error( &align->loc, "types can not be aligned\n" );
     return false;
   }
 
   if ( c_ast_is_register( ast ) ) {
-    print_error( &ast->align.loc,
+    print_error( &align->loc,
       "\"%s\" can not be combined with \"register\"\n", alignas_name()
     );
     return false;
@@ -261,39 +264,39 @@ static bool c_ast_check_alignas( c_ast_t const *ast ) {
   c_ast_t const *const raw_ast = c_ast_untypedef( ast );
 
   if ( (raw_ast->kind & K_ANY_OBJECT) == 0 ) {
-    print_error( &ast->align.loc, "%s", "" );
-    print_ast_kind_aka( ast, stderr );
+    print_error( &align->loc, "%s", "" );
+    print_ast_kind_aka( ast, cdecl_ferr );
     EPUTS( " can not be aligned\n" );
     return false;
   }
 
   if ( (raw_ast->kind & K_ANY_BIT_FIELD) != 0 &&
         ast->bit_field.bit_width > 0 ) {
-    print_error( &ast->align.loc, "bit fields can not be aligned\n" );
+    print_error( &align->loc, "bit fields can not be aligned\n" );
     return false;
   }
 
   if ( (raw_ast->kind & K_CLASS_STRUCT_UNION) != 0 &&
        !OPT_LANG_IS( ALIGNED_CSUS ) ) {
-    print_error( &ast->align.loc, "%s", "" );
-    print_ast_kind_aka( ast, stderr );
+    print_error( &align->loc, "%s", "" );
+    print_ast_kind_aka( ast, cdecl_ferr );
     EPRINTF( " can not be aligned%s\n", C_LANG_WHICH( ALIGNED_CSUS ) );
     return false;
   }
 
-  switch ( ast->align.kind ) {
+  switch ( align->kind ) {
     case C_ALIGNAS_NONE:
       unreachable();
     case C_ALIGNAS_BYTES:
-      if ( !is_01_bit( ast->align.bytes ) ) {
-        print_error( &ast->align.loc,
-          "\"%u\": alignment must be a power of 2\n", ast->align.bytes
+      if ( !is_01_bit( align->bytes ) ) {
+        print_error( &align->loc,
+          "\"%u\": alignment must be a power of 2\n", align->bytes
         );
         return false;
       }
       break;
     case C_ALIGNAS_TYPE:
-      return c_ast_check( ast->align.type_ast );
+      return c_ast_check( align->type_ast );
   } // switch
 
   return true;
@@ -357,7 +360,7 @@ static bool c_ast_check_array( c_ast_t const *ast ) {
       // At this point, we know it's a VLA.
       if ( !c_ast_is_integral( size_param_ast ) ) {
         print_error( &ast->loc, "invalid array dimension type " );
-        print_ast_type_aka( size_param_ast, stderr );
+        print_ast_type_aka( size_param_ast, cdecl_ferr );
         EPUTS( "; must be integral\n" );
         return false;
       }
@@ -605,7 +608,7 @@ static bool c_ast_check_cast( c_ast_t const *ast ) {
       break;
     case K_FUNCTION:
       print_error( &to_ast->loc, "can not cast into " );
-      print_ast_kind_aka( to_ast, stderr );
+      print_ast_kind_aka( to_ast, cdecl_ferr );
       print_hint( "cast into pointer to function" );
       return false;
     default:
@@ -616,7 +619,7 @@ static bool c_ast_check_cast( c_ast_t const *ast ) {
     case C_CAST_CONST:
       if ( (raw_to_ast->kind & (K_ANY_POINTER | K_ANY_REFERENCE)) == 0 ) {
         print_error( &to_ast->loc, "invalid const_cast type " );
-        print_ast_type_aka( to_ast, stderr );
+        print_ast_type_aka( to_ast, cdecl_ferr );
         EPRINTF(
           "; must be a pointer, pointer to member, %s\n",
           OPT_LANG_IS( RVALUE_REFERENCES ) ?
@@ -630,7 +633,7 @@ static bool c_ast_check_cast( c_ast_t const *ast ) {
       if ( !c_ast_is_ptr_to_kind_any( raw_to_ast, K_CLASS_STRUCT_UNION ) &&
            !c_ast_is_ref_to_kind_any( raw_to_ast, K_CLASS_STRUCT_UNION ) ) {
         print_error( &to_ast->loc, "invalid dynamic_cast type " );
-        print_ast_type_aka( to_ast, stderr );
+        print_ast_type_aka( to_ast, cdecl_ferr );
         EPUTS(
           "; must be a pointer or reference to a class, struct, or union\n"
         );
@@ -641,7 +644,7 @@ static bool c_ast_check_cast( c_ast_t const *ast ) {
     case C_CAST_REINTERPRET:
       if ( c_ast_is_builtin_any( to_ast, TB_void ) ) {
         print_error( &to_ast->loc, "invalid reinterpret_cast type " );
-        print_ast_type_aka( to_ast, stderr );
+        print_ast_type_aka( to_ast, cdecl_ferr );
         EPUTC( '\n' );
         return false;
       }
@@ -783,7 +786,7 @@ static bool c_ast_check_enum( c_ast_t const *ast ) {
         "invalid %s underlying type ",
         c_tid_name_error( TB_enum )
       );
-      print_ast_type_aka( of_ast, stderr );
+      print_ast_type_aka( of_ast, cdecl_ferr );
       EPUTS( "; must be integral\n" );
       return false;
     }
@@ -1075,7 +1078,7 @@ static bool c_ast_check_func_main( c_ast_t const *ast ) {
   c_ast_t const *const ret_ast = ast->func.ret_ast;
   if ( !c_ast_is_builtin_any( ret_ast, TB_int ) ) {
     print_error( &ret_ast->loc, "invalid main() return type " );
-    print_ast_type_aka( ret_ast, stderr );
+    print_ast_type_aka( ret_ast, cdecl_ferr );
     EPRINTF(
       "; must be \"%s\" or a typedef thereof\n",
       c_tid_name_error( TB_int )
@@ -1117,7 +1120,7 @@ static bool c_ast_check_func_main( c_ast_t const *ast ) {
           print_error( &param_ast->loc,
             "invalid main() first parameter type "
           );
-          print_ast_type_aka( param_ast, stderr );
+          print_ast_type_aka( param_ast, cdecl_ferr );
           EPRINTF(
             "; must be \"%s\" or a typedef thereof\n",
             c_tid_name_error( TB_int )
@@ -1167,7 +1170,7 @@ static bool c_ast_check_func_main_char_ptr_param( c_ast_t const *param_ast ) {
               &C_TYPE_LIT_S_ANY( c_tid_compl( TS_const ) ),
               &C_TYPE_LIT_B( TB_char ) ) ) {
         print_error( &param_ast->loc, "invalid main() parameter type " );
-        print_ast_type_aka( param_ast, stderr );
+        print_ast_type_aka( param_ast, cdecl_ferr );
         EPUTS( "; must be " );
         if ( cdecl_mode == CDECL_ENGLISH_TO_GIBBERISH ) {
           EPRINTF( "\"%s %s pointer to %s\"\n",
@@ -1186,7 +1189,7 @@ static bool c_ast_check_func_main_char_ptr_param( c_ast_t const *param_ast ) {
       break;
     default:                            // ???
       print_error( &param_ast->loc, "invalid main() parameter type " );
-      print_ast_type_aka( param_ast, stderr );
+      print_ast_type_aka( param_ast, cdecl_ferr );
       EPUTS( "; must be " );
       if ( cdecl_mode == CDECL_ENGLISH_TO_GIBBERISH )
         EPRINTF( "\"array of pointer to %s\"\n", c_tid_name_error( TB_char ) );
@@ -1663,7 +1666,7 @@ static bool c_ast_check_oper( c_ast_t const *ast ) {
           "invalid operator \"%s\" return type ",
           op->literal
         );
-        print_ast_type_aka( ret_ast, stderr );
+        print_ast_type_aka( ret_ast, cdecl_ferr );
         EPUTS( "; must be a pointer to struct, union, or class\n" );
         return false;
       }
@@ -1679,7 +1682,7 @@ static bool c_ast_check_oper( c_ast_t const *ast ) {
           "invalid operator \"%s\" return type ",
           op->literal
         );
-        print_ast_type_aka( ret_ast, stderr );
+        print_ast_type_aka( ret_ast, cdecl_ferr );
         EPRINTF( "; must be \"%s\"\n", c_tid_name_error( TB_void ) );
         return false;
       }
@@ -1696,7 +1699,7 @@ static bool c_ast_check_oper( c_ast_t const *ast ) {
           "invalid operator \"%s\" return type ",
           op->literal
         );
-        print_ast_type_aka( ret_ast, stderr );
+        print_ast_type_aka( ret_ast, cdecl_ferr );
         EPUTS( "; must be " );
         if ( cdecl_mode == CDECL_ENGLISH_TO_GIBBERISH )
           EPUTS( "\"pointer to void\"\n" );
@@ -1784,7 +1787,7 @@ static bool c_ast_check_op_delete_params( c_ast_t const *ast ) {
       "invalid operator \"%s\" parameter type ",
       ast->oper.operator->literal
     );
-    print_ast_type_aka( param_ast, stderr );
+    print_ast_type_aka( param_ast, cdecl_ferr );
     EPUTS( "; must be a pointer to void, class, struct, or union\n" );
     return false;
   }
@@ -1816,7 +1819,7 @@ static bool c_ast_check_op_new_params( c_ast_t const *ast ) {
       "invalid operator \"%s\" parameter type ",
       ast->oper.operator->literal
     );
-    print_ast_type_aka( param_ast, stderr );
+    print_ast_type_aka( param_ast, cdecl_ferr );
     EPUTS( "; must be \"std::size_t\" (or equivalent)\n" );
     return false;
   }
@@ -1956,7 +1959,7 @@ same: print_error( c_ast_params_loc( ast ),
           "invalid postfix %soperator \"%s\" parameter type ",
           member_or_nonmember, op->literal
         );
-        print_ast_type_aka( param_ast, stderr );
+        print_ast_type_aka( param_ast, cdecl_ferr );
         EPRINTF(
           "; must be \"%s\" or a typedef thereof\n",
           c_tid_name_error( TB_int )
@@ -2103,7 +2106,7 @@ rel_2par: print_error( c_ast_params_loc( ast ),
         "invalid operator \"%s\" return type ",
         op->literal
       );
-      print_ast_type_aka( ret_ast, stderr );
+      print_ast_type_aka( ret_ast, cdecl_ferr );
       EPRINTF(
         "; must be "
         "\"%s\", "
@@ -2121,7 +2124,7 @@ rel_2par: print_error( c_ast_params_loc( ast ),
       "invalid operator \"%s\" return type ",
       op->literal
     );
-    print_ast_type_aka( ret_ast, stderr );
+    print_ast_type_aka( ret_ast, cdecl_ferr );
     EPRINTF(
       "; must be \"%s\" or a typedef thereof\n",
       c_tid_name_error( TB_bool )
@@ -2150,7 +2153,7 @@ static bool c_ast_check_pointer( c_ast_t const *ast ) {
     case K_REFERENCE:
     case K_RVALUE_REFERENCE:
       print_error( &ast->loc, "%s to ", c_kind_name( ast->kind ) );
-      print_ast_kind_aka( to_ast, stderr );
+      print_ast_kind_aka( to_ast, cdecl_ferr );
       EPUTS( " is illegal" );
       if ( raw_to_ast == to_ast ) {
         if ( cdecl_mode == CDECL_ENGLISH_TO_GIBBERISH )
@@ -2308,7 +2311,7 @@ static bool c_ast_check_ret_type( c_ast_t const *ast ) {
     case K_CLASS_STRUCT_UNION:
       if ( !OPT_LANG_IS( CSU_RETURN_TYPES ) ) {
         print_error( &ret_ast->loc, "%s returning ", kind_name );
-        print_ast_kind_aka( ret_ast, stderr );
+        print_ast_kind_aka( ret_ast, cdecl_ferr );
         EPRINTF( " not supported%s\n", C_LANG_WHICH( CSU_RETURN_TYPES ) );
         return false;
       }
@@ -2316,7 +2319,7 @@ static bool c_ast_check_ret_type( c_ast_t const *ast ) {
 
     case K_FUNCTION:
       print_error( &ret_ast->loc, "%s returning ", kind_name );
-      print_ast_kind_aka( ret_ast, stderr );
+      print_ast_kind_aka( ret_ast, cdecl_ferr );
       EPUTS( " is illegal" );
       print_hint( "%s returning pointer to function", kind_name );
       return false;
@@ -2390,7 +2393,7 @@ static bool c_ast_check_udef_conv( c_ast_t const *ast ) {
     print_error( &to_ast->loc,
       "user-defined conversion operator return type "
     );
-    print_ast_type_aka( to_ast, stderr );
+    print_ast_type_aka( to_ast, cdecl_ferr );
     EPUTS( " can not be an array" );
     print_hint( "pointer to array" );
     return false;
@@ -2440,7 +2443,7 @@ static bool c_ast_check_udef_lit_params( c_ast_t const *ast ) {
             print_error( &param_ast->loc,
               "invalid user-defined literal parameter type "
             );
-            print_ast_type_aka( param_ast, stderr );
+            print_ast_type_aka( param_ast, cdecl_ferr );
             EPRINTF( "; must be \"%s\", ",
                      c_tid_name_error( TB_unsigned | TB_long | TB_long_long ) );
             EPRINTF( "\"%s\", ", c_tid_name_error( TB_long | TB_double ) );
@@ -2470,7 +2473,7 @@ static bool c_ast_check_udef_lit_params( c_ast_t const *ast ) {
         print_error( &param_ast->loc,
           "invalid user-defined literal parameter type "
         );
-        print_ast_type_aka( param_ast, stderr );
+        print_ast_type_aka( param_ast, cdecl_ferr );
         EPRINTF( "; must be "
           "const (char%s|char16_t|char32_t|wchar_t)*\n",
           OPT_LANG_IS( char8_t ) ? "|char8_t" : ""
@@ -2482,7 +2485,7 @@ static bool c_ast_check_udef_lit_params( c_ast_t const *ast ) {
         print_error( &param_ast->loc,
           "invalid user-defined literal parameter type "
         );
-        print_ast_type_aka( param_ast, stderr );
+        print_ast_type_aka( param_ast, cdecl_ferr );
         EPUTS( "; must be \"std::size_t\" (or equivalent)\n" );
         return false;
       }
@@ -2892,7 +2895,7 @@ static bool c_ast_visitor_warning( c_ast_t const *ast, user_data_t user_data ) {
           "\"%s\" on reference type ",
           c_tid_name_error( qual_stids )
         );
-        print_ast_type_aka( ast, stderr );
+        print_ast_type_aka( ast, cdecl_ferr );
         EPUTS( " has no effect\n" );
         break;
       }
@@ -2998,7 +3001,7 @@ static bool c_ast_visitor_warning( c_ast_t const *ast, user_data_t user_data ) {
       unreachable();
   } // switch
 
-  if ( cdecl_initialized )              // don't warn for predefined types
+  if ( cdecl_session->is_initialized )  // don't warn for predefined types
     c_ast_warn_name( ast );
 
   return /*stop=*/false;
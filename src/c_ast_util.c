@@ -881,10 +881,10 @@ c_ast_t* c_ast_patch_placeholder( c_ast_t *type_ast, c_ast_t *decl_ast ) {
   return decl_ast;
 }
 
-c_ast_t* c_ast_pointer( c_ast_t *ast, c_ast_list_t *ast_list ) {
+c_ast_t* c_ast_pointer( c_ast_t *ast, c_ast_arena_t *arena ) {
   assert( ast != NULL );
   c_ast_t *const ptr_ast =
-    c_ast_new( K_POINTER, ast->depth, &ast->loc, ast_list );
+    c_ast_new( K_POINTER, ast->depth, &ast->loc, arena );
   ptr_ast->sname = c_ast_move_sname( ast );
   c_ast_set_parent( ast, ptr_ast );
   return ptr_ast;
@@ -902,8 +902,7 @@ c_ast_t c_ast_sub_typedef( c_ast_t const *ast ) {
   assert( ast->kind == K_TYPEDEF );
 
   c_tid_t qual_stids;
-  c_ast_t rv_ast = *c_ast_untypedef_qual( ast, &qual_stids );
-  rv_ast.align = ast->align;
+  c_ast_t rv_ast = c_ast_copy( c_ast_untypedef_qual( ast, &qual_stids ) );
   rv_ast.loc = ast->loc;
   rv_ast.type.stids |= qual_stids;
   if ( c_ast_is_integral( &rv_ast ) )
@@ -398,13 +398,13 @@ c_ast_t* c_ast_patch_placeholder( c_ast_t *type_ast, c_ast_t *decl_ast );
  * nodes), if any, is moved to the new pointer AST.
  *
  * @param ast The AST to create a pointer to.
- * @param ast_list The list to append the new pointer AST node onto.
+ * @param arena The \ref c_ast_arena to allocate the new pointer AST node from.
  * @return Returns the new pointer AST.
  *
  * @sa c_ast_unpointer()
  */
 NODISCARD
-c_ast_t* c_ast_pointer( c_ast_t *ast, c_ast_list_t *ast_list );
+c_ast_t* c_ast_pointer( c_ast_t *ast, c_ast_arena_t *arena );
 
 /**
  * Gets the root AST node starting at \a ast.
@@ -617,9 +617,9 @@ bool c_ast_print_as_using( c_ast_t const *ast ) {
 
 /**
  * Creates a temporary AST node that is a copy of the AST node that \a ast is a
- * `typedef` for, but keeping the original's alignment, bit-field width (only
- * if it's an integral type), source location, and qualifiers bitwise-or'd in,
- * effectively substituting the `typedef`'d
+ * `typedef` for, but keeping the original's bit-field width (only if it's an
+ * integral type), source location, and qualifiers bitwise-or'd in, effectively
+ * substituting the `typedef`'d
  *
  * For example, given:
  *
@@ -637,8 +637,11 @@ bool c_ast_print_as_using( c_ast_t const *ast ) {
  * @param ast The AST to get what it's a `typedef` for .  It _must_ be of kind
  * #K_TYPEDEF.
  * @return Returns a new AST that is the AST that \a ast is a `typedef` for,
- * but with the original alignment, bit-field width (only if an integral type),
- * source location, and qualifiers bitwise-or'd in.
+ * but with the original bit-field width (only if an integral type), source
+ * location, and qualifiers bitwise-or'd in.
+ *
+ * @note The returned AST has no alignment since it's not in an arena; any
+ * alignment of \a ast is checked on \a ast itself.
  *
  * @sa c_ast_untypedef_qual()
  */
@@ -30,6 +30,7 @@
 #include "c_lang.h"
 #include "cdecl.h"
 #include "literals.h"
+#include "symtab.h"
 #include "util.h"
 #include "cdecl_parser.h"               /* must go last */
 
@@ -38,8 +39,6 @@
 // standard
 #include <assert.h>
 #include <stddef.h>                     /* for NULL */
-#include <stdlib.h>
-#include <string.h>
 
 // shorthands
 #define KC__                      C_KW_CTX_DEFAULT
@@ -61,9 +60,8 @@
  * @note There are two rows for `auto` since it has two meanings (one as a
  * storage class in C and C++ up to C++03 and the other as an automatically
  * deduced type in C++11 and later).
- * @note This is not declared `const` because it's sorted once.
  */
-static c_keyword_t C_KEYWORDS[] = {
+c_keyword_t const C_KEYWORDS[] = {
   // K&R C
   { L_auto,                 Y_auto_STORAGE,       KC__, TS_auto,
     LANG_auto_STORAGE,      AC_LANG(auto_STORAGE)                         },
@@ -449,39 +447,24 @@ static c_keyword_t C_KEYWORDS[] = {
     LANG_NONE,              AC_LANG(NONE)                                 }
 };
 
-////////// local functions ////////////////////////////////////////////////////
-
-/**
- * Compares two \ref c_keyword objects.
- *
- * @param i_ck The first \ref c_keyword to compare.
- * @param j_ck The second \ref c_keyword to compare.
- * @return @return Returns a number less than 0, 0, or greater than 0 if \a
- * i_ck is less than, equal to, or greater than \a j_ck, respectively.
- */
-NODISCARD
-static int c_keyword_cmp( c_keyword_t const *i_ck, c_keyword_t const *j_ck ) {
-  return strcmp( i_ck->literal, j_ck->literal );
-}
-
 ////////// extern functions ///////////////////////////////////////////////////
 
 c_keyword_t const* c_keyword_find( char const *literal, c_lang_id_t lang_ids,
                                    c_keyword_ctx_t kw_ctx ) {
   assert( literal != NULL );
-  assert( lang_ids != LANG_NONE );
+  return symtab_c_keyword( symtab_find( literal ), lang_ids, kw_ctx );
+}
 
-  // the list is small, so linear search is good enough
-  for ( c_keyword_t const *ck = C_KEYWORDS; ck->literal != NULL; ++ck ) {
-    int const cmp = strcmp( literal, ck->literal );
-    if ( cmp > 0 )
-      continue;
-    if ( cmp < 0 )                      // the array is sorted
-      break;
+c_keyword_t const* c_keyword_find_in( c_keyword_t const *const ck_array[],
+                                      size_t ck_len, c_lang_id_t lang_ids,
+                                      c_keyword_ctx_t kw_ctx ) {
+  assert( ck_array != NULL );
+  assert( lang_ids != LANG_NONE );
 
+  for ( size_t i = 0; i < ck_len && ck_array[i] != NULL; ++i ) {
+    c_keyword_t const *const ck = ck_array[i];
     if ( (ck->lang_ids & lang_ids) == LANG_NONE )
       continue;
-
     if ( cdecl_mode == CDECL_GIBBERISH_TO_ENGLISH &&
          ck->kw_ctx != C_KW_CTX_DEFAULT && kw_ctx != ck->kw_ctx ) {
       //
@@ -510,14 +493,6 @@ c_keyword_t const* c_keyword_find( char const *literal, c_lang_id_t lang_ids,
   return NULL;
 }
 
-void c_keyword_init( void ) {
-  ASSERT_RUN_ONCE();
-  qsort(                                // so we can stop the search early
-    C_KEYWORDS, ARRAY_SIZE( C_KEYWORDS ) - 1/*NULL*/, sizeof( c_keyword_t ),
-    POINTER_CAST( qsort_cmp_fn_t, &c_keyword_cmp )
-  );
-}
-
 c_keyword_t const* c_keyword_next( c_keyword_t const *ck ) {
   return ck == NULL ? C_KEYWORDS : (++ck)->literal == NULL ? NULL : ck;
 }
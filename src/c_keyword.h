@@ -103,6 +103,15 @@ struct c_keyword {
 };
 typedef struct c_keyword c_keyword_t;
 
+/**
+ * Array of all C/C++ keywords or C23/C++11 (or later) attributes terminated
+ * by an element whose \ref c_keyword::literal "literal" is NULL.
+ *
+ * @note This is extern only so the generated symbol table can point into it.
+ * Otherwise use #FOREACH_C_KEYWORD().
+ */
+extern c_keyword_t const C_KEYWORDS[];
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
@@ -121,11 +130,24 @@ c_keyword_t const* c_keyword_find( char const *literal, c_lang_id_t lang_ids,
                                    c_keyword_ctx_t kw_ctx );
 
 /**
- * Initializes \ref c_keyword data.
+ * Gets the first c_keyword in \a ck_array that is in \a lang_ids and \a
+ * kw_ctx.
  *
- * @note This function must be called exactly once.
+ * @param ck_array The c_keyword objects all having the same literal.
+ * @param ck_len The length of \a ck_array.  A NULL element before then ends
+ * it early.
+ * @param lang_ids The bitwise-or of language(s) to look for the keyword or
+ * attribute in.
+ * @param kw_ctx The keyword context to limit to.
+ * @return Returns a pointer to said c_keyword or NULL if none.
+ *
+ * @note This function isn't normally called directly; use either
+ * c_keyword_find() or symtab_c_keyword() instead.
  */
-void c_keyword_init( void );
+NODISCARD
+c_keyword_t const* c_keyword_find_in( c_keyword_t const *const ck_array[],
+                                      size_t ck_len, c_lang_id_t lang_ids,
+                                      c_keyword_ctx_t kw_ctx );
 
 /**
  * Iterates to the next C/C++ keyword or or C23/C++11 (or later) attribute
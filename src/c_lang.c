@@ -162,7 +162,7 @@ char const* c_lang_which( c_lang_id_t lang_ids ) {
   if ( lang_ids == LANG_NONE )
     return "";
 
-  static strbuf_t sbuf;
+  static _Thread_local strbuf_t sbuf;
   strbuf_reset( &sbuf );
   c_lang_id_t which_lang_id;
 
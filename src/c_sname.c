@@ -35,9 +35,11 @@
 #include "c_type.h"
 #include "c_typedef.h"
 #include "color.h"
+#include "intern.h"
 #include "literals.h"
 #include "options.h"
 #include "print.h"
+#include "sink.h"
 #include "strbuf.h"
 #include "util.h"
 
@@ -46,6 +48,7 @@
 #include <fnmatch.h>
 #include <stddef.h>                     /* for NULL */
 #include <stdlib.h>                     /* for free(3) */
+#include <string.h>                     /* for memcpy(3) */
 
 /**
  * @addtogroup sname-group
@@ -54,6 +57,35 @@
 
 ////////// local functions ////////////////////////////////////////////////////
 
+/**
+ * Appends a copy of \a data onto the end of \a sname, spilling all scopes to
+ * the heap if they no longer fit in place.
+ *
+ * @param sname The scoped name to append to.
+ * @param data The \ref c_scope_data to append.
+ */
+static void c_sname_push_back( c_sname_t *sname, c_scope_data_t const *data ) {
+  assert( sname != NULL );
+  assert( data != NULL );
+
+  if ( sname->cap == 0 ) {
+    if ( sname->len == C_SNAME_INLINE_SIZE ) {
+      c_scope_data_t *const heap_scopes =
+        MALLOC( c_scope_data_t, C_SNAME_INLINE_SIZE * 2 );
+      memcpy( heap_scopes, sname->inline_scopes,
+              sizeof sname->inline_scopes );
+      sname->heap_scopes = heap_scopes;
+      sname->cap = C_SNAME_INLINE_SIZE * 2;
+    }
+  }
+  else if ( sname->len == sname->cap ) {
+    sname->cap *= 2;
+    REALLOC( sname->heap_scopes, c_scope_data_t, sname->cap );
+  }
+
+  c_sname_scopes( sname )[ sname->len++ ] = *data;
+}
+
 /**
  * Helper function for c_sname_full_name() and c_sname_scope_name() that writes
  * the scope names from outermost to innermost separated by `::` into a buffer.
@@ -114,13 +146,13 @@ size_t c_sname_parse_impl( char const *s, c_sname_t *rv_sname, bool is_dtor ) {
   char const *prev_name = "";
 
   while ( (end = parse_identifier( s )) != NULL ) {
-    char *const name = check_strndup( s, STATIC_CAST( size_t, end - s ) );
+    char const *const name =
+      intern_strn( s, STATIC_CAST( size_t, end - s ) );
 
     // Ensure that the name is NOT a keyword.
     c_keyword_t const *const ck =
       c_keyword_find( name, opt_lang, C_KW_CTX_DEFAULT );
     if ( ck != NULL ) {
-      FREE( name );
       // ck->literal is set to L_* so == is OK
       if ( is_dtor && ck->literal == L_compl ) {
         char const *const t = s + strlen( L_compl );
@@ -140,7 +172,7 @@ size_t c_sname_parse_impl( char const *s, c_sname_t *rv_sname, bool is_dtor ) {
     prev_end = end;
     SKIP_WS( end );
     if ( *end == '\0' && parsed_tilde ) {
-      if ( is_dtor && strcmp( name, prev_name ) != 0 )
+      if ( is_dtor && name != prev_name )
         goto error;
       goto done;
     }
@@ -171,32 +203,27 @@ int c_scope_data_cmp( c_scope_data_t const *i_data,
                       c_scope_data_t const *j_data ) {
   assert( i_data != NULL );
   assert( j_data != NULL );
+  if ( i_data->name == j_data->name )   // interned names compare by pointer
+    return 0;
   return strcmp( i_data->name, j_data->name );
 }
 
-c_scope_data_t* c_scope_data_dup( c_scope_data_t const *src ) {
-  if ( src == NULL )
-    return NULL;                        // LCOV_EXCL_LINE
-  c_scope_data_t *const dst = MALLOC( c_scope_data_t, 1 );
-  dst->name = check_strdup( src->name );
-  dst->type = src->type;
-  return dst;
+void c_sname_append_name( c_sname_t *sname, char const *name ) {
+  assert( name != NULL );
+  c_sname_push_back( sname, &(c_scope_data_t){ name, T_NONE } );
 }
 
-void c_scope_data_free( c_scope_data_t *data ) {
-  if ( data != NULL ) {
-    FREE( data->name );
-    free( data );
+void c_sname_append_sname( c_sname_t *dst, c_sname_t *src ) {
+  assert( dst != NULL );
+  assert( src != NULL );
+  if ( c_sname_empty( dst ) ) {
+    c_sname_cleanup( dst );
+    *dst = c_sname_move( src );
+    return;
   }
-}
-
-void c_sname_append_name( c_sname_t *sname, char const *name ) {
-  assert( sname != NULL );
-  assert( name != NULL );
-  c_scope_data_t *const data = MALLOC( c_scope_data_t, 1 );
-  data->name = name;
-  data->type = T_NONE;
-  slist_push_back( sname, data );
+  FOREACH_SNAME_SCOPE( scope, src )
+    c_sname_push_back( dst, scope );
+  c_sname_cleanup( src );
 }
 
 bool c_sname_check( c_sname_t const *sname, c_loc_t const *sname_loc ) {
@@ -222,17 +249,21 @@ bool c_sname_check( c_sname_t const *sname, c_loc_t const *sname_loc ) {
   c_tid_t prev_btids = TB_NONE;
   unsigned prev_order = 0;
 
+  //
+  // A shallow copy of sname whose length is shortened to chop off any scopes
+  // past the given scope to look up a partial sname.  For example, given
+  // "A::B::C", see if "A::B" exists.  If it does, check that the sname's
+  // scope's type matches the previously declared sname's scope's type.  (Only
+  // scope names matter for look-ups, so it doesn't matter that the copy's
+  // scope types may be out of date.)
+  //
+  c_sname_t partial_sname = *sname;
+
   FOREACH_SNAME_SCOPE( scope, sname ) {
     c_type_t *const scope_type = &c_scope_data( scope )->type;
-    //
-    // Temporarily set scope->next to NULL to chop off any scopes past the
-    // given scope to look up a partial sname. For example, given "A::B::C",
-    // see if "A::B" exists.  If it does, check that the sname's scope's type
-    // matches the previously declared sname's scope's type.
-    //
-    c_scope_t *const orig_next = scope->next;
-    scope->next = NULL;
-    c_typedef_t const *const tdef = c_typedef_find_sname( sname );
+    partial_sname.len =
+      STATIC_CAST( unsigned, scope - c_sname_scopes( sname ) ) + 1;
+    c_typedef_t const *const tdef = c_typedef_find_sname( &partial_sname );
     if ( tdef != NULL ) {
       c_type_t const *const tdef_type = c_sname_local_type( &tdef->ast->sname );
       if ( c_tid_is_any( tdef_type->btids, TB_ANY_SCOPE | TB_enum ) &&
@@ -252,9 +283,8 @@ bool c_sname_check( c_sname_t const *sname, c_loc_t const *sname_loc ) {
             c_sname_local_name( sname ),
             c_type_name_error( tdef_type )
           );
-          print_type_decl( tdef, tdef->decl_flags, stderr );
+          print_type_decl( tdef, tdef->decl_flags, cdecl_ferr );
           EPUTS( "\")\n" );
-          scope->next = orig_next;
           return false;
         }
 
@@ -265,7 +295,6 @@ bool c_sname_check( c_sname_t const *sname, c_loc_t const *sname_loc ) {
         *scope_type = *tdef_type;
       }
     }
-    scope->next = orig_next;
 
     unsigned const scope_order = c_tid_scope_order( scope_type->btids );
     if ( scope_order < prev_order ) {
@@ -284,7 +313,29 @@ bool c_sname_check( c_sname_t const *sname, c_loc_t const *sname_loc ) {
 }
 
 void c_sname_cleanup( c_sname_t *sname ) {
-  slist_cleanup( sname, POINTER_CAST( slist_free_fn_t, &c_scope_data_free ) );
+  if ( sname == NULL )
+    return;
+  if ( sname->cap > 0 )
+    free( sname->heap_scopes );
+  c_sname_init( sname );
+}
+
+int c_sname_cmp( c_sname_t const *i_sname, c_sname_t const *j_sname ) {
+  assert( i_sname != NULL );
+  assert( j_sname != NULL );
+
+  c_scope_t const *const i_scopes = c_sname_scopes( i_sname );
+  c_scope_t const *const j_scopes = c_sname_scopes( j_sname );
+  unsigned const min_len = i_sname->len < j_sname->len ?
+    i_sname->len : j_sname->len;
+
+  for ( unsigned i = 0; i < min_len; ++i ) {
+    int const cmp = c_scope_data_cmp( &i_scopes[i], &j_scopes[i] );
+    if ( cmp != 0 )
+      return cmp;
+  } // for
+
+  return (i_sname->len > j_sname->len) - (i_sname->len < j_sname->len);
 }
 
 int c_sname_cmp_name( c_sname_t const *sname, char const *name ) {
@@ -295,13 +346,27 @@ int c_sname_cmp_name( c_sname_t const *sname, char const *name ) {
   return c_sname_cmp( sname, &name_sname );
 }
 
+c_sname_t c_sname_dup( c_sname_t const *sname ) {
+  c_sname_t rv_sname;
+  c_sname_init( &rv_sname );
+  if ( sname != NULL ) {
+    rv_sname = *sname;
+    if ( sname->cap > 0 ) {
+      rv_sname.heap_scopes = MALLOC( c_scope_data_t, sname->cap );
+      memcpy( rv_sname.heap_scopes, sname->heap_scopes,
+              sname->len * sizeof( c_scope_data_t ) );
+    }
+  }
+  return rv_sname;
+}
+
 void c_sname_fill_in_namespaces( c_sname_t *sname ) {
   assert( sname != NULL );
   c_type_t const *const local_type = c_sname_local_type( sname );
   if ( !c_tid_is_any( local_type->btids, TB_namespace ) )
     return;
 
-  FOREACH_SNAME_SCOPE_UNTIL( scope, sname, sname->tail ) {
+  FOREACH_SNAME_SCOPE_UNTIL( scope, sname, c_sname_local_scope( sname ) ) {
     c_type_t *const type = &c_scope_data( scope )->type;
     if ( c_type_is_none( type ) || c_tid_is_any( type->btids, TB_SCOPE ) ) {
       type->btids &= c_tid_compl( TB_SCOPE );
@@ -316,11 +381,26 @@ void c_sname_free( c_sname_t *sname ) {
 }
 
 char const* c_sname_full_name( c_sname_t const *sname ) {
-  static strbuf_t sbuf;
+  static _Thread_local strbuf_t sbuf;
   return sname != NULL ?
     c_sname_name_impl( &sbuf, sname, /*end_scope=*/NULL ) : "";
 }
 
+uint32_t c_sname_hash( c_sname_t const *sname ) {
+  assert( sname != NULL );
+  // 32-bit FNV-1a hash of the full name without the "::" separators but with
+  // a NUL between scopes so, e.g., "ab::c" and "a::bc" hash differently.
+  uint32_t hash = 2166136261u;
+  FOREACH_SNAME_SCOPE( scope, sname ) {
+    for ( char const *s = c_scope_data( scope )->name; *s != '\0'; ++s ) {
+      hash ^= STATIC_CAST( unsigned char, *s );
+      hash *= 16777619u;
+    } // for
+    hash *= 16777619u;                  // as if hashing '\0'
+  } // for
+  return hash;
+}
+
 bool c_sname_is_ctor( c_sname_t const *sname ) {
   assert( sname != NULL );
   if ( c_sname_count( sname ) < 2 )
@@ -336,9 +416,9 @@ void c_sname_list_cleanup( slist_t *list ) {
 
 char const* c_sname_local_name( c_sname_t const *sname ) {
   if ( sname != NULL ) {
-    c_scope_data_t const *const local_data = slist_back( sname );
-    if ( local_data != NULL )
-      return local_data->name;
+    c_scope_t const *const local_scope = c_sname_local_scope( sname );
+    if ( local_scope != NULL )
+      return local_scope->name;
   }
   return "";                            // LCOV_EXCL_LINE
 }
@@ -347,7 +427,8 @@ bool c_sname_match( c_sname_t const *sname, c_sglob_t const *sglob ) {
   assert( sname != NULL );
   assert( sglob != NULL );
 
-  c_scope_t const *scope = sname->head;
+  c_scope_t const *scope = c_sname_scopes( sname );
+  c_scope_t const *const end_scope = scope + sname->len;
   size_t const scope_count = c_sname_count( sname );
 
   if ( !sglob->match_in_any_scope ) {
@@ -375,18 +456,13 @@ bool c_sname_match( c_sname_t const *sname, c_sglob_t const *sglob ) {
     // `**::c::d` (glob_count = 2 since the `**::` is stripped), then skip past
     // 2 scopes (4 - 2) in sname to arrive at `c::d` that will match.
     //
-    for ( size_t diff_count = scope_count - sglob->count; diff_count > 0;
-          --diff_count, scope = scope->next ) {
-      assert( scope != NULL );
-    } // for
-    assert( scope != NULL );
+    scope += scope_count - sglob->count;
   }
 
   //
   // Finally, attempt to match each scope name against each scope glob.
   //
-  for ( size_t sglob_index = 0; scope != NULL;
-        ++sglob_index, scope = scope->next ) {
+  for ( size_t sglob_index = 0; scope < end_scope; ++sglob_index, ++scope ) {
     assert( sglob_index < sglob->count );
     char const *const name = c_scope_data( scope )->name;
     if ( fnmatch( sglob->pattern[ sglob_index ], name, /*flags=*/0 ) != 0 )
@@ -404,9 +480,18 @@ bool c_sname_parse_dtor( char const *s, c_sname_t *rv_sname ) {
   return c_sname_parse_impl( s, rv_sname, /*is_dtor=*/true ) > 0;
 }
 
+void c_sname_prepend_sname( c_sname_t *dst, c_sname_t *src ) {
+  assert( dst != NULL );
+  assert( src != NULL );
+  c_sname_append_sname( src, dst );
+  *dst = c_sname_move( src );
+}
+
 char const* c_sname_scope_name( c_sname_t const *sname ) {
-  static strbuf_t sbuf;
-  return sname != NULL ? c_sname_name_impl( &sbuf, sname, sname->tail ) : "";
+  static _Thread_local strbuf_t sbuf;
+  if ( sname == NULL || c_sname_count( sname ) < 2 )
+    return "";
+  return c_sname_name_impl( &sbuf, sname, c_sname_local_scope( sname ) );
 }
 
 void c_sname_set( c_sname_t *dst_sname, c_sname_t *src_sname ) {
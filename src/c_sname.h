@@ -38,6 +38,7 @@
 // standard
 #include <stdbool.h>
 #include <stddef.h>                     /* for size_t */
+#include <stdint.h>
 
 _GL_INLINE_HEADER_BEGIN
 #ifndef C_SNAME_H_INLINE
@@ -63,20 +64,40 @@ _GL_INLINE_HEADER_BEGIN
  *
  * @note For C, an sname is simply a single (unscoped) name, e.g., `x`.
  *
+ * @remarks Since most snames (and all of them in C) have only a single scope,
+ * up to #C_SNAME_INLINE_SIZE scopes are stored in place within the \ref
+ * c_sname itself; only snames having more scopes spill to the heap.  Hence,
+ * no sname in C requires memory allocation, but every C++ sname having a
+ * scope, e.g., `std::size_t`, does.
+ *
  * @sa \ref sglob-group
  * @{
  */
 
+/**
+ * The number of scopes a \ref c_sname stores in place before spilling to the
+ * heap.
+ *
+ * @note Since every AST node contains at least one \ref c_sname (and
+ * `YYSTYPE` contains one), each in-place scope costs `sizeof(c_scope_data_t)`
+ * bytes per node; hence this is kept small.  On x86_64, 2 in-place scopes
+ * would grow a \ref c_sname from 40 to 72 bytes and a \ref c_ast from 168 to
+ * 232 bytes.  With the precompiled table (see c_typedef_gen.h), predefined
+ * types cost no allocation either way.
+ */
+#define C_SNAME_INLINE_SIZE       1
+
 /**
  * Creates a scoped name variable \a VAR on the stack having a local \a NAME.
  *
  * @param VAR The \ref c_sname_t variable.
  * @param NAME The name.
  *
- * @warning c_sname_cleanup() must _not_ be called on \a VAR.
+ * @note Since \a VAR has only one scope that's stored in place,
+ * c_sname_cleanup() need not be called on it.
  */
 #define SNAME_VAR_INIT_NAME(VAR,NAME) \
-  SLIST_VAR_INIT( VAR, (&(c_scope_data_t){ (NAME), T_NONE }) )
+  c_sname_t VAR = { .len = 1, .inline_scopes = { { (NAME), T_NONE } } }
 
 /**
  * Gets the data associated with \a SCOPE.
@@ -87,31 +108,33 @@ _GL_INLINE_HEADER_BEGIN
  * either a `const` or non-`const` \a SCOPE.
  */
 #define c_scope_data(SCOPE) \
-  POINTER_CAST( c_scope_data_t*, (SCOPE)->data )
+  CONST_CAST( c_scope_data_t*, (SCOPE) )
 
 /**
  * Convenience macro for iterating over all scopes of an sname.
  *
- * @param VAR The \ref slist_node loop variable.
+ * @param VAR The \ref c_scope_t loop variable.
  * @param SNAME The \ref c_sname_t to iterate over the scopes of.
  *
  * @sa #FOREACH_SNAME_SCOPE_UNTIL()
  */
 #define FOREACH_SNAME_SCOPE(VAR,SNAME) \
-  FOREACH_SLIST_NODE( VAR, SNAME )
+  FOREACH_SNAME_SCOPE_UNTIL( VAR, SNAME, /*END=*/NULL )
 
 /**
  * Convenience macro for iterating over all scopes of an sname up to but not
  * including \a END.
  *
- * @param VAR The \ref slist_node loop variable.
+ * @param VAR The \ref c_scope_t loop variable.
  * @param SNAME The \ref c_sname_t to iterate over the scopes of.
  * @param END The scope to end before; may be NULL.
  *
  * @sa #FOREACH_SNAME_SCOPE()
  */
-#define FOREACH_SNAME_SCOPE_UNTIL(VAR,SNAME,END) \
-  FOREACH_SLIST_NODE_UNTIL( VAR, SNAME, END )
+#define FOREACH_SNAME_SCOPE_UNTIL(VAR,SNAME,END)                    \
+  for ( c_scope_t *VAR = c_sname_scopes( SNAME ),                   \
+        *const VAR##_end = c_sname_scopes_end( (SNAME), (END) );    \
+        VAR < VAR##_end; ++VAR )
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -120,7 +143,8 @@ _GL_INLINE_HEADER_BEGIN
  */
 struct c_scope_data {
   /**
-   * The scope's name.
+   * The scope's name.  It's either interned (see intern_str()) or has static
+   * storage duration; either way, it's never freed.
    */
   char const *name;
 
@@ -132,6 +156,30 @@ struct c_scope_data {
 };
 typedef struct c_scope_data c_scope_data_t;
 
+/**
+ * A C++ scoped name, e.g., `S::T::x`, stored as an array of \ref c_scope_data
+ * from outermost to innermost scope.
+ *
+ * @remarks The first #C_SNAME_INLINE_SIZE scopes are stored in place.  When
+ * more are appended, all scopes are moved to the heap.
+ *
+ * @warning Once scopes are on the heap, a \ref c_sname owns them, so simple
+ * assignment is valid only as a _move_: the source must not be cleaned up nor
+ * used afterwards, else both copies would free the same scopes.  Use either
+ * c_sname_move() to move or c_sname_dup() to copy.
+ */
+struct c_sname {
+  unsigned  len;                        ///< Number of scopes.
+  unsigned  cap;                        ///< Heap capacity or 0 if in place.
+  union {
+    /// Scopes stored in place when \ref cap is 0.
+    c_scope_data_t  inline_scopes[ C_SNAME_INLINE_SIZE ];
+
+    /// Scopes stored on the heap when \ref cap is &gt; 0.
+    c_scope_data_t *heap_scopes;
+  };
+};
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
@@ -147,29 +195,49 @@ int c_scope_data_cmp( c_scope_data_t const *i_data,
                       c_scope_data_t const *j_data );
 
 /**
- * Duplicates \a data.
+ * Gets the scopes of \a sname.
+ *
+ * @param sname The scoped name to get the scopes of.
+ * @return Returns a pointer to the outermost scope.
  *
- * @param data The \ref c_scope_data to duplicate; may be NULL.
- * @return Returns a duplicate of \a data or NULL only if \a data is NULL.  The
- * caller is responsible for calling c_scope_data_free() on it.
+ * @note This is a helper for #FOREACH_SNAME_SCOPE_UNTIL(); it should rarely
+ * be called directly.
  *
- * @sa c_scope_data_free()
+ * @sa c_sname_local_scope()
+ * @sa c_sname_scopes_end()
  */
-NODISCARD
-c_scope_data_t* c_scope_data_dup( c_scope_data_t const *data );
+NODISCARD C_SNAME_H_INLINE
+c_scope_t* c_sname_scopes( c_sname_t const *sname ) {
+  return CONST_CAST( c_scope_t*,
+    sname->cap == 0 ? sname->inline_scopes : sname->heap_scopes
+  );
+}
 
 /**
- * Frees all memory associated with \a data _including_ \a data itself.
+ * Gets the scope to end before when iterating over the scopes of \a sname.
+ *
+ * @param sname The scoped name to get the end of.
+ * @param end The scope to end before or NULL for all scopes.
+ * @return Returns \a end if not NULL; otherwise returns a pointer to one past
+ * the innermost scope.
+ *
+ * @note This is a helper for #FOREACH_SNAME_SCOPE_UNTIL(); it should rarely
+ * be called directly.
  *
- * @param data The \ref c_scope_data to free.  If NULL, does nothing.
+ * @sa c_sname_scopes()
  */
-void c_scope_data_free( c_scope_data_t *data );
+NODISCARD C_SNAME_H_INLINE
+c_scope_t* c_sname_scopes_end( c_sname_t const *sname, c_scope_t const *end ) {
+  return end != NULL ?
+    CONST_CAST( c_scope_t*, end ) : c_sname_scopes( sname ) + sname->len;
+}
 
 /**
  * Appends \a name onto the end of \a sname.
  *
  * @param sname The scoped name to append to.
- * @param name The name to append.  Ownership is taken.
+ * @param name The name to append.  It must either be interned (see
+ * intern_str()) or have static storage duration.
  *
  * @sa c_sname_append_sname()
  * @sa c_sname_prepend_sname()
@@ -187,10 +255,7 @@ void c_sname_append_name( c_sname_t *sname, char const *name );
  * @sa c_sname_prepend_sname()
  * @sa c_sname_set()
  */
-C_SNAME_H_INLINE
-void c_sname_append_sname( c_sname_t *dst, c_sname_t *src ) {
-  slist_push_list_back( dst, src );
-}
+void c_sname_append_sname( c_sname_t *dst, c_sname_t *src );
 
 /**
  * Checks a scoped name for valid scope order.
@@ -225,10 +290,8 @@ void c_sname_cleanup( c_sname_t *sname );
  *
  * @sa c_sname_cmp_name()
  */
-NODISCARD C_SNAME_H_INLINE
-int c_sname_cmp( c_sname_t const *i_sname, c_sname_t const *j_sname ) {
-  return slist_cmp( i_sname, j_sname, (slist_cmp_fn_t)&c_scope_data_cmp );
-}
+NODISCARD
+int c_sname_cmp( c_sname_t const *i_sname, c_sname_t const *j_sname );
 
 /**
  * Compares a scoped name and a name.
@@ -254,7 +317,7 @@ int c_sname_cmp_name( c_sname_t const *sname, char const *name );
  */
 NODISCARD C_SNAME_H_INLINE
 size_t c_sname_count( c_sname_t const *sname ) {
-  return slist_len( sname );
+  return sname->len;
 }
 
 /**
@@ -265,10 +328,8 @@ size_t c_sname_count( c_sname_t const *sname ) {
  * @return Returns a duplicate of \a sname or an empty scoped name if \a sname
  * is NULL.
  */
-NODISCARD C_SNAME_H_INLINE
-c_sname_t c_sname_dup( c_sname_t const *sname ) {
-  return slist_dup( sname, -1, (slist_dup_fn_t)&c_scope_data_dup );
-}
+NODISCARD
+c_sname_t c_sname_dup( c_sname_t const *sname );
 
 /**
  * Gets whether \a sname is empty.
@@ -278,7 +339,7 @@ c_sname_t c_sname_dup( c_sname_t const *sname ) {
  */
 NODISCARD C_SNAME_H_INLINE
 bool c_sname_empty( c_sname_t const *sname ) {
-  return slist_empty( sname );
+  return sname->len == 0;
 }
 
 /**
@@ -306,7 +367,7 @@ void c_sname_fill_in_namespaces( c_sname_t *sname );
  */
 NODISCARD C_SNAME_H_INLINE
 c_type_t const* c_sname_first_type( c_sname_t const *sname ) {
-  return c_sname_empty( sname ) ? &T_NONE : &c_scope_data( sname->head )->type;
+  return c_sname_empty( sname ) ? &T_NONE : &c_sname_scopes( sname )->type;
 }
 
 /**
@@ -352,14 +413,15 @@ char const* c_sname_full_name( c_sname_t const *sname );
  */
 C_SNAME_H_INLINE
 void c_sname_init( c_sname_t *sname ) {
-  slist_init( sname );
+  MEM_ZERO( sname );
 }
 
 /**
  * Initializes \a sname with \a name.
  *
  * @param sname The scoped name to initialize.
- * @param name The name to set to.  Ownership is taken.
+ * @param name The name to set to.  It must either be interned (see
+ * intern_str()) or have static storage duration.
  *
  * @sa c_sname_cleanup()
  * @sa c_sname_free()
@@ -367,10 +429,25 @@ void c_sname_init( c_sname_t *sname ) {
  */
 C_SNAME_H_INLINE
 void c_sname_init_name( c_sname_t *sname, char const *name ) {
-  slist_init( sname );
+  c_sname_init( sname );
   c_sname_append_name( sname, name );
 }
 
+/**
+ * Gets a hash of the names of all scopes of \a sname.
+ *
+ * @param sname The scoped name to hash.
+ * @return Returns said hash.
+ *
+ * @note Two scoped names that are equal according to c_sname_cmp() have the
+ * same hash.  The hash does not change across runs, so it may be precomputed
+ * at build time.
+ *
+ * @sa c_sname_cmp()
+ */
+NODISCARD
+uint32_t c_sname_hash( c_sname_t const *sname );
+
 /**
  * Gets whether \a sname is a constructor name, i.e., whether the last two
  * names match, for example `S::T::T`.
@@ -411,6 +488,20 @@ void c_sname_list_cleanup( slist_t *list );
 NODISCARD
 char const* c_sname_local_name( c_sname_t const *sname );
 
+/**
+ * Gets the local scope of \a sname (which is the innermost scope).
+ *
+ * @param sname The scoped name to get the local scope of.
+ * @return Returns said scope or NULL if \a sname is empty.
+ *
+ * @sa c_sname_scopes()
+ */
+NODISCARD C_SNAME_H_INLINE
+c_scope_t* c_sname_local_scope( c_sname_t const *sname ) {
+  return c_sname_empty( sname ) ?
+    NULL : c_sname_scopes( sname ) + (sname->len - 1);
+}
+
 /**
  * Gets the local scope-type of \a sname (which is the type of the innermost
  * scope).
@@ -424,7 +515,8 @@ char const* c_sname_local_name( c_sname_t const *sname );
  */
 NODISCARD C_SNAME_H_INLINE
 c_type_t const* c_sname_local_type( c_sname_t const *sname ) {
-  return c_sname_empty( sname ) ? &T_NONE : &c_scope_data( sname->tail )->type;
+  return c_sname_empty( sname ) ?
+    &T_NONE : &c_sname_local_scope( sname )->type;
 }
 
 
@@ -477,7 +569,9 @@ bool c_sname_match( c_sname_t const *sname, c_sglob_t const *sglob );
  */
 NODISCARD C_SNAME_H_INLINE
 c_sname_t c_sname_move( c_sname_t *sname ) {
-  return slist_move( sname );
+  c_sname_t const rv = *sname;
+  c_sname_init( sname );
+  return rv;
 }
 
 /**
@@ -493,8 +587,8 @@ c_sname_t c_sname_move( c_sname_t *sname ) {
  */
 NODISCARD C_SNAME_H_INLINE
 char const* c_sname_name_atr( c_sname_t const *sname, size_t roffset ) {
-  c_scope_data_t const *const data = slist_atr( sname, roffset );
-  return data != NULL ? data->name : "";
+  return roffset < sname->len ?
+    c_sname_scopes( sname )[ sname->len - 1 - roffset ].name : "";
 }
 
 /**
@@ -523,6 +617,21 @@ size_t c_sname_parse( char const *s, c_sname_t *rv_sname );
 NODISCARD
 bool c_sname_parse_dtor( char const *s, c_sname_t *rv_sname );
 
+/**
+ * Removes the local (innermost) scope from \a sname, e.g., `S::T::x` becomes
+ * `S::T`.
+ *
+ * @param sname The scoped name to remove the local scope from.  It must not be
+ * empty.
+ *
+ * @sa c_sname_append_name()
+ */
+C_SNAME_H_INLINE
+void c_sname_pop_back( c_sname_t *sname ) {
+  assert( !c_sname_empty( sname ) );
+  --sname->len;
+}
+
 /**
  * Prepends \a src onto the beginning of \a dst.
  *
@@ -532,10 +641,7 @@ bool c_sname_parse_dtor( char const *s, c_sname_t *rv_sname );
  * @sa c_sname_append_name()
  * @sa c_sname_append_sname()
  */
-C_SNAME_H_INLINE
-void c_sname_prepend_sname( c_sname_t *dst, c_sname_t *src ) {
-  slist_push_list_front( dst, src );
-}
+void c_sname_prepend_sname( c_sname_t *dst, c_sname_t *src );
 
 /**
  * Gets just the scope name of \a sname.
@@ -570,8 +676,8 @@ char const* c_sname_scope_name( c_sname_t const *sname );
  */
 NODISCARD C_SNAME_H_INLINE
 c_type_t const* c_sname_scope_type( c_sname_t const *sname ) {
-  c_scope_data_t const *const data = slist_atr( sname, 1 );
-  return data != NULL ? &data->type : &T_NONE;
+  return sname->len > 1 ?
+    &c_sname_scopes( sname )[ sname->len - 2 ].type : &T_NONE;
 }
 
 /**
@@ -602,7 +708,7 @@ void c_sname_set( c_sname_t *dst_sname, c_sname_t *src_sname );
  */
 C_SNAME_H_INLINE
 void c_sname_set_first_type( c_sname_t *sname, c_type_t const *type ) {
-  c_scope_data( sname->head )->type = *type;
+  c_sname_scopes( sname )->type = *type;
 }
 
 /**
@@ -618,7 +724,7 @@ void c_sname_set_first_type( c_sname_t *sname, c_type_t const *type ) {
  */
 C_SNAME_H_INLINE
 void c_sname_set_local_type( c_sname_t *sname, c_type_t const *type ) {
-  c_scope_data( sname->tail )->type = *type;
+  c_sname_local_scope( sname )->type = *type;
 }
 
 /**
@@ -634,9 +740,8 @@ void c_sname_set_local_type( c_sname_t *sname, c_type_t const *type ) {
  */
 C_SNAME_H_INLINE
 void c_sname_set_scope_type( c_sname_t *sname, c_type_t const *type ) {
-  c_scope_data_t *const data = slist_atr( sname, 1 );
-  if ( data != NULL )
-    data->type = *type;
+  if ( sname->len > 1 )
+    c_sname_scopes( sname )[ sname->len - 2 ].type = *type;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -832,8 +832,8 @@ NODISCARD
 static char const* c_type_name_impl( c_type_t const *type,
                                      bool apply_explicit_ecsu, bool in_english,
                                      bool is_error ) {
-  static strbuf_t sbufs[3];
-  static unsigned buf_index;
+  static _Thread_local strbuf_t sbufs[3];
+  static _Thread_local unsigned buf_index;
 
   strbuf_t *const sbuf = &sbufs[ buf_index++ % ARRAY_SIZE( sbufs ) ];
   strbuf_reset( sbuf );
@@ -29,9 +29,14 @@
 #include "c_typedef.h"
 #include "c_ast.h"
 #include "c_lang.h"
+#include "c_sname.h"
+#include "c_typedef_gen.h"
+#include "cdecl_session.h"
 #include "decl_flags.h"
+#include "intern.h"
 #include "options.h"
 #include "parse.h"
+#include "slist.h"
 #include "util.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -39,6 +44,7 @@
 // standard
 #include <assert.h>
 #include <stddef.h>                     /* for NULL */
+#include <stdint.h>
 #include <stdlib.h>
 #include <sysexits.h>
 
@@ -79,12 +85,60 @@ struct tdef_rb_visit_data {
 };
 typedef struct tdef_rb_visit_data tdef_rb_visit_data_t;
 
-// local variables
-static c_lang_id_t  predef_lang_ids;    ///< Languages when predefining types.
-static rb_tree_t    typedef_set;        ///< Global set of `typedef`s.
+/**
+ * A slot in \ref tdef_hash.
+ */
+struct tdef_hash_slot {
+  c_typedef_t  *tdef;                   ///< The `typedef` or NULL if empty.
+  uint32_t      sname_hash;             ///< c_sname_hash() of its name.
+};
+typedef struct tdef_hash_slot tdef_hash_slot_t;
+
+/**
+ * A hash index of \ref c_typedefs::set for fast point look-ups by scoped name
+ * using open addressing with linear probing.
+ *
+ * @remarks The red-black tree is still needed for in-order traversal by
+ * c_typedef_visit().
+ */
+struct tdef_hash {
+  tdef_hash_slot_t *slots;              ///< Slots; size is a power of 2.
+  size_t            size;               ///< Number of slots.
+  size_t            len;                ///< Number of slots used.
+};
+typedef struct tdef_hash tdef_hash_t;
+
+/**
+ * The set of all `typedef`s of a \ref cdecl_session.
+ */
+struct c_typedefs {
+  rb_tree_t     set;                    ///< Set of `typedef`s.
+  tdef_hash_t   hash;                   ///< Hash index of \ref set.
+
+  /**
+   * BK-tree index of the full names of \ref set for "did you mean"
+   * suggestions.  It's built only when first needed by c_typedef_names() and
+   * kept up to date thereafter.
+   */
+  bk_tree_t     names;
+  bool          is_names_indexed;       ///< Has \ref names been built?
+
+  c_ast_arena_t predef_ast_arena;       ///< AST nodes of predefined types.
+  c_ast_arena_t user_ast_arena;         ///< AST nodes of user-defined types.
+  c_lang_id_t   predef_lang_ids;        ///< Languages when predefining types.
+#ifdef WITH_PREDEF_TABLE
+  /**
+   * If `true`, all predefined types from #C_TYPEDEF_PREDEF have been loaded
+   * into \ref set.
+   */
+  bool          predef_all_loaded;
+#endif /* WITH_PREDEF_TABLE */
+};
 
 ///////////////////////////////////////////////////////////////////////////////
 
+#ifndef WITH_PREDEF_TABLE
+
 /**
  * Predefined types for K&R C.
  *
@@ -977,21 +1031,22 @@ static predef_type_t const PREDEFINED_WIN32[] = {
   PT( NULL )
 };
 
+#endif /* WITH_PREDEF_TABLE */
+
 ////////// local functions ////////////////////////////////////////////////////
 
+#ifdef WITH_PREDEF_TABLE
 /**
- * Cleans up \ref c_typedef data.
+ * Frees \a tdef only if it's a user-defined type: predefined types are in
+ * #C_TYPEDEF_PREDEF and so were never allocated.
  *
- * @sa c_typedef_init()
+ * @param tdef The \ref c_typedef to free.
  */
-static void c_typedef_cleanup( void ) {
-  // There is no c_typedef_free() function because c_typedef_add() adds only
-  // c_typedef_t nodes pointing to pre-existing AST nodes.  The AST nodes are
-  // freed independently in parser_cleanup().  Hence, this function frees only
-  // the red-black tree, its nodes, and the c_typedef_t data each node points
-  // to, but not the AST nodes the c_typedef_t data points to.
-  rb_tree_cleanup( &typedef_set, &free );
+static void c_typedef_free_user( c_typedef_t *tdef ) {
+  if ( !tdef->is_predefined )
+    free( tdef );
 }
+#endif /* WITH_PREDEF_TABLE */
 
 /**
  * Comparison function for two \ref c_typedef.
@@ -1013,17 +1068,20 @@ static int c_typedef_cmp( c_typedef_t const *i_tdef,
 /**
  * Creates a new \ref c_typedef.
  *
+ * @param tdefs The \ref c_typedefs the new \ref c_typedef is for.
  * @param ast The AST of the type.
  * @param decl_flags The declaration flags to use; must only be one of
  * #C_ENG_DECL, #C_GIB_TYPEDEF, or #C_GIB_USING.
  * @return Returns said \ref c_typedef.
  */
 NODISCARD
-static c_typedef_t* c_typedef_new( c_ast_t const *ast, unsigned decl_flags ) {
+static c_typedef_t* c_typedef_new( c_typedefs_t const *tdefs,
+                                   c_ast_t const *ast, unsigned decl_flags ) {
+  assert( tdefs != NULL );
   assert( ast != NULL );
   assert( is_1_bit_only_in_set( decl_flags, C_TYPE_DECL_ANY ) );
 
-  bool const is_predefined = predef_lang_ids != LANG_NONE;
+  bool const is_predefined = tdefs->predef_lang_ids != LANG_NONE;
 
   c_typedef_t *const tdef = MALLOC( c_typedef_t, 1 );
   *tdef = (c_typedef_t){
@@ -1035,12 +1093,339 @@ static c_typedef_t* c_typedef_new( c_ast_t const *ast, unsigned decl_flags ) {
     // only in those language(s); otherwise we're defining a user-defined type
     // that's available in the current language and newer.
     //
-    .lang_ids = is_predefined ? predef_lang_ids : c_lang_and_newer( opt_lang )
+    .lang_ids = is_predefined ?
+      tdefs->predef_lang_ids : c_lang_and_newer( opt_lang )
   };
 
   return tdef;
 }
 
+/**
+ * Gets the index of the slot in \ref c_typedefs::hash either containing the
+ * \ref c_typedef having the scoped name \a sname or the empty slot where it
+ * would go.
+ *
+ * @param tdefs The \ref c_typedefs to use.
+ * @param sname The scoped name to find.
+ * @param sname_hash The c_sname_hash() of \a sname.
+ * @return Returns said index.
+ */
+NODISCARD
+static size_t tdef_hash_slot_idx( c_typedefs_t const *tdefs,
+                                  c_sname_t const *sname,
+                                  uint32_t sname_hash ) {
+  assert( tdefs->hash.size > 0 );
+  size_t const mask = tdefs->hash.size - 1;
+  for ( size_t i = sname_hash & mask; ; i = (i + 1) & mask ) {
+    tdef_hash_slot_t const *const slot = &tdefs->hash.slots[i];
+    if ( slot->tdef == NULL ||
+         ( slot->sname_hash == sname_hash &&
+           c_sname_cmp( sname, &slot->tdef->ast->sname ) == 0 ) ) {
+      return i;
+    }
+  } // for
+}
+
+/**
+ * Finds the \ref c_typedef having the scoped name \a sname in \ref
+ * c_typedefs::hash.
+ *
+ * @param tdefs The \ref c_typedefs to use.
+ * @param sname The scoped name to find.
+ * @param sname_hash The c_sname_hash() of \a sname.
+ * @return Returns a pointer to the \ref c_typedef or NULL if none.
+ */
+NODISCARD
+static c_typedef_t* tdef_hash_find( c_typedefs_t const *tdefs,
+                                    c_sname_t const *sname,
+                                    uint32_t sname_hash ) {
+  if ( tdefs->hash.size == 0 )
+    return NULL;
+  return tdefs->hash.slots[
+    tdef_hash_slot_idx( tdefs, sname, sname_hash )
+  ].tdef;
+}
+
+/**
+ * Inserts \a tdef into \ref c_typedefs::hash.
+ *
+ * @param tdefs The \ref c_typedefs to use.
+ * @param tdef The \ref c_typedef to insert.  A \ref c_typedef having the same
+ * scoped name must not already be present.
+ * @param sname_hash The c_sname_hash() of the scoped name of \a tdef.
+ */
+static void tdef_hash_insert( c_typedefs_t *tdefs, c_typedef_t *tdef,
+                              uint32_t sname_hash ) {
+  assert( tdefs != NULL );
+  assert( tdef != NULL );
+
+  if ( (tdefs->hash.len + 1) * 2 > tdefs->hash.size ) {
+    //
+    // Keep the load factor <= 0.5: double the number of slots and reinsert.
+    //
+    tdef_hash_t const old_hash = tdefs->hash;
+    tdefs->hash.size = old_hash.size == 0 ? 64 : old_hash.size * 2;
+    tdefs->hash.slots = MALLOC( tdef_hash_slot_t, tdefs->hash.size );
+    for ( size_t i = 0; i < tdefs->hash.size; ++i )
+      tdefs->hash.slots[i] = (tdef_hash_slot_t){ NULL, 0 };
+    for ( size_t i = 0; i < old_hash.size; ++i ) {
+      tdef_hash_slot_t const *const old_slot = &old_hash.slots[i];
+      if ( old_slot->tdef == NULL )
+        continue;
+      size_t j = old_slot->sname_hash & (tdefs->hash.size - 1);
+      while ( tdefs->hash.slots[j].tdef != NULL )
+        j = (j + 1) & (tdefs->hash.size - 1);
+      tdefs->hash.slots[j] = *old_slot;
+    } // for
+    free( old_hash.slots );
+  }
+
+  size_t const i = tdef_hash_slot_idx( tdefs, &tdef->ast->sname, sname_hash );
+  assert( tdefs->hash.slots[i].tdef == NULL );
+  tdefs->hash.slots[i] = (tdef_hash_slot_t){ tdef, sname_hash };
+  ++tdefs->hash.len;
+}
+
+/**
+ * Removes \a tdef from \ref c_typedefs::hash.
+ *
+ * @param tdefs The \ref c_typedefs to use.
+ * @param tdef The \ref c_typedef to remove.  It must be present.
+ */
+static void tdef_hash_remove( c_typedefs_t *tdefs, c_typedef_t const *tdef ) {
+  assert( tdefs != NULL );
+  assert( tdef != NULL );
+  size_t const mask = tdefs->hash.size - 1;
+  size_t i = tdef_hash_slot_idx(
+    tdefs, &tdef->ast->sname, c_sname_hash( &tdef->ast->sname )
+  );
+  assert( tdefs->hash.slots[i].tdef == tdef );
+
+  //
+  // Backward-shift deletion: move every subsequent entry in the same probe
+  // run whose home slot isn't cyclically in (i,j] into the hole.
+  //
+  for ( size_t j = i; ; ) {
+    j = (j + 1) & mask;
+    tdef_hash_slot_t const *const slot = &tdefs->hash.slots[j];
+    if ( slot->tdef == NULL )
+      break;
+    size_t const home = slot->sname_hash & mask;
+    if ( i <= j ? (i < home && home <= j) : (i < home || home <= j) )
+      continue;
+    tdefs->hash.slots[i] = *slot;
+    i = j;
+  } // for
+
+  tdefs->hash.slots[i] = (tdef_hash_slot_t){ NULL, 0 };
+  --tdefs->hash.len;
+}
+
+/**
+ * Inserts \a tdef into \ref c_typedefs::names.
+ *
+ * @param tdefs The \ref c_typedefs to use.
+ * @param tdef The \ref c_typedef to insert.
+ */
+static void tdef_names_insert( c_typedefs_t *tdefs, c_typedef_t const *tdef ) {
+  assert( tdefs != NULL );
+  assert( tdef != NULL );
+  bk_tree_insert(
+    &tdefs->names, c_sname_full_name( &tdef->ast->sname ),
+    (user_data_t){ .pc = tdef }
+  );
+}
+
+/**
+ * Removes \a tdef from \ref c_typedefs::names, if it's been built.
+ *
+ * @param tdefs The \ref c_typedefs to use.
+ * @param tdef The \ref c_typedef to remove.
+ */
+static void tdef_names_remove( c_typedefs_t *tdefs, c_typedef_t const *tdef ) {
+  assert( tdefs != NULL );
+  assert( tdef != NULL );
+  if ( tdefs->is_names_indexed ) {
+    PJL_IGNORE_RV(
+      bk_tree_remove( &tdefs->names, c_sname_full_name( &tdef->ast->sname ) )
+    );
+  }
+}
+
+/**
+ * Red-black tree visitor function that inserts every \ref c_typedef into \ref
+ * c_typedefs::names.
+ *
+ * @param node_data A pointer to the node's data.
+ * @param v_data A pointer to the \ref c_typedefs.
+ * @return Always returns `false`.
+ *
+ * @sa c_typedef_names()
+ */
+NODISCARD
+static bool rb_names_visitor( void *node_data, void *v_data ) {
+  tdef_names_insert( v_data, node_data );
+  return /*stop=*/false;
+}
+
+/**
+ * Inserts \a tdef into \ref c_typedefs::set and, if inserted, \ref
+ * c_typedefs::hash and \ref c_typedefs::names (if it's been built).
+ *
+ * @param tdefs The \ref c_typedefs to use.
+ * @param tdef The \ref c_typedef to insert.
+ * @param sname_hash The c_sname_hash() of the scoped name of \a tdef.
+ * @return Returns the same as rb_tree_insert().
+ */
+NODISCARD
+static rb_insert_rv_t typedef_set_insert( c_typedefs_t *tdefs,
+                                          c_typedef_t *tdef,
+                                          uint32_t sname_hash ) {
+  rb_insert_rv_t const rbi = rb_tree_insert( &tdefs->set, tdef );
+  if ( rbi.inserted ) {
+    tdef_hash_insert( tdefs, tdef, sname_hash );
+    if ( tdefs->is_names_indexed )
+      tdef_names_insert( tdefs, tdef );
+  }
+  return rbi;
+}
+
+#ifdef WITH_PREDEF_TABLE
+/**
+ * Checks whether \a predef should be loaded at all.
+ *
+ * @param predef The \ref c_typedef_predef to check.
+ * @return Returns `true` only if either \ref opt_typedefs is `true` or \a
+ * predef is required.
+ */
+NODISCARD
+static inline bool predef_is_enabled( c_typedef_predef_t const *predef ) {
+  return opt_typedefs || predef->is_required;
+}
+
+/**
+ * Finds the precompiled predefined type having the scoped name \a sname via
+ * #C_TYPEDEF_PREDEF_HASH.
+ *
+ * @param sname The scoped name to find.
+ * @param sname_hash The c_sname_hash() of \a sname.
+ * @return Returns a pointer to the \ref c_typedef_predef or NULL if none.
+ */
+NODISCARD
+static c_typedef_predef_t const* predef_find( c_sname_t const *sname,
+                                        uint32_t sname_hash ) {
+  size_t const mask = C_TYPEDEF_PREDEF_HASH_SIZE - 1;
+  for ( size_t i = sname_hash & mask; ; i = (i + 1) & mask ) {
+    c_typedef_predef_hash_t const *const slot = &C_TYPEDEF_PREDEF_HASH[i];
+    if ( slot->predef_idx == 0 )
+      return NULL;
+    if ( slot->sname_hash == sname_hash ) {
+      c_typedef_predef_t const *const predef =
+        &C_TYPEDEF_PREDEF[ slot->predef_idx - 1 ];
+      if ( c_sname_cmp( sname, &predef->tdef.ast->sname ) == 0 )
+        return predef;
+    }
+  } // for
+}
+
+/**
+ * Inserts \a predef into \a tdefs.
+ *
+ * @param tdefs The \ref c_typedefs to insert into.
+ * @param predef The \ref c_typedef_predef to insert.
+ * @param sname_hash The c_sname_hash() of the scoped name of \a predef.
+ * @return Returns the \ref rb_insert_rv.
+ */
+static rb_insert_rv_t predef_insert( c_typedefs_t *tdefs,
+                                     c_typedef_predef_t const *predef,
+                                     uint32_t sname_hash ) {
+  //
+  // The set holds non-const pointers since it owns user-defined types, but a
+  // predefined type is never written through it nor freed (see
+  // c_typedef_free_user()).
+  //
+  return typedef_set_insert(
+    tdefs, CONST_CAST( c_typedef_t*, &predef->tdef ), sname_hash
+  );
+}
+
+/**
+ * Interns every name used by #C_TYPEDEF_PREDEF as-is so they compare by
+ * pointer against `Y_NAME` tokens and user-defined types.
+ *
+ * @remarks #C_TYPEDEF_PREDEF is `const` and shared by all sessions, so its
+ * names are interned without being written: each is a separate `char` array
+ * and becomes the interned string itself.  Since this is called by
+ * c_typedef_predef_init() before any other string is interned, that's so for
+ * every name.
+ */
+static void predef_intern_all( void ) {
+  for ( size_t i = 0; i < C_TYPEDEF_PREDEF_NAME_SIZE; ++i )
+    PJL_IGNORE_RV( intern_static_str( C_TYPEDEF_PREDEF_NAME[i] ) );
+}
+
+/**
+ * Loads all precompiled predefined types from #C_TYPEDEF_PREDEF that haven't
+ * been loaded already.
+ *
+ * @param tdefs The \ref c_typedefs to load into.
+ *
+ * @sa load_predef_sname()
+ */
+static void load_predef_all( c_typedefs_t *tdefs ) {
+  if ( tdefs->predef_all_loaded )
+    return;
+  for ( size_t i = 0; i < C_TYPEDEF_PREDEF_HASH_SIZE; ++i ) {
+    c_typedef_predef_hash_t const *const slot = &C_TYPEDEF_PREDEF_HASH[i];
+    if ( slot->predef_idx == 0 )
+      continue;
+    c_typedef_predef_t const *const predef =
+      &C_TYPEDEF_PREDEF[ slot->predef_idx - 1 ];
+    if ( predef_is_enabled( predef ) ) {
+      // If it was loaded previously via load_predef_sname(), this does
+      // nothing.
+      PJL_IGNORE_RV( predef_insert( tdefs, predef, slot->sname_hash ) );
+    }
+  } // for
+  tdefs->predef_all_loaded = true;
+}
+
+/**
+ * Loads the precompiled predefined type from #C_TYPEDEF_PREDEF having the
+ * scoped name \a sname, if any, regardless of language.
+ *
+ * @remarks At start-up, #C_TYPEDEF_PREDEF serves as an index of only the
+ * names and languages of all predefined types.  Each type is loaded into \ref
+ * c_typedefs::set only when it's first looked up.
+ * @par
+ * Types are deliberately loaded per name rather than per language: a type
+ * must be found even when it's not available in the current language so that
+ * the user gets, say, "unsupported type until C11" rather than an unknown
+ * name.
+ * Changing the current language therefore needs to load nothing.
+ *
+ * @param tdefs The \ref c_typedefs to load into.
+ * @param sname The scoped name of the type to load.
+ * @param sname_hash The c_sname_hash() of \a sname.
+ * @return Returns a pointer to the newly loaded \ref c_typedef or NULL if
+ * none.
+ *
+ * @sa load_predef_all()
+ */
+static c_typedef_t const* load_predef_sname( c_typedefs_t *tdefs,
+                                             c_sname_t const *sname,
+                                             uint32_t sname_hash ) {
+  assert( tdefs != NULL );
+  assert( sname != NULL );
+  if ( tdefs->predef_all_loaded )
+    return NULL;
+  c_typedef_predef_t const *const predef = predef_find( sname, sname_hash );
+  if ( predef == NULL || !predef_is_enabled( predef ) )
+    return NULL;
+  rb_insert_rv_t const rbi = predef_insert( tdefs, predef, sname_hash );
+  return rbi.inserted ? &predef->tdef : NULL;
+}
+#else
 /**
  * Parses an array of predefined type declarations.
  *
@@ -1054,6 +1439,7 @@ static void parse_predef_types( predef_type_t const types[static const 2] ) {
       INTERNAL_ERROR( "failed parsing type predefined on line %u\n", pt->line );
   } // for
 }
+#endif /* WITH_PREDEF_TABLE */
 
 /**
  * Red-black tree visitor function that forwards to the \ref
@@ -1075,15 +1461,52 @@ static bool rb_visitor( void *node_data, void *v_data ) {
   return (*trvd->visit_fn)( tdef, trvd->v_data );
 }
 
+/**
+ * Red-black tree visitor function that collects every user-defined \ref
+ * c_typedef.
+ *
+ * @param node_data A pointer to the node's data.
+ * @param v_data A pointer to the \ref slist to append to.
+ * @return Always returns `false`.
+ *
+ * @sa c_typedefs_reset()
+ */
+NODISCARD
+static bool rb_user_visitor( void *node_data, void *v_data ) {
+  assert( node_data != NULL );
+  assert( v_data != NULL );
+
+  c_typedef_t *const tdef = node_data;
+  if ( !tdef->is_predefined )
+    slist_push_back( v_data, tdef );
+  return /*stop=*/false;
+}
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 rb_node_t* c_typedef_add( c_ast_t const *ast, unsigned decl_flags ) {
   assert( ast != NULL );
   assert( !c_sname_empty( &ast->sname ) );
 
-  c_typedef_t *const new_tdef = c_typedef_new( ast, decl_flags );
-  rb_insert_rv_t const rbi = rb_tree_insert( &typedef_set, new_tdef );
-  if ( !rbi.inserted ) {
+  c_typedefs_t *const tdefs = cdecl_session->typedefs;
+  uint32_t const sname_hash = c_sname_hash( &ast->sname );
+
+#ifdef WITH_PREDEF_TABLE
+  //
+  // A predefined type having the same name must be found even if it hasn't
+  // been loaded yet.
+  //
+  if ( tdef_hash_find( tdefs, &ast->sname, sname_hash ) == NULL )
+    PJL_IGNORE_RV( load_predef_sname( tdefs, &ast->sname, sname_hash ) );
+#endif /* WITH_PREDEF_TABLE */
+
+  c_typedef_t *const new_tdef = c_typedef_new( tdefs, ast, decl_flags );
+  rb_insert_rv_t const rbi =
+    typedef_set_insert( tdefs, new_tdef, sname_hash );
+  if ( rbi.inserted ) {
+    ++cdecl_session->gen;               // invalidate the result cache
+  }
+  else {
     //
     // A typedef with the same name exists, so we don't need the new one.
     //
@@ -1092,6 +1515,23 @@ rb_node_t* c_typedef_add( c_ast_t const *ast, unsigned decl_flags ) {
   return rbi.node;
 }
 
+c_ast_arena_t* c_typedef_ast_arena( bool is_predefined ) {
+  c_typedefs_t *const tdefs = cdecl_session->typedefs;
+  return is_predefined ? &tdefs->predef_ast_arena : &tdefs->user_ast_arena;
+}
+
+bk_tree_t const* c_typedef_names( void ) {
+  c_typedefs_t *const tdefs = cdecl_session->typedefs;
+#ifdef WITH_PREDEF_TABLE
+  load_predef_all( tdefs );
+#endif /* WITH_PREDEF_TABLE */
+  if ( !tdefs->is_names_indexed ) {
+    PJL_IGNORE_RV( rb_tree_visit( &tdefs->set, &rb_names_visitor, tdefs ) );
+    tdefs->is_names_indexed = true;
+  }
+  return &tdefs->names;
+}
+
 c_typedef_t const* c_typedef_find_name( char const *name ) {
   assert( name != NULL );
   c_sname_t sname;
@@ -1105,19 +1545,29 @@ c_typedef_t const* c_typedef_find_name( char const *name ) {
 
 c_typedef_t const* c_typedef_find_sname( c_sname_t const *sname ) {
   assert( sname != NULL );
-  c_typedef_t const tdef = C_TYPEDEF_LIT(
-    &(c_ast_t const){ .sname = *sname },
-    /*decl_flags=*/0                    // doesn't matter
-  );
-  rb_node_t const *const found_rb = rb_tree_find( &typedef_set, &tdef );
-  return found_rb != NULL ? found_rb->data : NULL;
+  c_typedefs_t *const tdefs = cdecl_session->typedefs;
+  uint32_t const sname_hash = c_sname_hash( sname );
+  c_typedef_t const *const tdef = tdef_hash_find( tdefs, sname, sname_hash );
+#ifdef WITH_PREDEF_TABLE
+  if ( tdef == NULL )
+    return load_predef_sname( tdefs, sname, sname_hash );
+#endif /* WITH_PREDEF_TABLE */
+  return tdef;
 }
 
 void c_typedef_init( void ) {
-  ASSERT_RUN_ONCE();
-
-  rb_tree_init( &typedef_set, POINTER_CAST( rb_cmp_fn_t, &c_typedef_cmp ) );
-  ATEXIT( &c_typedef_cleanup );
+#ifdef WITH_PREDEF_TABLE
+  //
+  // Nothing to do: predefined types are loaded from C_TYPEDEF_PREDEF only when
+  // first looked up or visited.
+  //
+#else
+  //
+  // Without the table, there's no index of predefined names to load from on
+  // first use and a type can't be parsed then either since look-ups happen in
+  // the middle of a parse, so parse all of them now.
+  //
+  c_typedefs_t *const tdefs = cdecl_session->typedefs;
 
 #ifdef ENABLE_CDECL_DEBUG
   //
@@ -1130,7 +1580,7 @@ void c_typedef_init( void ) {
   //
   // Temporarily turn off Flex debug output for built-in typedefs.
   //
-  int const orig_flex_debug = opt_flex_debug;
+  bool const orig_flex_debug = opt_flex_debug;
   opt_flex_debug = false;
 #endif /* ENABLE_FLEX_DEBUG */
 #ifdef ENABLE_BISON_DEBUG
@@ -1150,36 +1600,36 @@ void c_typedef_init( void ) {
     //
     opt_lang = LANG_C_NEW;
 
-    predef_lang_ids = LANG_MIN(C_KNR);
+    tdefs->predef_lang_ids = LANG_MIN(C_KNR);
     parse_predef_types( PREDEFINED_KNR_C );
 
-    predef_lang_ids = LANG_MIN(C_89);
+    tdefs->predef_lang_ids = LANG_MIN(C_89);
     parse_predef_types( PREDEFINED_STD_C_89 );
     parse_predef_types( PREDEFINED_FLOATING_POINT_EXTENSIONS );
     parse_predef_types( PREDEFINED_GNU_C );
 
-    predef_lang_ids = LANG_MIN(C_95);
+    tdefs->predef_lang_ids = LANG_MIN(C_95);
     parse_predef_types( PREDEFINED_STD_C_95 );
     parse_predef_types( PREDEFINED_PTHREAD_H );
     parse_predef_types( PREDEFINED_WIN32 );
 
-    predef_lang_ids = LANG_MIN(C_99);
+    tdefs->predef_lang_ids = LANG_MIN(C_99);
     parse_predef_types( PREDEFINED_STD_C_99 );
 
     // However, Embedded C extensions are available only in C99.
     opt_lang = LANG_C_99;
-    predef_lang_ids = LANG_C_99;
+    tdefs->predef_lang_ids = LANG_C_99;
     parse_predef_types( PREDEFINED_EMBEDDED_C );
     opt_lang = LANG_C_NEW;
 
     // Must be defined after C99.
-    predef_lang_ids = LANG_MIN(C_89);
+    tdefs->predef_lang_ids = LANG_MIN(C_89);
     parse_predef_types( PREDEFINED_MISC );
 
-    predef_lang_ids = LANG_MIN(C_11);
+    tdefs->predef_lang_ids = LANG_MIN(C_11);
     parse_predef_types( PREDEFINED_STD_C_11 );
 
-    predef_lang_ids = LANG_MIN(C_23);
+    tdefs->predef_lang_ids = LANG_MIN(C_23);
     parse_predef_types( PREDEFINED_STD_C_23 );
   }
 
@@ -1190,26 +1640,34 @@ void c_typedef_init( void ) {
   opt_lang = LANG_CPP_NEW;
 
   if ( opt_typedefs ) {
-    predef_lang_ids = LANG_MIN(CPP_OLD);
+    tdefs->predef_lang_ids = LANG_MIN(CPP_OLD);
     parse_predef_types( PREDEFINED_STD_CPP );
 
-    predef_lang_ids = LANG_MIN(CPP_11);
+    tdefs->predef_lang_ids = LANG_MIN(CPP_11);
     parse_predef_types( PREDEFINED_STD_CPP_11 );
 
-    predef_lang_ids = LANG_MIN(CPP_17);
+    tdefs->predef_lang_ids = LANG_MIN(CPP_17);
     parse_predef_types( PREDEFINED_STD_CPP_17 );
 
-    predef_lang_ids = LANG_MIN(CPP_20);
+    tdefs->predef_lang_ids = LANG_MIN(CPP_20);
     parse_predef_types( PREDEFINED_STD_CPP_20 );
 
-    predef_lang_ids = LANG_MIN(CPP_23);
+    tdefs->predef_lang_ids = LANG_MIN(CPP_23);
     parse_predef_types( PREDEFINED_STD_CPP_23 );
   }
 
-  predef_lang_ids = LANG_MIN(CPP_20);
+#ifdef CDECL_PREDEF_GEN
+  c_typedef_gen_group( /*is_required=*/false );
+#endif /* CDECL_PREDEF_GEN */
+
+  tdefs->predef_lang_ids = LANG_MIN(CPP_20);
   parse_predef_types( PREDEFINED_STD_CPP_20_REQUIRED );
 
-  predef_lang_ids = LANG_NONE;
+#ifdef CDECL_PREDEF_GEN
+  c_typedef_gen_group( /*is_required=*/true );
+#endif /* CDECL_PREDEF_GEN */
+
+  tdefs->predef_lang_ids = LANG_NONE;
   opt_lang = orig_lang;
 
 #ifdef ENABLE_CDECL_DEBUG
@@ -1221,20 +1679,91 @@ void c_typedef_init( void ) {
 #ifdef ENABLE_BISON_DEBUG
   opt_bison_debug = orig_bison_debug;
 #endif /* ENABLE_BISON_DEBUG */
+#endif /* WITH_PREDEF_TABLE */
+}
+
+void c_typedef_predef_init( void ) {
+  ASSERT_RUN_ONCE();
+#ifdef WITH_PREDEF_TABLE
+  predef_intern_all();
+#endif /* WITH_PREDEF_TABLE */
 }
 
 c_typedef_t* c_typedef_remove( rb_node_t *node ) {
-  return rb_tree_delete( &typedef_set, node );
+  c_typedefs_t *const tdefs = cdecl_session->typedefs;
+  c_typedef_t *const tdef = rb_tree_delete( &tdefs->set, node );
+  tdef_hash_remove( tdefs, tdef );
+  tdef_names_remove( tdefs, tdef );
+  ++cdecl_session->gen;                 // invalidate the result cache
+  return tdef;
 }
 
 c_typedef_t const* c_typedef_visit( c_typedef_visit_fn_t visit_fn,
                                     void *v_data ) {
   assert( visit_fn != NULL );
+  c_typedefs_t *const tdefs = cdecl_session->typedefs;
+#ifdef WITH_PREDEF_TABLE
+  //
+  // Visitors, e.g., "show" or "did you mean," may want any predefined type,
+  // so load all of them that haven't been looked up yet.
+  //
+  load_predef_all( tdefs );
+#endif /* WITH_PREDEF_TABLE */
   tdef_rb_visit_data_t trvd = { visit_fn, v_data };
-  rb_node_t const *const rb = rb_tree_visit( &typedef_set, &rb_visitor, &trvd );
+  rb_node_t const *const rb = rb_tree_visit( &tdefs->set, &rb_visitor, &trvd );
   return rb != NULL ? rb->data : NULL;
 }
 
+void c_typedefs_free( c_typedefs_t *tdefs ) {
+  if ( tdefs == NULL )
+    return;
+  // There is no c_typedef_free() function because c_typedef_add() adds only
+  // c_typedef_t nodes pointing to pre-existing AST nodes.  The AST nodes are
+  // freed independently via the arenas below.  Hence, this function frees
+  // only the red-black tree, its nodes, and the c_typedef_t data each node
+  // points to, then the arenas.
+#ifdef WITH_PREDEF_TABLE
+  rb_tree_cleanup(
+    &tdefs->set, POINTER_CAST( rb_free_fn_t, &c_typedef_free_user )
+  );
+#else
+  rb_tree_cleanup( &tdefs->set, &free );
+#endif /* WITH_PREDEF_TABLE */
+  free( tdefs->hash.slots );
+  bk_tree_cleanup( &tdefs->names );
+  c_ast_arena_cleanup( &tdefs->predef_ast_arena );
+  c_ast_arena_cleanup( &tdefs->user_ast_arena );
+  free( tdefs );
+}
+
+c_typedefs_t* c_typedefs_new( void ) {
+  c_typedefs_t *const tdefs = MALLOC( c_typedefs_t, 1 );
+  MEM_ZERO( tdefs );
+  rb_tree_init( &tdefs->set, POINTER_CAST( rb_cmp_fn_t, &c_typedef_cmp ) );
+  return tdefs;
+}
+
+void c_typedefs_reset( c_typedefs_t *tdefs ) {
+  assert( tdefs != NULL );
+
+  slist_t user_list;
+  slist_init( &user_list );
+  PJL_IGNORE_RV(
+    rb_tree_visit( &tdefs->set, &rb_user_visitor, &user_list )
+  );
+
+  for ( c_typedef_t *tdef; (tdef = slist_pop_front( &user_list )) != NULL; ) {
+    rb_node_t *const node = rb_tree_find( &tdefs->set, tdef );
+    assert( node != NULL );
+    PJL_IGNORE_RV( rb_tree_delete( &tdefs->set, node ) );
+    tdef_hash_remove( tdefs, tdef );
+    tdef_names_remove( tdefs, tdef );
+    free( tdef );
+  } // for
+
+  c_ast_arena_reset( &tdefs->user_ast_arena );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
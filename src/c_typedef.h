@@ -29,6 +29,7 @@
 
 // local
 #include "pjl_config.h"                 /* must go first */
+#include "bk_tree.h"
 #include "red_black.h"
 #include "types.h"
 
@@ -81,7 +82,7 @@ typedef bool (*c_typedef_visit_fn_t)( c_typedef_t const *tdef, void *v_data );
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
- * Adds a new `typedef` (or `using`) to the global set.
+ * Adds a new `typedef` (or `using`) to the current \ref cdecl_session.
  *
  * @param type_ast The AST of the type to add.  Ownership is taken only if the
  * type was added.
@@ -98,6 +99,19 @@ typedef bool (*c_typedef_visit_fn_t)( c_typedef_t const *tdef, void *v_data );
 NODISCARD
 rb_node_t* c_typedef_add( c_ast_t const *type_ast, unsigned decl_flags );
 
+/**
+ * Gets the \ref c_ast_arena from which the AST nodes of `typedef`s of the
+ * current \ref cdecl_session are to be allocated.
+ *
+ * @param is_predefined If `true`, gets the arena for predefined types; if
+ * `false`, gets the arena for user-defined types.
+ * @return Returns said arena.
+ *
+ * @sa c_typedefs_reset()
+ */
+NODISCARD
+c_ast_arena_t* c_typedef_ast_arena( bool is_predefined );
+
 /**
  * Gets the \ref c_typedef for \a name.
  *
@@ -123,14 +137,47 @@ NODISCARD
 c_typedef_t const* c_typedef_find_sname( c_sname_t const *sname );
 
 /**
- * Initializes all \ref c_typedef data.
+ * Initializes the predefined types of the current \ref cdecl_session.
+ *
+ * @remarks When built with the precompiled table (the default), this does
+ * nothing per session: each predefined type is loaded only when first looked
+ * up or visited.  When configured with `--disable-predef-table`, however, all
+ * predefined types are parsed and loaded here since they can't be parsed on
+ * first use: the look-up happens from within the lexer in the middle of a
+ * parse by the session's only parser.
  *
- * @note This function must be called exactly once.
+ * @note This function must be called exactly once per session.
+ *
+ * @sa c_typedefs_new()
  */
 void c_typedef_init( void );
 
 /**
- * Removes a `typedef` (or `using`) from the global set.
+ * Gets the BK-tree index of the full names of all \ref c_typedef of the
+ * current \ref cdecl_session for "did you mean" suggestions.
+ *
+ * @remarks The index is built when this function is first called for the
+ * session and is updated incrementally as types are added or removed
+ * thereafter.
+ *
+ * @return Returns said index.  The \ref user_data::pc "pc" of each node's user
+ * data points to its \ref c_typedef.
+ */
+NODISCARD
+bk_tree_t const* c_typedef_names( void );
+
+/**
+ * Initializes the predefined types data shared by all sessions.
+ *
+ * @note This function must be called exactly once before any session is
+ * created and before any other thread is started.
+ *
+ * @sa c_typedef_init()
+ */
+void c_typedef_predef_init( void );
+
+/**
+ * Removes a `typedef` (or `using`) from the current \ref cdecl_session.
  *
  * @param node The rb_node containing the `typedef` to remove.
  * @return Returns the removed `typedef`.  The caller is responsible for
@@ -153,6 +200,38 @@ PJL_DISCARD
 c_typedef_t const* c_typedef_visit( c_typedef_visit_fn_t visit_fn,
                                     void *v_data );
 
+/**
+ * Frees all memory used by \a tdefs including all AST nodes of its types.
+ *
+ * @param tdefs The \ref c_typedefs to free.  If NULL, does nothing.
+ *
+ * @sa c_typedefs_new()
+ */
+void c_typedefs_free( c_typedefs_t *tdefs );
+
+/**
+ * Creates a new, empty set of `typedef`s.
+ *
+ * @return Returns said set.  The caller is responsible for freeing it via
+ * c_typedefs_free().
+ *
+ * @sa c_typedef_init()
+ * @sa c_typedefs_free()
+ */
+NODISCARD
+c_typedefs_t* c_typedefs_new( void );
+
+/**
+ * Removes all user-defined types from \a tdefs, but keeps all predefined
+ * types.
+ *
+ * @param tdefs The \ref c_typedefs to reset.
+ *
+ * @warning All pointers to AST nodes of user-defined types are invalid upon
+ * return.
+ */
+void c_typedefs_reset( c_typedefs_t *tdefs );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
@@ -0,0 +1,854 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/c_typedef_gen.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for emitting the C source code of the table of
+ * precompiled predefined types.
+ *
+ * @remarks This file is compiled only into the build-time generator program,
+ * never into **cdecl** itself.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "c_typedef_gen.h"
+#include "c_ast.h"
+#include "c_kind.h"
+#include "c_sname.h"
+#include "c_typedef.h"
+#include "cdecl.h"
+#include "red_black.h"
+#include "sink.h"
+#include "slist.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+/// @endcond
+
+/**
+ * @addtogroup c-typedef-gen-group
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The name prefix of each emitted `char` array of a name.
+ */
+#define GEN_NAME_ARRAY            "predef_name"
+
+/**
+ * The name prefix of each emitted array of \ref c_scope_data for a \ref
+ * c_sname having more than #C_SNAME_INLINE_SIZE scopes.
+ */
+#define GEN_SCOPE_ARRAY           "predef_scope"
+
+/**
+ * The name of the emitted array of \ref slist_node.
+ */
+#define GEN_NODE_ARRAY            "predef_node"
+
+/**
+ * The name of the emitted array of \ref c_ast.
+ */
+#define GEN_AST_ARRAY             "predef_ast"
+
+/**
+ * Maps a pointer to the index of the element it will be emitted as.
+ */
+struct gen_ptr {
+  void const *ptr;                      ///< The pointer.
+  size_t      idx;                      ///< Index into its emitted array.
+};
+typedef struct gen_ptr gen_ptr_t;
+
+/**
+ * A set of pointers all of the same type and their emitted indices.
+ */
+struct gen_ptr_set {
+  rb_tree_t   tree;                     ///< Maps pointers to \ref gen_ptr.
+  slist_t     list;                     ///< Pointers in index order.
+};
+typedef struct gen_ptr_set gen_ptr_set_t;
+
+// local functions
+static void gen_visit_ast( c_ast_t const* );
+
+// local variables
+static gen_ptr_set_t  gen_ast_set;      ///< All AST nodes.
+static gen_ptr_set_t  gen_name_set;     ///< All (interned) names.
+static gen_ptr_set_t  gen_node_set;     ///< All list nodes.
+static gen_ptr_set_t  gen_required_set; ///< Required predefined types.
+static gen_ptr_set_t  gen_sname_set;    ///< All snames too big to be inline.
+static gen_ptr_set_t  gen_seen_set;     ///< Predefined types seen so far.
+static slist_t        gen_tdef_list;    ///< Emitted predefined types.
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Compares two \ref gen_ptr by their pointers.
+ *
+ * @param i_gp The first \ref gen_ptr.
+ * @param j_gp The second \ref gen_ptr.
+ * @return Returns a number less than 0, 0, or greater than 0 if \a i_gp is
+ * less than, equal to, or greater than \a j_gp, respectively.
+ */
+NODISCARD
+static int gen_ptr_cmp( gen_ptr_t const *i_gp, gen_ptr_t const *j_gp ) {
+  uintptr_t const i = POINTER_CAST( uintptr_t, i_gp->ptr );
+  uintptr_t const j = POINTER_CAST( uintptr_t, j_gp->ptr );
+  return (i > j) - (i < j);
+}
+
+/**
+ * Adds \a ptr to \a set, if it's not there already.
+ *
+ * @param set The \ref gen_ptr_set to add to.
+ * @param ptr The pointer to add.
+ * @return Returns `true` only if \a ptr was added.
+ */
+static bool gen_ptr_add( gen_ptr_set_t *set, void const *ptr ) {
+  assert( set != NULL );
+  assert( ptr != NULL );
+
+  gen_ptr_t *const gp = MALLOC( gen_ptr_t, 1 );
+  *gp = (gen_ptr_t){ ptr, set->list.len };
+  rb_insert_rv_t const rbi = rb_tree_insert( &set->tree, gp );
+  if ( !rbi.inserted ) {
+    FREE( gp );
+    return false;
+  }
+  slist_push_back( &set->list, CONST_CAST( void*, ptr ) );
+  return true;
+}
+
+/**
+ * Cleans up \a set.
+ *
+ * @param set The \ref gen_ptr_set to clean up.
+ */
+static void gen_ptr_cleanup( gen_ptr_set_t *set ) {
+  assert( set != NULL );
+  rb_tree_cleanup( &set->tree, &free );
+  slist_cleanup( &set->list, /*free_fn=*/NULL );
+}
+
+/**
+ * Gets the index of \a ptr within \a set.
+ *
+ * @param set The \ref gen_ptr_set to look in.
+ * @param ptr The pointer to look up; must be in \a set.
+ * @return Returns said index.
+ */
+NODISCARD
+static size_t gen_ptr_idx( gen_ptr_set_t const *set, void const *ptr ) {
+  assert( set != NULL );
+  assert( ptr != NULL );
+  rb_node_t const *const found_rb =
+    rb_tree_find( &set->tree, &(gen_ptr_t){ ptr, 0 } );
+  assert( found_rb != NULL );
+  gen_ptr_t const *const gp = found_rb->data;
+  return gp->idx;
+}
+
+/**
+ * Initializes \a set.
+ *
+ * @param set The \ref gen_ptr_set to initialize.
+ */
+static void gen_ptr_init( gen_ptr_set_t *set ) {
+  assert( set != NULL );
+  rb_tree_init( &set->tree, POINTER_CAST( rb_cmp_fn_t, &gen_ptr_cmp ) );
+  slist_init( &set->list );
+}
+
+/**
+ * Checks whether \a ptr is in \a set.
+ *
+ * @param set The \ref gen_ptr_set to look in.
+ * @param ptr The pointer to look up.
+ * @return Returns `true` only if \a ptr is in \a set.
+ */
+NODISCARD
+static bool gen_ptr_in( gen_ptr_set_t const *set, void const *ptr ) {
+  return rb_tree_find( &set->tree, &(gen_ptr_t){ ptr, 0 } ) != NULL;
+}
+
+/**
+ * Emits a reference to \a ast, i.e., either `NULL` or the address (via the
+ * emitted `AST()` macro) of its element in the emitted array of \ref c_ast.
+ *
+ * @param ast The AST to emit a reference to.  May be NULL.
+ * @param fout The `FILE` to emit to.
+ */
+static void gen_emit_ast_ref( c_ast_t const *ast, FILE *fout ) {
+  if ( ast == NULL )
+    FPUTS( "NULL", fout );
+  else
+    FPRINTF( fout, "AST(%zu)", gen_ptr_idx( &gen_ast_set, ast ) );
+}
+
+/**
+ * Emits \a list as an \ref slist initializer.
+ *
+ * @param list The list to emit.
+ * @param fout The `FILE` to emit to.
+ */
+static void gen_emit_list( slist_t const *list, FILE *fout ) {
+  assert( list != NULL );
+  if ( slist_empty( list ) ) {
+    FPUTS( "{ NULL, NULL, 0 }", fout );
+    return;
+  }
+  FPRINTF( fout,
+    "{ NODE(%zu), NODE(%zu), %zu }",
+    gen_ptr_idx( &gen_node_set, list->head ),
+    gen_ptr_idx( &gen_node_set, list->tail ),
+    list->len
+  );
+}
+
+/**
+ * Emits a reference to \a name, i.e., either `NULL` or its emitted `char`
+ * array.
+ *
+ * @param name The name to emit a reference to.  May be NULL.
+ * @param fout The `FILE` to emit to.
+ *
+ * @sa gen_emit_name_array()
+ */
+static void gen_emit_name_ref( char const *name, FILE *fout ) {
+  if ( name == NULL )
+    FPUTS( "NULL", fout );
+  else
+    FPRINTF( fout, GEN_NAME_ARRAY "_%zu", gen_ptr_idx( &gen_name_set, name ) );
+}
+
+/**
+ * Emits the `char` array of \a name as a C string literal.
+ *
+ * @param name The name to emit.
+ * @param fout The `FILE` to emit to.
+ *
+ * @sa gen_emit_name_ref()
+ */
+static void gen_emit_name_array( char const *name, FILE *fout ) {
+  assert( name != NULL );
+  FPRINTF( fout, "static char const " GEN_NAME_ARRAY "_%zu[] = \"",
+    gen_ptr_idx( &gen_name_set, name )
+  );
+  for ( char const *s = name; *s != '\0'; ++s ) {
+    if ( *s == '"' || *s == '\\' )
+      FPUTC( '\\', fout );
+    FPUTC( *s, fout );
+  } // for
+  FPUTS( "\";\n", fout );
+}
+
+/**
+ * Emits \a type as a \ref c_type initializer.
+ *
+ * @param type The type to emit.
+ * @param fout The `FILE` to emit to.
+ */
+static void gen_emit_type( c_type_t const *type, FILE *fout ) {
+  assert( type != NULL );
+  FPRINTF( fout,
+    "{ UINT64_C(0x%" PRIX64 "), UINT64_C(0x%" PRIX64 "), "
+    "UINT64_C(0x%" PRIX64 ") }",
+    type->btids, type->stids, type->atids
+  );
+}
+
+/**
+ * Emits \a data as a \ref c_scope_data initializer.
+ *
+ * @param data The scope data to emit.
+ * @param fout The `FILE` to emit to.
+ */
+static void gen_emit_scope( c_scope_data_t const *data, FILE *fout ) {
+  assert( data != NULL );
+  FPUTS( "{ ", fout );
+  gen_emit_name_ref( data->name, fout );
+  FPUTS( ", ", fout );
+  gen_emit_type( &data->type, fout );
+  FPUTS( " }", fout );
+}
+
+/**
+ * Emits \a sname as a \ref c_sname initializer.
+ *
+ * @param sname The scoped name to emit.
+ * @param fout The `FILE` to emit to.
+ *
+ * @sa gen_emit_sname_scopes()
+ */
+static void gen_emit_sname( c_sname_t const *sname, FILE *fout ) {
+  assert( sname != NULL );
+
+  if ( sname->len > C_SNAME_INLINE_SIZE ) {
+    //
+    // The scopes are in their own static array, so the "heap" capacity is
+    // just the length.  (Predefined types are never cleaned up, so the array
+    // is never freed.)
+    //
+    FPRINTF( fout,
+      "{ .len = %u, .cap = %u, "
+      ".heap_scopes = CONST_CAST( c_scope_data_t*, " GEN_SCOPE_ARRAY "_%zu ) }",
+      sname->len, sname->len, gen_ptr_idx( &gen_sname_set, sname )
+    );
+    return;
+  }
+
+  FPRINTF( fout, "{ .len = %u", sname->len );
+  if ( !c_sname_empty( sname ) ) {
+    FPUTS( ", .inline_scopes = {", fout );
+    FOREACH_SNAME_SCOPE( scope, sname ) {
+      FPUTC( ' ', fout );
+      gen_emit_scope( scope, fout );
+      FPUTC( ',', fout );
+    } // for
+    FPUTS( " }", fout );
+  }
+  FPUTS( " }", fout );
+}
+
+/**
+ * Emits the static array of scopes of \a sname that has more than
+ * #C_SNAME_INLINE_SIZE scopes.
+ *
+ * @param sname The scoped name to emit the scopes of.
+ * @param fout The `FILE` to emit to.
+ *
+ * @sa gen_emit_sname()
+ */
+static void gen_emit_sname_scopes( c_sname_t const *sname, FILE *fout ) {
+  assert( sname != NULL );
+  FPRINTF( fout,
+    "\nstatic c_scope_data_t const " GEN_SCOPE_ARRAY "_%zu[] = {\n",
+    gen_ptr_idx( &gen_sname_set, sname )
+  );
+  FOREACH_SNAME_SCOPE( scope, sname ) {
+    FPUTS( "  ", fout );
+    gen_emit_scope( scope, fout );
+    FPUTS( ",\n", fout );
+  } // for
+  FPUTS( "};\n", fout );
+}
+
+/**
+ * Emits the kind-specific union member of \a ast.
+ *
+ * @param ast The AST to emit the union member of.
+ * @param fout The `FILE` to emit to.
+ * @return Returns `true` only if \a ast is of a kind that can be emitted.
+ */
+NODISCARD
+static bool gen_emit_ast_union( c_ast_t const *ast, FILE *fout ) {
+  assert( ast != NULL );
+
+  switch ( ast->kind ) {
+    case K_NAME:
+    case K_PLACEHOLDER:
+    case K_VARIADIC:
+      return true;
+
+    case K_APPLE_BLOCK:
+      FPUTS( "    .block = { .ret_ast = ", fout );
+      gen_emit_ast_ref( ast->block.ret_ast, fout );
+      FPUTS( ", .param_ast_list = ", fout );
+      gen_emit_list( &ast->block.param_ast_list, fout );
+      FPUTS( " },\n", fout );
+      return true;
+
+    case K_ARRAY:
+      FPUTS( "    .array = { .of_ast = ", fout );
+      gen_emit_ast_ref( ast->array.of_ast, fout );
+      FPRINTF( fout, ", .kind = %u", STATIC_CAST( unsigned, ast->array.kind ) );
+      switch ( ast->array.kind ) {
+        case C_ARRAY_EMPTY_SIZE:
+        case C_ARRAY_VLA_STAR:
+          break;
+        case C_ARRAY_INT_SIZE:
+          FPRINTF( fout, ", .size_int = %u", ast->array.size_int );
+          break;
+        case C_ARRAY_NAMED_SIZE:
+          FPUTS( ", .size_name = ", fout );
+          gen_emit_name_ref( ast->array.size_name, fout );
+          break;
+      } // switch
+      FPUTS( " },\n", fout );
+      return true;
+
+    case K_BUILTIN:
+      FPRINTF( fout,
+        "    .builtin = { .bit_width = %u, .BitInt = { .width = %u } },\n",
+        ast->builtin.bit_width, ast->builtin.BitInt.width
+      );
+      return true;
+
+    case K_CLASS_STRUCT_UNION:
+      FPUTS( "    .csu = { .csu_sname = ", fout );
+      gen_emit_sname( &ast->csu.csu_sname, fout );
+      FPUTS( " },\n", fout );
+      return true;
+
+    case K_ENUM:
+      FPUTS( "    .enum_ = { .of_ast = ", fout );
+      gen_emit_ast_ref( ast->enum_.of_ast, fout );
+      FPRINTF( fout, ", .bit_width = %u, .enum_sname = ",
+        ast->enum_.bit_width
+      );
+      gen_emit_sname( &ast->enum_.enum_sname, fout );
+      FPUTS( " },\n", fout );
+      return true;
+
+    case K_FUNCTION:
+      FPUTS( "    .func = { .ret_ast = ", fout );
+      gen_emit_ast_ref( ast->func.ret_ast, fout );
+      FPUTS( ", .param_ast_list = ", fout );
+      gen_emit_list( &ast->func.param_ast_list, fout );
+      FPRINTF( fout, ", .member = %u },\n",
+        STATIC_CAST( unsigned, ast->func.member )
+      );
+      return true;
+
+    case K_POINTER:
+    case K_REFERENCE:
+    case K_RVALUE_REFERENCE:
+      FPUTS( "    .ptr_ref = { .to_ast = ", fout );
+      gen_emit_ast_ref( ast->ptr_ref.to_ast, fout );
+      FPUTS( " },\n", fout );
+      return true;
+
+    case K_POINTER_TO_MEMBER:
+      FPUTS( "    .ptr_mbr = { .to_ast = ", fout );
+      gen_emit_ast_ref( ast->ptr_mbr.to_ast, fout );
+      FPUTS( ", .class_sname = ", fout );
+      gen_emit_sname( &ast->ptr_mbr.class_sname, fout );
+      FPUTS( " },\n", fout );
+      return true;
+
+    case K_TYPEDEF:
+      FPUTS( "    .tdef = { .for_ast = ", fout );
+      gen_emit_ast_ref( ast->tdef.for_ast, fout );
+      FPRINTF( fout, ", .bit_width = %u },\n", ast->tdef.bit_width );
+      return true;
+
+    case K_CAPTURE:
+    case K_CAST:
+    case K_CONSTRUCTOR:
+    case K_DESTRUCTOR:
+    case K_LAMBDA:
+    case K_OPERATOR:
+    case K_UDEF_CONV:
+    case K_UDEF_LIT:
+      break;
+  } // switch
+
+  return false;
+}
+
+/**
+ * Emits the hash index of all predefined types emitted by gen_emit_tdef().
+ *
+ * @param fout The `FILE` to emit to.
+ */
+static void gen_emit_hash( FILE *fout ) {
+  assert( fout != NULL );
+
+  size_t size = 64;
+  while ( size < gen_tdef_list.len * 2 )  // keep load factor <= 0.5
+    size *= 2;
+  c_typedef_predef_hash_t *const hash = MALLOC( c_typedef_predef_hash_t, size );
+  memset( hash, 0, size * sizeof *hash );
+
+  uint32_t idx = 0;
+  FOREACH_SLIST_NODE( node, &gen_tdef_list ) {
+    c_typedef_t const *const tdef = node->data;
+    uint32_t const sname_hash = c_sname_hash( &tdef->ast->sname );
+    size_t i = sname_hash & (size - 1);
+    while ( hash[i].predef_idx != 0 )
+      i = (i + 1) & (size - 1);
+    hash[i] = (c_typedef_predef_hash_t){ sname_hash, ++idx };
+  } // for
+
+  FPUTS(
+    "\nc_typedef_predef_hash_t const C_TYPEDEF_PREDEF_HASH[] = {\n", fout
+  );
+  for ( size_t i = 0; i < size; ++i ) {
+    FPRINTF( fout, "  { 0x%08" PRIX32 "u, %" PRIu32 " },\n",
+      hash[i].sname_hash, hash[i].predef_idx
+    );
+  } // for
+  FPUTS(
+    "};\n"
+    "\n"
+    "size_t const C_TYPEDEF_PREDEF_HASH_SIZE = "
+      "ARRAY_SIZE( C_TYPEDEF_PREDEF_HASH );\n",
+    fout
+  );
+
+  free( hash );
+}
+
+/**
+ * Emits \a ast as a \ref c_ast initializer.
+ *
+ * @param ast The AST to emit.
+ * @param fout The `FILE` to emit to.
+ * @return Returns `true` only if \a ast could be emitted.
+ */
+NODISCARD
+static bool gen_emit_ast( c_ast_t const *ast, FILE *fout ) {
+  assert( ast != NULL );
+
+  FPRINTF( fout, "  [%zu] = { // %s\n",
+    gen_ptr_idx( &gen_ast_set, ast ), c_kind_name( ast->kind )
+  );
+
+  if ( ast->is_aligned ) {
+    // Predefined types are typedefs and typedefs can't be aligned.
+    EPRINTF( "%s: %s: aligned AST not supported in predefined types table\n",
+      me, c_kind_name( ast->kind )
+    );
+    return false;
+  }
+
+  FPRINTF( fout,
+    "    .depth = %u,\n"
+    "    .kind = 0x%X,\n"
+    "    .loc = { %d, %d, %d, %d },\n",
+    ast->depth, STATIC_CAST( unsigned, ast->kind ),
+    ast->loc.first_line, ast->loc.first_column,
+    ast->loc.last_line, ast->loc.last_column
+  );
+
+  FPUTS( "    .sname = ", fout );
+  gen_emit_sname( &ast->sname, fout );
+  FPUTS( ",\n    .type = ", fout );
+  gen_emit_type( &ast->type, fout );
+  FPUTS( ",\n    .parent_ast = ", fout );
+  gen_emit_ast_ref( ast->parent_ast, fout );
+  FPUTS( ",\n    .param_of_ast = ", fout );
+  gen_emit_ast_ref( ast->param_of_ast, fout );
+  FPUTS( ",\n", fout );
+
+#ifdef ENABLE_CDECL_DEBUG
+  FPRINTF( fout,
+    "    .unique_id = " PRId_C_AST_ID_T ",\n"
+    "    .dup_from_id = " PRId_C_AST_ID_T ",\n",
+    ast->unique_id, ast->dup_from_id
+  );
+#endif /* ENABLE_CDECL_DEBUG */
+
+  if ( !gen_emit_ast_union( ast, fout ) ) {
+    EPRINTF( "%s: %s: AST kind not supported in predefined types table\n",
+      me, c_kind_name( ast->kind )
+    );
+    return false;
+  }
+
+  FPUTS( "  },\n", fout );
+  return true;
+}
+
+/**
+ * Emits the \ref slist_node for \a node.
+ *
+ * @param node The node to emit.
+ * @param fout The `FILE` to emit to.
+ */
+static void gen_emit_node( slist_node_t const *node, FILE *fout ) {
+  assert( node != NULL );
+
+  FPRINTF( fout, "  [%zu] = { ", gen_ptr_idx( &gen_node_set, node ) );
+  if ( node->next == NULL )
+    FPUTS( "NULL", fout );
+  else
+    FPRINTF( fout, "NODE(%zu)",
+      gen_ptr_idx( &gen_node_set, node->next )
+    );
+  FPUTS( ", ", fout );
+  gen_emit_ast_ref( node->data, fout );
+  FPUTS( " },\n", fout );
+}
+
+/**
+ * Emits \a tdef as a \ref c_typedef_predef initializer.
+ *
+ * @param tdef The \ref c_typedef to emit.
+ * @param v_data A pointer to the `FILE` to emit to.
+ * @return Always returns `false`.
+ */
+NODISCARD
+static bool gen_emit_tdef( c_typedef_t const *tdef, void *v_data ) {
+  assert( tdef != NULL );
+  FILE *const fout = v_data;
+
+  if ( !tdef->is_predefined )
+    return false;
+  slist_push_back( &gen_tdef_list, CONST_CAST( void*, tdef ) );
+
+  FPUTS( "  { { ", fout );
+  gen_emit_ast_ref( tdef->ast, fout );
+  FPRINTF( fout, ", 0x%" PRIX32 ", 0x%X, true }, %s }, // %s\n",
+    tdef->lang_ids, tdef->decl_flags,
+    gen_ptr_in( &gen_required_set, tdef ) ? "true" : "false",
+    c_sname_full_name( &tdef->ast->sname )
+  );
+  return false;
+}
+
+/**
+ * Adds the names of \a sname and \a sname itself if its scopes can't be
+ * emitted inline.
+ *
+ * @param sname The scoped name to visit.
+ */
+static void gen_visit_sname( c_sname_t const *sname ) {
+  assert( sname != NULL );
+  FOREACH_SNAME_SCOPE( scope, sname )
+    gen_ptr_add( &gen_name_set, c_scope_data( scope )->name );
+  if ( sname->len > C_SNAME_INLINE_SIZE )
+    gen_ptr_add( &gen_sname_set, sname );
+}
+
+/**
+ * Adds all nodes and ASTs of \a list.
+ *
+ * @param list The list of ASTs to visit.
+ */
+static void gen_visit_ast_list( c_ast_list_t const *list ) {
+  assert( list != NULL );
+  FOREACH_SLIST_NODE( node, list ) {
+    gen_ptr_add( &gen_node_set, node );
+    gen_visit_ast( node->data );
+  } // for
+}
+
+/**
+ * Adds \a ast and every AST, node, and sname reachable from it.
+ *
+ * @param ast The AST to visit.  May be NULL.
+ */
+static void gen_visit_ast( c_ast_t const *ast ) {
+  if ( ast == NULL || !gen_ptr_add( &gen_ast_set, ast ) )
+    return;
+
+  gen_visit_sname( &ast->sname );
+  gen_visit_ast( ast->parent_ast );
+  gen_visit_ast( ast->param_of_ast );
+
+  switch ( ast->kind ) {
+    case K_APPLE_BLOCK:
+    case K_FUNCTION:
+      gen_visit_ast( ast->func.ret_ast );
+      gen_visit_ast_list( &ast->func.param_ast_list );
+      break;
+    case K_ARRAY:
+      gen_visit_ast( ast->array.of_ast );
+      if ( ast->array.kind == C_ARRAY_NAMED_SIZE )
+        gen_ptr_add( &gen_name_set, ast->array.size_name );
+      break;
+    case K_CLASS_STRUCT_UNION:
+      gen_visit_sname( &ast->csu.csu_sname );
+      break;
+    case K_ENUM:
+      gen_visit_ast( ast->enum_.of_ast );
+      gen_visit_sname( &ast->enum_.enum_sname );
+      break;
+    case K_POINTER:
+    case K_REFERENCE:
+    case K_RVALUE_REFERENCE:
+      gen_visit_ast( ast->ptr_ref.to_ast );
+      break;
+    case K_POINTER_TO_MEMBER:
+      gen_visit_ast( ast->ptr_mbr.to_ast );
+      gen_visit_sname( &ast->ptr_mbr.class_sname );
+      break;
+    case K_TYPEDEF:
+      gen_visit_ast( ast->tdef.for_ast );
+      break;
+    default:
+      // Any other kind is diagnosed by gen_emit_ast_union().
+      break;
+  } // switch
+}
+
+/**
+ * Adds the AST of \a tdef and everything reachable from it.
+ *
+ * @param tdef The \ref c_typedef to visit.
+ * @param v_data Not used.
+ * @return Always returns `false`.
+ */
+NODISCARD
+static bool gen_visit_tdef( c_typedef_t const *tdef, void *v_data ) {
+  (void)v_data;
+  if ( tdef->is_predefined )
+    gen_visit_ast( tdef->ast );
+  return false;
+}
+
+/**
+ * Marks \a tdef as required or not, if it hasn't been marked already.
+ *
+ * @param tdef The \ref c_typedef to mark.
+ * @param v_data A pointer to a `bool` that's `true` only if \a tdef is
+ * required.
+ * @return Always returns `false`.
+ */
+NODISCARD
+static bool gen_group_tdef( c_typedef_t const *tdef, void *v_data ) {
+  bool const is_required = *POINTER_CAST( bool const*, v_data );
+  if ( gen_ptr_add( &gen_seen_set, tdef ) && is_required )
+    gen_ptr_add( &gen_required_set, tdef );
+  return false;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+int c_typedef_gen_emit( FILE *fout ) {
+  assert( fout != NULL );
+
+  gen_ptr_init( &gen_ast_set );
+  gen_ptr_init( &gen_name_set );
+  gen_ptr_init( &gen_node_set );
+  gen_ptr_init( &gen_sname_set );
+  c_typedef_visit( &gen_visit_tdef, /*v_data=*/NULL );
+
+  FPRINTF( fout,
+    "/*\n"
+    "** This file was generated by %s -- DO NOT EDIT.\n"
+    "*/\n"
+    "\n"
+    "// local\n"
+    "#include \"pjl_config.h\"                 /* must go first */\n"
+    "#include \"c_typedef_gen.h\"\n"
+    "#include \"c_ast.h\"\n"
+    "#include \"c_sname.h\"\n"
+    "#include \"slist.h\"\n"
+    "#include \"util.h\"\n"
+    "\n"
+    "// standard\n"
+    "#include <stddef.h>\n"
+    "#include <stdint.h>\n"
+    "\n"
+    "static slist_node_t const  " GEN_NODE_ARRAY "[%zu];\n"
+    "static c_ast_t const       " GEN_AST_ARRAY "[%zu];\n"
+    "\n"
+    "//\n"
+    "// The tables are const, but the pointer members of their elements aren't,\n"
+    "// so references to elements must cast const away.  Nothing ever writes\n"
+    "// through them.\n"
+    "//\n"
+    "#define AST(I)   CONST_CAST( c_ast_t*, &" GEN_AST_ARRAY "[I] )\n"
+    "#define NODE(I)  CONST_CAST( slist_node_t*, &" GEN_NODE_ARRAY "[I] )\n"
+    "\n",
+    me,
+    gen_node_set.list.len, gen_ast_set.list.len
+  );
+
+  FOREACH_SLIST_NODE( node, &gen_name_set.list )
+    gen_emit_name_array( node->data, fout );
+
+  FOREACH_SLIST_NODE( node, &gen_sname_set.list )
+    gen_emit_sname_scopes( node->data, fout );
+
+  FPUTS( "\nstatic slist_node_t const " GEN_NODE_ARRAY "[] = {\n", fout );
+  FOREACH_SLIST_NODE( node, &gen_node_set.list )
+    gen_emit_node( node->data, fout );
+  FPUTS( "};\n", fout );
+
+  int status = EX_OK;
+
+  FPUTS( "\nstatic c_ast_t const " GEN_AST_ARRAY "[] = {\n", fout );
+  FOREACH_SLIST_NODE( node, &gen_ast_set.list ) {
+    if ( !gen_emit_ast( node->data, fout ) ) {
+      status = EX_SOFTWARE;
+      goto done;
+    }
+  } // for
+  FPUTS( "};\n", fout );
+
+  FPUTS( "\nc_typedef_predef_t const C_TYPEDEF_PREDEF[] = {\n", fout );
+  c_typedef_visit( &gen_emit_tdef, fout );
+  FPUTS(
+    "};\n"
+    "\n"
+    "size_t const C_TYPEDEF_PREDEF_SIZE = ARRAY_SIZE( C_TYPEDEF_PREDEF );\n",
+    fout
+  );
+
+  FPUTS( "\nchar const *const C_TYPEDEF_PREDEF_NAME[] = {\n", fout );
+  FOREACH_SLIST_NODE( node, &gen_name_set.list ) {
+    FPUTS( "  ", fout );
+    gen_emit_name_ref( node->data, fout );
+    FPUTS( ",\n", fout );
+  } // for
+  FPUTS(
+    "};\n"
+    "\n"
+    "size_t const C_TYPEDEF_PREDEF_NAME_SIZE = "
+      "ARRAY_SIZE( C_TYPEDEF_PREDEF_NAME );\n",
+    fout
+  );
+
+  gen_emit_hash( fout );
+
+done:
+  gen_ptr_cleanup( &gen_ast_set );
+  gen_ptr_cleanup( &gen_name_set );
+  gen_ptr_cleanup( &gen_node_set );
+  gen_ptr_cleanup( &gen_required_set );
+  gen_ptr_cleanup( &gen_sname_set );
+  gen_ptr_cleanup( &gen_seen_set );
+  slist_cleanup( &gen_tdef_list, /*free_fn=*/NULL );
+  return status;
+}
+
+void c_typedef_gen_group( bool is_required ) {
+  static bool sets_init;
+  if ( !sets_init ) {
+    gen_ptr_init( &gen_required_set );
+    gen_ptr_init( &gen_seen_set );
+    sets_init = true;
+  }
+  c_typedef_visit( &gen_group_tdef, &is_required );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
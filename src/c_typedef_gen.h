@@ -0,0 +1,157 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/c_typedef_gen.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_c_typedef_gen_H
+#define cdecl_c_typedef_gen_H
+
+/**
+ * @file
+ * Declares types, data, and functions for the build-time table of precompiled
+ * predefined types.
+ *
+ * @remarks At build time, a special version of **cdecl** (compiled with
+ * `CDECL_PREDEF_GEN` defined) parses all predefined types in the usual way and
+ * then emits their ASTs as C source code of static initializers.  That code is
+ * then compiled into the real **cdecl** so it need not parse any predefined
+ * types at start-up.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "c_typedef.h"
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdbool.h>
+#include <stddef.h>                     /* for size_t */
+#include <stdint.h>
+#include <stdio.h>
+
+/// @endcond
+
+/**
+ * Defined only if the tables generated at build time (of precompiled
+ * predefined types and of keywords) should be used.
+ *
+ * @sa symtab_gen.h
+ */
+#if defined(ENABLE_PREDEF_TABLE) && !defined(CDECL_PREDEF_GEN)
+# define WITH_PREDEF_TABLE 1
+#endif
+
+/**
+ * @defgroup c-typedef-gen-group Precompiled Predefined Types
+ * Types, data, and functions for the build-time table of precompiled
+ * predefined types.
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A precompiled predefined type.
+ */
+struct c_typedef_predef {
+  c_typedef_t tdef;                     ///< The predefined type.
+  bool        is_required;              ///< Load even if `--no-typedefs`?
+};
+typedef struct c_typedef_predef c_typedef_predef_t;
+
+/**
+ * A slot in the open-addressing hash index of #C_TYPEDEF_PREDEF.
+ */
+struct c_typedef_predef_hash {
+  uint32_t  sname_hash;                 ///< c_sname_hash() of the type's name.
+  uint32_t  predef_idx;                 ///< Index + 1 or 0 if slot is empty.
+};
+typedef struct c_typedef_predef_hash c_typedef_predef_hash_t;
+
+#ifdef WITH_PREDEF_TABLE
+
+/**
+ * The precompiled predefined types sorted by name, i.e., in the same order
+ * as c_sname_cmp().
+ *
+ * @remarks This table and all the ASTs it refers to are `const` and shared by
+ * all sessions: which types a session has loaded is recorded only in that
+ * session's \ref c_typedefs.
+ */
+extern c_typedef_predef_t const C_TYPEDEF_PREDEF[];
+
+/**
+ * The number of elements in #C_TYPEDEF_PREDEF.
+ */
+extern size_t const         C_TYPEDEF_PREDEF_SIZE;
+
+/**
+ * Hash index of #C_TYPEDEF_PREDEF by c_sname_hash() using linear probing.
+ */
+extern c_typedef_predef_hash_t const C_TYPEDEF_PREDEF_HASH[];
+
+/**
+ * The number of elements in #C_TYPEDEF_PREDEF_HASH; always a power of 2.
+ */
+extern size_t const         C_TYPEDEF_PREDEF_HASH_SIZE;
+
+/**
+ * Every distinct name used by #C_TYPEDEF_PREDEF.  Each is a separate `char`
+ * array so that it can be interned as-is via intern_static_str().
+ */
+extern char const *const    C_TYPEDEF_PREDEF_NAME[];
+
+/**
+ * The number of elements in #C_TYPEDEF_PREDEF_NAME.
+ */
+extern size_t const         C_TYPEDEF_PREDEF_NAME_SIZE;
+
+#endif /* WITH_PREDEF_TABLE */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+#ifdef CDECL_PREDEF_GEN
+
+/**
+ * Emits C source code for all predefined types defined by c_typedef_init().
+ *
+ * @param fout The `FILE` to emit to.
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ */
+NODISCARD
+int c_typedef_gen_emit( FILE *fout );
+
+/**
+ * Called by c_typedef_init() after each group of predefined types has been
+ * parsed so every newly added type can be marked as required or not.
+ *
+ * @param is_required If `true`, all predefined types added since the previous
+ * call are required, that is are loaded even if `--no-typedefs` is given.
+ */
+void c_typedef_gen_group( bool is_required );
+
+#endif /* CDECL_PREDEF_GEN */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_c_typedef_gen_H */
+/* vim:set et sw=2 ts=2: */
@@ -20,40 +20,35 @@
 
 /**
  * @file
- * Defines main() as well as functions for initialization and clean-up.
+ * Defines global variables as well as functions for initialization and
+ * clean-up.
  */
 
 // local
 #include "pjl_config.h"                 /* must go first */
 #include "cdecl.h"
 #include "c_ast.h"
-#include "c_keyword.h"
 #include "c_typedef.h"
-#include "cdecl_command.h"
-#include "cdecl_keyword.h"
-#include "cli_options.h"
-#include "color.h"
-#include "conf_file.h"
-#include "lexer.h"
-#include "options.h"
-#include "parse.h"
+#include "cdecl_session.h"
+#include "did_you_mean.h"
+#include "prompt.h"
+#include "slist.h"
+#include "symtab.h"
 #include "util.h"
 
 /// @cond DOXYGEN_IGNORE
 
 // standard
-#include <stddef.h>                     /* for size_t */
-#include <stdlib.h>
+#include <string.h>
 
 /// @endcond
 
 ///////////////////////////////////////////////////////////////////////////////
 
 // extern variable definitions
-bool          cdecl_initialized;
-bool          cdecl_interactive;
-cdecl_mode_t  cdecl_mode;
-char const   *me;
+bool                        cdecl_interactive;
+_Thread_local cdecl_mode_t  cdecl_mode;
+char const                 *me;
 
 ////////// local functions ////////////////////////////////////////////////////
 
@@ -62,12 +57,22 @@ char const   *me;
  */
 static void cdecl_cleanup( void ) {
   free_now();
-  parser_cleanup();                     // must go before c_ast_cleanup()
+  cdecl_session_free( cdecl_session );  // must go before c_ast_cleanup()
   c_ast_cleanup();
+  cdecl_prompt_cleanup();
+  slist_pool_cleanup();                 // must go last
 }
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+void cdecl_init( void ) {
+  ASSERT_RUN_ONCE();
+  ATEXIT( &cdecl_cleanup );
+  c_typedef_predef_init();              // must go before any intern_str()
+  symtab_init();
+  dym_init();
+}
+
 bool is_cppdecl( void ) {
   static char const *const NAMES[] = {
     CPPDECL,
@@ -82,37 +87,5 @@ bool is_cppdecl( void ) {
   return false;
 }
 
-/**
- * The main entry point.
- *
- * @param argc The command-line argument count.
- * @param argv The command-line argument values.
- * @return Returns 0 on success, non-zero on failure.
- */
-int main( int argc, char const *argv[] ) {
-  me = base_name( argv[0] );
-  ATEXIT( &cdecl_cleanup );
-  cli_option_init( &argc, &argv );
-  c_keyword_init();
-  cdecl_keyword_init();
-  color_init();
-  lexer_init();
-  //
-  // Everything above must come before c_typedef_init() since it actually uses
-  // the parser.
-  //
-  c_typedef_init();
-  lexer_reset( /*hard_reset=*/true );   // resets line number
-
-  if ( opt_read_conf )
-    conf_init();
-  cdecl_initialized = true;
-  //
-  // Note that cli_option_init() adjusts argv such that argv[0] becomes the
-  // first argument, if any, and no longer the program name.
-  //
-  exit( cdecl_parse_cli( STATIC_CAST( size_t, argc ), argv ) );
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 /* vim:set et sw=2 ts=2: */
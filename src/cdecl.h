@@ -52,13 +52,23 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 // extern variables
-extern bool         cdecl_initialized;  ///< Initialized (read conf. file)?
 extern bool         cdecl_interactive;  ///< Interactive (connected to a tty)?
-extern cdecl_mode_t cdecl_mode;         ///< Converting English or gibberish?
+
+/// Converting English or gibberish?
+extern _Thread_local cdecl_mode_t cdecl_mode;
 extern char const  *me;                 ///< Program name.
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+/**
+ * Initializes all process-wide **cdecl** data and arranges for it to be
+ * cleaned up upon exit.
+ *
+ * @note This must be called exactly once, before creating any sessions or
+ * threads.
+ */
+void cdecl_init( void );
+
 /**
  * Checks whether we're **c++decl** or a variant.
  *
@@ -0,0 +1,314 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/cdecl_cache.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for caching the output of **cdecl** commands.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "cdecl_cache.h"
+#include "sink.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// @endcond
+
+/**
+ * @addtogroup cdecl-cache-group
+ * @{
+ */
+
+/**
+ * A \ref cdecl_cache entry.  It's a single allocation: the key is followed
+ * immediately by the output.
+ */
+struct cdecl_cache_entry {
+  cdecl_cache_entry_t  *hash_next;      ///< Next entry in the same bucket.
+  cdecl_cache_entry_t  *lru_next;       ///< Next less recently used entry.
+  cdecl_cache_entry_t  *lru_prev;       ///< Next more recently used entry.
+  uint32_t              hash;           ///< Hash of the key.
+  size_t                key_len;        ///< Length of the key.
+  size_t                out_len;        ///< Length of the output.
+  char                  data[];         ///< Key followed by output.
+};
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Gets the bucket for \a hash.
+ *
+ * @param cache The \ref cdecl_cache to use.
+ * @param hash The hash to get the bucket for.
+ * @return Returns a pointer to the pointer to the first entry of the bucket.
+ */
+NODISCARD
+static inline cdecl_cache_entry_t** cache_bucket( cdecl_cache_t const *cache,
+                                                  uint32_t hash ) {
+  return &cache->buckets[ hash & cache->bucket_mask ];
+}
+
+/**
+ * Removes \a entry from the LRU list of \a cache.
+ *
+ * @param cache The \ref cdecl_cache to use.
+ * @param entry The entry to remove.
+ *
+ * @sa cache_lru_push_front()
+ */
+static void cache_lru_remove( cdecl_cache_t *cache,
+                              cdecl_cache_entry_t *entry ) {
+  if ( entry->lru_prev == NULL )
+    cache->lru_head = entry->lru_next;
+  else
+    entry->lru_prev->lru_next = entry->lru_next;
+  if ( entry->lru_next == NULL )
+    cache->lru_tail = entry->lru_prev;
+  else
+    entry->lru_next->lru_prev = entry->lru_prev;
+}
+
+/**
+ * Makes \a entry the most recently used entry of \a cache.
+ *
+ * @param cache The \ref cdecl_cache to use.
+ * @param entry The entry to push.  It must not be in the LRU list.
+ *
+ * @sa cache_lru_remove()
+ */
+static void cache_lru_push_front( cdecl_cache_t *cache,
+                                  cdecl_cache_entry_t *entry ) {
+  entry->lru_prev = NULL;
+  entry->lru_next = cache->lru_head;
+  if ( cache->lru_head == NULL )
+    cache->lru_tail = entry;
+  else
+    cache->lru_head->lru_prev = entry;
+  cache->lru_head = entry;
+}
+
+/**
+ * Empties \a cache.
+ *
+ * @param cache The \ref cdecl_cache to empty.
+ */
+static void cache_clear( cdecl_cache_t *cache ) {
+  for ( cdecl_cache_entry_t *entry = cache->lru_head, *next; entry != NULL;
+        entry = next ) {
+    next = entry->lru_next;
+    free( entry );
+  } // for
+  for ( size_t i = 0; i <= cache->bucket_mask; ++i )
+    cache->buckets[i] = NULL;
+  cache->lru_head = cache->lru_tail = NULL;
+  cache->len = 0;
+}
+
+/**
+ * Evicts the least recently used entry of \a cache.
+ *
+ * @param cache The \ref cdecl_cache to evict from.  It must not be empty.
+ */
+static void cache_evict( cdecl_cache_t *cache ) {
+  cdecl_cache_entry_t *const entry = cache->lru_tail;
+  assert( entry != NULL );
+
+  cdecl_cache_entry_t **pnext = cache_bucket( cache, entry->hash );
+  while ( *pnext != entry )
+    pnext = &(*pnext)->hash_next;
+  *pnext = entry->hash_next;
+
+  cache_lru_remove( cache, entry );
+  free( entry );
+  --cache->len;
+  ++cache->evictions;
+}
+
+/**
+ * Sets the key of \a cache to \a cmd with leading and trailing whitespace
+ * removed and every other run of whitespace replaced by a single space.
+ *
+ * @param cache The \ref cdecl_cache to set the key of.
+ * @param cmd The command to make the key from.
+ * @param cmd_len The length of \a cmd.
+ */
+static void cache_key_set( cdecl_cache_t *cache, char const *cmd,
+                           size_t cmd_len ) {
+  strbuf_t *const key = &cache->key_sbuf;
+  strbuf_reset( key );
+  strbuf_reserve( key, cmd_len );
+
+  bool in_space = false;
+  for ( char const *const end = cmd + cmd_len; cmd < end; ++cmd ) {
+    if ( isspace( STATIC_CAST( unsigned char, *cmd ) ) ) {
+      in_space = true;
+      continue;
+    }
+    if ( in_space && key->len > 0 )
+      strbuf_putc( key, ' ' );
+    in_space = false;
+    strbuf_putc( key, *cmd );
+  } // for
+
+  // 32-bit FNV-1a hash: same as intern_strn().
+  uint32_t hash = 2166136261u;
+  for ( size_t i = 0; i < key->len; ++i ) {
+    hash ^= STATIC_CAST( unsigned char, key->str[i] );
+    hash *= 16777619u;
+  } // for
+  cache->key_hash = hash;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+void cdecl_cache_add( cdecl_cache_t *cache, char const *out, size_t out_len ) {
+  assert( cache != NULL );
+  assert( out != NULL || out_len == 0 );
+
+  if ( cache->len == cache->len_max )
+    cache_evict( cache );
+
+  size_t const key_len = cache->key_sbuf.len;
+  cdecl_cache_entry_t *const entry =
+    check_realloc( NULL, sizeof( cdecl_cache_entry_t ) + key_len + out_len );
+  entry->hash = cache->key_hash;
+  entry->key_len = key_len;
+  entry->out_len = out_len;
+  memcpy( entry->data, cache->key_sbuf.str, key_len );
+  if ( out_len > 0 )
+    memcpy( entry->data + key_len, out, out_len );
+
+  cdecl_cache_entry_t **const pbucket = cache_bucket( cache, entry->hash );
+  entry->hash_next = *pbucket;
+  *pbucket = entry;
+  cache_lru_push_front( cache, entry );
+  ++cache->len;
+}
+
+char const* cdecl_cache_find( cdecl_cache_t *cache, unsigned long gen,
+                              char const *cmd, size_t cmd_len,
+                              size_t *pout_len ) {
+  assert( cache != NULL );
+  assert( cmd != NULL );
+  assert( pout_len != NULL );
+
+  if ( gen != cache->gen ) {
+    if ( cache->len > 0 ) {
+      cache_clear( cache );
+      ++cache->invalidations;
+    }
+    cache->gen = gen;
+  }
+
+  cache_key_set( cache, cmd, cmd_len );
+  size_t const key_len = cache->key_sbuf.len;
+
+  for ( cdecl_cache_entry_t *entry =
+          *cache_bucket( cache, cache->key_hash );
+        entry != NULL; entry = entry->hash_next ) {
+    if ( entry->hash == cache->key_hash && entry->key_len == key_len &&
+         memcmp( entry->data, cache->key_sbuf.str, key_len ) == 0 ) {
+      if ( entry != cache->lru_head ) {
+        cache_lru_remove( cache, entry );
+        cache_lru_push_front( cache, entry );
+      }
+      ++cache->hits;
+      *pout_len = entry->out_len;
+      return entry->data + key_len;
+    }
+  } // for
+
+  ++cache->misses;
+  return NULL;
+}
+
+void cdecl_cache_free( cdecl_cache_t *cache ) {
+  if ( cache == NULL )
+    return;
+  cache_clear( cache );
+  free( cache->buckets );
+  strbuf_cleanup( &cache->key_sbuf );
+  free( cache );
+}
+
+cdecl_cache_t* cdecl_cache_new( size_t len_max ) {
+  assert( len_max > 0 );
+
+  // Keep the load factor <= 0.5.
+  size_t buckets_len = 16;
+  while ( buckets_len < len_max * 2 )
+    buckets_len *= 2;
+
+  cdecl_cache_t *const cache = MALLOC( cdecl_cache_t, 1 );
+  *cache = (cdecl_cache_t){
+    .buckets = MALLOC( cdecl_cache_entry_t*, buckets_len ),
+    .bucket_mask = buckets_len - 1,
+    .len_max = len_max
+  };
+  for ( size_t i = 0; i < buckets_len; ++i )
+    cache->buckets[i] = NULL;
+  strbuf_init( &cache->key_sbuf );
+  return cache;
+}
+
+void cdecl_cache_print_stats( cdecl_cache_t const *cache, sink_t *sink ) {
+  assert( sink != NULL );
+
+  if ( cache == NULL ) {
+    sink_puts( sink, "result cache: disabled\n" );
+    return;
+  }
+
+  size_t const lookups = cache->hits + cache->misses;
+  sink_printf( sink,
+    "result cache: %zu/%zu entries\n"
+    "  hits: %zu\n"
+    "  misses: %zu\n"
+    "  hit rate: %.1f%%\n"
+    "  evictions: %zu\n"
+    "  invalidations: %zu\n",
+    cache->len, cache->len_max,
+    cache->hits,
+    cache->misses,
+    lookups > 0 ?
+      100.0 * STATIC_CAST( double, cache->hits ) /
+              STATIC_CAST( double, lookups ) :
+      0.0,
+    cache->evictions,
+    cache->invalidations
+  );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
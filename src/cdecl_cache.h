@@ -0,0 +1,152 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/cdecl_cache.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_cdecl_cache_H
+#define cdecl_cdecl_cache_H
+
+/**
+ * @file
+ * Declares types and functions for caching the output of **cdecl** commands.
+ *
+ * @remarks The same declarations, e.g., `char *argv[]`, tend to be explained
+ * over and over.  A result cache maps the text of a command (with whitespace
+ * normalized) to the output it produced so that a repeated command need not
+ * be parsed again.  The cache has a maximum number of entries; when full, the
+ * least recently used entry is evicted.
+ * @par
+ * Since a command's output depends on all types defined and all options set,
+ * every cache lookup is given the current \ref cdecl_session::gen
+ * "generation" of that state: if it differs from that of the cached entries,
+ * all of them are discarded.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "strbuf.h"
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stddef.h>                     /* for size_t */
+#include <stdint.h>
+
+/// @endcond
+
+/**
+ * @defgroup cdecl-cache-group Result Cache
+ * Types and functions for caching the output of **cdecl** commands.
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A least-recently-used cache of the output of **cdecl** commands.
+ */
+struct cdecl_cache {
+  cdecl_cache_entry_t **buckets;        ///< Hash table of entries.
+  size_t                bucket_mask;    ///< Number of buckets - 1.
+  cdecl_cache_entry_t  *lru_head;       ///< Most recently used entry.
+  cdecl_cache_entry_t  *lru_tail;       ///< Least recently used entry.
+  size_t                len;            ///< Number of entries.
+  size_t                len_max;        ///< Maximum number of entries.
+  unsigned long         gen;            ///< Generation of all entries.
+  strbuf_t              key_sbuf;       ///< Key of the last missed command.
+  uint32_t              key_hash;       ///< Hash of \ref key_sbuf.
+
+  size_t                evictions;      ///< Number of entries evicted.
+  size_t                hits;           ///< Number of lookups found.
+  size_t                invalidations;  ///< Number of times emptied.
+  size_t                misses;         ///< Number of lookups not found.
+};
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Adds \a out as the output of the command most recently not found by
+ * cdecl_cache_find().  If \a cache is full, the least recently used entry is
+ * evicted first.
+ *
+ * @param cache The \ref cdecl_cache to add to.
+ * @param out The output to add.  It need not be null-terminated.
+ * @param out_len The length of \a out.
+ *
+ * @sa cdecl_cache_find()
+ */
+void cdecl_cache_add( cdecl_cache_t *cache, char const *out, size_t out_len );
+
+/**
+ * Finds the cached output of a command.
+ *
+ * @param cache The \ref cdecl_cache to search.
+ * @param gen The current generation of types and options.  If it differs from
+ * that of \a cache, \a cache is emptied first.
+ * @param cmd The command to find.  It need not be null-terminated.
+ * Differences in whitespace are ignored.
+ * @param cmd_len The length of \a cmd.
+ * @param pout_len Set to the length of the output, if found.
+ * @return Returns said output (that need not be null-terminated) or NULL if
+ * not found.  It remains valid only until the next call to any cache
+ * function.
+ *
+ * @sa cdecl_cache_add()
+ */
+NODISCARD
+char const* cdecl_cache_find( cdecl_cache_t *cache, unsigned long gen,
+                              char const *cmd, size_t cmd_len,
+                              size_t *pout_len );
+
+/**
+ * Frees a \ref cdecl_cache.
+ *
+ * @param cache The \ref cdecl_cache to free.  If NULL, does nothing.
+ *
+ * @sa cdecl_cache_new()
+ */
+void cdecl_cache_free( cdecl_cache_t *cache );
+
+/**
+ * Creates a new \ref cdecl_cache.
+ *
+ * @param len_max The maximum number of entries.  It _must_ be &gt; 0.
+ * @return Returns said \ref cdecl_cache.  The caller is responsible for
+ * freeing it via cdecl_cache_free().
+ *
+ * @sa cdecl_cache_free()
+ */
+NODISCARD
+cdecl_cache_t* cdecl_cache_new( size_t len_max );
+
+/**
+ * Prints the statistics of \a cache.
+ *
+ * @param cache The \ref cdecl_cache to print the statistics of or NULL if
+ * caching is disabled.
+ * @param sink The \ref sink to print to.
+ */
+void cdecl_cache_print_stats( cdecl_cache_t const *cache, sink_t *sink );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_cdecl_cache_H */
+/* vim:set et sw=2 ts=2: */
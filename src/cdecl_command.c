@@ -81,6 +81,7 @@ static cdecl_command_t const CDECL_COMMANDS[] = {
   { L_set,                  FIRST_ARG,  LANG_SAME(ANY)                },
   { L_show,                 FIRST_ARG,  LANG_SAME(ANY)                },
   { L_static /*cast*/,      FIRST_ARG,  LANG_SAME(NEW_STYLE_CASTS)    },
+  { L_stats,                LANG_ONLY,  LANG_SAME(ANY)                },
   { L_struct,               FIRST_ARG,  LANG_SAME(ANY)                },
   { L_typedef,              FIRST_ARG,  LANG_SAME(ANY)                },
   { L_union,                FIRST_ARG,  LANG_SAME(ANY)                },
@@ -29,6 +29,7 @@
 #include "cdecl_keyword.h"
 #include "c_lang.h"
 #include "literals.h"
+#include "symtab.h"
 #include "util.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -36,8 +37,6 @@
 // standard
 #include <assert.h>
 #include <stddef.h>                     /* for NULL */
-#include <stdlib.h>
-#include <string.h>
 
 /// @endcond
 
@@ -162,8 +161,6 @@
  *    C++.
  *  + `double` so it can specify the #AC_NEXT_KEYWORDS() of `precision`.
  *
- * @note This is not declared `const` because it's sorted once.
- *
  * ## Initialization Macros
  *
  * The #SYNONYM, #SYNONYMS, and #TOKEN macros are used to initialize entries in
@@ -245,7 +242,7 @@
  * @sa CDECL_COMMANDS
  * @sa #FIND_IN_ENGLISH_ONLY
  */
-static cdecl_keyword_t CDECL_KEYWORDS[] = {
+cdecl_keyword_t const CDECL_KEYWORDS[] = {
   { L_address,
     LANG_no_unique_address,
     TOKEN( Y_address ),
@@ -1682,48 +1679,12 @@ static cdecl_keyword_t CDECL_KEYWORDS[] = {
   }
 };
 
-////////// local functions ////////////////////////////////////////////////////
-
-/**
- * Compares two \ref cdecl_keyword objects.
- *
- * @param i_cdk The first \ref cdecl_keyword to compare.
- * @param j_cdk The second \ref cdecl_keyword to compare.
- * @return @return Returns a number less than 0, 0, or greater than 0 if \a
- * i_cdk is less than, equal to, or greater than \a j_cdk, respectively.
- */
-NODISCARD
-static int cdecl_keyword_cmp( cdecl_keyword_t const *i_cdk,
-                              cdecl_keyword_t const *j_cdk ) {
-  return strcmp( i_cdk->literal, j_cdk->literal );
-}
-
 ////////// extern functions ///////////////////////////////////////////////////
 
 cdecl_keyword_t const* cdecl_keyword_find( char const *s ) {
   assert( s != NULL );
-
-  // the list is small, so linear search is good enough
-  for ( cdecl_keyword_t const *cdk = CDECL_KEYWORDS; cdk->literal != NULL;
-        ++cdk ) {
-    int const cmp = strcmp( s, cdk->literal );
-    if ( cmp > 0 )
-      continue;
-    if ( cmp < 0 )                      // the array is sorted
-      break;
-    return cdk;
-  } // for
-
-  return NULL;
-}
-
-void cdecl_keyword_init( void ) {
-  ASSERT_RUN_ONCE();
-  qsort(                                // don't rely on manual sorting above
-    CDECL_KEYWORDS, ARRAY_SIZE( CDECL_KEYWORDS ) - 1/*NULL*/,
-    sizeof( cdecl_keyword_t ),
-    POINTER_CAST( qsort_cmp_fn_t, &cdecl_keyword_cmp )
-  );
+  symtab_sym_t const *const sym = symtab_find( s );
+  return sym != NULL ? sym->cdk : NULL;
 }
 
 cdecl_keyword_t const* cdecl_keyword_next( cdecl_keyword_t const *cdk ) {
@@ -100,6 +100,15 @@ struct cdecl_keyword {
 };
 typedef struct cdecl_keyword cdecl_keyword_t;
 
+/**
+ * Array of all **cdecl** keywords terminated by an element whose \ref
+ * cdecl_keyword::literal "literal" is NULL.
+ *
+ * @note This is extern only so the generated symbol table can point into it.
+ * Otherwise use #FOREACH_CDECL_KEYWORD().
+ */
+extern cdecl_keyword_t const CDECL_KEYWORDS[];
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
@@ -112,13 +121,6 @@ typedef struct cdecl_keyword cdecl_keyword_t;
 NODISCARD
 cdecl_keyword_t const* cdecl_keyword_find( char const *literal );
 
-/**
- * Initializes \ref cdecl_keyword data.
- *
- * @note This function must be called exactly once.
- */
-void cdecl_keyword_init( void );
-
 /**
  * Iterates to the next **cdecl** keyword.
  *
@@ -24,16 +24,25 @@
 /**
  * @file
  * Wrapper around the Bison-generated `parser.h` to add necessary `#include`s
- * for the types in Bison's <code>\%union</code> declaration as well as a
- * declaration for the parser_cleanup() function.
+ * for the types in Bison's <code>\%union</code> declaration as well as
+ * declarations for the functions to create, use, and free a \ref parser.
  */
 
 // local
 #include "pjl_config.h"                 /* must go first */
+#include "c_sname.h"
 #include "c_type.h"
 #include "slist.h"
+#include "types.h"
 #include "parser.h"                     /* must go last */
 
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdio.h>                      /* for FILE */
+
+/// @endcond
+
 /**
  * @ingroup parser-group
  * @{
@@ -42,16 +51,58 @@
 ///////////////////////////////////////////////////////////////////////////////
 
 /**
- * Cleans up global parser data at program termination.
+ * Frees all memory used by \a parser _including_ \a parser itself.
+ *
+ * @param parser The \ref parser to free.  If NULL, does nothing.
+ *
+ * @sa parser_new()
+ */
+void parser_free( parser_t *parser );
+
+/**
+ * Creates a new \ref parser.
+ *
+ * @remarks Each parser has its own lexer and per-parse state, so different
+ * parsers may be used independently, e.g., by different threads.
+ *
+ * @return Returns a pointer to a new parser.  The caller is responsible for
+ * freeing it via parser_free().
+ *
+ * @sa parser_free()
+ */
+NODISCARD
+parser_t* parser_new( void );
+
+/**
+ * Parses all **cdecl** commands read from \a fin.
+ *
+ * @param parser The \ref parser to use.
+ * @param fin The `FILE` to read from.
+ * @return Returns the value of yyparse(): 0 upon success, 1 upon a parse
+ * error, or 2 if out of memory.
+ */
+NODISCARD
+int parser_parse( parser_t *parser, FILE *fin );
+
+/**
+ * Resets \a parser to its initial state including resetting the line number.
+ *
+ * @param parser The \ref parser to reset.
+ */
+void parser_reset( parser_t *parser );
+
+/**
+ * Flex: gets the next token ID.
  *
- * @remarks The parser uses a "cleanup" function rather than an "init" function
- * (that calls **atexit**(3) with <code>%parser_cleanup()</code>) because
- * parser clean-up needs to be done at a specific point in the program's clean-
- * up sequence and that's trivial to do by having to call this explicitly.
+ * @param lval A pointer to the token's semantic value to set.
+ * @param lloc A pointer to the token's location to set.
+ * @param scanner The Flex scanner to use.
+ * @return Returns the token ID.
  *
- * @sa cdecl_cleanup()
+ * @note The definition is provided by Flex.
  */
-void parser_cleanup( void );
+NODISCARD
+int lexer_lex( YYSTYPE *lval, YYLTYPE *lloc, yyscan_t scanner );
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -0,0 +1,116 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/cdecl_session.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines variables and functions for **cdecl** sessions.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "cdecl_session.h"
+#include "c_typedef.h"
+#include "cdecl_cache.h"
+#include "cdecl_parser.h"
+#include "options.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <stdlib.h>
+
+/// @endcond
+
+/**
+ * @addtogroup cdecl-session-group
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+// extern variable definitions
+_Thread_local cdecl_session_t *cdecl_session;
+
+////////// extern functions ///////////////////////////////////////////////////
+
+void cdecl_session_free( cdecl_session_t *session ) {
+  if ( session == NULL )
+    return;
+  if ( session == cdecl_session )
+    PJL_IGNORE_RV( cdecl_session_set( NULL ) );
+  parser_free( session->parser );
+  c_typedefs_free( session->typedefs );
+  cdecl_cache_free( session->cache );
+  free( session );
+}
+
+cdecl_session_t* cdecl_session_new( void ) {
+  cdecl_session_t *const session = MALLOC( cdecl_session_t, 1 );
+  *session = (cdecl_session_t){
+    .opts = cdecl_opts,
+    .init_opts = cdecl_opts,
+    .typedefs = c_typedefs_new(),
+    .parser = parser_new(),
+    .cache = opt_cache_size > 0 ? cdecl_cache_new( opt_cache_size ) : NULL
+  };
+
+  //
+  // Predefined types are loaded by parsing them (unless they're precompiled),
+  // so the session has to be current while doing so.
+  //
+  cdecl_session_t *const prev_session = cdecl_session_set( session );
+  c_typedef_init();
+  parser_reset( session->parser );      // resets line number
+  PJL_IGNORE_RV( cdecl_session_set( prev_session ) );
+
+  return session;
+}
+
+void cdecl_session_reset( cdecl_session_t *session ) {
+  assert( session != NULL );
+  if ( session == cdecl_session )
+    cdecl_opts = session->init_opts;
+  else
+    session->opts = session->init_opts;
+  c_typedefs_reset( session->typedefs );
+  parser_reset( session->parser );
+  session->is_quit = false;
+  ++session->gen;
+}
+
+cdecl_session_t* cdecl_session_set( cdecl_session_t *session ) {
+  cdecl_session_t *const prev_session = cdecl_session;
+  if ( session != prev_session ) {
+    if ( prev_session != NULL )
+      prev_session->opts = cdecl_opts;
+    if ( session != NULL )
+      cdecl_opts = session->opts;
+    cdecl_session = session;
+  }
+  return prev_session;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,163 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/cdecl_session.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_cdecl_session_H
+#define cdecl_cdecl_session_H
+
+/**
+ * @file
+ * Declares types, variables, and functions for **cdecl** sessions.
+ *
+ * @remarks A _session_ owns all state that commands can change: options, all
+ * `typedef`s, and the parser (including its lexer and the set of included
+ * files).  Any number of sessions may exist at once.  Each thread has at most
+ * one _current_ session that all commands use; different threads may use
+ * different sessions concurrently, but a session must be current on at most
+ * one thread at a time.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "options.h"
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdbool.h>
+
+/// @endcond
+
+/**
+ * @defgroup cdecl-session-group Sessions
+ * Types, variables, and functions for **cdecl** sessions.
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A **cdecl** session.
+ */
+struct cdecl_session {
+  /**
+   * The session's options.
+   *
+   * @remarks While the session is current, its options are in \ref
+   * cdecl_opts instead so all `opt_*` macros refer to them; this is updated
+   * only when the session stops being current.
+   */
+  cdecl_options_t   opts;
+
+  cdecl_options_t   init_opts;          ///< Options for cdecl_session_reset().
+  c_typedefs_t     *typedefs;           ///< All `typedef`s.
+  parser_t         *parser;             ///< Parser (and its lexer).
+  cdecl_cache_t    *cache;              ///< Result cache, if any.
+
+  /**
+   * Generation of the session's state that affects the output of commands.
+   * It's incremented whenever a type is defined or undefined or an option is
+   * set so that \ref cache is invalidated.
+   */
+  unsigned long     gen;
+
+  /**
+   * Has the session finished initializing, e.g., reading a configuration
+   * file?  It's `false` after cdecl_session_new(); it's up to the creator to
+   * set it to `true`.
+   */
+  bool              is_initialized;
+
+  /**
+   * If `true`, the `quit` command sets \ref is_quit rather than exiting, e.g.,
+   * for a session of a client of cdecl_serve().
+   */
+  bool              is_quit_deferred;
+
+  /**
+   * If `true`, the session's output never goes to a terminal, e.g., for a
+   * library session, so the terminal is never queried for its number of
+   * columns.
+   */
+  bool              is_termless;
+
+  bool              is_quit;            ///< Was `quit` given?
+};
+
+/**
+ * The current session of the calling thread, if any.
+ *
+ * @sa cdecl_session_set()
+ */
+extern _Thread_local cdecl_session_t *cdecl_session;
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Frees a session.  If it's the current session of the calling thread, the
+ * thread no longer has a current session.
+ *
+ * @param session The session to free.  If NULL, does nothing.
+ *
+ * @sa cdecl_session_new()
+ */
+void cdecl_session_free( cdecl_session_t *session );
+
+/**
+ * Creates a new session.  Its options are a copy of those of the calling
+ * thread and all predefined types are loaded.
+ *
+ * @return Returns said session.  The caller is responsible for freeing it via
+ * cdecl_session_free().
+ *
+ * @note The new session is _not_ made current.
+ *
+ * @sa cdecl_session_free()
+ * @sa cdecl_session_set()
+ */
+NODISCARD
+cdecl_session_t* cdecl_session_new( void );
+
+/**
+ * Resets a session to nearly the state it had when it was created: its
+ * options are restored, all user-defined types are removed, and its parser is
+ * reset.  This is much cheaper than freeing it and creating a new one since
+ * predefined types are kept.
+ *
+ * @param session The session to reset.
+ */
+void cdecl_session_reset( cdecl_session_t *session );
+
+/**
+ * Makes \a session the current session of the calling thread.
+ *
+ * @param session The session to make current or NULL for none.  It must not
+ * be current on any other thread.
+ * @return Returns the previously current session, if any.
+ */
+PJL_DISCARD
+cdecl_session_t* cdecl_session_set( cdecl_session_t *session );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_cdecl_session_H */
+/* vim:set et sw=2 ts=2: */
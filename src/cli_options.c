@@ -36,6 +36,7 @@
 #include "help.h"
 #include "options.h"
 #include "print.h"
+#include "sink.h"
 #include "strbuf.h"
 #include "util.h"
 
@@ -72,7 +73,12 @@
 #endif /* ENABLE_FLEX_DEBUG */
 #define OPT_HELP              h
 #define OPT_EXPLICIT_INT      i
+#define OPT_JOBS              j
+#define OPT_JSONL             J
 #define OPT_COLOR             k
+#define OPT_CLIENT            K
+#define OPT_BATCH             l
+#define OPT_CACHE             m
 #define OPT_OUTPUT            o
 #define OPT_NO_PROMPT         p
 #define OPT_TRAILING_RETURN   r
@@ -84,6 +90,14 @@
 #define OPT_VERSION           v
 #define OPT_WEST_POINTER      w
 #define OPT_LANGUAGE          x
+#define OPT_ZYGOTE            Y
+#define OPT_SERVE             Z
+
+/// Maximum number of result cache entries.
+#define CACHE_SIZE_MAX            1048576
+
+/// Maximum number of batch mode worker processes.
+#define JOBS_MAX                  256
 
 /// Command-line short option as a character literal.
 #define COPT(X)                   CHARIFY(OPT_##X)
@@ -117,9 +131,12 @@ static struct option const CLI_OPTIONS[] = {
   //  4. The corresponding "set" option in SET_OPTIONS in set_options.c.
   //
   { "alt-tokens",       no_argument,        NULL, COPT(ALT_TOKENS)        },
+  { "batch",            no_argument,        NULL, COPT(BATCH)             },
 #ifdef ENABLE_BISON_DEBUG
   { "bison-debug",      no_argument,        NULL, COPT(BISON_DEBUG)       },
 #endif /* ENABLE_BISON_DEBUG */
+  { "cache",            required_argument,  NULL, COPT(CACHE)             },
+  { "client",           required_argument,  NULL, COPT(CLIENT)            },
   { "color",            required_argument,  NULL, COPT(COLOR)             },
   { "config",           required_argument,  NULL, COPT(CONFIG)            },
 #ifdef ENABLE_CDECL_DEBUG
@@ -136,6 +153,8 @@ static struct option const CLI_OPTIONS[] = {
   { "flex-debug",       no_argument,        NULL, COPT(FLEX_DEBUG)        },
 #endif /* ENABLE_FLEX_DEBUG */
   { "help",             no_argument,        NULL, COPT(HELP)              },
+  { "jobs",             required_argument,  NULL, COPT(JOBS)              },
+  { "jsonl",            no_argument,        NULL, COPT(JSONL)             },
   { "language",         required_argument,  NULL, COPT(LANGUAGE)          },
   { "no-buffer-stdout", no_argument,        NULL, COPT(NO_BUFFER_STDOUT)  },
   { "no-config",        no_argument,        NULL, COPT(NO_CONFIG)         },
@@ -145,14 +164,17 @@ static struct option const CLI_OPTIONS[] = {
   { "no-typedefs",      no_argument,        NULL, COPT(NO_TYPEDEFS)       },
   { "no-using",         no_argument,        NULL, COPT(NO_USING)          },
   { "output",           required_argument,  NULL, COPT(OUTPUT)            },
+  { "serve",            required_argument,  NULL, COPT(SERVE)             },
   { "trailing-return",  no_argument,        NULL, COPT(TRAILING_RETURN)   },
   { "trigraphs",        no_argument,        NULL, COPT(TRIGRAPHS)         },
   { "version",          no_argument,        NULL, COPT(VERSION)           },
   { "west-pointer",     required_argument,  NULL, COPT(WEST_POINTER)      },
+  { "zygote",           required_argument,  NULL, COPT(ZYGOTE)            },
   { NULL,               0,                  NULL, 0                       }
 };
 
 // local variables
+static sink_t       batch_fout;         ///< Standard output in batch mode.
 static bool         opts_given[ 128 ];  ///< Table of options that were given.
 
 // local functions
@@ -167,6 +189,19 @@ static void         print_version( bool );
 
 ////////// local functions ////////////////////////////////////////////////////
 
+/**
+ * Flushes and cleans up \ref batch_fout.
+ *
+ * @note This function is called via **atexit**(3) since a `quit` command or a
+ * fatal error exits without returning to main().
+ */
+static void batch_fout_cleanup( void ) {
+  if ( cdecl_fout_redirect != &batch_fout )
+    return;
+  cdecl_fout_redirect = NULL;
+  sink_cleanup( &batch_fout );
+}
+
 /**
  * Makes the `optstring` (short option) equivalent of \a opts for the third
  * argument of `getopt_long()`.
@@ -355,6 +390,48 @@ static color_when_t parse_color_when( char const *when ) {
   opt_invalid_value( COPT(COLOR), when, when_sbuf.str );
 }
 
+/**
+ * Parses the maximum number of result cache entries.
+ *
+ * @param s The null-terminated string to parse.
+ * @return Returns said number or prints an error message and exits if \a s is
+ * invalid.
+ */
+NODISCARD
+static size_t parse_cache_size( char const *s ) {
+  assert( s != NULL );
+
+  if ( isdigit( *s ) ) {
+    char *end;
+    errno = 0;
+    unsigned long const size = strtoul( s, &end, 10 );
+    if ( errno == 0 && *end == '\0' && size <= CACHE_SIZE_MAX )
+      return STATIC_CAST( size_t, size );
+  }
+  opt_invalid_value( COPT(CACHE), s, "0-" STRINGIFY(CACHE_SIZE_MAX) );
+}
+
+/**
+ * Parses the number of batch mode worker processes.
+ *
+ * @param s The null-terminated string to parse.
+ * @return Returns said number or prints an error message and exits if \a s is
+ * invalid.
+ */
+NODISCARD
+static unsigned parse_jobs( char const *s ) {
+  assert( s != NULL );
+
+  if ( isdigit( *s ) ) {
+    char *end;
+    errno = 0;
+    unsigned long const jobs = strtoul( s, &end, 10 );
+    if ( errno == 0 && *end == '\0' && jobs >= 1 && jobs <= JOBS_MAX )
+      return STATIC_CAST( unsigned, jobs );
+  }
+  opt_invalid_value( COPT(JOBS), s, "1-" STRINGIFY(JOBS_MAX) );
+}
+
 /**
  * Parses a language name.
  *
@@ -407,6 +484,17 @@ static void parse_options( int *pargc, char const **pargv[const] ) {
       case COPT(ALT_TOKENS):
         opt_alt_tokens = true;
         break;
+      case COPT(BATCH):
+        opt_batch = true;
+        break;
+      case COPT(CACHE):
+        opt_cache_size = parse_cache_size( optarg );
+        break;
+      case COPT(CLIENT):
+        if ( *SKIP_WS( optarg ) == '\0' )
+          goto missing_arg;
+        opt_client_path = optarg;
+        break;
 #ifdef ENABLE_BISON_DEBUG
       case COPT(BISON_DEBUG):
         opt_bison_debug = true;
@@ -415,7 +503,9 @@ static void parse_options( int *pargc, char const **pargv[const] ) {
 #ifdef ENABLE_CDECL_DEBUG
       case COPT(CDECL_DEBUG):
         if ( !parse_cdecl_debug( empty_if_null( optarg ) ) )
-          opt_invalid_value( COPT(CDECL_DEBUG), optarg, "*, -, or u" );
+          opt_invalid_value(
+            COPT(CDECL_DEBUG), optarg, "*, -, or {m|u}+"
+          );
         break;
 #endif /* ENABLE_CDECL_DEBUG */
       case COPT(COLOR):
@@ -463,6 +553,13 @@ static void parse_options( int *pargc, char const **pargv[const] ) {
       case COPT(HELP):
         opt_help = true;
         break;
+      case COPT(JOBS):
+        opt_jobs = parse_jobs( optarg );
+        opt_batch = true;
+        break;
+      case COPT(JSONL):
+        opt_jsonl = true;
+        break;
       case COPT(LANGUAGE):
         opt_lang = parse_lang( optarg );
         break;
@@ -498,6 +595,13 @@ static void parse_options( int *pargc, char const **pargv[const] ) {
           goto missing_arg;
         fout_path = optarg;
         break;
+      case COPT(SERVE):
+      case COPT(ZYGOTE):
+        if ( *SKIP_WS( optarg ) == '\0' )
+          goto missing_arg;
+        opt_serve_path = optarg;
+        opt_zygote = opt == COPT(ZYGOTE);
+        break;
       case COPT(VERSION):
         ++opt_version;
         break;
@@ -532,9 +636,21 @@ static void parse_options( int *pargc, char const **pargv[const] ) {
   *pargc -= optind;
   *pargv += optind;
 
+  opt_check_exclusive( COPT(CLIENT) );
   opt_check_exclusive( COPT(HELP) );
   opt_check_exclusive( COPT(VERSION) );
+  opt_check_mutually_exclusive( COPT(BATCH), SOPT(NO_BUFFER_STDOUT) );
+  opt_check_mutually_exclusive( COPT(JOBS), SOPT(NO_BUFFER_STDOUT) );
   opt_check_mutually_exclusive( COPT(DIGRAPHS), SOPT(TRIGRAPHS) );
+  opt_check_mutually_exclusive(
+    COPT(SERVE), SOPT(BATCH) SOPT(JOBS) SOPT(ZYGOTE)
+  );
+  opt_check_mutually_exclusive( COPT(ZYGOTE), SOPT(BATCH) SOPT(JOBS) );
+  opt_check_mutually_exclusive(
+    COPT(JSONL),
+    SOPT(BATCH) SOPT(COLOR) SOPT(ECHO_COMMANDS) SOPT(JOBS) SOPT(SERVE)
+    SOPT(ZYGOTE)
+  );
 
   if ( strcmp( fin_path, "-" ) != 0 ) {
     FILE *const fin = fopen( fin_path, "r" );
@@ -554,10 +670,25 @@ static void parse_options( int *pargc, char const **pargv[const] ) {
 
   if ( !opt_buffer_stdout )
     setvbuf( stdout, /*buf=*/NULL, _IONBF, /*size=*/0 );
+  else if ( opt_batch ) {
+    //
+    // In batch mode, bypass stdio for standard output: buffer output in large
+    // chunks and write them all at once via writev(2).
+    //
+    sink_init_writev( &batch_fout, STDOUT_FILENO );
+    cdecl_fout_redirect = &batch_fout;
+    ATEXIT( &batch_fout_cleanup );
+  }
 
   if ( opt_help )
     print_usage( *pargc > 0 ? EX_USAGE : EX_OK );
 
+  if ( (opt_jsonl || opt_serve_path != NULL) && *pargc > 0 )
+    print_usage( EX_USAGE );            // cdecl --serve=path foo
+
+  if ( opt_jsonl )                      // escape sequences would be noise
+    opt_color_when = COLOR_NEVER;
+
   if ( opt_version > 0 ) {
     if ( *pargc > 0 )                   // cdecl -v foo
       print_usage( EX_USAGE );
@@ -604,9 +735,12 @@ static void print_usage( int status ) {
     "usage: %s [options] [command...]\n"
     "options:\n"
     "  --alt-tokens        " UOPT(ALT_TOKENS)       "Print alternative tokens.\n"
+    "  --batch             " UOPT(BATCH)            "Read input in batch mode.\n"
 #ifdef ENABLE_BISON_DEBUG
     "  --bison-debug       " UOPT(BISON_DEBUG)      "Print Bison debug output.\n"
 #endif /* ENABLE_BISON_DEBUG */
+    "  --cache=N           " UOPT(CACHE)            "Cache the output of up to N commands.\n"
+    "  --client=PATH       " UOPT(CLIENT)           "Send commands to the server at socket PATH.\n"
     "  --color=WHEN        " UOPT(COLOR)            "Colorize output WHEN [default: not_file].\n"
     "  --config=FILE       " UOPT(CONFIG)           "Configuration file path [default: ~/." CONF_FILE_NAME_DEFAULT "].\n"
 #ifdef ENABLE_CDECL_DEBUG
@@ -623,6 +757,8 @@ static void print_usage( int status ) {
     "  --flex-debug        " UOPT(FLEX_DEBUG)       "Print Flex debug output.\n"
 #endif /* ENABLE_FLEX_DEBUG */
     "  --help              " UOPT(HELP)             "Print this help and exit.\n"
+    "  --jobs=N            " UOPT(JOBS)             "Use N worker processes for batch mode.\n"
+    "  --jsonl             " UOPT(JSONL)            "Read JSON requests and write JSON responses.\n"
     "  --language=LANG     " UOPT(LANGUAGE)         "Use LANG.\n"
     "  --no-buffer-stdout  " UOPT(NO_BUFFER_STDOUT) "Set stdout to unbuffered.\n"
     "  --no-config         " UOPT(NO_CONFIG)        "Suppress reading configuration file.\n"
@@ -632,10 +768,12 @@ static void print_usage( int status ) {
     "  --no-typedefs       " UOPT(NO_TYPEDEFS)      "Suppress predefining standard types.\n"
     "  --no-using          " UOPT(NO_USING)         "Declare types with typedef, not using, in C++.\n"
     "  --output=FILE       " UOPT(OUTPUT)           "Write to FILE [default: stdout].\n"
+    "  --serve=PATH        " UOPT(SERVE)            "Serve clients on Unix domain socket PATH.\n"
     "  --trailing-return   " UOPT(TRAILING_RETURN)  "Print trailing return type in C++.\n"
     "  --trigraphs         " UOPT(TRIGRAPHS)        "Print trigraphs.\n"
     "  --version           " UOPT(VERSION)          "Print version and exit.\n"
     "  --west-pointer      " UOPT(WEST_POINTER)     "Print *, &, and && next to type.\n"
+    "  --zygote=PATH       " UOPT(ZYGOTE)           "Like --serve, but fork a child per client.\n"
     "\n"
     PACKAGE_NAME " home page: " PACKAGE_URL "\n"
     "Report bugs to: " PACKAGE_BUGREPORT "\n",
@@ -687,6 +825,9 @@ static void print_version( bool verbose ) {
 #ifdef ENABLE_MSAN
   PUT_CONFIG_OPT( "enable-msan" );
 #endif /* ENABLE_MSAN */
+#ifndef ENABLE_PREDEF_TABLE
+  PUT_CONFIG_OPT( "disable-predef-table" );
+#endif /* ENABLE_PREDEF_TABLE */
 #ifndef WITH_READLINE
   PUT_CONFIG_OPT( "without-readline" );
 #endif /* WITH_READLINE */
@@ -713,12 +854,6 @@ void cli_option_init( int *pargc, char const **pargv[const] ) {
   assert( pargv != NULL );
 
   opt_lang = is_cppdecl() ? LANG_CPP_NEW : LANG_C_NEW;
-#ifdef ENABLE_FLEX_DEBUG
-  //
-  // When -d is specified, Flex enables debugging by default -- undo that.
-  //
-  opt_flex_debug = false;
-#endif /* ENABLE_FLEX_DEBUG */
   parse_options( pargc, pargv );
   c_lang_set( opt_lang );
 }
@@ -30,6 +30,7 @@
 
 // local
 #include "pjl_config.h"                 /* must go first */
+#include "sink.h"
 #include "strbuf.h"
 #include "util.h"
 
@@ -123,16 +124,16 @@ extern char const  *sgr_warning;        ///< Color of `warning`.
 /**
  * Ends printing in \a sgr_color.
  *
- * @param file The `FILE` to print to.
+ * @param sink The \ref sink to print to.
  * @param sgr_color The predefined color.  If NULL, does nothing.  This _must_
  * be the same value that was passed to color_start().
  *
  * @sa color_start()
  */
 COLOR_H_INLINE
-void color_end( FILE *file, char const *sgr_color ) {
+void color_end( sink_t *sink, char const *sgr_color ) {
   if ( sgr_color != NULL )
-    FPUTS( SGR_END SGR_EL, file );
+    sink_puts( sink, SGR_END SGR_EL );
 }
 
 /**
@@ -145,16 +146,16 @@ void color_init( void );
 /**
  * Starts printing in the predefined \a sgr_color.
  *
- * @param file The `FILE` to print to.
+ * @param sink The \ref sink to print to.
  * @param sgr_color The predefined color.  If NULL, does nothing.
  *
  * @sa color_end()
  * @sa color_strbuf_start()
  */
 COLOR_H_INLINE
-void color_start( FILE *file, char const *sgr_color ) {
+void color_start( sink_t *sink, char const *sgr_color ) {
   if ( sgr_color != NULL )
-    FPRINTF( file, SGR_START SGR_EL, sgr_color );
+    sink_printf( sink, SGR_START SGR_EL, sgr_color );
 }
 
 /**
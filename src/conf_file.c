@@ -102,13 +102,18 @@ static bool read_conf_file( char const *conf_path ) {
 
 void conf_init( void ) {
   ASSERT_RUN_ONCE();
+  if ( !conf_read() )
+    fatal_error( EX_NOINPUT, "%s: %s\n", opt_conf_path, STRERROR() );
+}
 
+bool conf_read( void ) {
   char const *conf_path = opt_conf_path;
   if ( conf_path == NULL )
     conf_path = null_if_empty( getenv( "CDECLRC" ) );
 
   strbuf_t sbuf;
   strbuf_init( &sbuf );
+  bool ok = true;
 
   if ( conf_path == NULL ) {
     char const *const home = home_dir();
@@ -121,11 +126,14 @@ void conf_init( void ) {
 
   if ( conf_path != NULL ) {
     print_params.conf_path = conf_path;
-    if ( !read_conf_file( conf_path ) && opt_conf_path != NULL )
-      fatal_error( EX_NOINPUT, "%s: %s\n", conf_path, STRERROR() );
+    ok = read_conf_file( conf_path ) || opt_conf_path == NULL;
     print_params.conf_path = NULL;
-    strbuf_cleanup( &sbuf );
   }
+
+  int const saved_errno = errno;        // for the caller's STRERROR()
+  strbuf_cleanup( &sbuf );
+  errno = saved_errno;
+  return ok;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
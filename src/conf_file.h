@@ -23,9 +23,19 @@
 
 /**
  * @file
- * Declares a function for reading **cdecl**'s configuration file.
+ * Declares functions for reading **cdecl**'s configuration file.
  */
 
+// local
+#include "pjl_config.h"                 /* must go first */
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdbool.h>
+
+/// @endcond
+
 /**
  * @defgroup conf-file-group Configuration File
  * Functions for reading **cdecl**'s configuration file.
@@ -42,10 +52,27 @@
  *  2. The value of the `CDECLRC` environment variable; or:
  *  3. `~/.cdeclrc`
  *
+ * If the file was given explicitly but can't be read, prints an error
+ * message and exits.
+ *
  * @note This function must be called as most once.
+ *
+ * @sa conf_read()
  */
 void conf_init( void );
 
+/**
+ * Reads the configuration file, if any, the same way as conf_init() does,
+ * but may be called any number of times, e.g., once per \ref cdecl_session.
+ *
+ * @return Returns `false` only if the configuration file was given explicitly
+ * but couldn't be read (and `errno` is set).
+ *
+ * @sa conf_init()
+ */
+NODISCARD
+bool conf_read( void );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
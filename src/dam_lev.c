@@ -33,6 +33,7 @@
 #include <stdalign.h>
 #include <stdbool.h>
 #include <stddef.h>                     /* for NULL */
+#include <stdint.h>
 #include <string.h>
 
 ////////// inline functions ///////////////////////////////////////////////////
@@ -49,6 +50,18 @@ static inline size_t min_dist( size_t i, size_t j ) {
   return i < j ? i : j;
 }
 
+/**
+ * Gets the absolute difference between \a i and \a j.
+ *
+ * @param i The first number.
+ * @param j The second number
+ * @return Returns said difference.
+ */
+NODISCARD
+static inline size_t diff_dist( size_t i, size_t j ) {
+  return i > j ? i - j : j - i;
+}
+
 /**
  * Rounds \a n up to a multiple of \a multiple.
  *
@@ -90,6 +103,104 @@ static void** matrix2d_new( size_t esize, size_t ealign, size_t idim,
   return rows;
 }
 
+/**
+ * Calculates the _optimal string alignment_ distance between two strings, that
+ * is the Damerau-Levenshtein distance where no substring is edited more than
+ * once, but only if it's less than or equal to \a max_dist.
+ *
+ * @remarks The calculation is bit-parallel: every column of the matrix is
+ * represented by bit-vectors of the vertical differences between adjacent
+ * entries so a column is calculated in a few word-sized operations.
+ *
+ * @param source The source string.
+ * @param slen The length of \a source.  It must be &gt; 0 and &le;
+ * #DAM_LEV_BITS.
+ * @param target The target string.
+ * @param tlen The length of \a target.
+ * @param max_dist The maximum distance.
+ * @return Returns said distance if it's less than or equal to \a max_dist;
+ * otherwise returns \a max_dist + 1.
+ *
+ * @sa [Heikki Hyyrö. A Bit-Vector Algorithm for Computing Levenshtein and Damerau Edit Distances. Nordic Journal of Computing, 10(1), 2003](https://www.researchgate.net/publication/220693253)
+ */
+NODISCARD
+static size_t osa_dist_bits( char const *source, size_t slen,
+                             char const *target, size_t tlen,
+                             size_t max_dist ) {
+  assert( slen > 0 && slen <= DAM_LEV_BITS );
+
+  //
+  // Map from a character to the bit-vector of positions where it appears in
+  // source.  Rather than zeroing all 256 entries, zero only those that will be
+  // read.
+  //
+  uint64_t peq[256];
+  for ( size_t col = 0; col < tlen; ++col )
+    peq[ (unsigned char)target[ col ] ] = 0;
+  for ( size_t row = 0; row < slen; ++row )
+    peq[ (unsigned char)source[ row ] ] = 0;
+  for ( size_t row = 0; row < slen; ++row )
+    peq[ (unsigned char)source[ row ] ] |= UINT64_C(1) << row;
+
+  uint64_t const last_bit = UINT64_C(1) << (slen - 1);
+  uint64_t vp = ~UINT64_C(0);           // vertical +1 differences
+  uint64_t vn = 0;                      // vertical -1 differences
+  uint64_t d0 = 0;                      // diagonal zero differences
+  uint64_t prev_pm = 0;                 // peq of previous target character
+  size_t dist = slen;                   // the last row of the current column
+
+  for ( size_t col = 0; col < tlen; ++col ) {
+    uint64_t const pm = peq[ (unsigned char)target[ col ] ];
+    uint64_t const tr = ((~d0 & pm) << 1) & prev_pm;
+    d0 = (((pm & vp) + vp) ^ vp) | pm | vn | tr;
+    uint64_t const hp = vn | ~(d0 | vp);
+    uint64_t const hn = d0 & vp;
+    if ( (hp & last_bit) != 0 )
+      ++dist;
+    else if ( (hn & last_bit) != 0 )
+      --dist;
+    //
+    // The distance can decrease by at most 1 per remaining column, so stop if
+    // it can no longer get down to max_dist.
+    //
+    if ( dist > max_dist + (tlen - col - 1) )
+      return max_dist + 1;
+    uint64_t const x = (hp << 1) | 1;
+    vn = x & d0;
+    vp = (hn << 1) | ~(x | d0);
+    prev_pm = pm;
+  } // for
+
+  return dist;
+}
+
+/**
+ * Initializes the zeroth and first rows and columns of the matrix returned by
+ * dam_lev_new().
+ *
+ * @param dist_matrix The matrix to initialize.
+ * @param slen The length of the source string.
+ * @param tlen The length of the target string.
+ * @param inf The distance to use as infinity.
+ */
+static void dam_lev_matrix_init( size_t *const *dist_matrix, size_t slen,
+                                 size_t tlen, size_t inf ) {
+  //
+  // The zeroth row and column are for infinity; the last row and column are
+  // extras with higher-than-possible distances to prevent erroneous detection
+  // of transpositions that would be outside the bounds of the strings.
+  //
+  dist_matrix[0][0] = inf;
+  for ( size_t i = 0; i <= slen; ++i ) {
+    dist_matrix[i+1][1] = i;
+    dist_matrix[i+1][0] = inf;
+  } // for
+  for ( size_t j = 0; j <= tlen; ++j ) {
+    dist_matrix[1][j+1] = j;
+    dist_matrix[0][j+1] = inf;
+  } // for
+}
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 size_t dam_lev_dist( void *working_mem, char const *source, size_t slen,
@@ -108,22 +219,9 @@ size_t dam_lev_dist( void *working_mem, char const *source, size_t slen,
   if ( tlen == 0 )
     return slen;                        // LCOV_EXCL_LINE
 
-  //
-  // The zeroth row and column are for infinity; the last row and column are
-  // extras with higher-than-possible distances to prevent erroneous detection
-  // of transpositions that would be outside the bounds of the strings.
-  //
   size_t const inf = slen + tlen;
   size_t *const *const dist_matrix = POINTER_CAST( size_t**, working_mem );
-  dist_matrix[0][0] = inf;
-  for ( size_t i = 0; i <= slen; ++i ) {
-    dist_matrix[i+1][1] = i;
-    dist_matrix[i+1][0] = inf;
-  } // for
-  for ( size_t j = 0; j <= tlen; ++j ) {
-    dist_matrix[1][j+1] = j;
-    dist_matrix[0][j+1] = inf;
-  } // for
+  dam_lev_matrix_init( dist_matrix, slen, tlen, inf );
 
   // Map from a character to the row where it last appeared in source.
   size_t last_row[256] = { 0 };
@@ -191,6 +289,117 @@ size_t dam_lev_dist( void *working_mem, char const *source, size_t slen,
   return dist_matrix[ slen+1 ][ tlen+1 ];
 }
 
+size_t dam_lev_dist_max( void *working_mem, char const *source, size_t slen,
+                         char const *target, size_t tlen, size_t max_dist ) {
+  assert( working_mem != NULL );
+  assert( source != NULL );
+  assert( target != NULL );
+
+  // The distance can never be more than the length of the longer string.
+  max_dist = min_dist( max_dist, slen > tlen ? slen : tlen );
+
+  // Every entry is at least its distance from the main diagonal.
+  if ( diff_dist( slen, tlen ) > max_dist )
+    return max_dist + 1;
+  if ( slen == 0 || tlen == 0 )
+    return slen + tlen;                 // LCOV_EXCL_LINE
+
+  if ( slen <= DAM_LEV_BITS || tlen <= DAM_LEV_BITS ) {
+    //
+    // The optimal string alignment distance is never less than the
+    // Damerau-Levenshtein distance.  The only difference is that a
+    // transposition having g > 0 edits between the transposed characters costs
+    // 1 + g for the latter, but must instead be done as a deletion and an
+    // insertion for 2 + g for the former.  Since each such transposition costs
+    // at least 2, the former is at most 3/2 the latter.  Hence, it's a fast
+    // bound in both directions.
+    //
+    size_t const max_osa_dist = max_dist + max_dist / 2;
+    size_t const osa_dist = slen <= DAM_LEV_BITS ?
+      osa_dist_bits( source, slen, target, tlen, max_osa_dist ) :
+      osa_dist_bits( target, tlen, source, slen, max_osa_dist );
+    if ( osa_dist > max_osa_dist )
+      return max_dist + 1;
+    if ( osa_dist <= 2 )                // 3/2 bound means they're the same
+      return osa_dist;
+    max_dist = min_dist( max_dist, osa_dist );
+  }
+
+  //
+  // This is the same as dam_lev_dist() except only entries within max_dist of
+  // the main diagonal are calculated: every entry outside that band is at
+  // least its distance from the main diagonal, hence is more than max_dist.
+  // The entries just outside the band that are read by the next row are set to
+  // infinity.
+  //
+  size_t const inf = slen + tlen;
+  size_t *const *const dist_matrix = POINTER_CAST( size_t**, working_mem );
+  dam_lev_matrix_init( dist_matrix, slen, tlen, inf );
+
+  // As with osa_dist_bits(), zero only those entries that will be read.
+  size_t last_row[256];
+  for ( size_t col = 0; col < tlen; ++col )
+    last_row[ (unsigned char)target[ col ] ] = 0;
+
+  for ( size_t row = 1; row <= slen; ++row ) {
+    char const sc = source[ row - 1 ];
+    size_t const lo_col = row > max_dist ? row - max_dist : 1;
+    size_t const hi_col = min_dist( tlen, row + max_dist );
+    size_t last_match_col = 0;
+
+    // The least entry in the current row including the one in column 0.
+    size_t row_min = row > max_dist ? inf : row;
+
+    if ( lo_col > 1 )
+      dist_matrix[ row+1 ][ lo_col ] = inf;
+
+    for ( size_t col = lo_col; col <= hi_col; ++col ) {
+      char const tc = target[ col - 1 ];
+      size_t const last_match_row = last_row[ (unsigned char)tc ];
+      bool const match = sc == tc;
+
+      size_t const ins_dist = dist_matrix[ row   ][ col+1 ] + 1;
+      size_t const del_dist = dist_matrix[ row+1 ][ col   ] + 1;
+      size_t const sub_dist = dist_matrix[ row   ][ col   ] + !match;
+      //
+      // A transposition can only be within max_dist if the entry it's from is
+      // within the band; otherwise that entry may not have been calculated.
+      //
+      size_t const xpos_dist =
+        diff_dist( last_match_row, last_match_col ) > max_dist ? inf :
+          dist_matrix[ last_match_row ][ last_match_col ]
+          + (row - last_match_row - 1)
+          + (col - last_match_col - 1)
+          + 1;
+
+      size_t dist_min = min_dist( ins_dist, del_dist );
+             dist_min = min_dist( dist_min, sub_dist );
+             dist_min = min_dist( dist_min, xpos_dist );
+      dist_matrix[ row+1 ][ col+1 ] = dist_min;
+      row_min = min_dist( row_min, dist_min );
+
+      if ( match )
+        last_match_col = col;
+    } // for
+
+    if ( hi_col < tlen )
+      dist_matrix[ row+1 ][ hi_col+2 ] = inf;
+
+    //
+    // No entry in a subsequent row can be less than the least entry in this
+    // row: even a transposition from an earlier row must delete this row's
+    // character.
+    //
+    if ( row_min > max_dist )
+      return max_dist + 1;
+
+    last_row[ (unsigned char)sc ] = row;
+  } // for
+
+  size_t const dist = dist_matrix[ slen+1 ][ tlen+1 ];
+  return dist > max_dist ? max_dist + 1 : dist;
+}
+
 void* dam_lev_new( size_t max_source_len, size_t max_target_len ) {
   return matrix2d_new(
     sizeof(size_t), alignof(size_t), max_source_len + 2, max_target_len + 2
@@ -32,6 +32,12 @@
 // standard
 #include <stddef.h>                     /* for size_t */
 
+/**
+ * The maximum length of either string for which dam_lev_dist_max() can use a
+ * bit-parallel calculation.
+ */
+#define DAM_LEV_BITS              64
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
@@ -53,6 +59,34 @@ NODISCARD
 size_t dam_lev_dist( void *working_mem, char const *source, size_t source_len,
                      char const *target, size_t target_len );
 
+/**
+ * Calculates the _Damerau-Levenshtein distance_ between two strings exactly
+ * as dam_lev_dist() does, but only if it's less than or equal to \a max_dist.
+ *
+ * @remarks This is much faster than dam_lev_dist() when most strings are
+ * farther apart than \a max_dist because:
+ *  + If either string is at most #DAM_LEV_BITS long, a bit-parallel lower
+ *    bound is calculated first that often rejects the strings outright.
+ *  + Otherwise, only the diagonal band of the matrix within \a max_dist of the
+ *    main diagonal is calculated and the calculation stops as soon as no
+ *    entry in a row is within \a max_dist.
+ *
+ * @param working_mem A pointer to working memory returned by dam_lev_new().
+ * @param source The source string.
+ * @param source_len The length of \a source.
+ * @param target The target string.
+ * @param target_len The length of \a target.
+ * @param max_dist The maximum distance.
+ * @return Returns said distance if it's less than or equal to \a max_dist;
+ * otherwise returns \a max_dist + 1.
+ *
+ * @sa dam_lev_dist()
+ */
+NODISCARD
+size_t dam_lev_dist_max( void *working_mem, char const *source,
+                         size_t source_len, char const *target,
+                         size_t target_len, size_t max_dist );
+
 /**
  * Allocates working memory for use with subsequent calls of dam_lev_dist().
  *
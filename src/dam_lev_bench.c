@@ -0,0 +1,266 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/dam_lev_bench.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines main() for a microbenchmark of dam_lev_dist() versus
+ * dam_lev_dist_max().
+ *
+ * @remarks Usage: `dam_lev_bench [queries]`.  The corpus is every C/C++
+ * keyword, **cdecl** keyword, and predefined type name.  Each query is a
+ * corpus word with two adjacent letters transposed that is compared against
+ * every corpus word by both functions to find the least distance.  As "Did you
+ * mean ...?" does, dam_lev_dist_max() starts with the maximum distance that
+ * could be "similar enough" and lowers it to the least distance found so far.
+ * The results are checked for agreement.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "c_keyword.h"
+#include "c_sname.h"
+#include "c_typedef.h"
+#include "cdecl.h"
+#include "cdecl_keyword.h"
+#include "cdecl_session.h"
+#include "dam_lev.h"
+#include "libcdecl.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdint.h>                     /* for SIZE_MAX */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+/// @endcond
+
+/// Default number of queries.
+#define BENCH_QUERIES_DEFAULT     500
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The corpus of words.
+ */
+struct bench_corpus {
+  char const  **words;                  ///< Words.
+  size_t       *lens;                   ///< Lengths of \ref words.
+  size_t        len;                    ///< Number of \ref words.
+  size_t        cap;                    ///< Capacity of \ref words.
+  size_t        max_word_len;           ///< Length of longest word.
+};
+typedef struct bench_corpus bench_corpus_t;
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Adds a copy of \a word to \a corpus.
+ *
+ * @param corpus The \ref bench_corpus to add to.
+ * @param word The word to add.
+ */
+static void bench_add( bench_corpus_t *corpus, char const *word ) {
+  if ( corpus->len == corpus->cap ) {
+    corpus->cap = corpus->cap == 0 ? 256 : corpus->cap * 2;
+    REALLOC( corpus->words, char const*, corpus->cap );
+    REALLOC( corpus->lens, size_t, corpus->cap );
+  }
+  size_t const len = strlen( word );
+  if ( len > corpus->max_word_len )
+    corpus->max_word_len = len;
+  corpus->lens[ corpus->len ] = len;
+  corpus->words[ corpus->len++ ] = check_strdup( word );
+}
+
+/**
+ * A \ref c_typedef visitor function that adds the type's name to the corpus.
+ *
+ * @param tdef The \ref c_typedef to visit.
+ * @param v_data A pointer to the \ref bench_corpus.
+ * @return Always returns `false`.
+ */
+static bool bench_typedef_visitor( c_typedef_t const *tdef, void *v_data ) {
+  bench_add( v_data, c_sname_full_name( &tdef->ast->sname ) );
+  return false;
+}
+
+/**
+ * Gets the maximum edit distance "Did you mean ...?" would use for a word of
+ * length \a len.
+ *
+ * @param len The length of the word.
+ * @return Returns said distance.
+ */
+static size_t bench_max_dist( size_t len ) {
+  size_t max_dist = 0;
+  while ( max_dist + 1 <=
+          STATIC_CAST( size_t, STATIC_CAST( double, len + max_dist + 1 ) * .37
+                               + 0.5 ) ) {
+    ++max_dist;
+  } // while
+  return max_dist;
+}
+
+// LCOV_EXCL_START
+_Noreturn
+static void usage( void ) {
+  fprintf( stderr, "usage: %s [queries]\n", me );
+  exit( EX_USAGE );
+}
+// LCOV_EXCL_STOP
+
+////////// main ///////////////////////////////////////////////////////////////
+
+/**
+ * The main entry point.
+ *
+ * @param argc The command-line argument count.
+ * @param argv The command-line argument values.
+ * @return Returns 0 on success, non-zero on failure.
+ */
+int main( int argc, char const *argv[] ) {
+  cdecl_lib_init( /*prog_name=*/NULL );
+
+  unsigned long queries = BENCH_QUERIES_DEFAULT;
+  switch ( argc ) {
+    case 1:
+      break;
+    case 2:
+      queries = strtoul( argv[1], /*endptr=*/NULL, 10 );
+      if ( queries > 0 )
+        break;
+      FALLTHROUGH;
+    default:
+      usage();
+  } // switch
+
+  cdecl_session_t *const session = cdecl_lib_session_new();
+  cdecl_session_t *const prev_session = cdecl_session_set( session );
+
+  bench_corpus_t corpus = { 0 };
+  FOREACH_C_KEYWORD( ck )
+    bench_add( &corpus, ck->literal );
+  FOREACH_CDECL_KEYWORD( cdk )
+    bench_add( &corpus, cdk->literal );
+  PJL_IGNORE_RV( c_typedef_visit( &bench_typedef_visitor, &corpus ) );
+
+  if ( queries > corpus.len )
+    queries = corpus.len;
+
+  // Make each query by transposing the middle two letters of a corpus word.
+  char **const query = MALLOC( char*, queries );
+  size_t *const query_len = MALLOC( size_t, queries );
+  size_t max_query_len = 0;
+  for ( size_t q = 0; q < queries; ++q ) {
+    size_t const w = q * corpus.len / queries;
+    query[q] = check_strdup( corpus.words[w] );
+    query_len[q] = corpus.lens[w];
+    if ( query_len[q] > max_query_len )
+      max_query_len = query_len[q];
+    if ( query_len[q] >= 2 ) {
+      size_t const i = query_len[q] / 2 - 1;
+      char const c = query[q][i];
+      query[q][i] = query[q][i+1];
+      query[q][i+1] = c;
+    }
+  } // for
+
+  void *const dam_lev_mem = dam_lev_new( max_query_len, corpus.max_word_len );
+  size_t const calls = queries * corpus.len;
+  size_t *const least_dist = MALLOC( size_t, queries );
+
+  double start = monotonic_now();
+  for ( size_t q = 0; q < queries; ++q ) {
+    least_dist[q] = SIZE_MAX;
+    for ( size_t w = 0; w < corpus.len; ++w ) {
+      size_t const dist = dam_lev_dist(
+        dam_lev_mem, query[q], query_len[q], corpus.words[w], corpus.lens[w]
+      );
+      if ( dist < least_dist[q] )
+        least_dist[q] = dist;
+    } // for
+  } // for
+  double const full_elapsed = monotonic_now() - start;
+
+  size_t *const least_max_dist = MALLOC( size_t, queries );
+
+  start = monotonic_now();
+  for ( size_t q = 0; q < queries; ++q ) {
+    least_max_dist[q] = bench_max_dist( query_len[q] );
+    for ( size_t w = 0; w < corpus.len; ++w ) {
+      size_t const dist = dam_lev_dist_max(
+        dam_lev_mem, query[q], query_len[q], corpus.words[w], corpus.lens[w],
+        least_max_dist[q]
+      );
+      if ( dist < least_max_dist[q] )
+        least_max_dist[q] = dist;
+    } // for
+  } // for
+  double const max_elapsed = monotonic_now() - start;
+
+  // Check that both agree outside of the timed loops.
+  size_t matches = 0;
+  for ( size_t q = 0; q < queries; ++q ) {
+    size_t const max_dist = bench_max_dist( query_len[q] );
+    if ( least_dist[q] <= max_dist )
+      ++matches;
+    size_t const expected_dist =
+      least_dist[q] < max_dist ? least_dist[q] : max_dist;
+    if ( least_max_dist[q] != expected_dist ) {
+      fatal_error( EX_SOFTWARE,
+        "\"%s\": least distance %zu != %zu\n",
+        query[q], least_max_dist[q], expected_dist
+      );
+    }
+  } // for
+
+  printf( "%zu words, %lu queries, %zu similar enough\n",
+    corpus.len, queries, matches
+  );
+  printf( "dam_lev_dist:     %.3fs (%.1fns/call)\n",
+    full_elapsed, full_elapsed * 1e9 / STATIC_CAST( double, calls )
+  );
+  printf( "dam_lev_dist_max: %.3fs (%.1fns/call, %.1fx)\n",
+    max_elapsed, max_elapsed * 1e9 / STATIC_CAST( double, calls ),
+    max_elapsed > 0 ? full_elapsed / max_elapsed : 0.0
+  );
+
+  free( dam_lev_mem );
+  free( least_dist );
+  free( least_max_dist );
+  for ( size_t q = 0; q < queries; ++q )
+    free( query[q] );
+  free( query );
+  free( query_len );
+  for ( size_t w = 0; w < corpus.len; ++w )
+    FREE( corpus.words[w] );
+  free( corpus.words );
+  free( corpus.lens );
+  PJL_IGNORE_RV( cdecl_session_set( prev_session ) );
+  cdecl_session_free( session );
+  exit( EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,221 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/dam_lev_test.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "dam_lev.h"
+#include "sink.h"
+#include "util.h"
+#include "unit_test.h"
+
+// standard
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+/// Maximum length of random strings; more than DAM_LEV_BITS to test both.
+#define RANDOM_LEN_MAX            (DAM_LEV_BITS + 8)
+
+/// Number of random string pairs to test.
+#define RANDOM_PAIRS              20000
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A string pair and its Damerau-Levenshtein distance.
+ */
+struct dam_lev_test {
+  char const *source;                   ///< Source string.
+  char const *target;                   ///< Target string.
+  size_t      dist;                     ///< Expected distance.
+};
+typedef struct dam_lev_test dam_lev_test_t;
+
+// extern variables
+char const         *me;                 ///< Program name.
+
+// local variables
+static unsigned     test_failures;
+
+static dam_lev_test_t const DAM_LEV_TESTS[] = {
+  { "",         "",         0 },
+  { "",         "abc",      3 },
+  { "abc",      "",         3 },
+  { "abc",      "abc",      0 },
+  { "abc",      "abd",      1 },
+  { "abc",      "acb",      1 },
+  { "abc",      "ab",       1 },
+  { "abc",      "abcd",     1 },
+  { "ca",       "abc",      2 },    // optimal string alignment would be 3
+  { "char",     "chra",     1 },
+  { "const",    "cnost",    1 },
+  { "struct",   "strcut",   1 },
+  { "unsigned", "usngiend", 3 },
+  { "typedef",  "xyzzy",    6 },
+};
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Gets a pseudo-random number.
+ *
+ * @remarks The standard **rand**(3) isn't used so the strings are the same on
+ * every platform.
+ *
+ * @return Returns said number.
+ */
+static uint32_t test_rand( void ) {
+  static uint32_t state = 2463534242u;
+  state ^= state << 13;
+  state ^= state >> 17;
+  state ^= state << 5;
+  return state;
+}
+
+/**
+ * Fills \a s with a pseudo-random string over a small alphabet so that
+ * matches and transpositions are common.
+ *
+ * @param s The buffer to fill.  It must be at least #RANDOM_LEN_MAX + 1 long.
+ * @return Returns the length of \a s.
+ */
+static size_t test_rand_str( char *s ) {
+  size_t const len = test_rand() % (RANDOM_LEN_MAX + 1);
+  for ( size_t i = 0; i < len; ++i )
+    s[i] = STATIC_CAST( char, 'a' + test_rand() % 4 );
+  s[ len ] = '\0';
+  return len;
+}
+
+/**
+ * Copies \a source to \a target with a few pseudo-random edits so that the
+ * strings are close.
+ *
+ * @param source The source string.
+ * @param slen The length of \a source.
+ * @param target The buffer to copy to.  It must be at least #RANDOM_LEN_MAX + 1
+ * long.
+ * @return Returns the length of \a target.
+ */
+static size_t test_rand_edit( char const *source, size_t slen, char *target ) {
+  strcpy( target, source );
+  size_t tlen = slen;
+  for ( unsigned edits = test_rand() % 4; edits > 0; --edits ) {
+    size_t const i = tlen > 0 ? test_rand() % tlen : 0;
+    switch ( test_rand() % 4 ) {
+      case 0:                           // insertion
+        if ( tlen == RANDOM_LEN_MAX )
+          break;
+        memmove( target + i + 1, target + i, tlen - i + 1 );
+        target[i] = STATIC_CAST( char, 'a' + test_rand() % 4 );
+        ++tlen;
+        break;
+      case 1:                           // deletion
+        if ( tlen == 0 )
+          break;
+        memmove( target + i, target + i + 1, tlen - i );
+        --tlen;
+        break;
+      case 2:                           // substitution
+        if ( tlen > 0 )
+          target[i] = STATIC_CAST( char, 'a' + test_rand() % 4 );
+        break;
+      case 3:                           // transposition
+        if ( i + 1 < tlen ) {
+          char const c = target[i];
+          target[i] = target[i+1];
+          target[i+1] = c;
+        }
+        break;
+    } // switch
+  } // for
+  return tlen;
+}
+
+/**
+ * Tests that dam_lev_dist_max() agrees with dam_lev_dist() for every maximum
+ * distance from 0 to one more than the distance.
+ *
+ * @param working_mem The working memory to use.
+ * @param source The source string.
+ * @param slen The length of \a source.
+ * @param target The target string.
+ * @param tlen The length of \a target.
+ * @return Returns said distance.
+ */
+static size_t test_dam_lev_max( void *working_mem, char const *source,
+                                size_t slen, char const *target,
+                                size_t tlen ) {
+  size_t const dist = dam_lev_dist( working_mem, source, slen, target, tlen );
+  for ( size_t max_dist = 0; max_dist <= dist + 1; ++max_dist ) {
+    size_t const expected = dist > max_dist ? max_dist + 1 : dist;
+    if ( !TEST( dam_lev_dist_max( working_mem, source, slen, target, tlen,
+                                  max_dist ) == expected ) ) {
+      EPRINTF( "  \"%s\", \"%s\", %zu\n", source, target, max_dist );
+      break;
+    }
+  } // for
+  TEST( dam_lev_dist_max( working_mem, source, slen, target, tlen,
+                          SIZE_MAX ) == dist );
+  return dist;
+}
+
+// LCOV_EXCL_START
+_Noreturn
+static void usage( void ) {
+  EPRINTF( "usage: %s\n", me );
+  exit( EX_USAGE );
+}
+// LCOV_EXCL_STOP
+
+////////// main ///////////////////////////////////////////////////////////////
+
+int main( int argc, char const *argv[const] ) {
+  me = base_name( argv[0] );
+  if ( --argc != 0 )
+    usage();                            // LCOV_EXCL_LINE
+
+  void *const working_mem = dam_lev_new( RANDOM_LEN_MAX, RANDOM_LEN_MAX );
+
+  FOREACH_ARRAY_ELEMENT( dam_lev_test_t, t, DAM_LEV_TESTS ) {
+    TEST( test_dam_lev_max( working_mem, t->source, strlen( t->source ),
+                            t->target, strlen( t->target ) ) == t->dist );
+  } // for
+
+  char source[ RANDOM_LEN_MAX + 1 ], target[ RANDOM_LEN_MAX + 1 ];
+  for ( unsigned i = 0; i < RANDOM_PAIRS; ++i ) {
+    size_t const slen = test_rand_str( source );
+    size_t const tlen = i % 2 == 0 ?
+      test_rand_str( target ) : test_rand_edit( source, slen, target );
+    PJL_IGNORE_RV(
+      test_dam_lev_max( working_mem, source, slen, target, tlen )
+    );
+  } // for
+
+  free( working_mem );
+
+  printf( "%u failures\n", test_failures );
+  exit( test_failures > 0 ? EX_SOFTWARE : EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
@@ -27,6 +27,7 @@
 // local
 #include "pjl_config.h"                 /* must go first */
 #include "did_you_mean.h"
+#include "bk_tree.h"
 #include "c_keyword.h"
 #include "c_lang.h"
 #include "c_sname.h"
@@ -34,7 +35,6 @@
 #include "cdecl_command.h"
 #include "cdecl_keyword.h"
 #include "cli_options.h"
-#include "dam_lev.h"
 #include "set_options.h"
 #include "util.h"
 
@@ -50,15 +50,35 @@
  */
 
 /**
- * Used by copy_typedefs() and copy_typedef_visitor() to pass and return data.
+ * A BK-tree of candidate literals for a \ref dym_kind.
  */
-struct copy_typedef_visit_data {
-  /// Pointer to a pointer to a candidate list or NULL to just get the count.
-  did_you_mean_t  **pdym;
+struct dym_tree {
+  dym_kind_t  kind;                     ///< The kind of candidates.
+  bk_tree_t   tree;                     ///< The candidates.
+};
+typedef struct dym_tree dym_tree_t;
+
+/**
+ * Data passed to dym_visitor().
+ */
+struct dym_visit_data {
+  /**
+   * Candidates at \ref best_dist.  Until dym_new() returns, their literals
+   * point into the BK-trees and aren't copied.
+   */
+  did_you_mean_t *dym_array;
 
-  size_t            count;              ///< The count.
+  size_t          dym_len;              ///< Length of \ref dym_array.
+  size_t          dym_cap;              ///< Capacity of \ref dym_array.
+  size_t          best_dist;            ///< Least distance found so far.
+
+  /**
+   * If `true`, the user data of each node points to a \ref c_typedef;
+   * otherwise, it's the \ref c_lang_id_t the literal is in.
+   */
+  bool            is_typedef;
 };
-typedef struct copy_typedef_visit_data copy_typedef_visit_data_t;
+typedef struct dym_visit_data dym_visit_data_t;
 
 /**
  * The edit distance must be less than or equal to this percent of a target
@@ -67,192 +87,145 @@ typedef struct copy_typedef_visit_data copy_typedef_visit_data_t;
  */
 static double const SIMILAR_ENOUGH_PERCENT = .37;
 
+/**
+ * BK-trees of candidate literals for every \ref dym_kind except `typedef`s
+ * that are in c_typedef_names() instead.
+ *
+ * @remarks Since the candidates are the same for all sessions, the trees are
+ * built once by dym_init() and only ever read thereafter.
+ */
+static dym_tree_t dym_trees[] = {
+  { DYM_COMMANDS,       { 0 } },
+  { DYM_CLI_OPTIONS,    { 0 } },
+  { DYM_SET_OPTIONS,    { 0 } },
+  { DYM_C_ATTRIBUTES,   { 0 } },
+  { DYM_C_KEYWORDS,     { 0 } },
+  { DYM_C_TYPES,        { 0 } },
+  { DYM_CDECL_KEYWORDS, { 0 } },
+};
+
 ////////// local functions ////////////////////////////////////////////////////
 
 /**
- * Copies C/C++ keywords in the current language to the candidate list pointed
- * to by \a pdym; if \a pdym is NULL, only counts the number of keywords.
- *
- * @param pdym A pointer to the current \ref did_you_mean pointer or NULL to
- * just count keywords, not copy.  If not NULL, on return, the pointed-to
- * pointer is incremented.
- * @param tpid The type part ID that a keyword must have in order to be copied
- * (or counted).
- * @return If \a pdym is NULL, returns said number of keywords; otherwise the
- * return value is unspecifed.
+ * Cleans up all \ref dym_trees.
  */
-PJL_DISCARD
-static size_t copy_c_keywords( did_you_mean_t **const pdym, c_tpid_t tpid ) {
-  size_t count = 0;
-  FOREACH_C_KEYWORD( ck ) {
-    if ( opt_lang_is_any( ck->lang_ids ) && c_tid_tpid( ck->tid ) == tpid ) {
-      if ( pdym == NULL )
-        ++count;
-      else
-        (*pdym)++->literal = check_strdup( ck->literal );
-    }
-  } // for
-  return count;
+static void dym_cleanup( void ) {
+  for ( size_t i = 0; i < ARRAY_SIZE( dym_trees ); ++i )
+    bk_tree_cleanup( &dym_trees[i].tree );
 }
 
 /**
- * Copies **cdecl** keywords in the current language to the candidate list
- * pointed to by \a pdym; if \a pdym is NULL, only counts the number of
- * keywords.
+ * Inserts \a literal into \a tree.
  *
- * @param pdym A pointer to the current \ref did_you_mean pointer or NULL to
- * just count keywords, not copy.  If not NULL, on return, the pointed-to
- * pointer is incremented.
- * @return If \a pdym is NULL, returns said number of keywords; otherwise the
- * return value is unspecifed.
+ * @param tree The BK-tree to insert into.
+ * @param literal The literal to insert.
+ * @param lang_ids The language(s) \a literal is in.
  */
-PJL_DISCARD
-static size_t copy_cdecl_keywords( did_you_mean_t **const pdym ) {
-  assert( cdecl_mode == CDECL_ENGLISH_TO_GIBBERISH );
-
-  size_t count = 0;
-  FOREACH_CDECL_KEYWORD( cdk ) {
-    if ( !opt_lang_is_any( cdk->lang_ids ) )
-      continue;
-    char const *literal;
-    if ( cdk->lang_syn == NULL )
-      literal = cdk->literal;
-    else if ( (literal = c_lang_literal( cdk->lang_syn )) == NULL )
-      continue;
-    if ( pdym == NULL )
-      ++count;
-    else
-      (*pdym)++->literal = check_strdup( literal );
-  } // for
-  return count;
+static void dym_insert( bk_tree_t *tree, char const *literal,
+                        c_lang_id_t lang_ids ) {
+  bk_tree_insert( tree, literal, (user_data_t){ .ui32 = lang_ids } );
 }
 
 /**
- * Copies **cdecl** commands in the current language to the candidate list
- * pointed to by \a pdym; if \a pdym is NULL, only counts the number of
- * commands.
+ * Inserts C/C++ keywords into \a tree.
  *
- * @param pdym A pointer to the current \ref did_you_mean pointer or NULL to
- * just count commands, not copy.  If not NULL, on return, the pointed-to
- * pointer is incremented.
- * @return If \a pdym is NULL, returns said number of commands; otherwise the
- * return value is unspecifed.
+ * @param tree The BK-tree to insert into.
+ * @param tpid The type part ID that a keyword must have in order to be
+ * inserted.
  */
-PJL_DISCARD
-static size_t copy_commands( did_you_mean_t **const pdym ) {
-  size_t count = 0;
-  FOREACH_CDECL_COMMAND( command ) {
-    if ( opt_lang_is_any( command->lang_ids ) ) {
-      if ( pdym == NULL )
-        ++count;
-      else
-        (*pdym)++->literal = check_strdup( command->literal );
-    }
+static void dym_insert_c_keywords( bk_tree_t *tree, c_tpid_t tpid ) {
+  FOREACH_C_KEYWORD( ck ) {
+    if ( c_tid_tpid( ck->tid ) == tpid )
+      dym_insert( tree, ck->literal, ck->lang_ids );
   } // for
-  return count;
 }
 
 /**
- * Copies **cdecl** command-line options to the candidate list pointed to by \a
- * pdym; if \a pdym is NULL, only counts the number of options.
+ * Inserts **cdecl** keywords into \a tree.
  *
- * @param pdym A pointer to the current \ref did_you_mean pointer or NULL to
- * just count options, not copy.  If not NULL, on return, the pointed-to
- * pointer is incremented.
- * @return If \a pdym is NULL, returns said number of options; otherwise the
- * return value is unspecifed.
+ * @remarks For a keyword having language-specific synonyms, every synonym is
+ * inserted for only the language(s) c_lang_literal() would return it for.
+ *
+ * @param tree The BK-tree to insert into.
  */
-PJL_DISCARD
-static size_t copy_cli_options( did_you_mean_t **pdym ) {
-  size_t count = 0;
-  FOREACH_CLI_OPTION( opt ) {
-    if ( pdym == NULL )
-      ++count;
-    else
-      (*pdym)++->literal = check_strdup( opt->name );
+static void dym_insert_cdecl_keywords( bk_tree_t *tree ) {
+  FOREACH_CDECL_KEYWORD( cdk ) {
+    if ( cdk->lang_syn == NULL ) {
+      dym_insert( tree, cdk->literal, cdk->lang_ids );
+      continue;
+    }
+    c_lang_id_t prev_lang_ids = LANG_NONE;
+    for ( c_lang_lit_t const *ll = cdk->lang_syn; ll->literal != NULL; ++ll ) {
+      c_lang_id_t const lang_ids =
+        cdk->lang_ids & ll->lang_ids & ~prev_lang_ids;
+      if ( lang_ids != LANG_NONE )
+        dym_insert( tree, ll->literal, lang_ids );
+      prev_lang_ids |= ll->lang_ids;
+    } // for
   } // for
-  return count;
 }
 
 /**
- * Copies **cdecl** `set` options to the candidate list pointed to by \a pdym;
- * if \a pdym is NULL, only counts the number of options.
+ * Inserts **cdecl** `set` options into \a tree.
  *
- * @param pdym A pointer to the current \ref did_you_mean pointer or NULL to
- * just count options, not copy.  If not NULL, on return, the pointed-to
- * pointer is incremented.
- * @return If \a pdym is NULL, returns said number of options; otherwise the
- * return value is unspecifed.
+ * @param tree The BK-tree to insert into.
  */
-PJL_DISCARD
-static size_t copy_set_options( did_you_mean_t **const pdym ) {
-  size_t count = 0;
+static void dym_insert_set_options( bk_tree_t *tree ) {
   FOREACH_SET_OPTION( opt ) {
     switch ( opt->kind ) {
       case SET_OPTION_TOGGLE:
-        if ( pdym == NULL ) {
-          count += 2;
-        } else {
-          (*pdym)++->literal = check_strdup( opt->name );
-          (*pdym)++->literal = check_prefix_strdup( "no", 2, opt->name );
-        }
+        dym_insert( tree, opt->name, LANG_ANY );
+        FALLTHROUGH;
+      case SET_OPTION_NEG_ONLY: {
+        char *const no_name = check_prefix_strdup( "no", 2, opt->name );
+        dym_insert( tree, no_name, LANG_ANY );
+        FREE( no_name );
         break;
+      }
       case SET_OPTION_AFF_ONLY:
-        if ( pdym == NULL )
-          ++count;
-        else
-          (*pdym)++->literal = check_strdup( opt->name );
-        break;
-      case SET_OPTION_NEG_ONLY:
-        if ( pdym == NULL )
-          ++count;
-        else
-          (*pdym)++->literal = check_prefix_strdup( "no", 2, opt->name );
+        dym_insert( tree, opt->name, LANG_ANY );
         break;
     } // switch
   } // for
-  return count;
 }
 
 /**
- * A \ref c_typedef visitor function to copy names of types that are only valid
- * in the current language to the candidate list pointed to.
+ * A BK-tree visitor function that collects the candidates in the current
+ * language having the least edit distance.
  *
- * @param tdef The c_typedef to visit.
- * @param data A pointer to a \ref copy_typedef_visit_data.
- * @return Always returns `false`.
+ * @param literal The candidate literal.
+ * @param dist The edit distance of \a literal.
+ * @param data The user data of \a literal.
+ * @param v_data A pointer to a \ref dym_visit_data.
+ * @return Returns the least edit distance found so far.
  */
-PJL_DISCARD
-static bool copy_typedef_visitor( c_typedef_t const *tdef, void *data ) {
-  assert( tdef != NULL );
-  assert( data != NULL );
-
-  if ( opt_lang_is_any( tdef->lang_ids ) ) {
-    copy_typedef_visit_data_t *const ctvd = data;
-    if ( ctvd->pdym == NULL ) {
-      ++ctvd->count;
-    } else {
-      char const *const name = c_sname_full_name( &tdef->ast->sname );
-      (*ctvd->pdym)++->literal = check_strdup( name );
-    }
+NODISCARD
+static size_t dym_visitor( char const *literal, size_t dist, user_data_t data,
+                           void *v_data ) {
+  assert( literal != NULL );
+  assert( v_data != NULL );
+  dym_visit_data_t *const dvd = v_data;
+
+  c_lang_id_t const lang_ids = dvd->is_typedef ?
+    POINTER_CAST( c_typedef_t const*, data.pc )->lang_ids : data.ui32;
+  if ( !opt_lang_is_any( lang_ids ) )
+    return dvd->best_dist;
+
+  if ( dist < dvd->best_dist ) {
+    dvd->dym_len = 0;
+    dvd->best_dist = dist;
   }
-  return false;
-}
 
-/**
- * Counts the number of `typedef`s that are only valid in the current language.
- *
- * @param pdym A pointer to the current \ref did_you_mean pointer or NULL to
- * just count typedefs, not copy.  If not NULL, on return, the pointed-to
- * pointer is incremented.
- * @return If \a pdym is NULL, returns said number of `typedef`s; otherwise the
- * return value is unspecifed.
- */
-PJL_DISCARD
-static size_t copy_typedefs( did_you_mean_t **const pdym ) {
-  copy_typedef_visit_data_t ctvd = { pdym, 0 };
-  c_typedef_visit( &copy_typedef_visitor, &ctvd );
-  return ctvd.count;
+  if ( dvd->dym_len + 1 >= dvd->dym_cap ) {
+    dvd->dym_cap = dvd->dym_cap == 0 ? 8 : dvd->dym_cap * 2;
+    REALLOC( dvd->dym_array, did_you_mean_t, dvd->dym_cap );
+  }
+  dvd->dym_array[ dvd->dym_len++ ] = (did_you_mean_t){
+    .literal = literal,
+    .dam_lev_dist = dist
+  };
+
+  return dvd->best_dist;
 }
 
 /**
@@ -329,91 +302,46 @@ did_you_mean_t const* dym_new( dym_kind_t kinds, char const *unknown_literal ) {
   if ( kinds == DYM_NONE )
     return NULL;
   assert( unknown_literal != NULL );
+  assert( (kinds & DYM_CDECL_KEYWORDS) == DYM_NONE ||
+          cdecl_mode == CDECL_ENGLISH_TO_GIBBERISH );
 
-  // Pre-flight to calculate array size; the order here doesn't matter.
-  size_t const dym_size =
-    ((kinds & DYM_COMMANDS) != DYM_NONE ?
-      copy_commands( /*pdym=*/NULL ) : 0) +
-    ((kinds & DYM_CLI_OPTIONS) != DYM_NONE ?
-      copy_cli_options( /*pdym=*/NULL ) : 0) +
-    ((kinds & DYM_SET_OPTIONS) != DYM_NONE ?
-      copy_set_options( /*pdym=*/NULL ) : 0) +
-    ((kinds & DYM_C_KEYWORDS) != DYM_NONE ?
-      copy_c_keywords( /*pdym=*/NULL, C_TPID_NONE ) +
-      copy_c_keywords( /*pdym=*/NULL, C_TPID_STORE ) : 0) +
-    ((kinds & DYM_C_ATTRIBUTES) != DYM_NONE ?
-      copy_c_keywords( /*pdym=*/NULL, C_TPID_ATTR ) : 0) +
-    ((kinds & DYM_C_TYPES) != DYM_NONE ?
-      copy_c_keywords( /*pdym=*/NULL, C_TPID_BASE ) +
-      copy_typedefs( /*pdym=*/NULL ) : 0) +
-    ((kinds & DYM_CDECL_KEYWORDS) != DYM_NONE ?
-      copy_cdecl_keywords( /*pdym=*/NULL ) : 0);
-
-  if ( dym_size == 0 )
-    return NULL;                        // LCOV_EXCL_LINE
-
-  did_you_mean_t *const dym_array = MALLOC( did_you_mean_t, dym_size + 1 );
-  did_you_mean_t *dym = dym_array;
-
-  // The order here doesn't matter either.
-  if ( (kinds & DYM_COMMANDS) != DYM_NONE ) {
-    copy_commands( &dym );
-  }
-  if ( (kinds & DYM_CLI_OPTIONS) != DYM_NONE ) {
-    copy_cli_options( &dym );
-  }
-  if ( (kinds & DYM_SET_OPTIONS) != DYM_NONE ) {
-    copy_set_options( &dym );
-  }
-  if ( (kinds & DYM_C_KEYWORDS) != DYM_NONE ) {
-    copy_c_keywords( &dym, C_TPID_NONE );
-    copy_c_keywords( &dym, C_TPID_STORE );
-  }
-  if ( (kinds & DYM_C_ATTRIBUTES) != DYM_NONE ) {
-    copy_c_keywords( &dym, C_TPID_ATTR );
-  }
-  if ( (kinds & DYM_C_TYPES) != DYM_NONE ) {
-    copy_c_keywords( &dym, C_TPID_BASE );
-    copy_typedefs( &dym );
-  }
-  if ( (kinds & DYM_CDECL_KEYWORDS) != DYM_NONE ) {
-    copy_cdecl_keywords( &dym );
-  }
-  MEM_ZERO( dym );                      // one past last is zero'd
-
-  // calculate the maximum source and target lengths
+  //
+  // A candidate at distance d is "similar enough" only if d is within some
+  // percent of its length that, in turn, can be at most d more than the
+  // unknown literal's length.  That bounds the distance to search within.
+  //
   size_t const source_len = strlen( unknown_literal );
-  size_t max_target_len = 0;
-  for ( dym = dym_array; dym->literal != NULL; ++dym ) {
-    size_t const len = strlen( dym->literal );
-    if ( len > max_target_len )
-      max_target_len = len;
+  size_t max_dist = 0;
+  while ( is_similar_enough( max_dist + 1, SIMILAR_ENOUGH_PERCENT,
+                             source_len + max_dist + 1 ) ) {
+    ++max_dist;
+  } // while
+
+  dym_visit_data_t dvd = { .best_dist = max_dist };
+
+  FOREACH_ARRAY_ELEMENT( dym_tree_t, dt, dym_trees ) {
+    if ( (kinds & dt->kind) != DYM_NONE ) {
+      PJL_IGNORE_RV(
+        bk_tree_search(
+          &dt->tree, unknown_literal, dvd.best_dist, &dym_visitor, &dvd
+        )
+      );
+    }
   } // for
-
-  /*
-   * Adapted from the code:
-   * <https://github.com/git/git/blob/3a0b884caba2752da0af626fb2de7d597c844e8b/help.c#L516>
-   */
-
-  // calculate Damerau-Levenshtein edit distance for all candidates
-  void *const dam_lev_mem = dam_lev_new( source_len, max_target_len );
-  for ( dym = dym_array; dym->literal != NULL; ++dym ) {
-    dym->dam_lev_dist = dam_lev_dist(
-      dam_lev_mem,
-      unknown_literal, source_len,
-      dym->literal, strlen( dym->literal )
+  if ( (kinds & DYM_C_TYPES) != DYM_NONE ) {
+    dvd.is_typedef = true;
+    PJL_IGNORE_RV(
+      bk_tree_search(
+        c_typedef_names(), unknown_literal, dvd.best_dist, &dym_visitor, &dvd
+      )
     );
-  } // for
-  free( dam_lev_mem );
+  }
 
-  // sort by Damerau-Levenshtein distance
-  qsort(
-    dym_array, dym_size, sizeof( did_you_mean_t ),
-    POINTER_CAST( qsort_cmp_fn_t, &dym_cmp )
-  );
+  did_you_mean_t *const dym_array = dvd.dym_array;
+  if ( dvd.dym_len == 0 )
+    goto none;
 
-  size_t const best_dist = dym_array->dam_lev_dist;
-  if ( best_dist == 0 ) {
+  if ( dvd.best_dist == 0 ) {
     //
     // This means unknown_literal was an exact match for a literal which means
     // we shouldn't suggest it for itself.
@@ -421,29 +349,66 @@ did_you_mean_t const* dym_new( dym_kind_t kinds, char const *unknown_literal ) {
     goto none;
   }
 
+  // sort by Damerau-Levenshtein distance (all are the same) then literal
+  qsort(
+    dym_array, dvd.dym_len, sizeof( did_you_mean_t ),
+    POINTER_CAST( qsort_cmp_fn_t, &dym_cmp )
+  );
+
   size_t const best_len = strlen( dym_array->literal );
-  if ( !is_similar_enough( best_dist, SIMILAR_ENOUGH_PERCENT, best_len ) )
+  if ( !is_similar_enough( dvd.best_dist, SIMILAR_ENOUGH_PERCENT, best_len ) )
     goto none;
 
-  // include all candidates that have the same distance
-  for ( dym = dym_array;
-        (++dym)->literal != NULL && dym->dam_lev_dist == best_dist; )
-    ;
-
-  //
-  // Free literals past the best ones and set the one past the last to NULL to
-  // mark the end.
-  //
-  dym_free_literals( dym );
-  dym->literal = NULL;
+  // Only now copy the literals of the candidates actually suggested.
+  for ( size_t i = 0; i < dvd.dym_len; ++i )
+    dym_array[i].literal = check_strdup( dym_array[i].literal );
+  MEM_ZERO( &dym_array[ dvd.dym_len ] );  // one past last is zero'd
 
   return dym_array;
 
 none:
-  dym_free( dym_array );
+  free( dym_array );
   return NULL;
 }
 
+void dym_init( void ) {
+  ASSERT_RUN_ONCE();
+
+  for ( size_t i = 0; i < ARRAY_SIZE( dym_trees ); ++i ) {
+    bk_tree_t *const tree = &dym_trees[i].tree;
+    switch ( dym_trees[i].kind ) {
+      case DYM_COMMANDS:
+        FOREACH_CDECL_COMMAND( command )
+          dym_insert( tree, command->literal, command->lang_ids );
+        break;
+      case DYM_CLI_OPTIONS:
+        FOREACH_CLI_OPTION( opt )
+          dym_insert( tree, opt->name, LANG_ANY );
+        break;
+      case DYM_SET_OPTIONS:
+        dym_insert_set_options( tree );
+        break;
+      case DYM_C_ATTRIBUTES:
+        dym_insert_c_keywords( tree, C_TPID_ATTR );
+        break;
+      case DYM_C_KEYWORDS:
+        dym_insert_c_keywords( tree, C_TPID_NONE );
+        dym_insert_c_keywords( tree, C_TPID_STORE );
+        break;
+      case DYM_C_TYPES:
+        dym_insert_c_keywords( tree, C_TPID_BASE );
+        break;
+      case DYM_CDECL_KEYWORDS:
+        dym_insert_cdecl_keywords( tree );
+        break;
+      case DYM_NONE:
+        UNEXPECTED_INT_VALUE( dym_trees[i].kind );
+    } // switch
+  } // for
+
+  ATEXIT( &dym_cleanup );
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
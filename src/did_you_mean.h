@@ -93,6 +93,14 @@ void dym_free( did_you_mean_t const *dym_array );
 NODISCARD
 did_you_mean_t const* dym_new( dym_kind_t kinds, char const *unknown_literal );
 
+/**
+ * Initializes "Did you mean ...?" data.
+ *
+ * @note This function must be called exactly once and before any other thread
+ * creates a session.
+ */
+void dym_init( void );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
@@ -33,6 +33,7 @@
 #include "cdecl.h"
 #include "english.h"
 #include "literals.h"
+#include "sink.h"
 #include "util.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -51,11 +52,11 @@
   DUMP_KEY( (D), KEY ": " ); c_ast_list_dump_impl( (LIST), (D) ); )
 
 #define DUMP_FORMAT(D,...) BLOCK(                   \
-  FPUTNSP( (D)->indent * DUMP_INDENT, (D)->dout );  \
-  FPRINTF( (D)->dout, __VA_ARGS__ ); )
+  sink_putnsp( (D)->dout, (D)->indent * DUMP_INDENT );  \
+  sink_printf( (D)->dout, __VA_ARGS__ ); )
 
 #define DUMP_KEY(D,...) BLOCK(                \
-  fput_sep( ",\n", &(D)->comma, (D)->dout );  \
+  sink_put_sep( (D)->dout, ",\n", &(D)->comma );  \
   DUMP_FORMAT( (D), __VA_ARGS__ ); )
 
 #define DUMP_LOC(D,KEY,LOC) BLOCK( \
@@ -77,7 +78,7 @@
  * Dump state.
  */
 struct dump_state {
-  FILE     *dout;                       ///< File to dump to.
+  sink_t   *dout;                       ///< Sink to dump to.
   unsigned  indent;                     ///< Current indentation.
   bool      comma;                      ///< Print a comma?
 };
@@ -96,8 +97,8 @@ typedef enum json_state json_state_t;
 // local functions
 static void c_ast_dump_impl( c_ast_t const*, dump_state_t* );
 static void c_ast_list_dump_impl( c_ast_list_t const*, dump_state_t const* );
-static void c_loc_dump( c_loc_t const*, FILE* );
-static void dump_init( dump_state_t*, unsigned, FILE* );
+static void c_loc_dump( c_loc_t const*, sink_t* );
+static void dump_init( dump_state_t*, unsigned, sink_t* );
 NODISCARD
 static json_state_t json_object_begin( json_state_t, char const*,
                                        dump_state_t* );
@@ -149,7 +150,7 @@ static void c_ast_dump_impl( c_ast_t const *ast, dump_state_t *dump ) {
   assert( dump != NULL );
 
   if ( ast == NULL ) {
-    FPUTS( "null", dump->dout );
+    sink_puts( dump->dout, "null" );
     return;
   }
 
@@ -178,9 +179,9 @@ static void c_ast_dump_impl( c_ast_t const *ast, dump_state_t *dump ) {
     // LCOV_EXCL_STOP
   }
   DUMP_KEY( dump, "depth: %u", ast->depth );
-  if ( ast->align.kind != C_ALIGNAS_NONE ) {
+  if ( ast->is_aligned ) {
     DUMP_KEY( dump, "align: " );
-    c_alignas_dump_impl( &ast->align, dump );
+    c_alignas_dump_impl( c_ast_align( ast ), dump );
   }
   DUMP_LOC( dump, "loc", &ast->loc );
   DUMP_KEY( dump, "type: " );
@@ -194,16 +195,16 @@ static void c_ast_dump_impl( c_ast_t const *ast, dump_state_t *dump ) {
       DUMP_KEY( dump, "size: " );
       switch ( ast->array.kind ) {
         case C_ARRAY_EMPTY_SIZE:
-          FPUTS( "\"unspecified\"", dump->dout );
+          sink_puts( dump->dout, "\"unspecified\"" );
           break;
         case C_ARRAY_INT_SIZE:
-          FPRINTF( dump->dout, "%u", ast->array.size_int );
+          sink_printf( dump->dout, "%u", ast->array.size_int );
           break;
         case C_ARRAY_NAMED_SIZE:
-          FPRINTF( dump->dout, "\"%s\"", ast->array.size_name );
+          sink_printf( dump->dout, "\"%s\"", ast->array.size_name );
           break;
         case C_ARRAY_VLA_STAR:
-          FPUTS( "'*'", dump->dout );
+          sink_puts( dump->dout, "'*'" );
           break;
       } // switch
       DUMP_AST( dump, "of_ast", ast->array.of_ast );
@@ -228,19 +229,19 @@ static void c_ast_dump_impl( c_ast_t const *ast, dump_state_t *dump ) {
       DUMP_KEY( dump, "kind: " );
       switch ( ast->capture.kind ) {
         case C_CAPTURE_COPY:
-          FPUTS( "'='", dump->dout );
+          sink_puts( dump->dout, "'='" );
           break;
         case C_CAPTURE_REFERENCE:
-          FPUTS( "'&'", dump->dout );
+          sink_puts( dump->dout, "'&'" );
           break;
         case C_CAPTURE_STAR_THIS:
-          FPUTS( "\"*this\"", dump->dout );
+          sink_puts( dump->dout, "\"*this\"" );
           break;
         case C_CAPTURE_THIS:
-          FPUTS( "\"this\"", dump->dout );
+          sink_puts( dump->dout, "\"this\"" );
           break;
         case C_CAPTURE_VARIABLE:
-          FPUTS( "\"variable\"", dump->dout );
+          sink_puts( dump->dout, "\"variable\"" );
           break;
       } // switch
       json_object_end( kind_json, dump );
@@ -276,16 +277,16 @@ static void c_ast_dump_impl( c_ast_t const *ast, dump_state_t *dump ) {
       DUMP_KEY( dump, "member: \"" );
       switch ( ast->func.member ) {
         case C_FUNC_UNSPECIFIED:
-          FPUTS( "unspecified", dump->dout );
+          sink_puts( dump->dout, "unspecified" );
           break;
         case C_FUNC_MEMBER:
-          FPUTS( "member", dump->dout );
+          sink_puts( dump->dout, "member" );
           break;
         case C_FUNC_NON_MEMBER:
-          FPUTS( "non-member", dump->dout );
+          sink_puts( dump->dout, "non-member" );
           break;
       } // switch
-      FPUTC( '"', dump->dout );
+      sink_putc( dump->dout, '"' );
       FALLTHROUGH;
 
     case K_APPLE_BLOCK:
@@ -356,10 +357,10 @@ static void c_ast_list_dump_impl( c_ast_list_t const *list,
   assert( dump != NULL );
 
   if ( slist_empty( list ) ) {
-    FPUTS( "[]", dump->dout );
+    sink_puts( dump->dout, "[]" );
     return;
   }
-  FPUTS( "[\n", dump->dout );
+  sink_puts( dump->dout, "[\n" );
 
   dump_state_t list_dump;
   dump_init( &list_dump, dump->indent + 1, dump->dout );
@@ -369,7 +370,7 @@ static void c_ast_list_dump_impl( c_ast_list_t const *list,
     c_ast_dump_impl( c_param_ast( node ), &list_dump );
   } // for
 
-  FPUTC( '\n', dump->dout );
+  sink_putc( dump->dout, '\n' );
   DUMP_FORMAT( dump, "]" );
 }
 
@@ -377,15 +378,15 @@ static void c_ast_list_dump_impl( c_ast_list_t const *list,
  * Dumps \a loc in [JSON5](https://json5.org) format (for debugging).
  *
  * @param loc The location to dump.
- * @param dout The `FILE` to dump to.
+ * @param dout The \ref sink to dump to.
  */
-static void c_loc_dump( c_loc_t const *loc, FILE *dout ) {
+static void c_loc_dump( c_loc_t const *loc, sink_t *dout ) {
   assert( loc != NULL );
   assert( dout != NULL );
-  FPRINTF( dout, "{ first_column: %d", loc->first_column );
+  sink_printf( dout, "{ first_column: %d", loc->first_column );
   if ( loc->last_column != loc->first_column )
-    FPRINTF( dout, ", last_column: %d", loc->last_column );
-  FPUTS( " }", dout );
+    sink_printf( dout, ", last_column: %d", loc->last_column );
+  sink_puts( dout, " }" );
 }
 
 /**
@@ -414,9 +415,9 @@ static char const* c_tpid_name( c_tpid_t tpid ) {
  *
  * @param dump The dump_state to initialize.
  * @param indent The current indent.
- * @param dout The `FILE` to dump to.
+ * @param dout The \ref sink to dump to.
  */
-static void dump_init( dump_state_t *dump, unsigned indent, FILE *dout ) {
+static void dump_init( dump_state_t *dump, unsigned indent, sink_t *dout ) {
   assert( dump != NULL );
   assert( dout != NULL );
 
@@ -468,7 +469,7 @@ static json_state_t json_object_begin( json_state_t json, char const *key,
     key = null_if_empty( key );
     if ( key != NULL )
       DUMP_KEY( dump, "%s: ", key );
-    FPUTS( "{\n", dump->dout );
+    sink_puts( dump->dout, "{\n" );
     json = JSON_OBJ_BEGUN;
     if ( dump->comma ) {
       json |= JSON_COMMA;
@@ -491,7 +492,7 @@ static void json_object_end( json_state_t json, dump_state_t *dump ) {
   assert( json != JSON_INIT );
   assert( dump != NULL );
 
-  FPUTC( '\n', dump->dout );
+  sink_putc( dump->dout, '\n' );
   dump->comma = !!(json & JSON_COMMA);
   --dump->indent;
   DUMP_FORMAT( dump, "}" );
@@ -499,30 +500,30 @@ static void json_object_end( json_state_t json, dump_state_t *dump ) {
 
 ////////// extern functions ///////////////////////////////////////////////////
 
-void bool_dump( bool value, FILE *dout ) {
+void bool_dump( bool value, sink_t *dout ) {
   assert( dout != NULL );
-  FPUTS( value ? L_true : L_false, dout );
+  sink_puts( dout, value ? L_true : L_false );
 }
 
-void c_alignas_dump( c_alignas_t const *align, FILE *dout ) {
+void c_alignas_dump( c_alignas_t const *align, sink_t *dout ) {
   dump_state_t dump;
   dump_init( &dump, 1, dout );
   c_alignas_dump_impl( align, &dump );
 }
 
-void c_ast_dump( c_ast_t const *ast, FILE *dout ) {
+void c_ast_dump( c_ast_t const *ast, sink_t *dout ) {
   dump_state_t dump;
   dump_init( &dump, 1, dout );
   c_ast_dump_impl( ast, &dump );
 }
 
-void c_ast_list_dump( c_ast_list_t const *list, FILE *dout ) {
+void c_ast_list_dump( c_ast_list_t const *list, sink_t *dout ) {
   dump_state_t dump;
   dump_init( &dump, 1, dout );
   c_ast_list_dump_impl( list, &dump );
 }
 
-void c_ast_pair_dump( c_ast_pair_t const *astp, FILE *dout ) {
+void c_ast_pair_dump( c_ast_pair_t const *astp, sink_t *dout ) {
   assert( astp != NULL );
 
   dump_state_t dump;
@@ -534,62 +535,64 @@ void c_ast_pair_dump( c_ast_pair_t const *astp, FILE *dout ) {
   json_object_end( json, &dump );
 }
 
-void c_sname_dump( c_sname_t const *sname, FILE *dout ) {
+void c_sname_dump( c_sname_t const *sname, sink_t *dout ) {
   assert( sname != NULL );
   assert( dout != NULL );
 
   if ( c_sname_empty( sname ) ) {
-    FPUTS( "null", dout );
+    sink_puts( dout, "null" );
     return;
   }
 
-  FPRINTF( dout, "{ string: \"%s\", scopes: \"", c_sname_full_name( sname ) );
+  sink_printf(
+    dout, "{ string: \"%s\", scopes: \"", c_sname_full_name( sname )
+  );
 
   bool colon2 = false;
   FOREACH_SNAME_SCOPE( scope, sname ) {
-    fput_sep( "::", &colon2, dout );
+    sink_put_sep( dout, "::", &colon2 );
     c_type_t const *const t = &c_scope_data( scope )->type;
-    FPUTS( c_type_is_none( t ) ? "none" : c_type_name_c( t ), dout );
+    sink_puts( dout, c_type_is_none( t ) ? "none" : c_type_name_c( t ) );
   } // for
 
-  FPUTS( "\" }", dout );
+  sink_puts( dout, "\" }" );
 }
 
-void c_sname_list_dump( slist_t const *list, FILE *dout ) {
+void c_sname_list_dump( slist_t const *list, sink_t *dout ) {
   assert( list != NULL );
   assert( dout != NULL );
 
   if ( slist_empty( list ) ) {
-    FPUTS( "[]", dout );
+    sink_puts( dout, "[]" );
     return;
   }
 
-  FPUTS( "[ ", dout );
+  sink_puts( dout, "[ " );
 
   bool comma = false;
   FOREACH_SLIST_NODE( node, list ) {
-    fput_sep( ", ", &comma, dout );
+    sink_put_sep( dout, ", ", &comma );
     c_sname_dump( node->data, dout );
   } // for
 
-  FPUTS( " ]", dout );
+  sink_puts( dout, " ]" );
 }
 
-void c_tid_dump( c_tid_t tid, FILE *dout ) {
+void c_tid_dump( c_tid_t tid, sink_t *dout ) {
   assert( dout != NULL );
-  FPRINTF( dout,
+  sink_printf( dout,
     "{ %s: 0x%" PRIX_C_TID_T ", string: \"%s\" }",
     c_tpid_name( c_tid_tpid( tid ) ), tid,
     c_tid_is_none( tid ) ? "none" : c_tid_name_c( tid )
   );
 }
 
-void c_type_dump( c_type_t const *type, FILE *dout ) {
+void c_type_dump( c_type_t const *type, sink_t *dout ) {
   assert( type != NULL );
   assert( dout != NULL );
 
   char const *const type_name = c_type_name_c( type );
-  FPRINTF( dout,
+  sink_printf( dout,
     "{ %s: 0x%" PRIX_C_TID_T
     ", %s: 0x%" PRIX_C_TID_T
     ", %s: 0x%" PRIX_C_TID_T
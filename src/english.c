@@ -32,6 +32,7 @@
 #include "c_typedef.h"
 #include "decl_flags.h"
 #include "literals.h"
+#include "sink.h"
 #include "slist.h"
 #include "util.h"
 
@@ -54,7 +55,7 @@
  * State maintained by c_ast_visit_english().
  */
 struct eng_state {
-  FILE           *eout;                 ///< Where to print the English.
+  sink_t         *eout;                 ///< Where to print the English.
   c_ast_t const  *func_ast;             ///< The current function AST, if any.
 };
 typedef struct eng_state eng_state_t;
@@ -63,9 +64,9 @@ typedef struct eng_state eng_state_t;
 NODISCARD
 static bool c_ast_visitor_english( c_ast_t*, user_data_t );
 
-static void c_type_name_nobase_english( c_type_t const*, FILE* );
+static void c_type_name_nobase_english( c_type_t const*, sink_t* );
 static void c_ast_visit_english( c_ast_t const*, eng_state_t const* );
-static void eng_init( eng_state_t*, FILE* );
+static void eng_init( eng_state_t*, sink_t* );
 
 ////////// local functions ////////////////////////////////////////////////////
 
@@ -74,15 +75,15 @@ static void eng_init( eng_state_t*, FILE* );
  * if any.
  *
  * @param ast The AST to print the bit-field width of.
- * @param eout The `FILE` to emit to.
+ * @param eout The \ref sink to emit to.
  */
-static void c_ast_bit_width_english( c_ast_t const *ast, FILE *eout ) {
+static void c_ast_bit_width_english( c_ast_t const *ast, sink_t *eout ) {
   assert( ast != NULL );
   assert( is_1_bit_only_in_set( ast->kind, K_ANY_BIT_FIELD ) );
   assert( eout != NULL );
 
   if ( ast->bit_field.bit_width > 0 )
-    FPRINTF( eout, " width %u bits", ast->bit_field.bit_width );
+    sink_printf( eout, " width %u bits", ast->bit_field.bit_width );
 }
 
 /**
@@ -98,7 +99,7 @@ static void c_ast_func_params_english( c_ast_t const *ast,
   assert( is_1_bit_only_in_set( ast->kind, K_ANY_FUNCTION_LIKE ) );
   assert( eng != NULL );
 
-  FPUTC( '(', eng->eout );
+  sink_putc( eng->eout, '(' );
 
   eng_state_t param_eng;
   eng_init( &param_eng, eng->eout );
@@ -106,7 +107,7 @@ static void c_ast_func_params_english( c_ast_t const *ast,
 
   bool comma = false;
   FOREACH_AST_FUNC_PARAM( param, ast ) {
-    fput_sep( ", ", &comma, eng->eout );
+    sink_put_sep( eng->eout, ", ", &comma );
 
     c_ast_t const *const param_ast = c_param_ast( param );
     c_sname_t const *const sname = c_ast_find_name( param_ast, C_VISIT_DOWN );
@@ -124,7 +125,7 @@ static void c_ast_func_params_english( c_ast_t const *ast,
       //
       c_sname_english( sname, eng->eout );
       if ( param_ast->kind != K_NAME )
-        FPUTS( " as ", eng->eout );
+        sink_puts( eng->eout, " as " );
     }
     else {
       //
@@ -139,7 +140,7 @@ static void c_ast_func_params_english( c_ast_t const *ast,
     c_ast_visit_english( param_ast, &param_eng );
   } // for
 
-  FPUTC( ')', eng->eout );
+  sink_putc( eng->eout, ')' );
 }
 
 /**
@@ -147,53 +148,53 @@ static void c_ast_func_params_english( c_ast_t const *ast,
  * captures, if any.
  *
  * @param ast The lambda AST to print the captures of.
- * @param eout The `FILE` to emit to.
+ * @param eout The \ref sink to emit to.
  */
-static void c_ast_lambda_captures_english( c_ast_t const *ast, FILE *eout ) {
+static void c_ast_lambda_captures_english( c_ast_t const *ast, sink_t *eout ) {
   assert( ast != NULL );
   assert( ast->kind == K_LAMBDA );
   assert( eout != NULL );
 
-  FPUTC( '[', eout );
+  sink_putc( eout, '[' );
 
   bool comma = false;
   FOREACH_AST_LAMBDA_CAPTURE( capture, ast ) {
-    fput_sep( ", ", &comma, eout );
+    sink_put_sep( eout, ", ", &comma );
 
     c_ast_t const *const capture_ast = c_capture_ast( capture );
     switch ( capture_ast->capture.kind ) {
       case C_CAPTURE_COPY:
-        FPUTS( "copy by default", eout );
+        sink_puts( eout, "copy by default" );
         break;
       case C_CAPTURE_REFERENCE:
         if ( c_sname_empty( &capture_ast->sname ) ) {
-          FPUTS( "reference by default", eout );
+          sink_puts( eout, "reference by default" );
           break;
         }
-        FPUTS( "reference to ", eout );
+        sink_puts( eout, "reference to " );
         FALLTHROUGH;
       case C_CAPTURE_VARIABLE:
         c_sname_english( &capture_ast->sname, eout );
         break;
       case C_CAPTURE_STAR_THIS:
-        FPUTC( '*', eout );
+        sink_putc( eout, '*' );
         FALLTHROUGH;
       case C_CAPTURE_THIS:
-        FPUTS( L_this, eout );
+        sink_puts( eout, L_this );
         break;
     } // switch
   } // for
 
-  FPUTC( ']', eout );
+  sink_putc( eout, ']' );
 }
 
 /**
  * Prints the scoped name of \a AST in pseudo-English.
  *
  * @param ast The AST to print the name of.
- * @param eout The `FILE` to emit to.
+ * @param eout The \ref sink to emit to.
  */
-static void c_ast_name_english( c_ast_t const *ast, FILE *eout ) {
+static void c_ast_name_english( c_ast_t const *ast, sink_t *eout ) {
   assert( ast != NULL );
   assert( eout != NULL );
 
@@ -216,10 +217,12 @@ static void c_ast_name_english( c_ast_t const *ast, FILE *eout ) {
   }
 
   assert( local_name[0] != '\0' );
-  FPUTS( local_name, eout );
+  sink_puts( eout, local_name );
   if ( scope_name[0] != '\0' ) {
     assert( !c_type_is_none( scope_type ) );
-    FPRINTF( eout, " of %s %s", c_type_name_english( scope_type ), scope_name );
+    sink_printf(
+      eout, " of %s %s", c_type_name_english( scope_type ), scope_name
+    );
   }
 }
 
@@ -241,7 +244,7 @@ static void c_ast_visit_english( c_ast_t const *ast, eng_state_t const *eng ) {
  * Visitor function that prints \a ast as pseudo-English.
  *
  * @param ast The AST to print.
- * @param user_data A pointer to a `FILE` to emit to.
+ * @param user_data A pointer to a \ref sink to emit to.
  * @return Always returns `false`.
  */
 NODISCARD
@@ -284,26 +287,26 @@ static bool c_ast_visitor_english( c_ast_t *ast, user_data_t user_data ) {
           FALLTHROUGH;
 
         case C_ARRAY_VLA_STAR:
-          FPUTS( "variable length ", eng->eout );
+          sink_puts( eng->eout, "variable length " );
           break;
 
         case C_ARRAY_EMPTY_SIZE:
         case C_ARRAY_INT_SIZE:
           break;
       } // switch
-      FPUTS( "array ", eng->eout );
+      sink_puts( eng->eout, "array " );
       switch ( ast->array.kind ) {
         case C_ARRAY_INT_SIZE:
-          FPRINTF( eng->eout, "%u ", ast->array.size_int );
+          sink_printf( eng->eout, "%u ", ast->array.size_int );
           break;
         case C_ARRAY_NAMED_SIZE:
-          FPRINTF( eng->eout, "%s ", ast->array.size_name );
+          sink_printf( eng->eout, "%s ", ast->array.size_name );
           break;
         case C_ARRAY_EMPTY_SIZE:
         case C_ARRAY_VLA_STAR:
           break;
       } // switch
-      FPUTS( "of ", eng->eout );
+      sink_puts( eng->eout, "of " );
       break;
 
     case K_APPLE_BLOCK:
@@ -316,7 +319,7 @@ static bool c_ast_visitor_english( c_ast_t *ast, user_data_t user_data ) {
       switch ( ast->kind ) {
         case K_FUNCTION:
           if ( c_tid_is_any( ast->type.stids, TS_MEMBER_FUNC_ONLY ) )
-            FPUTS( "member ", eng->eout );
+            sink_puts( eng->eout, "member " );
           break;
         case K_OPERATOR:
           NO_OP;
@@ -325,25 +328,25 @@ static bool c_ast_visitor_english( c_ast_t *ast, user_data_t user_data ) {
             op_mbr == C_FUNC_MEMBER     ? "member "     :
             op_mbr == C_FUNC_NON_MEMBER ? "non-member " :
             "";
-          FPUTS( op_literal, eng->eout );
+          sink_puts( eng->eout, op_literal );
           break;
         default:
           /* suppress warning */;
       } // switch
 
-      FPUTS( c_kind_name( ast->kind ), eng->eout );
+      sink_puts( eng->eout, c_kind_name( ast->kind ) );
       if ( c_ast_params_count( ast ) > 0 ) {
-        FPUTC( ' ', eng->eout );
+        sink_putc( eng->eout, ' ' );
         c_ast_func_params_english( ast, eng );
       }
       if ( ast->func.ret_ast != NULL )
-        FPUTS( " returning ", eng->eout );
+        sink_puts( eng->eout, " returning " );
       break;
 
     case K_BUILTIN:
-      FPUTS( c_type_name_english( &ast->type ), eng->eout );
+      sink_puts( eng->eout, c_type_name_english( &ast->type ) );
       if ( c_ast_is_tid_any( ast, TB__BitInt ) )
-        FPRINTF( eng->eout, " width %u bits", ast->builtin.BitInt.width );
+        sink_printf( eng->eout, " width %u bits", ast->builtin.BitInt.width );
       c_ast_bit_width_english( ast, eng->eout );
       break;
 
@@ -354,43 +357,43 @@ static bool c_ast_visitor_english( c_ast_t *ast, user_data_t user_data ) {
 
     case K_CAST:
       if ( ast->cast.kind != C_CAST_C )
-        FPRINTF( eng->eout, "%s ", c_cast_english( ast->cast.kind ) );
-      FPUTS( L_cast, eng->eout );
+        sink_printf( eng->eout, "%s ", c_cast_english( ast->cast.kind ) );
+      sink_puts( eng->eout, L_cast );
       if ( !c_sname_empty( &ast->sname ) ) {
-        FPUTC( ' ', eng->eout );
+        sink_putc( eng->eout, ' ' );
         c_sname_english( &ast->sname, eng->eout );
       }
-      FPUTS( " into ", eng->eout );
+      sink_puts( eng->eout, " into " );
       break;
 
     case K_CLASS_STRUCT_UNION:
-      FPRINTF( eng->eout, "%s ", c_type_name_english( &ast->type ) );
+      sink_printf( eng->eout, "%s ", c_type_name_english( &ast->type ) );
       c_sname_english( &ast->csu.csu_sname, eng->eout );
       break;
 
     case K_ENUM:
-      FPRINTF( eng->eout, "%s ", c_type_name_english( &ast->type ) );
+      sink_printf( eng->eout, "%s ", c_type_name_english( &ast->type ) );
       c_sname_english( &ast->enum_.enum_sname, eng->eout );
       if ( ast->enum_.of_ast != NULL )
-        FPUTS( " of type ", eng->eout );
+        sink_puts( eng->eout, " of type " );
       else
         c_ast_bit_width_english( ast, eng->eout );
       break;
 
     case K_LAMBDA:
       if ( !c_type_is_none( &ast->type ) )
-        FPRINTF( eng->eout, "%s ", c_type_name_english( &ast->type ) );
-      FPUTS( L_lambda, eng->eout );
+        sink_printf( eng->eout, "%s ", c_type_name_english( &ast->type ) );
+      sink_puts( eng->eout, L_lambda );
       if ( c_ast_captures_count( ast ) > 0 ) {
-        FPUTS( " capturing ", eng->eout );
+        sink_puts( eng->eout, " capturing " );
         c_ast_lambda_captures_english( ast, eng->eout );
       }
       if ( c_ast_params_count( ast ) > 0 ) {
-        FPUTC( ' ', eng->eout );
+        sink_putc( eng->eout, ' ' );
         c_ast_func_params_english( ast, eng );
       }
       if ( ast->lambda.ret_ast != NULL )
-        FPUTS( " returning ", eng->eout );
+        sink_puts( eng->eout, " returning " );
       break;
 
     case K_NAME:
@@ -403,38 +406,38 @@ static bool c_ast_visitor_english( c_ast_t *ast, user_data_t user_data ) {
     case K_REFERENCE:
     case K_RVALUE_REFERENCE:
       c_type_name_nobase_english( &ast->type, eng->eout );
-      FPRINTF( eng->eout, "%s to ", c_kind_name( ast->kind ) );
+      sink_printf( eng->eout, "%s to ", c_kind_name( ast->kind ) );
       break;
 
     case K_POINTER_TO_MEMBER:
       c_type_name_nobase_english( &ast->type, eng->eout );
-      FPRINTF( eng->eout, "%s of ", c_kind_name( ast->kind ) );
-      fputs_sp( c_tid_name_english( ast->type.btids ), eng->eout );
+      sink_printf( eng->eout, "%s of ", c_kind_name( ast->kind ) );
+      sink_puts_sp( eng->eout, c_tid_name_english( ast->type.btids ) );
       c_sname_english( &ast->ptr_mbr.class_sname, eng->eout );
-      FPUTC( ' ', eng->eout );
+      sink_putc( eng->eout, ' ' );
       break;
 
     case K_TYPEDEF:
       if ( !c_type_equiv( &ast->type, &C_TYPE_LIT_B( TB_typedef ) ) )
-        FPRINTF( eng->eout, "%s ", c_type_name_english( &ast->type ) );
+        sink_printf( eng->eout, "%s ", c_type_name_english( &ast->type ) );
       c_sname_english( &ast->tdef.for_ast->sname, eng->eout );
       c_ast_bit_width_english( ast, eng->eout );
       break;
 
     case K_UDEF_CONV:
-      fputs_sp( c_type_name_english( &ast->type ), eng->eout );
-      FPUTS( c_kind_name( ast->kind ), eng->eout );
+      sink_puts_sp( eng->eout, c_type_name_english( &ast->type ) );
+      sink_puts( eng->eout, c_kind_name( ast->kind ) );
       if ( !c_sname_empty( &ast->sname ) ) {
-        FPRINTF( eng->eout,
+        sink_printf( eng->eout,
           " of %s ", c_type_name_english( c_sname_local_type( &ast->sname ) )
         );
         c_sname_english( &ast->sname, eng->eout );
       }
-      FPUTS( " returning ", eng->eout );
+      sink_puts( eng->eout, " returning " );
       break;
 
     case K_VARIADIC:
-      FPUTS( c_kind_name( ast->kind ), eng->eout );
+      sink_puts( eng->eout, c_kind_name( ast->kind ) );
       break;
 
     case K_PLACEHOLDER:
@@ -444,49 +447,28 @@ static bool c_ast_visitor_english( c_ast_t *ast, user_data_t user_data ) {
   return /*stop=*/false;
 }
 
-/**
- * Helper function for c_sname_english() that prints the scopes' types and
- * names in inner-to-outer order except for the inner-most scope.  For example,
- * `S::T::x` is printed as "of scope T of scope S."
- *
- * @param scope A pointer to the outermost scope.
- * @param eout The `FILE` to emit to.
- */
-static void c_scope_english( c_scope_t const *scope, FILE *eout ) {
-  assert( scope != NULL );
-  assert( eout != NULL );
-
-  if ( scope->next != NULL ) {
-    c_scope_english( scope->next, eout );
-    c_scope_data_t const *const data = c_scope_data( scope );
-    FPRINTF( eout,
-      " of %s %s", c_type_name_english( &data->type ), data->name
-    );
-  }
-}
-
 /**
  * Prints the non-base (attribute(s), storage class, qualifier(s), etc.) parts
  * of \a type, if any.
  *
  * @param type The type to perhaps print.
- * @param eout The `FILE` to emit to.
+ * @param eout The \ref sink to emit to.
  */
-static void c_type_name_nobase_english( c_type_t const *type, FILE *eout ) {
+static void c_type_name_nobase_english( c_type_t const *type, sink_t *eout ) {
   assert( type != NULL );
   assert( eout != NULL );
 
   c_type_t const nobase_type = { TB_NONE, type->stids, type->atids };
-  fputs_sp( c_type_name_english( &nobase_type ), eout );
+  sink_puts_sp( eout, c_type_name_english( &nobase_type ) );
 }
 
 /**
  * Initializes an eng_state.
  *
  * @param eng The eng_state to initialize.
- * @param eout The `FILE` to print to.
+ * @param eout The \ref sink to print to.
  */
-static void eng_init( eng_state_t *eng, FILE *eout ) {
+static void eng_init( eng_state_t *eng, sink_t *eout ) {
   assert( eng != NULL );
   assert( eout != NULL );
 
@@ -496,14 +478,14 @@ static void eng_init( eng_state_t *eng, FILE *eout ) {
 
 ////////// extern functions ///////////////////////////////////////////////////
 
-void c_ast_english( c_ast_t const *ast, unsigned eng_flags, FILE *eout ) {
+void c_ast_english( c_ast_t const *ast, unsigned eng_flags, sink_t *eout ) {
   assert( ast != NULL );
   assert( is_1n_bit_only_in_set( eng_flags, C_ENG_ANY ) );
   assert( (eng_flags & C_ENG_DECL) != 0 );
   assert( eout != NULL );
 
   if ( (eng_flags & C_ENG_OPT_OMIT_DECLARE) == 0 && ast->kind != K_CAST ) {
-    FPUTS( "declare ", eout );
+    sink_puts( eout, "declare " );
     // We can't just check to see if ast->sname is empty and print it only if
     // it isn't because operators have a name but don't use ast->sname.
     switch ( ast->kind ) {
@@ -524,7 +506,7 @@ void c_ast_english( c_ast_t const *ast, unsigned eng_flags, FILE *eout ) {
       case K_TYPEDEF:
       case K_UDEF_LIT:
         c_ast_name_english( ast, eout );
-        FPUTS( " as ", eout );
+        sink_puts( eout, " as " );
         break;
 
       case K_LAMBDA:
@@ -543,21 +525,25 @@ void c_ast_english( c_ast_t const *ast, unsigned eng_flags, FILE *eout ) {
   eng_init( &eng, eout );
   c_ast_visit_english( ast, &eng );
 
-  switch ( ast->align.kind ) {
+  c_alignas_t const *const align = c_ast_align( ast );
+  if ( align == NULL )
+    return;
+
+  switch ( align->kind ) {
     case C_ALIGNAS_NONE:
       break;
     case C_ALIGNAS_BYTES:
-      if ( ast->align.bytes > 0 )
-        FPRINTF( eout, " aligned as %u bytes", ast->align.bytes );
+      if ( align->bytes > 0 )
+        sink_printf( eout, " aligned as %u bytes", align->bytes );
       break;
     case C_ALIGNAS_TYPE:
-      FPUTS( " aligned as ", eout );
-      c_ast_visit_english( ast->align.type_ast, &eng );
+      sink_puts( eout, " aligned as " );
+      c_ast_visit_english( align->type_ast, &eng );
       break;
   } // switch
 }
 
-void c_ast_list_english( c_ast_list_t const *ast_list, FILE *eout ) {
+void c_ast_list_english( c_ast_list_t const *ast_list, sink_t *eout ) {
   assert( ast_list != NULL );
 
   switch ( slist_len( ast_list ) ) {
@@ -565,7 +551,7 @@ void c_ast_list_english( c_ast_list_t const *ast_list, FILE *eout ) {
       NO_OP;
       c_ast_t const *const ast = slist_front( ast_list );
       c_ast_english( ast, C_ENG_DECL, eout );
-      FPUTC( '\n', eout );
+      sink_putc( eout, '\n' );
       FALLTHROUGH;
     case 0:
       return;
@@ -649,21 +635,21 @@ void c_ast_list_english( c_ast_list_t const *ast_list, FILE *eout ) {
     // First, print "declare" followed by the names of all the declarations
     // that have the same base type.
     //
-    FPUTS( "declare ", eout );
+    sink_puts( eout, "declare " );
     bool comma = false;
     FOREACH_SLIST_NODE( equal_node, equal_ast_list ) {
       c_ast_t const *const equal_ast = equal_node->data;
-      fput_sep( ", ", &comma, eout );
+      sink_put_sep( eout, ", ", &comma );
       c_ast_name_english( equal_ast, eout );
     } // for
 
     //
     // Now print "as" followed by the type.
     //
-    FPUTS( " as ", eout );
+    sink_puts( eout, " as " );
     c_ast_t const *const ast = slist_front( equal_ast_list );
     c_ast_english( ast, C_ENG_DECL | C_ENG_OPT_OMIT_DECLARE, eout );
-    FPUTC( '\n', eout );
+    sink_putc( eout, '\n' );
   } // for
 
   // Clean-up list and sub-lists.
@@ -685,24 +671,37 @@ char const* c_cast_english( c_cast_kind_t kind ) {
   UNEXPECTED_INT_VALUE( kind );
 }
 
-void c_sname_english( c_sname_t const *sname, FILE *eout ) {
+void c_sname_english( c_sname_t const *sname, sink_t *eout ) {
   assert( sname != NULL );
   assert( eout != NULL );
 
-  if ( !c_sname_empty( sname ) ) {
-    FPUTS( c_sname_local_name( sname ), eout );
-    c_scope_english( sname->head, eout );
-  }
+  if ( c_sname_empty( sname ) )
+    return;
+
+  sink_puts( eout, c_sname_local_name( sname ) );
+
+  //
+  // Print the scopes' types and names in inner-to-outer order except for the
+  // inner-most scope.  For example, `S::T::x` is printed as "of scope T of
+  // scope S."
+  //
+  c_scope_t const *const first_scope = c_sname_scopes( sname );
+  for ( c_scope_t const *scope = c_sname_local_scope( sname );
+        scope-- != first_scope; ) {
+    sink_printf( eout,
+      " of %s %s", c_type_name_english( &scope->type ), scope->name
+    );
+  } // for
 }
 
-void c_typedef_english( c_typedef_t const *tdef, FILE *eout ) {
+void c_typedef_english( c_typedef_t const *tdef, sink_t *eout ) {
   assert( tdef != NULL );
   assert( tdef->ast != NULL );
   assert( eout != NULL );
 
-  FPUTS( "define ", eout );
+  sink_puts( eout, "define " );
   c_sname_english( &tdef->ast->sname, eout );
-  FPUTS( " as ", eout );
+  sink_puts( eout, " as " );
 
   eng_state_t eng;
   eng_init( &eng, eout );
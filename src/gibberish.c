@@ -34,6 +34,7 @@
 #include "decl_flags.h"
 #include "literals.h"
 #include "options.h"
+#include "sink.h"
 #include "util.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -60,7 +61,7 @@
  */
 struct gib_state {
   unsigned  gib_flags;                  ///< Gibberish printing flags.
-  FILE     *gout;                       ///< Where to print the gibberish.
+  sink_t   *gout;                       ///< Where to print the gibberish.
   bool      is_nested_scope;            ///< Within `{` ... `}`?
   bool      is_postfix;                 ///< Doing postfix gibberish?
   bool      printed_space;              ///< Printed a space yet?
@@ -74,7 +75,7 @@ static void c_ast_name_gibberish( c_ast_t const*, gib_state_t* );
 static void c_ast_postfix_gibberish( c_ast_t const*, gib_state_t* );
 static void c_ast_qual_name_gibberish( c_ast_t const*, gib_state_t* );
 static void c_ast_space_name_gibberish( c_ast_t const*, gib_state_t* );
-static void gib_init( gib_state_t*, unsigned, FILE* );
+static void gib_init( gib_state_t*, unsigned, sink_t* );
 
 NODISCARD
 static bool c_ast_space_before_ptr_ref( c_ast_t const*, gib_state_t const* );
@@ -103,7 +104,7 @@ static inline c_ast_t const* c_ast_find_parent_func( c_ast_t const *ast ) {
  */
 static inline void gib_print_space_once( gib_state_t *gib ) {
   if ( false_set( &gib->printed_space ) )
-    FPUTC( ' ', gib->gout );
+    sink_putc( gib->gout, ' ' );
 }
 
 ////////// local functions ////////////////////////////////////////////////////
@@ -163,27 +164,31 @@ static void c_ast_array_size_gibberish( c_ast_t const *ast,
   assert( ast->kind == K_ARRAY );
   assert( gib != NULL );
 
-  FPUTS( other_token_c( "[" ), gib->gout );
+  sink_puts( gib->gout, other_token_c( "[" ) );
 
   bool const is_qual = c_tid_is_any( ast->type.stids, TS_ANY_ARRAY_QUALIFIER );
   if ( is_qual )
-    FPUTS( c_type_name_c( &ast->type ), gib->gout );
+    sink_puts( gib->gout, c_type_name_c( &ast->type ) );
 
   switch ( ast->array.kind ) {
     case C_ARRAY_EMPTY_SIZE:
       break;
     case C_ARRAY_INT_SIZE:
-      FPRINTF( gib->gout, "%s%u", is_qual ? " " : "", ast->array.size_int );
+      sink_printf(
+        gib->gout, "%s%u", is_qual ? " " : "", ast->array.size_int
+      );
       break;
     case C_ARRAY_NAMED_SIZE:
-      FPRINTF( gib->gout, "%s%s", is_qual ? " " : "", ast->array.size_name );
+      sink_printf(
+        gib->gout, "%s%s", is_qual ? " " : "", ast->array.size_name
+      );
       break;
     case C_ARRAY_VLA_STAR:
-      FPUTC( '*', gib->gout );
+      sink_putc( gib->gout, '*' );
       break;
   } // switch
 
-  FPUTS( other_token_c( "]" ), gib->gout );
+  sink_puts( gib->gout, other_token_c( "]" ) );
 }
 
 /**
@@ -200,7 +205,7 @@ static void c_ast_bit_width_gibberish( c_ast_t const *ast,
   assert( gib != NULL );
 
   if ( ast->bit_field.bit_width > 0 )
-    FPRINTF( gib->gout, " : %u", ast->bit_field.bit_width );
+    sink_printf( gib->gout, " : %u", ast->bit_field.bit_width );
 }
 
 /**
@@ -310,18 +315,18 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
     case K_ARRAY:
       if ( ast->kind != K_ARRAY ||
            ( !c_tid_is_any( ast->type.stids, TS_ANY_ARRAY_QUALIFIER ) ) ) {
-        fputs_sp( c_type_name_c( &type ), gib->gout );
+        sink_puts_sp( gib->gout, c_type_name_c( &type ) );
       }
       if ( ast->kind == K_UDEF_CONV ) {
         if ( !c_sname_empty( &ast->sname ) )
-          FPRINTF( gib->gout, "%s::", c_sname_full_name( &ast->sname ) );
-        FPUTS( "operator ", gib->gout );
+          sink_printf( gib->gout, "%s::", c_sname_full_name( &ast->sname ) );
+        sink_puts( gib->gout, "operator " );
       }
       if ( ast->parent.of_ast != NULL ) {
         is_trailing_ret = (ast->kind & K_ANY_TRAILING_RETURN) != 0 &&
           opt_trailing_ret && OPT_LANG_IS( TRAILING_RETURN_TYPES );
         if ( is_trailing_ret )
-          FPUTS( L_auto, gib->gout );
+          sink_puts( gib->gout, L_auto );
         else
           c_ast_gibberish_impl( ast->parent.of_ast, gib );
       }
@@ -333,7 +338,7 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
         // (Pointers to such functions are handled in
         // c_ast_postfix_gibberish().)
         //
-        FPRINTF( gib->gout, " %s", c_tid_name_c( msc_call_atids ) );
+        sink_printf( gib->gout, " %s", c_tid_name_c( msc_call_atids ) );
       }
       if ( false_set( &gib->is_postfix ) ) {
         if ( (gib->gib_flags & (C_GIB_PRINT_CAST | C_GIB_USING)) == 0 )
@@ -341,24 +346,24 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
         c_ast_postfix_gibberish( ast, gib );
       }
       if ( cv_qual_stids != TS_NONE )
-        FPRINTF( gib->gout, " %s", c_tid_name_c( cv_qual_stids ) );
+        sink_printf( gib->gout, " %s", c_tid_name_c( cv_qual_stids ) );
       if ( ref_qual_stids != TS_NONE ) {
-        FPRINTF( gib->gout, " %s",
+        sink_printf( gib->gout, " %s",
           other_token_c(
             c_tid_is_any( ref_qual_stids, TS_REFERENCE ) ? "&" : "&&"
           )
         );
       }
       if ( is_noexcept )
-        FPUTS( " noexcept", gib->gout );
+        sink_puts( gib->gout, " noexcept" );
       else if ( is_throw )
-        FPUTS( " throw()", gib->gout );
+        sink_puts( gib->gout, " throw()" );
       if ( is_override )
-        FPUTS( " override", gib->gout );
+        sink_puts( gib->gout, " override" );
       else if ( is_final )
-        FPUTS( " final", gib->gout );
+        sink_puts( gib->gout, " final" );
       if ( is_trailing_ret ) {
-        FPUTS( " -> ", gib->gout );
+        sink_puts( gib->gout, " -> " );
         //
         // Temporarily orphan the return type's AST in order to print it as a
         // stand-alone trailing type.
@@ -372,18 +377,18 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
         ret_ast->parent_ast = orig_ret_ast_parent_ast;
       }
       if ( is_pure_virtual )
-        FPUTS( " = 0", gib->gout );
+        sink_puts( gib->gout, " = 0" );
       else if ( is_default )
-        FPUTS( " = default", gib->gout );
+        sink_puts( gib->gout, " = default" );
       else if ( is_delete )
-        FPUTS( " = delete", gib->gout );
+        sink_puts( gib->gout, " = delete" );
       break;
 
     case K_BUILTIN:
       if ( (gib->gib_flags & C_GIB_OPT_OMIT_TYPE) == 0 )
-        FPUTS( c_type_name_c( &type ), gib->gout );
+        sink_puts( gib->gout, c_type_name_c( &type ) );
       if ( c_ast_is_tid_any( ast, TB__BitInt ) )
-        FPRINTF( gib->gout, "(%u)", ast->builtin.BitInt.width );
+        sink_printf( gib->gout, "(%u)", ast->builtin.BitInt.width );
       c_ast_space_name_gibberish( ast, gib );
       c_ast_bit_width_gibberish( ast, gib );
       break;
@@ -391,23 +396,23 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
     case K_CAPTURE:
       switch ( ast->capture.kind ) {
         case C_CAPTURE_COPY:
-          FPUTC( '=', gib->gout );
+          sink_putc( gib->gout, '=' );
           break;
         case C_CAPTURE_REFERENCE:
-          FPUTS( other_token_c( "&" ), gib->gout );
+          sink_puts( gib->gout, other_token_c( "&" ) );
           if ( c_sname_empty( &ast->sname ) )
             break;
           if ( opt_alt_tokens )
-            FPUTC( ' ', gib->gout );
+            sink_putc( gib->gout, ' ' );
           FALLTHROUGH;
         case C_CAPTURE_VARIABLE:
-          FPUTS( c_sname_full_name( &ast->sname ), gib->gout );
+          sink_puts( gib->gout, c_sname_full_name( &ast->sname ) );
           break;
         case C_CAPTURE_STAR_THIS:
-          FPUTC( '*', gib->gout );
+          sink_putc( gib->gout, '*' );
           FALLTHROUGH;
         case C_CAPTURE_THIS:
-          FPUTS( L_this, gib->gout );
+          sink_puts( gib->gout, L_this );
           break;
       } // switch
       break;
@@ -416,13 +421,13 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
       assert( gib->gib_flags == C_GIB_PRINT_CAST );
       gib_init( &child_gib, C_GIB_PRINT_CAST, gib->gout );
       if ( ast->cast.kind == C_CAST_C ) {
-        FPUTC( '(', gib->gout );
+        sink_putc( gib->gout, '(' );
         c_ast_gibberish_impl( ast->cast.to_ast, &child_gib );
-        FPRINTF( gib->gout, ")%s\n", c_sname_full_name( &ast->sname ) );
+        sink_printf( gib->gout, ")%s\n", c_sname_full_name( &ast->sname ) );
       } else {
-        FPRINTF( gib->gout, "%s<", c_cast_gibberish( ast->cast.kind ) );
+        sink_printf( gib->gout, "%s<", c_cast_gibberish( ast->cast.kind ) );
         c_ast_gibberish_impl( ast->cast.to_ast, &child_gib );
-        FPRINTF( gib->gout, ">(%s)\n", c_sname_full_name( &ast->sname ) );
+        sink_printf( gib->gout, ">(%s)\n", c_sname_full_name( &ast->sname ) );
       }
       break;
 
@@ -455,7 +460,7 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
           c_type_name_ecsu( &type ) :
           c_type_name_c( &type );
 
-      FPUTS( type_name, gib->gout );
+      sink_puts( gib->gout, type_name );
 
       if ( (gib->gib_flags & C_GIB_TYPEDEF) == 0 || gib->printed_typedef ) {
         //
@@ -474,7 +479,7 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
         //
         //          typedef struct S T; // ast->sname ="T"; escu_name = "S"
         //
-        FPRINTF( gib->gout,
+        sink_printf( gib->gout,
           "%s%s",
           type_name[0] != '\0' ? " " : "",
           c_sname_full_name( &ast->csu.csu_sname )
@@ -501,12 +506,12 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
           c_ast_space_name_gibberish( ast, gib );
           printed_name = true;
         }
-        FPUTS( " : ", gib->gout );
+        sink_puts( gib->gout, " : " );
         c_ast_gibberish_impl( ast->enum_.of_ast, gib );
       }
 
       if ( cv_qual_stids != TS_NONE )
-        FPRINTF( gib->gout, " %s", c_tid_name_c( cv_qual_stids ) );
+        sink_printf( gib->gout, " %s", c_tid_name_c( cv_qual_stids ) );
 
       if ( !printed_name )
         c_ast_space_name_gibberish( ast, gib );
@@ -516,21 +521,21 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
       break;
 
     case K_LAMBDA:
-      FPUTS( other_token_c( "[" ), gib->gout );
+      sink_puts( gib->gout, other_token_c( "[" ) );
       c_ast_list_gibberish( &ast->lambda.capture_ast_list, gib );
-      FPUTS( other_token_c( "]" ), gib->gout );
+      sink_puts( gib->gout, other_token_c( "]" ) );
       if ( c_ast_params_count( ast ) > 0 ) {
-        FPUTC( '(', gib->gout );
+        sink_putc( gib->gout, '(' );
         c_ast_list_gibberish( &ast->lambda.param_ast_list, gib );
-        FPUTC( ')', gib->gout );
+        sink_putc( gib->gout, ')' );
       }
       if ( !c_tid_is_none( ast->type.stids ) )
-        FPRINTF( gib->gout, " %s", c_tid_name_c( ast->type.stids ) );
+        sink_printf( gib->gout, " %s", c_tid_name_c( ast->type.stids ) );
       if ( !c_tid_is_none( ast->type.atids ) )
-        FPRINTF( gib->gout, " %s", c_tid_name_c( ast->type.atids ) );
+        sink_printf( gib->gout, " %s", c_tid_name_c( ast->type.atids ) );
       if ( ast->lambda.ret_ast != NULL &&
            !c_ast_is_builtin_any( ast->lambda.ret_ast, TB_auto | TB_void ) ) {
-        FPUTS( " -> ", gib->gout );
+        sink_puts( gib->gout, " -> " );
         c_ast_gibberish_impl( ast->lambda.ret_ast, gib );
       }
       break;
@@ -543,11 +548,11 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
         //      cdecl> declare f as function (x) returning double
         //      double f(int x)
         //
-        FPUTS( L_int, gib->gout );
+        sink_puts( gib->gout, L_int );
       }
       if ( (gib->gib_flags & C_GIB_PRINT_CAST) == 0 ) {
         if ( OPT_LANG_IS( PROTOTYPES ) )
-          FPUTC( ' ', gib->gout );
+          sink_putc( gib->gout, ' ' );
         c_ast_name_gibberish( ast, gib );
       }
       break;
@@ -556,7 +561,7 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
     case K_REFERENCE:
     case K_RVALUE_REFERENCE:
       if ( (gib->gib_flags & C_GIB_OPT_OMIT_TYPE) == 0 )
-        fputs_sp( c_tid_name_c( type.stids & TS_ANY_STORAGE ), gib->gout );
+        sink_puts_sp( gib->gout, c_tid_name_c( type.stids & TS_ANY_STORAGE ) );
       c_ast_gibberish_impl( ast->ptr_ref.to_ast, gib );
       if ( c_ast_space_before_ptr_ref( ast, gib ) )
         gib_print_space_once( gib );
@@ -581,7 +586,7 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
           !c_type_equiv( &ast->type, &C_TYPE_LIT_B( TB_typedef ) );
 
         if ( is_more_than_plain_typedef && !opt_east_const )
-          FPUTS( c_type_name_c( &ast->type ), gib->gout );
+          sink_puts( gib->gout, c_type_name_c( &ast->type ) );
 
         //
         // Special case: C++23 adds an _Atomic(T) macro for compatibility with
@@ -599,9 +604,9 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
           c_tid_is_any( type.stids, TS__Atomic );
 
         if ( print_parens_for_Atomic )
-          FPUTC( '(', gib->gout );
+          sink_putc( gib->gout, '(' );
         else if ( is_more_than_plain_typedef && !opt_east_const )
-          FPUTC( ' ', gib->gout );
+          sink_putc( gib->gout, ' ' );
 
         //
         // Temporarily turn off C_GIB_USING to force printing of the type's
@@ -617,9 +622,9 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
         c_ast_name_gibberish( ast->tdef.for_ast, gib );
         gib->gib_flags = orig_flags;
         if ( print_parens_for_Atomic )
-          FPUTC( ')', gib->gout );
+          sink_putc( gib->gout, ')' );
         if ( is_more_than_plain_typedef && opt_east_const )
-          FPRINTF( gib->gout, " %s", c_type_name_c( &ast->type ) );
+          sink_printf( gib->gout, " %s", c_type_name_c( &ast->type ) );
       }
 
       c_ast_space_name_gibberish( ast, gib );
@@ -627,7 +632,7 @@ static void c_ast_gibberish_impl( c_ast_t const *ast, gib_state_t *gib ) {
       break;
 
     case K_VARIADIC:
-      FPUTS( L_ellipsis, gib->gout );
+      sink_puts( gib->gout, L_ellipsis );
       break;
 
     case K_PLACEHOLDER:
@@ -653,7 +658,7 @@ static void c_ast_list_gibberish( c_ast_list_t const *ast_list,
     gib_state_t node_gib;
     gib_init( &node_gib, gib->gib_flags & ~C_GIB_OPT_OMIT_TYPE, gib->gout );
     node_gib.is_nested_scope = gib->is_nested_scope;
-    fput_sep( ", ", &comma, gib->gout );
+    sink_put_sep( gib->gout, ", ", &comma );
     c_ast_gibberish_impl( c_param_ast( ast_node ), &node_gib );
   } // for
 }
@@ -703,13 +708,13 @@ static void c_ast_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
     return;
   }
 
-  FPUTS(
+  sink_puts(
+    gib->gout,
     //
     // If we're in a nested scope, just print the local name.
     //
     gib->is_nested_scope ?
-      c_sname_local_name( &ast->sname ) : c_sname_full_name( &ast->sname ),
-    gib->gout
+      c_sname_local_name( &ast->sname ) : c_sname_full_name( &ast->sname )
   );
 }
 
@@ -750,7 +755,7 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       case K_RVALUE_REFERENCE:
         switch ( ast->kind ) {
           case K_APPLE_BLOCK:
-            FPRINTF( gib->gout, "(%s", c_op_token_c( C_OP_CARET ) );
+            sink_printf( gib->gout, "(%s", c_op_token_c( C_OP_CARET ) );
             break;
 
           default:
@@ -763,7 +768,7 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
             //
             // so we need to add parentheses.
             //
-            FPUTC( '(', gib->gout );
+            sink_putc( gib->gout, '(' );
 
             if ( c_tid_is_any( ast->type.atids, TA_ANY_MSC_CALL ) ) {
               //
@@ -773,7 +778,7 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
               //      void (__stdcall *pf)(int, int)
               //
               c_tid_t const msc_call_atids = ast->type.atids & TA_ANY_MSC_CALL;
-              FPRINTF( gib->gout, "%s ", c_tid_name_c( msc_call_atids ) );
+              sink_printf( gib->gout, "%s ", c_tid_name_c( msc_call_atids ) );
             }
             break;
 
@@ -795,7 +800,7 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
           c_ast_postfix_gibberish( parent_ast, gib );
 
         if ( (ast->kind & K_ANY_POINTER) == 0 )
-          FPUTC( ')', gib->gout );
+          sink_putc( gib->gout, ')' );
         break;
 
       case K_CLASS_STRUCT_UNION:
@@ -818,13 +823,13 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
     // printing the gibberish for.
     //
     if ( ast->kind == K_APPLE_BLOCK ) {
-      FPRINTF( gib->gout, "(%s", c_op_token_c( C_OP_CARET ) );
+      sink_printf( gib->gout, "(%s", c_op_token_c( C_OP_CARET ) );
       if ( opt_alt_tokens && !c_sname_empty( &ast->sname ) )
-        FPUTC( ' ', gib->gout );
+        sink_putc( gib->gout, ' ' );
     }
     c_ast_space_name_gibberish( ast, gib );
     if ( ast->kind == K_APPLE_BLOCK )
-      FPUTC( ')', gib->gout );
+      sink_putc( gib->gout, ')' );
   }
 
   //
@@ -840,13 +845,13 @@ static void c_ast_postfix_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
     case K_FUNCTION:
     case K_OPERATOR:
     case K_UDEF_LIT:
-      FPUTC( '(', gib->gout );
+      sink_putc( gib->gout, '(' );
       c_ast_list_gibberish( &ast->func.param_ast_list, gib );
-      FPUTC( ')', gib->gout );
+      sink_putc( gib->gout, ')' );
       break;
     case K_DESTRUCTOR:
     case K_UDEF_CONV:
-      FPUTS( "()", gib->gout );
+      sink_puts( gib->gout, "()" );
       break;
     case K_BUILTIN:
     case K_CAPTURE:
@@ -909,11 +914,11 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
         //
         gib_print_space_once( gib );
       }
-      FPUTC( '*', gib->gout );
+      sink_putc( gib->gout, '*' );
       break;
 
     case K_POINTER_TO_MEMBER:
-      FPRINTF( gib->gout,
+      sink_printf( gib->gout,
         "%s::*", c_sname_full_name( &ast->ptr_mbr.class_sname )
       );
       c_ast_t const *const func_ast = c_ast_find_parent_func( ast );
@@ -924,18 +929,18 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
     case K_REFERENCE:
       if ( opt_alt_tokens ) {
         gib_print_space_once( gib );
-        FPUTS( "bitand ", gib->gout );
+        sink_puts( gib->gout, "bitand " );
       } else {
-        FPUTC( '&', gib->gout );
+        sink_putc( gib->gout, '&' );
       }
       break;
 
     case K_RVALUE_REFERENCE:
       if ( opt_alt_tokens ) {
         gib_print_space_once( gib );
-        FPUTS( "and ", gib->gout );
+        sink_puts( gib->gout, "and " );
       } else {
-        FPUTS( "&&", gib->gout );
+        sink_puts( gib->gout, "&&" );
       }
       break;
 
@@ -944,7 +949,7 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
   } // switch
 
   if ( qual_stids != TS_NONE ) {
-    FPUTS( c_tid_name_c( qual_stids ), gib->gout );
+    sink_puts( gib->gout, c_tid_name_c( qual_stids ) );
 
     if ( (gib->gib_flags & (C_GIB_PRINT_DECL | C_GIB_TYPEDEF)) != 0 &&
          c_ast_find_name( ast, C_VISIT_UP ) != NULL ) {
@@ -955,7 +960,7 @@ static void c_ast_qual_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       //
       //      char *const p;
       //                 ^
-      FPUTC( ' ', gib->gout );
+      sink_putc( gib->gout, ' ' );
       gib->printed_space = true;
     }
   }
@@ -1069,25 +1074,25 @@ static void c_ast_space_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
       break;
 
     case K_CONSTRUCTOR:
-      FPUTS( c_sname_full_name( &ast->sname ), gib->gout );
+      sink_puts( gib->gout, c_sname_full_name( &ast->sname ) );
       break;
 
     case K_DESTRUCTOR:
       if ( c_sname_count( &ast->sname ) > 1 )
-        FPRINTF( gib->gout, "%s::", c_sname_scope_name( &ast->sname ) );
+        sink_printf( gib->gout, "%s::", c_sname_scope_name( &ast->sname ) );
       if ( opt_alt_tokens )
-        FPUTS( "compl ", gib->gout );
+        sink_puts( gib->gout, "compl " );
       else
-        FPUTC( '~', gib->gout );
-      FPUTS( c_sname_local_name( &ast->sname ), gib->gout );
+        sink_putc( gib->gout, '~' );
+      sink_puts( gib->gout, c_sname_local_name( &ast->sname ) );
       break;
 
     case K_OPERATOR:
       gib_print_space_once( gib );
       if ( !c_sname_empty( &ast->sname ) )
-        FPRINTF( gib->gout, "%s::", c_sname_full_name( &ast->sname ) );
+        sink_printf( gib->gout, "%s::", c_sname_full_name( &ast->sname ) );
       char const *const token = c_op_token_c( ast->oper.operator->op_id );
-      FPRINTF( gib->gout,
+      sink_printf( gib->gout,
         "operator%s%s", isalpha( token[0] ) ? " " : "", token
       );
       break;
@@ -1095,8 +1100,8 @@ static void c_ast_space_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
     case K_UDEF_LIT:
       gib_print_space_once( gib );
       if ( c_sname_count( &ast->sname ) > 1 )
-        FPRINTF( gib->gout, "%s::", c_sname_scope_name( &ast->sname ) );
-      FPRINTF( gib->gout,
+        sink_printf( gib->gout, "%s::", c_sname_scope_name( &ast->sname ) );
+      sink_printf( gib->gout,
         "operator\"\" %s", c_sname_local_name( &ast->sname )
       );
       break;
@@ -1113,9 +1118,9 @@ static void c_ast_space_name_gibberish( c_ast_t const *ast, gib_state_t *gib ) {
  *
  * @param gib The gib_state to initialize.
  * @param gib_flags The gibberish flags to use.
- * @param gout The `FILE` to print to.
+ * @param gout The \ref sink to print to.
  */
-static void gib_init( gib_state_t *gib, unsigned gib_flags, FILE *gout ) {
+static void gib_init( gib_state_t *gib, unsigned gib_flags, sink_t *gout ) {
   assert( gib != NULL );
   assert( is_1n_bit_only_in_set( gib_flags, C_GIB_ANY ) );
   assert( gout != NULL );
@@ -1195,7 +1200,7 @@ static char const* graph_token_c( char const *token ) {
 
 ////////// extern functions ///////////////////////////////////////////////////
 
-void c_ast_gibberish( c_ast_t const *ast, unsigned gib_flags, FILE *gout ) {
+void c_ast_gibberish( c_ast_t const *ast, unsigned gib_flags, sink_t *gout ) {
   assert( ast != NULL );
   assert( is_1n_bit_only_in_set( gib_flags, C_GIB_ANY ) );
   assert(
@@ -1229,16 +1234,19 @@ void c_ast_gibberish( c_ast_t const *ast, unsigned gib_flags, FILE *gout ) {
       //
       // print the alignment (and "int") only for "i" and not again for "j".
       //
-      switch ( ast->align.kind ) {
+      c_alignas_t const *const align = c_ast_align( ast );
+      c_alignas_kind_t const align_kind =
+        align != NULL ? align->kind : C_ALIGNAS_NONE;
+      switch ( align_kind ) {
         case C_ALIGNAS_NONE:
           break;
         case C_ALIGNAS_BYTES:
-          FPRINTF( gout, "%s(%u) ", alignas_name(), ast->align.bytes );
+          sink_printf( gout, "%s(%u) ", alignas_name(), align->bytes );
           break;
         case C_ALIGNAS_TYPE:
-          FPRINTF( gout, "%s(", alignas_name() );
-          c_ast_gibberish( ast->align.type_ast, C_GIB_PRINT_DECL, gout );
-          FPUTS( ") ", gout );
+          sink_printf( gout, "%s(", alignas_name() );
+          c_ast_gibberish( align->type_ast, C_GIB_PRINT_DECL, gout );
+          sink_puts( gout, ") " );
           break;
       } // switch
     }
@@ -1249,7 +1257,7 @@ void c_ast_gibberish( c_ast_t const *ast, unsigned gib_flags, FILE *gout ) {
   }
 
   if ( (gib_flags & C_GIB_OPT_SEMICOLON) != 0 )
-    FPUTC( ';', gout );
+    sink_putc( gout, ';' );
 }
 
 char const* c_cast_gibberish( c_cast_kind_t kind ) {
@@ -1265,7 +1273,7 @@ char const* c_cast_gibberish( c_cast_kind_t kind ) {
 }
 
 void c_sname_list_ast_gibberish( slist_t const *sname_list, c_ast_t *ast,
-                                 FILE *gout ) {
+                                 sink_t *gout ) {
   assert( sname_list != NULL );
   assert( ast != NULL );
   assert( gout != NULL );
@@ -1302,7 +1310,7 @@ void c_sname_list_ast_gibberish( slist_t const *sname_list, c_ast_t *ast,
       // declarations, they need to be separated by newlines.  (The final
       // newine is handled below.)
       //
-      FPUTC( '\n', gout );
+      sink_putc( gout, '\n' );
     }
     else {
       //
@@ -1317,13 +1325,13 @@ void c_sname_list_ast_gibberish( slist_t const *sname_list, c_ast_t *ast,
       // the gibberish for `y` must not print the `int` again.
       //
       decl_flags |= C_GIB_OPT_OMIT_TYPE;
-      FPUTS( ", ", gout );
+      sink_puts( gout, ", " );
     }
   } // for
 }
 
 void c_typedef_gibberish( c_typedef_t const *tdef, unsigned gib_flags,
-                          FILE *gout ) {
+                          sink_t *gout ) {
   assert( tdef != NULL );
   assert( is_1_bit_in_set( gib_flags, C_GIB_DECL_ANY ) );
   assert(
@@ -1376,7 +1384,7 @@ void c_typedef_gibberish( c_typedef_t const *tdef, unsigned gib_flags,
         // so we have to turn off TS_inline on the sname's scope type.
         //
         temp_sname = c_sname_dup( sname );
-        c_scope_data( temp_sname.head )->type.stids &= c_tid_compl( TS_inline );
+        c_sname_scopes( &temp_sname )->type.stids &= c_tid_compl( TS_inline );
         sname = &temp_sname;
       }
       else {
@@ -1407,7 +1415,7 @@ void c_typedef_gibberish( c_typedef_t const *tdef, unsigned gib_flags,
         scope_type.stids &= c_tid_compl( TS_inline );
       }
 
-      FPRINTF( gout,
+      sink_printf( gout,
         "%s %s %s ",
         c_type_name_c( &scope_type ), c_sname_scope_name( sname ),
         other_token_c( "{" )
@@ -1420,9 +1428,9 @@ void c_typedef_gibberish( c_typedef_t const *tdef, unsigned gib_flags,
       //
       //      namespace S { namespace T { typedef int I; } }
       //
-      FOREACH_SNAME_SCOPE_UNTIL( scope, sname, sname->tail ) {
+      FOREACH_SNAME_SCOPE_UNTIL( scope, sname, c_sname_local_scope( sname ) ) {
         scope_type = c_scope_data( scope )->type;
-        FPRINTF( gout,
+        sink_printf( gout,
           "%s %s %s ",
           c_type_name_c( &scope_type ), c_scope_data( scope )->name,
           other_token_c( "{" )
@@ -1468,13 +1476,13 @@ void c_typedef_gibberish( c_typedef_t const *tdef, unsigned gib_flags,
   bool const print_using = (gib_flags & C_GIB_USING) != 0 && !is_ecsu;
 
   if ( print_typedef ) {
-    FPUTS( "typedef ", gout );
+    sink_puts( gout, "typedef " );
   }
   else if ( print_using ) {
-    FPRINTF( gout, "using %s ", c_sname_local_name( sname ) );
+    sink_printf( gout, "using %s ", c_sname_local_name( sname ) );
     if ( tdef->ast->type.atids != TA_NONE )
-      FPRINTF( gout, "%s ", c_tid_name_c( tdef->ast->type.atids ) );
-    FPUTS( "= ", gout );
+      sink_printf( gout, "%s ", c_tid_name_c( tdef->ast->type.atids ) );
+    sink_puts( gout, "= " );
   }
 
   c_sname_cleanup( &temp_sname );
@@ -1486,14 +1494,14 @@ void c_typedef_gibberish( c_typedef_t const *tdef, unsigned gib_flags,
   c_ast_gibberish_impl( tdef->ast, &gib );
 
   if ( scope_close_braces_to_print > 0 ) {
-    FPUTC( ';', gout );
+    sink_putc( gout, ';' );
     while ( scope_close_braces_to_print-- > 0 )
-      FPRINTF( gout, " %s", other_token_c( "}" ) );
+      sink_printf( gout, " %s", other_token_c( "}" ) );
   }
 
   if ( (gib_flags & C_GIB_OPT_SEMICOLON) != 0 &&
        scope_type.btids != TB_namespace ) {
-    FPUTC( ';', gout );
+    sink_putc( gout, ';' );
   }
 }
 
@@ -33,6 +33,7 @@
 #include "literals.h"
 #include "options.h"
 #include "print.h"
+#include "sink.h"
 #include "util.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -194,7 +195,7 @@ static void print_h( char const *line ) {
   char const *recent_color = NULL;      // most recent color set
 
   if ( in_title )
-    color_start( stdout, recent_color = sgr_help_title );
+    color_start( cdecl_fout, recent_color = sgr_help_title );
 
   for ( char const *s = line; *s != '\0'; ++s ) {
     if ( !is_escaped ) {
@@ -204,10 +205,10 @@ static void print_h( char const *line ) {
           continue;
         case ':':                       // ends a title
           if ( true_clear( &in_title ) )
-            color_end( stdout, recent_color );
+            color_end( cdecl_fout, recent_color );
           break;
         case '<':                       // begins non-terminal
-          color_start( stdout, recent_color = sgr_help_nonterm );
+          color_start( cdecl_fout, recent_color = sgr_help_nonterm );
           break;
         case '*':                       // other EBNF chars
         case '+':
@@ -216,11 +217,11 @@ static void print_h( char const *line ) {
         case '{':
         case '|':
         case '}':
-          color_start( stdout, recent_color = sgr_help_punct );
+          color_start( cdecl_fout, recent_color = sgr_help_punct );
           FALLTHROUGH;
         case '>':                       // ends non-terminal
           PUTC( *s );
-          color_end( stdout, recent_color );
+          color_end( cdecl_fout, recent_color );
           continue;
       } // switch
     }
@@ -314,6 +315,9 @@ static void print_help_command( cdecl_command_t const *command ) {
   if ( OPT_LANG_IS( using_DECLS ) && command_is( command, L_using ) )
     print_h( "  using <name> = <gibberish>\n" );
 
+  if ( command_is( command, L_stats ) )
+    print_h( "  stats\n" );
+
   if ( command_is_any( command, L_exit, L_quit, NULL ) )
     print_h( "  exit | q[uit]\n" );
 
@@ -0,0 +1,196 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/intern.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for interning strings.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "intern.h"
+#include "util.h"
+
+// standard
+#include <assert.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * @addtogroup intern-group
+ * @{
+ */
+
+/**
+ * A slot in the open-addressing hash table of interned strings.
+ */
+struct intern_slot {
+  char const *s;                        ///< Interned string or NULL if empty.
+  size_t      len;                      ///< Length of \ref s.
+  uint32_t    hash;                     ///< Hash of \ref s.
+  bool        is_static;                ///< Is \ref s not owned by us?
+};
+typedef struct intern_slot intern_slot_t;
+
+// local variables
+static intern_slot_t *intern_slots;     ///< Hash table of interned strings.
+static size_t         intern_size;      ///< Number of slots; a power of 2.
+static size_t         intern_len;       ///< Number of strings interned.
+
+/**
+ * Lock for the interned strings since they're shared by all sessions on all
+ * threads.
+ *
+ * @remarks A spin lock suffices since it's held only briefly.
+ */
+static atomic_flag    intern_lock = ATOMIC_FLAG_INIT;
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Frees all memory used by interned strings.
+ */
+static void intern_cleanup( void ) {
+  for ( size_t i = 0; i < intern_size; ++i ) {
+    if ( !intern_slots[i].is_static )
+      FREE( intern_slots[i].s );
+  } // for
+  FREE( intern_slots );
+  intern_slots = NULL;
+  intern_size = intern_len = 0;
+}
+
+/**
+ * Acquires \ref intern_lock.
+ *
+ * @sa intern_lock_release()
+ */
+static inline void intern_lock_acquire( void ) {
+  while ( atomic_flag_test_and_set_explicit( &intern_lock,
+                                             memory_order_acquire ) )
+    ;
+}
+
+/**
+ * Releases \ref intern_lock.
+ *
+ * @sa intern_lock_acquire()
+ */
+static inline void intern_lock_release( void ) {
+  atomic_flag_clear_explicit( &intern_lock, memory_order_release );
+}
+
+/**
+ * Doubles the number of slots of the hash table and reinserts all interned
+ * strings.
+ */
+static void intern_grow( void ) {
+  intern_slot_t *const old_slots = intern_slots;
+  size_t const old_size = intern_size;
+
+  intern_size = old_size == 0 ? 256 : old_size * 2;
+  intern_slots = MALLOC( intern_slot_t, intern_size );
+  for ( size_t i = 0; i < intern_size; ++i )
+    intern_slots[i] = (intern_slot_t){ NULL, 0, 0, false };
+
+  size_t const mask = intern_size - 1;
+  for ( size_t i = 0; i < old_size; ++i ) {
+    intern_slot_t const *const old_slot = &old_slots[i];
+    if ( old_slot->s == NULL )
+      continue;
+    size_t j = old_slot->hash & mask;
+    while ( intern_slots[j].s != NULL )
+      j = (j + 1) & mask;
+    intern_slots[j] = *old_slot;
+  } // for
+
+  free( old_slots );
+}
+
+/**
+ * Interns at most \a s_len characters of \a s.
+ *
+ * @param s The string to intern.  It need not be null-terminated unless \a
+ * is_static is `true`.
+ * @param s_len The number of characters of \a s to intern.
+ * @param is_static If `true`, \a s has static storage duration and is interned
+ * as-is rather than copied.
+ * @return Returns the interned string.
+ */
+NODISCARD
+static char const* intern_impl( char const *s, size_t s_len, bool is_static ) {
+  assert( s != NULL );
+
+  // 32-bit FNV-1a hash of the s_len characters of s.
+  uint32_t hash = 2166136261u;
+  for ( size_t i = 0; i < s_len; ++i ) {
+    hash ^= STATIC_CAST( unsigned char, s[i] );
+    hash *= 16777619u;
+  } // for
+
+  intern_lock_acquire();
+
+  if ( (intern_len + 1) * 2 > intern_size ) {
+    RUN_ONCE ATEXIT( &intern_cleanup );
+    intern_grow();                      // keep the load factor <= 0.5
+  }
+
+  size_t const mask = intern_size - 1;
+  size_t i = hash & mask;
+  for ( ; intern_slots[i].s != NULL; i = (i + 1) & mask ) {
+    intern_slot_t const *const slot = &intern_slots[i];
+    if ( slot->hash == hash && slot->len == s_len &&
+         memcmp( slot->s, s, s_len ) == 0 ) {
+      intern_lock_release();
+      return slot->s;
+    }
+  } // for
+
+  char const *const interned = is_static ? s : check_strndup( s, s_len );
+  intern_slots[i] = (intern_slot_t){ interned, s_len, hash, is_static };
+  ++intern_len;
+  intern_lock_release();
+  return interned;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+char const* intern_static_str( char const *s ) {
+  assert( s != NULL );
+  return intern_impl( s, strlen( s ), /*is_static=*/true );
+}
+
+char const* intern_str( char const *s ) {
+  assert( s != NULL );
+  return intern_strn( s, strlen( s ) );
+}
+
+char const* intern_strn( char const *s, size_t s_len ) {
+  return intern_impl( s, s_len, /*is_static=*/false );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
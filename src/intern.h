@@ -0,0 +1,108 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/intern.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_intern_H
+#define cdecl_intern_H
+
+/**
+ * @file
+ * Declares functions for interning strings.
+ *
+ * @remarks An _interned_ string is a unique copy of a string that lives until
+ * **cdecl** exits.  Interning the same string contents more than once always
+ * returns the same pointer, hence two strings _returned_ by these functions
+ * are equal only if their pointers are equal (just like the `L_*` literals).
+ * All identifier names (`Y_NAME` tokens) and scope names of \ref c_sname_t
+ * objects are interned so they need never be duplicated nor freed.
+ * @par
+ * However, a string passed to intern_static_str() is itself the interned
+ * string only if no equal string was interned before it.  Code that keeps
+ * such strings rather than what intern_static_str() returned must therefore
+ * still fall back to **strcmp**(3) when pointers differ, as
+ * c_scope_data_cmp() does.
+ * @par
+ * Interned strings are never freed, so a long-running process, e.g., a
+ * server or a library host, uses memory for every distinct name it has ever
+ * seen.
+ *
+ * @note These functions are thread-safe.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stddef.h>                     /* for size_t */
+
+/// @endcond
+
+/**
+ * @defgroup intern-group Interned Strings
+ * Functions for interning strings.
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Interns \a s.
+ *
+ * @param s The null-terminated string to intern.
+ * @return Returns the interned copy of \a s.  The caller must _not_ free it.
+ *
+ * @sa intern_strn()
+ */
+NODISCARD
+char const* intern_str( char const *s );
+
+/**
+ * Interns \a s without copying it.
+ *
+ * @param s The null-terminated string to intern.  It must have static storage
+ * duration.
+ * @return Returns \a s itself unless a string equal to \a s was interned
+ * previously in which case returns that string.
+ *
+ * @sa intern_str()
+ */
+NODISCARD
+char const* intern_static_str( char const *s );
+
+/**
+ * Interns at most \a s_len characters of \a s.
+ *
+ * @param s The string to intern.  It need not be null-terminated.
+ * @param s_len The number of characters of \a s to intern.
+ * @return Returns the interned copy of the first \a s_len characters of \a s.
+ * The caller must _not_ free it.
+ *
+ * @sa intern_str()
+ */
+NODISCARD
+char const* intern_strn( char const *s, size_t s_len );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_intern_H */
+/* vim:set et sw=2 ts=2: */
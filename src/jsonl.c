@@ -0,0 +1,866 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/jsonl.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines a function for executing **cdecl** commands given as JSON lines.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "jsonl.h"
+#include "cdecl_session.h"
+#include "libcdecl.h"
+#include "options.h"
+#include "print.h"
+#include "prompt.h"
+#include "sink.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <sysexits.h>
+
+/// @endcond
+
+/**
+ * @addtogroup jsonl-group
+ * @{
+ */
+
+/// Maximum nesting depth of skipped JSON values.
+#define JSONL_DEPTH_MAX           64
+
+/**
+ * A JSON parser for a single request line.
+ */
+struct jsonl_parser {
+  char const *s;                        ///< Current position.
+  char const *end;                      ///< End of the line.
+  char const *error;                    ///< Error message, if any.
+};
+typedef struct jsonl_parser jsonl_parser_t;
+
+/**
+ * A JSON request.
+ */
+struct jsonl_request {
+  strbuf_t  command;                    ///< Command to execute.
+  strbuf_t  id;                         ///< Raw JSON `id` value, if any.
+  strbuf_t  set;                        ///< `set` command for `lang`, etc.
+  bool      has_command;                ///< Was `command` given?
+};
+typedef struct jsonl_request jsonl_request_t;
+
+// local functions
+NODISCARD
+static bool jp_skip_value( jsonl_parser_t*, unsigned );
+static void jsonl_put_str( strbuf_t*, char const*, size_t );
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Sets the error message of \a p, but only if it isn't set already.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param error The error message.
+ * @return Always returns `false`.
+ */
+NODISCARD
+static bool jp_error( jsonl_parser_t *p, char const *error ) {
+  if ( p->error == NULL )
+    p->error = error;
+  return false;
+}
+
+/**
+ * Skips whitespace, if any.
+ *
+ * @param p The \ref jsonl_parser to use.
+ */
+static void jp_skip_ws( jsonl_parser_t *p ) {
+  while ( p->s < p->end && isspace( STATIC_CAST( unsigned char, *p->s ) ) )
+    ++p->s;
+}
+
+/**
+ * Skips whitespace, if any, then checks whether the next character is \a c;
+ * if so, skips it.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param c The character to check for.
+ * @return Returns `true` only if the next character was \a c.
+ */
+NODISCARD
+static bool jp_accept( jsonl_parser_t *p, char c ) {
+  jp_skip_ws( p );
+  if ( p->s == p->end || *p->s != c )
+    return false;
+  ++p->s;
+  return true;
+}
+
+/**
+ * Parses the 4 hexadecimal digits of a `\u` escape sequence.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param pcp Set to the code point.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool jp_parse_hex4( jsonl_parser_t *p, uint32_t *pcp ) {
+  if ( p->end - p->s < 4 )
+    return jp_error( p, "invalid \\u escape" );
+  uint32_t cp = 0;
+  for ( unsigned i = 0; i < 4; ++i ) {
+    char const c = *p->s++;
+    if ( !isxdigit( STATIC_CAST( unsigned char, c ) ) )
+      return jp_error( p, "invalid \\u escape" );
+    cp = cp << 4 | STATIC_CAST( uint32_t,
+      isdigit( STATIC_CAST( unsigned char, c ) ) ? c - '0' :
+      tolower( STATIC_CAST( unsigned char, c ) ) - 'a' + 10
+    );
+  } // for
+  *pcp = cp;
+  return true;
+}
+
+/**
+ * Appends the UTF-8 encoding of \a cp onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @param cp The Unicode code point.
+ */
+static void jp_put_utf8( strbuf_t *sbuf, uint32_t cp ) {
+  if ( cp < 0x80 ) {
+    strbuf_putc( sbuf, STATIC_CAST( char, cp ) );
+  }
+  else if ( cp < 0x800 ) {
+    strbuf_putc( sbuf, STATIC_CAST( char, 0xC0 | cp >> 6 ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp & 0x3F) ) );
+  }
+  else if ( cp < 0x10000 ) {
+    strbuf_putc( sbuf, STATIC_CAST( char, 0xE0 | cp >> 12 ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp >> 6 & 0x3F) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp & 0x3F) ) );
+  }
+  else {
+    strbuf_putc( sbuf, STATIC_CAST( char, 0xF0 | cp >> 18 ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp >> 12 & 0x3F) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp >> 6 & 0x3F) ) );
+    strbuf_putc( sbuf, STATIC_CAST( char, 0x80 | (cp & 0x3F) ) );
+  }
+}
+
+/**
+ * Parses a JSON string.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param sbuf The \ref strbuf to append the unescaped string onto or NULL to
+ * skip it.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool jp_parse_string( jsonl_parser_t *p, strbuf_t *sbuf ) {
+  if ( !jp_accept( p, '"' ) )
+    return jp_error( p, "string expected" );
+
+  while ( p->s < p->end ) {
+    char c = *p->s++;
+    if ( c == '"' )
+      return true;
+    if ( STATIC_CAST( unsigned char, c ) < 0x20 )
+      return jp_error( p, "control character in string" );
+    if ( c == '\\' ) {
+      if ( p->s == p->end )
+        break;
+      switch ( c = *p->s++ ) {
+        case '"':
+        case '/':
+        case '\\':
+          break;
+        case 'b': c = '\b'; break;
+        case 'f': c = '\f'; break;
+        case 'n': c = '\n'; break;
+        case 'r': c = '\r'; break;
+        case 't': c = '\t'; break;
+        case 'u': {
+          uint32_t cp;
+          if ( !jp_parse_hex4( p, &cp ) )
+            return false;
+          if ( cp >= 0xD800 && cp <= 0xDBFF ) {
+            uint32_t lo;
+            if ( p->end - p->s < 2 || p->s[0] != '\\' || p->s[1] != 'u' )
+              return jp_error( p, "unpaired surrogate" );
+            p->s += 2;
+            if ( !jp_parse_hex4( p, &lo ) )
+              return false;
+            if ( lo < 0xDC00 || lo > 0xDFFF )
+              return jp_error( p, "unpaired surrogate" );
+            cp = 0x10000 + ((cp - 0xD800) << 10) + (lo - 0xDC00);
+          }
+          else if ( cp >= 0xDC00 && cp <= 0xDFFF ) {
+            return jp_error( p, "unpaired surrogate" );
+          }
+          if ( cp == 0 )
+            return jp_error( p, "null character in string" );
+          if ( sbuf != NULL )
+            jp_put_utf8( sbuf, cp );
+          continue;
+        }
+        default:
+          return jp_error( p, "invalid escape sequence" );
+      } // switch
+    }
+    if ( sbuf != NULL )
+      strbuf_putc( sbuf, c );
+  } // while
+
+  return jp_error( p, "unterminated string" );
+}
+
+/**
+ * Parses a JSON array of strings.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param fn The function to call for each string.
+ * @param req The \ref jsonl_request to pass to \a fn.
+ * @param sbuf The \ref strbuf to use for each string.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool jp_parse_strings( jsonl_parser_t *p,
+                              bool (*fn)( jsonl_parser_t*, jsonl_request_t*,
+                                          char const* ),
+                              jsonl_request_t *req, strbuf_t *sbuf ) {
+  if ( !jp_accept( p, '[' ) )
+    return jp_error( p, "array expected" );
+  if ( jp_accept( p, ']' ) )
+    return true;
+  do {
+    strbuf_reset( sbuf );
+    if ( !jp_parse_string( p, sbuf ) || !(*fn)( p, req, sbuf->str ) )
+      return false;
+  } while ( jp_accept( p, ',' ) );
+  return jp_accept( p, ']' ) || jp_error( p, "',' or ']' expected" );
+}
+
+/**
+ * Skips a JSON array or object.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param close The closing character, either `]` or `}`.
+ * @param depth The current nesting depth.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool jp_skip_aggregate( jsonl_parser_t *p, char close,
+                               unsigned depth ) {
+  if ( jp_accept( p, close ) )
+    return true;
+  do {
+    if ( close == '}' ) {
+      if ( !jp_parse_string( p, /*sbuf=*/NULL ) )
+        return false;
+      if ( !jp_accept( p, ':' ) )
+        return jp_error( p, "':' expected" );
+    }
+    if ( !jp_skip_value( p, depth + 1 ) )
+      return false;
+  } while ( jp_accept( p, ',' ) );
+  return jp_accept( p, close ) || jp_error( p, "',' or bracket expected" );
+}
+
+/**
+ * Skips the digits, if any.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @return Returns `true` only if at least one digit was skipped.
+ */
+NODISCARD
+static bool jp_skip_digits( jsonl_parser_t *p ) {
+  char const *const start = p->s;
+  while ( p->s < p->end && isdigit( STATIC_CAST( unsigned char, *p->s ) ) )
+    ++p->s;
+  return p->s > start;
+}
+
+/**
+ * Skips a JSON number, `true`, `false`, or `null`.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool jp_skip_literal( jsonl_parser_t *p ) {
+  static char const *const KEYWORDS[] = { "false", "null", "true" };
+  for ( size_t i = 0; i < ARRAY_SIZE( KEYWORDS ); ++i ) {
+    size_t const len = strlen( KEYWORDS[i] );
+    if ( STATIC_CAST( size_t, p->end - p->s ) >= len &&
+         strncmp( p->s, KEYWORDS[i], len ) == 0 ) {
+      if ( p->s + len < p->end &&
+           isalnum( STATIC_CAST( unsigned char, p->s[ len ] ) ) ) {
+        break;
+      }
+      p->s += len;
+      return true;
+    }
+  } // for
+
+  //
+  // A number is: -?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?
+  //
+  if ( p->s < p->end && *p->s == '-' )
+    ++p->s;
+  if ( p->s < p->end && *p->s == '0' )
+    ++p->s;
+  else if ( !jp_skip_digits( p ) )
+    return jp_error( p, "value expected" );
+  if ( p->s < p->end && *p->s == '.' ) {
+    ++p->s;
+    if ( !jp_skip_digits( p ) )
+      return jp_error( p, "invalid number" );
+  }
+  if ( p->s < p->end && (*p->s == 'e' || *p->s == 'E') ) {
+    ++p->s;
+    if ( p->s < p->end && (*p->s == '+' || *p->s == '-') )
+      ++p->s;
+    if ( !jp_skip_digits( p ) )
+      return jp_error( p, "invalid number" );
+  }
+  if ( p->s < p->end && isalnum( STATIC_CAST( unsigned char, *p->s ) ) )
+    return jp_error( p, "invalid number" );
+  return true;
+}
+
+/**
+ * Skips any JSON value.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param depth The current nesting depth.
+ * @return Returns `true` only upon success.
+ */
+static bool jp_skip_value( jsonl_parser_t *p, unsigned depth ) {
+  if ( depth > JSONL_DEPTH_MAX )
+    return jp_error( p, "nested too deeply" );
+  jp_skip_ws( p );
+  if ( p->s == p->end )
+    return jp_error( p, "value expected" );
+
+  switch ( *p->s ) {
+    case '"':
+      return jp_parse_string( p, /*sbuf=*/NULL );
+    case '[':
+      ++p->s;
+      return jp_skip_aggregate( p, ']', depth );
+    case '{':
+      ++p->s;
+      return jp_skip_aggregate( p, '}', depth );
+  } // switch
+
+  return jp_skip_literal( p );
+}
+
+/**
+ * Checks that \a value is a valid `set` option name or value, i.e., is
+ * non-empty and contains neither whitespace nor `;` (that would end the
+ * `set` command).
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param value The value to check.
+ * @return Returns `true` only if \a value is valid.
+ */
+NODISCARD
+static bool jp_check_set_value( jsonl_parser_t *p, char const *value ) {
+  if ( *value == '\0' )
+    return jp_error( p, "empty option" );
+  for ( ; *value != '\0'; ++value ) {
+    unsigned char const c = STATIC_CAST( unsigned char, *value );
+    if ( isspace( c ) || iscntrl( c ) || c == ';' )
+      return jp_error( p, "invalid character in option" );
+  } // for
+  return true;
+}
+
+/**
+ * Adds `lang=`\a lang to the `set` command of \a req.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param req The \ref jsonl_request to add to.
+ * @param lang The language name.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool jp_set_lang( jsonl_parser_t *p, jsonl_request_t *req,
+                         char const *lang ) {
+  if ( !jp_check_set_value( p, lang ) )
+    return false;
+  //
+  // The language must be set before other options since some of them depend
+  // on it, so insert it right after "set".
+  //
+  strbuf_t opts;
+  strbuf_init( &opts );
+  if ( req->set.len > 0 )
+    strbuf_puts( &opts, req->set.str + STRLITLEN( "set" ) );
+  strbuf_reset( &req->set );
+  strbuf_printf( &req->set, "set lang=%s", lang );
+  if ( opts.len > 0 )
+    strbuf_putsn( &req->set, opts.str, opts.len );
+  strbuf_cleanup( &opts );
+  return true;
+}
+
+/**
+ * Adds \a option to the `set` command of \a req.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param req The \ref jsonl_request to add to.
+ * @param option The option.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool jp_set_option( jsonl_parser_t *p, jsonl_request_t *req,
+                           char const *option ) {
+  if ( !jp_check_set_value( p, option ) )
+    return false;
+  if ( req->set.len == 0 )
+    strbuf_puts( &req->set, "set" );
+  strbuf_putc( &req->set, ' ' );
+  strbuf_puts( &req->set, option );
+  return true;
+}
+
+/**
+ * Parses a JSON request object.
+ *
+ * @param p The \ref jsonl_parser to use.
+ * @param req The \ref jsonl_request to parse into.
+ * @param key_sbuf The \ref strbuf to use for member names and values.
+ * @return Returns `true` only upon success.
+ */
+NODISCARD
+static bool jp_parse_request( jsonl_parser_t *p, jsonl_request_t *req,
+                              strbuf_t *key_sbuf ) {
+  if ( !jp_accept( p, '{' ) )
+    return jp_error( p, "object expected" );
+
+  if ( !jp_accept( p, '}' ) ) {
+    do {
+      strbuf_reset( key_sbuf );
+      if ( !jp_parse_string( p, key_sbuf ) )
+        return false;
+      if ( !jp_accept( p, ':' ) )
+        return jp_error( p, "':' expected" );
+
+      if ( strcmp( key_sbuf->str, "command" ) == 0 ) {
+        strbuf_reset( &req->command );
+        if ( !jp_parse_string( p, &req->command ) )
+          return false;
+        req->has_command = true;
+      }
+      else if ( strcmp( key_sbuf->str, "id" ) == 0 ) {
+        strbuf_reset( &req->id );
+        jp_skip_ws( p );
+        if ( p->s < p->end && *p->s == '"' ) {
+          //
+          // Re-encode the string rather than echo it verbatim so any invalid
+          // UTF-8 in it is replaced.
+          //
+          strbuf_reset( key_sbuf );
+          if ( !jp_parse_string( p, key_sbuf ) )
+            return false;
+          jsonl_put_str( &req->id, key_sbuf->str, key_sbuf->len );
+        }
+        else {
+          char const *const id = p->s;
+          if ( p->s < p->end && (*p->s == '[' || *p->s == '{') ) {
+            return jp_error( p,
+              "\"id\" must be a string, number, true, false, or null"
+            );
+          }
+          if ( !jp_skip_literal( p ) )
+            return false;
+          strbuf_putsn( &req->id, id, STATIC_CAST( size_t, p->s - id ) );
+        }
+      }
+      else if ( strcmp( key_sbuf->str, "lang" ) == 0 ) {
+        strbuf_reset( key_sbuf );
+        if ( !jp_parse_string( p, key_sbuf ) ||
+             !jp_set_lang( p, req, key_sbuf->str ) ) {
+          return false;
+        }
+      }
+      else if ( strcmp( key_sbuf->str, "options" ) == 0 ) {
+        if ( !jp_parse_strings( p, &jp_set_option, req, key_sbuf ) )
+          return false;
+      }
+      else if ( !jp_skip_value( p, /*depth=*/0 ) ) {
+        return false;
+      }
+    } while ( jp_accept( p, ',' ) );
+
+    if ( !jp_accept( p, '}' ) )
+      return jp_error( p, "',' or '}' expected" );
+  }
+
+  jp_skip_ws( p );
+  if ( p->s != p->end )
+    return jp_error( p, "extra characters after object" );
+  if ( !req->has_command )
+    return jp_error( p, "\"command\" expected" );
+  return true;
+}
+
+/**
+ * Gets the length of the well-formed UTF-8 sequence starting at \a s.
+ *
+ * @param s The first byte of the sequence.  It must be &ge; 0x80.
+ * @param end The end of the string.
+ * @return Returns the length of the sequence or 0 if it's ill-formed, e.g.,
+ * is truncated, is overlong, or encodes a surrogate.
+ */
+NODISCARD
+static size_t utf8_seq_len( char const *s, char const *end ) {
+  unsigned char const c0 = STATIC_CAST( unsigned char, s[0] );
+  size_t len;
+  unsigned char lo = 0x80, hi = 0xBF;   // range of the second byte
+
+  if ( c0 >= 0xC2 && c0 <= 0xDF )
+    len = 2;
+  else if ( c0 >= 0xE0 && c0 <= 0xEF ) {
+    len = 3;
+    if ( c0 == 0xE0 )
+      lo = 0xA0;                        // overlong
+    else if ( c0 == 0xED )
+      hi = 0x9F;                        // surrogate
+  }
+  else if ( c0 >= 0xF0 && c0 <= 0xF4 ) {
+    len = 4;
+    if ( c0 == 0xF0 )
+      lo = 0x90;                        // overlong
+    else if ( c0 == 0xF4 )
+      hi = 0x8F;                        // > U+10FFFF
+  }
+  else {
+    return 0;
+  }
+
+  if ( STATIC_CAST( size_t, end - s ) < len )
+    return 0;
+  unsigned char const c1 = STATIC_CAST( unsigned char, s[1] );
+  if ( c1 < lo || c1 > hi )
+    return 0;
+  for ( size_t i = 2; i < len; ++i ) {
+    if ( (STATIC_CAST( unsigned char, s[i] ) & 0xC0) != 0x80 )
+      return 0;
+  } // for
+  return len;
+}
+
+/**
+ * Appends \a s as a JSON string onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @param s The string to append.  It need not be null-terminated.  Ill-formed
+ * UTF-8 sequences in it are replaced by U+FFFD so the result is always valid
+ * JSON.
+ * @param s_len The length of \a s.
+ */
+static void jsonl_put_str( strbuf_t *sbuf, char const *s, size_t s_len ) {
+  strbuf_putc( sbuf, '"' );
+  for ( char const *const end = s + s_len; s < end; ++s ) {
+    if ( STATIC_CAST( unsigned char, *s ) >= 0x80 ) {
+      size_t const len = utf8_seq_len( s, end );
+      if ( len == 0 ) {
+        strbuf_putsn( sbuf, "\\ufffd", 6 );
+      }
+      else {
+        strbuf_putsn( sbuf, s, len );
+        s += len - 1;
+      }
+      continue;
+    }
+    switch ( *s ) {
+      case '"' : strbuf_putsn( sbuf, "\\\"", 2 ); continue;
+      case '\\': strbuf_putsn( sbuf, "\\\\", 2 ); continue;
+      case '\b': strbuf_putsn( sbuf, "\\b" , 2 ); continue;
+      case '\f': strbuf_putsn( sbuf, "\\f" , 2 ); continue;
+      case '\n': strbuf_putsn( sbuf, "\\n" , 2 ); continue;
+      case '\r': strbuf_putsn( sbuf, "\\r" , 2 ); continue;
+      case '\t': strbuf_putsn( sbuf, "\\t" , 2 ); continue;
+    } // switch
+    if ( STATIC_CAST( unsigned char, *s ) < 0x20 )
+      strbuf_printf( sbuf, "\\u%04x", STATIC_CAST( unsigned, *s ) );
+    else
+      strbuf_putc( sbuf, *s );
+  } // for
+  strbuf_putc( sbuf, '"' );
+}
+
+/**
+ * Appends a diagnostic as a JSON object onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @param diag The \ref print_diag or NULL for an error without a location.
+ * @param msg The message.  Leading and trailing whitespace is trimmed.
+ * @param msg_len The length of \a msg.
+ * @param comma A pointer to a flag that is `true` if a comma must be printed
+ * first; it is set to `true`.
+ */
+static void jsonl_put_diag( strbuf_t *sbuf, print_diag_t const *diag,
+                            char const *msg, size_t msg_len, bool *comma ) {
+  while ( msg_len > 0 && isspace( STATIC_CAST( unsigned char, *msg ) ) )
+    ++msg, --msg_len;
+  while ( msg_len > 0 &&
+          isspace( STATIC_CAST( unsigned char, msg[ msg_len - 1 ] ) ) ) {
+    --msg_len;
+  }
+  if ( diag == NULL && msg_len == 0 )
+    return;
+
+  if ( true_or_set( comma ) )
+    strbuf_putc( sbuf, ',' );
+  strbuf_printf( sbuf, "{\"severity\":\"%s\"",
+    diag != NULL && diag->is_warning ? "warning" : "error"
+  );
+  if ( diag != NULL && diag->has_loc ) {
+    strbuf_printf( sbuf,
+      ",\"first_line\":%d,\"first_column\":%d"
+      ",\"last_line\":%d,\"last_column\":%d",
+      diag->loc.first_line, diag->loc.first_column,
+      diag->loc.last_line, diag->loc.last_column
+    );
+  }
+  strbuf_puts( sbuf, ",\"message\":" );
+  jsonl_put_str( sbuf, msg, msg_len );
+  if ( diag != NULL && diag->dym != NULL ) {
+    strbuf_puts( sbuf, ",\"suggestions\":[" );
+    for ( did_you_mean_t const *dym = diag->dym; dym->literal != NULL;
+          ++dym ) {
+      if ( dym != diag->dym )
+        strbuf_putc( sbuf, ',' );
+      jsonl_put_str( sbuf, dym->literal, strlen( dym->literal ) );
+    } // for
+    strbuf_putc( sbuf, ']' );
+  }
+  strbuf_putc( sbuf, '}' );
+}
+
+/**
+ * Appends all diagnostics as a JSON array onto \a sbuf.
+ *
+ * @param sbuf The \ref strbuf to append onto.
+ * @param diags The \ref print_diags.
+ * @param err The errors and warnings that were printed: the message of each
+ * diagnostic is preceded by #PRINT_DIAG_SEP; anything preceding the first is
+ * a message without a location.
+ */
+static void jsonl_put_diags( strbuf_t *sbuf, print_diags_t const *diags,
+                             strbuf_t const *err ) {
+  char const *msg = err->str != NULL ? err->str : "";
+  char const *const end = msg + err->len;
+  bool comma = false;
+
+  strbuf_puts( sbuf, ",\"diagnostics\":[" );
+  for ( size_t i = 0; ; ++i ) {
+    char const *const sep =
+      memchr( msg, PRINT_DIAG_SEP, STATIC_CAST( size_t, end - msg ) );
+    char const *const msg_end = sep != NULL ? sep : end;
+    jsonl_put_diag(
+      sbuf, i > 0 && i <= diags->len ? &diags->diag[ i - 1 ] : NULL,
+      msg, STATIC_CAST( size_t, msg_end - msg ), &comma
+    );
+    if ( sep == NULL )
+      break;
+    msg = sep + 1;
+  } // for
+  strbuf_putc( sbuf, ']' );
+}
+
+/**
+ * Reads a line from \a fin.
+ *
+ * @param sbuf The \ref strbuf to read into.  It is reset first.
+ * @param fin The `FILE` to read from.
+ * @return Returns `false` only upon EOF.
+ */
+NODISCARD
+static bool jsonl_read_line( strbuf_t *sbuf, FILE *fin ) {
+  strbuf_reset( sbuf );
+  char buf[ 1024 ];
+  while ( fgets( buf, sizeof buf, fin ) != NULL ) {
+    size_t const len = strlen( buf );
+    strbuf_putsn( sbuf, buf, len );
+    if ( len > 0 && buf[ len - 1 ] == '\n' )
+      return true;
+  } // while
+  FERROR( fin );
+  return sbuf->len > 0;
+}
+
+/**
+ * Executes \a req and prints its response.
+ *
+ * @param req The \ref jsonl_request to execute.
+ * @param rsp The \ref strbuf to use for the response.
+ * @param out The \ref strbuf to use for the command's output.
+ * @param err The \ref strbuf to use for the command's errors.
+ */
+static void jsonl_exec( jsonl_request_t const *req, strbuf_t *rsp,
+                        strbuf_t *out, strbuf_t *err ) {
+  cdecl_session_t *const session = cdecl_session;
+  print_diags_t diags = { 0 };
+  print_params.diags = &diags;
+
+  cdecl_options_t const prev_opts = cdecl_opts;
+  double const start = monotonic_now();
+  int status = EX_OK;
+
+  if ( req->set.len > 0 ) {
+    status = cdecl_lib_command( session, req->set.str, out, err );
+    // Locations would be within the "set" command we made, not the request.
+    for ( size_t i = 0; i < diags.len; ++i )
+      diags.diag[i].has_loc = false;
+  }
+  if ( status == EX_OK )
+    status = cdecl_lib_command( session, req->command.str, out, err );
+
+  double const elapsed = monotonic_now() - start;
+  if ( req->set.len > 0 ) {
+    if ( !cdecl_options_equal( &prev_opts, &cdecl_opts ) ) {
+      cdecl_opts = prev_opts;
+      ++session->gen;                   // invalidate the result cache
+      cdecl_prompt_init();
+    }
+  }
+  print_params.diags = NULL;
+
+  strbuf_putc( rsp, '{' );
+  if ( req->id.len > 0 ) {
+    strbuf_puts( rsp, "\"id\":" );
+    strbuf_putsn( rsp, req->id.str, req->id.len );
+    strbuf_putc( rsp, ',' );
+  }
+  strbuf_printf( rsp, "\"status\":%d,\"output\":", status );
+  jsonl_put_str( rsp, out->str != NULL ? out->str : "", out->len );
+  jsonl_put_diags( rsp, &diags, err );
+  strbuf_printf( rsp, ",\"time_us\":%.1f}\n", elapsed * 1e6 );
+
+  print_diags_cleanup( &diags );
+}
+
+/**
+ * Prints the response for a malformed request.
+ *
+ * @param req The \ref jsonl_request, possibly partially parsed.
+ * @param p The \ref jsonl_parser that failed.
+ * @param line The request line.
+ * @param rsp The \ref strbuf to use for the response.
+ */
+static void jsonl_malformed( jsonl_request_t const *req,
+                             jsonl_parser_t const *p, char const *line,
+                             strbuf_t *rsp ) {
+  strbuf_putc( rsp, '{' );
+  if ( req->id.len > 0 ) {
+    strbuf_puts( rsp, "\"id\":" );
+    strbuf_putsn( rsp, req->id.str, req->id.len );
+    strbuf_putc( rsp, ',' );
+  }
+  strbuf_printf( rsp,
+    "\"status\":%d,\"output\":\"\",\"diagnostics\":[{\"severity\":\"error\""
+    ",\"first_column\":%td,\"message\":",
+    EX_DATAERR, p->s - line
+  );
+  strbuf_t msg;
+  strbuf_init( &msg );
+  strbuf_printf( &msg, "invalid JSON request: %s", p->error );
+  jsonl_put_str( rsp, msg.str, msg.len );
+  strbuf_cleanup( &msg );
+  strbuf_puts( rsp, "}],\"time_us\":0.0}\n" );
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+int cdecl_jsonl( void ) {
+  strbuf_t line, key, rsp, out, err;
+  strbuf_init( &line );
+  strbuf_init( &key );
+  strbuf_init( &rsp );
+  strbuf_init( &out );
+  strbuf_init( &err );
+  jsonl_request_t req;
+  strbuf_init( &req.command );
+  strbuf_init( &req.id );
+  strbuf_init( &req.set );
+
+  cdecl_session->is_quit_deferred = true;
+  cdecl_session->is_termless = true;    // output goes into the response
+
+  while ( !cdecl_session->is_quit && jsonl_read_line( &line, stdin ) ) {
+    if ( str_is_empty( line.str ) )
+      continue;
+    size_t line_len = line.len;
+    strn_rtrim( line.str, &line_len );
+
+    strbuf_reset( &req.command );
+    strbuf_reset( &req.id );
+    strbuf_reset( &req.set );
+    req.has_command = false;
+    strbuf_reset( &rsp );
+
+    jsonl_parser_t p = { .s = line.str, .end = line.str + line_len };
+    if ( jp_parse_request( &p, &req, &key ) ) {
+      strbuf_reset( &out );
+      strbuf_reset( &err );
+      jsonl_exec( &req, &rsp, &out, &err );
+    }
+    else {
+      jsonl_malformed( &req, &p, line.str, &rsp );
+    }
+
+    sink_putsn( cdecl_fout, rsp.str, rsp.len );
+    sink_flush( cdecl_fout );
+  } // while
+
+  strbuf_cleanup( &line );
+  strbuf_cleanup( &key );
+  strbuf_cleanup( &rsp );
+  strbuf_cleanup( &out );
+  strbuf_cleanup( &err );
+  strbuf_cleanup( &req.command );
+  strbuf_cleanup( &req.id );
+  strbuf_cleanup( &req.set );
+  return EX_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,93 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/jsonl.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_jsonl_H
+#define cdecl_jsonl_H
+
+/**
+ * @file
+ * Declares a function for executing **cdecl** commands given as JSON lines.
+ *
+ * @remarks Tools that use **cdecl** otherwise have to parse its human-readable
+ * output and error messages.  Instead, each line of input can be a JSON
+ * request object like:
+ *
+ *      {"id":1,"command":"explain int *p","options":["east-const"]}
+ *
+ * where:
+ *
+ *  + `command` is the **cdecl** command to execute (required).
+ *  + `lang` is the language to use (optional).
+ *  + `options` is an array of `set` options to use (optional).
+ *  + `id` is any JSON value that is copied as-is into the response
+ *    (optional).
+ *
+ * Any other members are ignored.  Both `lang` and `options` apply only to
+ * that request.  Types defined by a request remain defined for subsequent
+ * requests.
+ * @par
+ * For each request, a single line of a JSON response object is printed like:
+ *
+ *      {"id":1,"status":0,"output":"...","diagnostics":[],"time_us":21.4}
+ *
+ * where:
+ *
+ *  + `status` is the command's `EX_` status code.
+ *  + `output` is what would have been printed to standard output.
+ *  + `diagnostics` is an array of errors and warnings, each an object like:
+ *
+ *          {"severity":"error","first_line":0,"first_column":8,
+ *           "last_line":0,"last_column":10,"message":"...",
+ *           "suggestions":["FILE"]}
+ *
+ *    where the location members are the zero-based members of \ref c_loc
+ *    (and are present only if the diagnostic has a location) and
+ *    `suggestions` are the "did you mean" suggestions, if any.
+ *  + `time_us` is the time taken to execute the command in microseconds.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+
+/**
+ * @defgroup jsonl-group JSON Lines
+ * Function for executing **cdecl** commands given as JSON lines.
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Reads JSON request lines from standard input and prints a JSON response
+ * line for each to standard output until either EOF or the `quit` command.
+ *
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ * Failures of individual commands (including malformed requests) are
+ * reported in their responses.
+ */
+NODISCARD
+int cdecl_jsonl( void );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_jsonl_H */
+/* vim:set et sw=2 ts=2: */
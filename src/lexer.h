@@ -23,13 +23,15 @@
 
 /**
  * @file
- * Declares types, global variables, and functions for interacting with the
- * lexical analyzer.
+ * Declares types and functions for interacting with the lexical analyzer.
  */
 
 // local
 #include "pjl_config.h"                 /* must go first */
 #include "c_keyword.h"
+#include "red_black.h"
+#include "slist.h"
+#include "strbuf.h"
 #include "types.h"
 
 /// @cond DOXYGEN_IGNORE
@@ -43,8 +45,7 @@
 
 /**
  * @defgroup lexer-group Lexical Analyzer
- * Types, global variables, and functions for interacting with the lexical
- * analyzer.
+ * Types and functions for interacting with the lexical analyzer.
  * @{
  */
 
@@ -61,106 +62,138 @@ enum lexer_find_kind {
 };
 typedef enum lexer_find_kind lexer_find_kind_t;
 
-////////// extern variables ///////////////////////////////////////////////////
+/**
+ * C++ raw string delimiter maximum length.
+ */
+#define LEXER_RSTR_DELIM_LEN_MAX  16u
 
 /**
- * For the lexer, specifies what to look-up when an identifier is lex'd.
+ * Lexer state.
  *
- * @remarks Defaults to #LEXER_FIND_ANY, but other values can be turned off
- * either individually or in combination via bitwise-and'ing the complement to
- * find all _but_ those things.  For example:
+ * @remarks All state of a lexer is kept here (rather than in global variables)
+ * so that any number of lexers can be used independently, e.g., by different
+ * threads.  The Flex scanner is reentrant and its "extra" data points back to
+ * the \ref lexer that owns it.
+ * @par
+ * Only \ref find, \ref keyword_ctx, and \ref token are meant to be used
+ * outside of the lexer; all other members are private.
  *
- *      lexer_find &= ~LEXER_FIND_CDECL_KEYWORDS;
- *
- * would find all _but_ **cdecl** keywords so they'd be returned as ordinary
- * identifiers.
+ * @sa lexer_init()
+ * @sa lexer_cleanup()
  */
-extern lexer_find_kind_t  lexer_find;
+struct lexer {
+  /**
+   * Specifies what to look-up when an identifier is lex'd.
+   *
+   * @remarks Defaults to #LEXER_FIND_ANY, but other values can be turned off
+   * either individually or in combination via bitwise-and'ing the complement
+   * to find all _but_ those things.  For example:
+   *
+   *      lexer->find &= ~LEXER_FIND_CDECL_KEYWORDS;
+   *
+   * would find all _but_ **cdecl** keywords so they'd be returned as ordinary
+   * identifiers.
+   */
+  lexer_find_kind_t find;
+
+  c_keyword_ctx_t   keyword_ctx;        ///< Keyword context.
+
+  /**
+   * Text of current token.
+   *
+   * @remarks A separate pointer for the current token allows it:
+   *  + To be `const`.
+   *  + To be assigned to either other `const` strings or string literals.
+   *
+   * @sa lexer_printable_token()
+   */
+  char const       *token;
+
+  yyscan_t          scanner;            ///< Flex reentrant scanner.
+  bool              digraph_warned;     ///< Printed digraph warning once?
+  rb_tree_t         include_set;        ///< Set of resolved include paths.
+  slist_t           include_stack;      ///< Stack of include paths.
+  char             *input_buf;          ///< Entire current input line.
+  size_t            input_cap;          ///< Capacity of \ref input_buf.
+  size_t            input_len;          ///< Length of \ref input_buf.
+  size_t            input_sent;         ///< How many bytes returned to Flex.
+  bool              is_eof;             ///< Encountered EOF?
+  int               newline_column;     ///< Column position of newline.
+  strbuf_t          str_lit_buf;        ///< String (or character) literal.
+  c_loc_t           str_lit_loc;        ///< String literal starting location.
+  int               token_column;       ///< Column position of current token.
+  bool              trigraph_warned;    ///< Printed trigraph warning once?
+
+  /// C++ raw string literal delimiter.
+  char rstr_delim[ LEXER_RSTR_DELIM_LEN_MAX + 1/*"*/ + 1/*\0*/ ];
+};
 
-/**
- * Lexer keyword context.
- */
-extern c_keyword_ctx_t    lexer_keyword_ctx;
+////////// extern functions ///////////////////////////////////////////////////
 
 /**
- * Text of current token.
+ * Cleans up all memory used by \a lexer including its Flex scanner, but _not_
+ * \a lexer itself.
+ *
+ * @param lexer The \ref lexer to clean up.  If NULL, does nothing.
  *
- * @sa lexer_printable_token()
+ * @sa lexer_init()
  */
-extern char const        *lexer_token;
-
-////////// extern functions ///////////////////////////////////////////////////
+void lexer_cleanup( lexer_t *lexer );
 
 /**
- * Initializes the lexer.
+ * Initializes \a lexer including creating its Flex scanner.
  *
- * @note This function must be called exactly once.
+ * @param lexer The \ref lexer to initialize.
+ *
+ * @sa lexer_cleanup()
  */
-void lexer_init( void );
+void lexer_init( lexer_t *lexer );
 
 /**
  * Gets the current input line.
  *
+ * @param lexer The \ref lexer to use.
  * @param rv_len Receives the length of said line.
  * @return Returns said line.
  */
 NODISCARD
-char const* lexer_input_line( size_t *rv_len );
+char const* lexer_input_line( lexer_t const *lexer, size_t *rv_len );
 
 /**
  * Gets the lexer's current location.
  *
+ * @param lexer The \ref lexer to use.
  * @return Returns said location.
  */
 NODISCARD
-c_loc_t lexer_loc( void );
+c_loc_t lexer_loc( lexer_t const *lexer );
 
 /**
- * Gets a printable string of \ref lexer_token.
+ * Gets a printable string of \ref lexer::token "token".
  *
- * @return Returns said string or NULL if \ref lexer_token is the empty string.
+ * @param lexer The \ref lexer to use.
+ * @return Returns said string or NULL if \ref lexer::token "token" is the
+ * empty string.
  */
 NODISCARD
-char const* lexer_printable_token( void );
+char const* lexer_printable_token( lexer_t const *lexer );
 
 /**
  * Resets the lexer to its initial state.
  *
+ * @param lexer The \ref lexer to reset.
  * @param hard_reset If `true`, does a "hard" reset that currently resets the
  * EOF flag also.
  */
-void lexer_reset( bool hard_reset );
-
-/**
- * Flex: gets the next token ID.
- *
- * @return Returns the token ID.
- *
- * @note The definition is provided by Flex.
- */
-NODISCARD
-int yylex( void );
-
-#ifdef __GNUC__
-# pragma GCC diagnostic push
-  // Declare yyrestart() so it can be called from anywhere.  However, Flex
-  // declares yyrestart() in the generated .c file before it #includes headers,
-  // so we'd get a redundant declaration warning -- so suppress that.
-# pragma GCC diagnostic ignored "-Wredundant-decls"
-#endif /* __GNUC__ */
+void lexer_reset( lexer_t *lexer, bool hard_reset );
 
 /**
- * Flex: immediately switch to reading \a file.
+ * Immediately switches \a lexer to reading \a fin.
  *
- * @param in_file The `FILE` to read from.
- *
- * @note The definition is provided by Flex.
+ * @param lexer The \ref lexer to use.
+ * @param fin The `FILE` to read from.
  */
-void yyrestart( FILE *in_file );
-
-#ifdef __GNUC__
-# pragma GCC diagnostic pop
-#endif /* __GNUC__ */
+void lexer_restart( lexer_t *lexer, FILE *fin );
 
 ///////////////////////////////////////////////////////////////////////////////
 
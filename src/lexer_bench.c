@@ -0,0 +1,231 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/lexer_bench.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines main() for a throughput benchmark of the lexer.
+ *
+ * @remarks Usage: `lexer_bench iterations file...`, e.g.:
+ *
+ *      lexer_bench 100 ../test/tests/\*.test
+ *
+ * The corpus is the input to **cdecl** in every `<<END` "here document" in the
+ * given test files.  The whole corpus is lexed (but not parsed) the given
+ * number of times with every kind of look-up of identifiers enabled and the
+ * number of tokens per second is reported.
+ *
+ * @note The numbers say something about Flex's scanner tables only when
+ * `lexer.c` was generated by Flex itself.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "c_sname.h"
+#include "cdecl.h"
+#include "cdecl_session.h"
+#include "lexer.h"
+#include "libcdecl.h"
+#include "print.h"
+#include "sink.h"
+#include "strbuf.h"
+#include "util.h"
+#include "cdecl_parser.h"               /* must go last */
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <errno.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+/// @endcond
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Appends the input to **cdecl** in every `<<END` "here document" in the test
+ * file \a path to \a corpus.
+ *
+ * @param path The path of the test file.
+ * @param corpus The corpus to append to.
+ * @return Returns the number of lines appended.
+ */
+static size_t bench_read_test( char const *path, strbuf_t *corpus ) {
+  FILE *const fin = fopen( path, "r" );
+  if ( fin == NULL )
+    fatal_error( EX_NOINPUT, "\"%s\": %s\n", path, STRERROR() );
+
+  char *line = NULL;
+  size_t line_cap = 0, lines = 0;
+  bool in_here_doc = false;
+  ssize_t line_len;
+
+  while ( (line_len = getline( &line, &line_cap, fin )) != -1 ) {
+    if ( !in_here_doc ) {
+      in_here_doc = strstr( line, "<<END" ) != NULL ||
+                    strstr( line, "<<'END'" ) != NULL;
+      continue;
+    }
+    if ( strcmp( line, "END\n" ) == 0 ) {
+      in_here_doc = false;
+      continue;
+    }
+    strbuf_putsn( corpus, line, STATIC_CAST( size_t, line_len ) );
+    ++lines;
+  } // while
+
+  free( line );
+  PJL_IGNORE_RV( fclose( fin ) );
+  return lines;
+}
+
+/**
+ * Lexes \a corpus once.
+ *
+ * @param lexer The \ref lexer to use.
+ * @param corpus The corpus to lex.
+ * @param errors Incremented for every lexical error.
+ * @return Returns the number of tokens lexed.
+ */
+static size_t bench_run( lexer_t *lexer, strbuf_t const *corpus,
+                         size_t *errors ) {
+  FILE *const fin =
+    fmemopen( CONST_CAST( void*, corpus->str ), corpus->len, "r" );
+  PERROR_EXIT_IF( fin == NULL, EX_IOERR );
+  lexer_reset( lexer, /*hard_reset=*/true );
+  lexer_restart( lexer, fin );
+
+  size_t tokens = 0;
+  for (;;) {
+    YYSTYPE lval;
+    YYLTYPE lloc;
+    int const token = lexer_lex( &lval, &lloc, lexer->scanner );
+    if ( token == 0 )
+      break;
+    ++tokens;
+    switch ( token ) {
+      case Y_CHAR_LIT:
+      case Y_GLOB:
+      case Y_SET_OPTION:
+      case Y_STR_LIT:
+        FREE( lval.str_val );
+        break;
+      case Y_CONSTRUCTOR_SNAME:
+      case Y_DESTRUCTOR_SNAME:
+      case Y_OPERATOR_SNAME:
+        c_sname_cleanup( &lval.sname );
+        break;
+      case Y_LEXER_ERROR:
+        ++*errors;
+        break;
+    } // switch
+  } // for
+
+  PJL_IGNORE_RV( fclose( fin ) );
+  return tokens;
+}
+
+// LCOV_EXCL_START
+_Noreturn
+static void usage( void ) {
+  fprintf( stderr, "usage: %s iterations file...\n", me );
+  exit( EX_USAGE );
+}
+// LCOV_EXCL_STOP
+
+////////// main ///////////////////////////////////////////////////////////////
+
+/**
+ * The main entry point.
+ *
+ * @param argc The command-line argument count.
+ * @param argv The command-line argument values.
+ * @return Returns 0 on success, non-zero on failure.
+ */
+int main( int argc, char const *argv[] ) {
+  cdecl_lib_init( /*prog_name=*/NULL );
+
+  if ( argc < 3 )
+    usage();
+  unsigned long const iterations = strtoul( argv[1], /*endptr=*/NULL, 10 );
+  if ( iterations == 0 )
+    usage();
+
+  strbuf_t corpus;
+  strbuf_init( &corpus );
+  size_t lines = 0;
+  for ( int i = 2; i < argc; ++i )
+    lines += bench_read_test( argv[i], &corpus );
+  if ( corpus.len == 0 )
+    fatal_error( EX_DATAERR, "no \"<<END\" input in test files\n" );
+
+  cdecl_session_t *const session = cdecl_lib_session_new();
+  cdecl_session_t *const prev_session = cdecl_session_set( session );
+
+  // Lexical errors are counted, not printed.
+  strbuf_t err_buf;
+  strbuf_init( &err_buf );
+  sink_t err_sink;
+  sink_init_strbuf( &err_sink, &err_buf );
+  sink_t *const prev_ferr = cdecl_ferr_redirect;
+  cdecl_ferr_redirect = &err_sink;
+
+  lexer_t lexer;
+  lexer_init( &lexer );
+
+  // Lexical errors print their input line, so there must be one.
+  print_params_t const prev_print_params = print_params;
+  print_params.command_line = "";
+  print_params.command_line_len = 0;
+  print_params.lexer = &lexer;
+
+  size_t tokens = 0, errors = 0;
+  double const start = monotonic_now();
+  for ( unsigned long i = 0; i < iterations; ++i ) {
+    tokens += bench_run( &lexer, &corpus, &errors );
+    strbuf_reset( &err_buf );
+  } // for
+  double const elapsed = monotonic_now() - start;
+
+  printf( "%zu lines, %zu bytes, %lu iterations, %zu tokens, %zu errors\n",
+    lines, corpus.len, iterations, tokens, errors
+  );
+  printf( "%.3fs (%.0f tokens/s, %.1fns/token)\n",
+    elapsed,
+    elapsed > 0 ? STATIC_CAST( double, tokens ) / elapsed : 0.0,
+    tokens > 0 ? elapsed * 1e9 / STATIC_CAST( double, tokens ) : 0.0
+  );
+
+  print_params = prev_print_params;
+  lexer_cleanup( &lexer );
+  cdecl_ferr_redirect = prev_ferr;
+  sink_cleanup( &err_sink );
+  strbuf_cleanup( &err_buf );
+  PJL_IGNORE_RV( cdecl_session_set( prev_session ) );
+  cdecl_session_free( session );
+  strbuf_cleanup( &corpus );
+  exit( EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,167 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/libcdecl.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for using **cdecl** as a library.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "libcdecl.h"
+#include "c_lang.h"
+#include "cdecl.h"
+#include "cdecl_session.h"
+#include "literals.h"
+#include "options.h"
+#include "parse.h"
+#include "prompt.h"
+#include "sink.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+/// @endcond
+
+/**
+ * @addtogroup libcdecl-group
+ * @{
+ */
+
+// local variables
+static cdecl_options_t  lib_opts;       ///< Options for new sessions.
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Executes the **cdecl** command \a command followed by \a args.
+ *
+ * @param session The session to use.
+ * @param command The command.
+ * @param args The command's arguments.
+ * @param out The string buffer to append output onto.
+ * @param err The string buffer to append errors onto or NULL to discard.
+ * @return Returns `EX_OK` upon success or another `EX_` code upon failure.
+ */
+NODISCARD
+static int lib_command_args( cdecl_session_t *session, char const *command,
+                             char const *args, strbuf_t *out, strbuf_t *err ) {
+  assert( command != NULL );
+  assert( args != NULL );
+
+  strbuf_t sbuf;
+  strbuf_init( &sbuf );
+  strbuf_puts( &sbuf, command );
+  strbuf_putc( &sbuf, ' ' );
+  strbuf_puts( &sbuf, args );
+  int const status = cdecl_lib_command( session, sbuf.str, out, err );
+  strbuf_cleanup( &sbuf );
+  return status;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+int cdecl_declare( cdecl_session_t *session, char const *english,
+                   strbuf_t *out, strbuf_t *err ) {
+  return lib_command_args( session, L_declare, english, out, err );
+}
+
+int cdecl_explain( cdecl_session_t *session, char const *gibberish,
+                   strbuf_t *out, strbuf_t *err ) {
+  return lib_command_args( session, L_explain, gibberish, out, err );
+}
+
+int cdecl_lib_command( cdecl_session_t *session, char const *command,
+                       strbuf_t *out, strbuf_t *err ) {
+  assert( session != NULL );
+  assert( command != NULL );
+  assert( out != NULL );
+
+  strbuf_t discard_sbuf;
+  if ( err == NULL ) {
+    strbuf_init( &discard_sbuf );
+    err = &discard_sbuf;
+  }
+
+  sink_t out_sink, err_sink;
+  sink_init_strbuf( &out_sink, out );
+  sink_init_strbuf( &err_sink, err );
+
+  sink_t *const prev_fout = cdecl_fout_redirect;
+  sink_t *const prev_ferr = cdecl_ferr_redirect;
+  cdecl_fout_redirect = &out_sink;
+  cdecl_ferr_redirect = &err_sink;
+  cdecl_session_t *const prev_session = cdecl_session_set( session );
+  if ( cdecl_prompt[0] == NULL )        // first command on this thread
+    cdecl_prompt_init();
+
+  int const status = cdecl_parse_string( command, strlen( command ) );
+
+  PJL_IGNORE_RV( cdecl_session_set( prev_session ) );
+  cdecl_fout_redirect = prev_fout;
+  cdecl_ferr_redirect = prev_ferr;
+
+  sink_cleanup( &out_sink );
+  sink_cleanup( &err_sink );
+  if ( err == &discard_sbuf )
+    strbuf_cleanup( &discard_sbuf );
+  return status;
+}
+
+void cdecl_lib_init( char const *prog_name ) {
+  ASSERT_RUN_ONCE();
+  me = prog_name != NULL ? prog_name : CDECL;
+  cdecl_init();
+  lib_opts = cdecl_opts;
+  lib_opts.lang = is_cppdecl() ? LANG_CPP_NEW : LANG_C_NEW;
+}
+
+cdecl_session_t* cdecl_lib_session_new( void ) {
+  //
+  // A new session gets a copy of the options of the calling thread, so
+  // temporarily replace them with the library's defaults.
+  //
+  cdecl_session_t *const prev_session = cdecl_session_set( NULL );
+  cdecl_options_t const prev_opts = cdecl_opts;
+  cdecl_opts = lib_opts;
+
+  cdecl_session_t *const session = cdecl_session_new();
+  session->is_initialized = true;
+  session->is_quit_deferred = true;     // a library must never exit()
+  session->is_termless = true;
+
+  cdecl_opts = prev_opts;
+  PJL_IGNORE_RV( cdecl_session_set( prev_session ) );
+  return session;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
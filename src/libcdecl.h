@@ -0,0 +1,152 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/libcdecl.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_libcdecl_H
+#define cdecl_libcdecl_H
+
+/**
+ * @file
+ * Declares functions for using **cdecl** as a library.
+ *
+ * @remarks Rather than printing to standard output and standard error, these
+ * functions return whatever **cdecl** would have printed in caller-owned
+ * string buffers.  A typical use is:
+ *
+ *      cdecl_lib_init( NULL );
+ *      cdecl_session_t *const session = cdecl_lib_session_new();
+ *      strbuf_t out;
+ *      strbuf_init( &out );
+ *      if ( cdecl_explain( session, "int (*f)(void)", &out, NULL ) == EX_OK )
+ *        // out.str is "declare f as pointer to function (void) returning int\n"
+ *      strbuf_cleanup( &out );
+ *      cdecl_session_free( session );
+ *
+ * Since each session owns all of its mutable state, different threads may use
+ * different sessions concurrently.
+ * @par
+ * Every distinct name given to any session is interned (see intern.h) and
+ * stays in memory until the process exits, even after its session is freed.
+ * A long-running host given arbitrary input therefore grows by the number of
+ * distinct names it has ever seen.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "cdecl_session.h"
+#include "strbuf.h"
+#include "types.h"
+
+/**
+ * @defgroup libcdecl-group Library API
+ * Functions for using **cdecl** as a library.
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Executes a **cdecl** command.
+ *
+ * @param session The session to execute \a command in.  While executing, it's
+ * made the current session of the calling thread.
+ * @param command The command to execute, e.g., `explain int *p`.
+ * @param out The string buffer to append what would have been printed to
+ * standard output onto.
+ * @param err The string buffer to append what would have been printed to
+ * standard error (errors and warnings) onto or NULL to discard them.
+ * @return Returns `EX_OK` upon success or another `EX_` code upon failure.
+ *
+ * @sa cdecl_declare()
+ * @sa cdecl_explain()
+ */
+NODISCARD
+int cdecl_lib_command( cdecl_session_t *session, char const *command,
+                       strbuf_t *out, strbuf_t *err );
+
+/**
+ * Initializes **cdecl** for use as a library.
+ *
+ * @param prog_name The program name used in error messages that also selects
+ * the default language the same way the name of the **cdecl** executable does
+ * (C for `cdecl`, C++ for `c++decl`) or NULL for `cdecl`.  It must remain
+ * valid until the process exits.
+ *
+ * @note This must be called exactly once, before calling any other **cdecl**
+ * function and before creating any threads that do.
+ *
+ * @sa cdecl_lib_session_new()
+ */
+void cdecl_lib_init( char const *prog_name );
+
+/**
+ * Creates a new session having the default options (as if no configuration
+ * file were read and no command-line options were given).  In it, the `quit`
+ * command sets cdecl_session::is_quit rather than exiting.
+ *
+ * @return Returns said session.  The caller is responsible for freeing it via
+ * cdecl_session_free().
+ *
+ * @sa cdecl_lib_init()
+ */
+NODISCARD
+cdecl_session_t* cdecl_lib_session_new( void );
+
+/**
+ * Declares (composes) a C/C++ declaration from pseudo-English.
+ *
+ * @param session The session to use.
+ * @param english The pseudo-English to declare, i.e., what follows `declare`,
+ * e.g., `f as pointer to function returning int`.
+ * @param out The string buffer to append the resulting gibberish onto.
+ * @param err The string buffer to append errors and warnings onto or NULL to
+ * discard them.
+ * @return Returns `EX_OK` upon success or another `EX_` code upon failure.
+ *
+ * @sa cdecl_explain()
+ * @sa cdecl_lib_command()
+ */
+NODISCARD
+int cdecl_declare( cdecl_session_t *session, char const *english,
+                   strbuf_t *out, strbuf_t *err );
+
+/**
+ * Explains (deciphers) a C/C++ declaration or cast into pseudo-English.
+ *
+ * @param session The session to use.
+ * @param gibberish The gibberish to explain, i.e., what follows `explain`,
+ * e.g., `int (*f)(void)`.
+ * @param out The string buffer to append the resulting pseudo-English onto.
+ * @param err The string buffer to append errors and warnings onto or NULL to
+ * discard them.
+ * @return Returns `EX_OK` upon success or another `EX_` code upon failure.
+ *
+ * @sa cdecl_declare()
+ * @sa cdecl_lib_command()
+ */
+NODISCARD
+int cdecl_explain( cdecl_session_t *session, char const *gibberish,
+                   strbuf_t *out, strbuf_t *err );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_libcdecl_H */
+/* vim:set et sw=2 ts=2: */
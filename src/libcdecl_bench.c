@@ -0,0 +1,166 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/libcdecl_bench.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines main() for a throughput benchmark of the **libcdecl** API.
+ *
+ * @remarks Usage: `libcdecl_bench [iterations]`.  It repeatedly explains and
+ * declares a fixed set of declarations in a single session and reports the
+ * number of calls per second.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "cdecl.h"
+#include "cdecl_session.h"
+#include "libcdecl.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdio.h>
+#include <stdlib.h>
+#include <sysexits.h>
+
+/// @endcond
+
+/// Default number of iterations over all declarations.
+#define BENCH_ITERATIONS_DEFAULT  10000
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Gibberish to explain.
+ */
+static char const *const BENCH_GIBBERISH[] = {
+  "int x",
+  "int (*f)(void)",
+  "char *const *argv",
+  "unsigned long (*a[4])(int, char const*)",
+  "struct S *(*g)(struct S const*)",
+  "void (*signal(int, void (*)(int)))(int)",
+};
+
+/**
+ * Pseudo-English to declare.
+ */
+static char const *const BENCH_ENGLISH[] = {
+  "x as int",
+  "f as pointer to function (void) returning int",
+  "a as array 4 of pointer to const char",
+  "p as pointer to pointer to function (int, double) returning void",
+};
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Runs all declarations through \a fn once.
+ *
+ * @param session The session to use.
+ * @param fn Either cdecl_explain() or cdecl_declare().
+ * @param decls The declarations.
+ * @param decls_len The number of \a decls.
+ * @param out The string buffer to use for output.
+ * @return Returns the number of calls made.
+ */
+static size_t bench_run( cdecl_session_t *session,
+                         int (*fn)( cdecl_session_t*, char const*, strbuf_t*,
+                                    strbuf_t* ),
+                         char const *const decls[], size_t decls_len,
+                         strbuf_t *out ) {
+  for ( size_t i = 0; i < decls_len; ++i ) {
+    strbuf_reset( out );
+    if ( (*fn)( session, decls[i], out, /*err=*/NULL ) != EX_OK )
+      fatal_error( EX_SOFTWARE, "\"%s\": unexpected failure\n", decls[i] );
+  } // for
+  return decls_len;
+}
+
+// LCOV_EXCL_START
+_Noreturn
+static void usage( void ) {
+  fprintf( stderr, "usage: %s [iterations]\n", me );
+  exit( EX_USAGE );
+}
+// LCOV_EXCL_STOP
+
+////////// main ///////////////////////////////////////////////////////////////
+
+/**
+ * The main entry point.
+ *
+ * @param argc The command-line argument count.
+ * @param argv The command-line argument values.
+ * @return Returns 0 on success, non-zero on failure.
+ */
+int main( int argc, char const *argv[] ) {
+  cdecl_lib_init( /*prog_name=*/NULL );
+
+  unsigned long iterations = BENCH_ITERATIONS_DEFAULT;
+  switch ( argc ) {
+    case 1:
+      break;
+    case 2:
+      iterations = strtoul( argv[1], /*endptr=*/NULL, 10 );
+      if ( iterations > 0 )
+        break;
+      FALLTHROUGH;
+    default:
+      usage();
+  } // switch
+
+  double const init_start = monotonic_now();
+  cdecl_session_t *const session = cdecl_lib_session_new();
+  double const init_elapsed = monotonic_now() - init_start;
+
+  strbuf_t out;
+  strbuf_init( &out );
+  size_t calls = 0;
+
+  double const start = monotonic_now();
+  for ( unsigned long i = 0; i < iterations; ++i ) {
+    calls += bench_run(
+      session, &cdecl_explain,
+      BENCH_GIBBERISH, ARRAY_SIZE( BENCH_GIBBERISH ), &out
+    );
+    calls += bench_run(
+      session, &cdecl_declare,
+      BENCH_ENGLISH, ARRAY_SIZE( BENCH_ENGLISH ), &out
+    );
+  } // for
+  double const elapsed = monotonic_now() - start;
+
+  printf( "session: %.3fms\n", init_elapsed * 1e3 );
+  printf( "%zu calls in %.3fs (%.0f calls/s, %.2fus/call)\n",
+    calls, elapsed,
+    elapsed > 0 ? STATIC_CAST( double, calls ) / elapsed : 0.0,
+    calls > 0 ? elapsed * 1e6 / STATIC_CAST( double, calls ) : 0.0
+  );
+
+  strbuf_cleanup( &out );
+  cdecl_session_free( session );
+  exit( EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,212 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/libcdecl_test.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "cdecl.h"
+#include "cdecl_session.h"
+#include "libcdecl.h"
+#include "strbuf.h"
+#include "util.h"
+#include "unit_test.h"
+
+// standard
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The number of threads for test_lib_threads().
+ */
+#define TEST_THREADS              8
+
+/**
+ * The number of times each thread runs #TEST_THREAD_COMMANDS.
+ */
+#define TEST_THREAD_ITERATIONS    20
+
+/**
+ * Commands run by each thread of test_lib_threads(), each in its own session,
+ * that exercise the parser, every kind of `typedef`, and options.
+ */
+static char const *const TEST_THREAD_COMMANDS[] = {
+  "explain int *const (*f)(char const*, ...)",
+  "declare x as array 4 of pointer to function returning size_t",
+  "define Int as int",
+  "explain Int (*a)[3]",
+  "explain char16_t c",
+  "typedef struct S { int i; } S",
+  "show user typedef",
+  "set c++",
+  "explain std::string const &s",
+  "define N::C as class C",
+  "explain int N::C::*p",
+  "declare f as virtual member function returning reference to N::C",
+  "show user typedef",
+  "explain intt x",
+  "set c",
+  "explain int (^b)(void)",
+  NULL
+};
+
+/**
+ * Data for each thread of test_lib_threads().
+ */
+struct test_thread {
+  strbuf_t  out;                        ///< Output of all sessions.
+  strbuf_t  err;                        ///< Errors of all sessions.
+};
+typedef struct test_thread test_thread_t;
+
+// local variables
+static unsigned     test_failures;
+
+////////// local functions ////////////////////////////////////////////////////
+
+static bool test_lib_command( void ) {
+  TEST_FN_BEGIN();
+  cdecl_session_t *const session = cdecl_lib_session_new();
+  strbuf_t out, err;
+  strbuf_init( &out );
+  strbuf_init( &err );
+
+  TEST( cdecl_explain( session, "int *p", &out, &err ) == EX_OK );
+  TEST( out.str != NULL &&
+        strcmp( out.str, "declare p as pointer to integer\n" ) == 0 );
+  TEST( err.len == 0 );
+
+  strbuf_reset( &out );
+  TEST( cdecl_declare( session, "x as int", &out, &err ) == EX_OK );
+  TEST( out.str != NULL && strcmp( out.str, "int x;\n" ) == 0 );
+
+  strbuf_cleanup( &out );
+  strbuf_cleanup( &err );
+  cdecl_session_free( session );
+  TEST_FN_END();
+}
+
+static bool test_lib_quit( void ) {
+  TEST_FN_BEGIN();
+  cdecl_session_t *const session = cdecl_lib_session_new();
+  strbuf_t out;
+  strbuf_init( &out );
+
+  // A library session must never exit the process: if it would, don't give
+  // it "quit" since this test would then exit with EX_OK.
+  TEST( !session->is_quit );
+  if ( TEST( session->is_quit_deferred ) ) {
+    TEST( cdecl_lib_command( session, "quit", &out, /*err=*/NULL ) == EX_OK );
+    TEST( session->is_quit );
+  }
+
+  strbuf_cleanup( &out );
+  cdecl_session_free( session );
+  TEST_FN_END();
+}
+
+/**
+ * Runs all #TEST_THREAD_COMMANDS #TEST_THREAD_ITERATIONS times, each time in
+ * a new session.
+ *
+ * @param data A pointer to the \ref test_thread to append output to.
+ * @return Always returns NULL.
+ */
+static void* test_thread_run( void *data ) {
+  test_thread_t *const tt = data;
+  for ( unsigned i = 0; i < TEST_THREAD_ITERATIONS; ++i ) {
+    cdecl_session_t *const session = cdecl_lib_session_new();
+    for ( char const *const *cmd = TEST_THREAD_COMMANDS; *cmd != NULL; ++cmd )
+      PJL_IGNORE_RV( cdecl_lib_command( session, *cmd, &tt->out, &tt->err ) );
+    cdecl_session_free( session );
+  } // for
+  return NULL;
+}
+
+static bool test_lib_threads( void ) {
+  TEST_FN_BEGIN();
+  //
+  // Sessions racing on shared data usually still produce the right output,
+  // so this reliably catches races only when built with -fsanitize=thread.
+  //
+
+  // Get the expected output single-threaded first.
+  test_thread_t expected;
+  strbuf_init( &expected.out );
+  strbuf_init( &expected.err );
+  PJL_IGNORE_RV( test_thread_run( &expected ) );
+  TEST( expected.out.len > 0 );
+  TEST( expected.err.len > 0 );         // from "explain intt x"
+
+  test_thread_t tts[ TEST_THREADS ];
+  pthread_t threads[ TEST_THREADS ];
+  for ( unsigned i = 0; i < TEST_THREADS; ++i ) {
+    strbuf_init( &tts[i].out );
+    strbuf_init( &tts[i].err );
+    if ( !TEST( pthread_create( &threads[i], NULL, &test_thread_run,
+                                &tts[i] ) == 0 ) ) {
+      exit( EX_OSERR );                 // LCOV_EXCL_LINE
+    }
+  } // for
+
+  for ( unsigned i = 0; i < TEST_THREADS; ++i ) {
+    TEST( pthread_join( threads[i], NULL ) == 0 );
+    TEST( tts[i].out.len == expected.out.len &&
+          strcmp( tts[i].out.str, expected.out.str ) == 0 );
+    TEST( tts[i].err.len == expected.err.len &&
+          strcmp( tts[i].err.str, expected.err.str ) == 0 );
+    strbuf_cleanup( &tts[i].out );
+    strbuf_cleanup( &tts[i].err );
+  } // for
+
+  strbuf_cleanup( &expected.out );
+  strbuf_cleanup( &expected.err );
+  TEST_FN_END();
+}
+
+// LCOV_EXCL_START
+_Noreturn
+static void usage( void ) {
+  EPRINTF( "usage: %s\n", me );
+  exit( EX_USAGE );
+}
+// LCOV_EXCL_STOP
+
+////////// main ///////////////////////////////////////////////////////////////
+
+int main( int argc, char const *argv[const] ) {
+  cdecl_lib_init( base_name( argv[0] ) );
+  if ( --argc != 0 )
+    usage();                            // LCOV_EXCL_LINE
+
+  test_lib_command();
+  test_lib_quit();
+  test_lib_threads();
+
+  printf( "%u failures\n", test_failures );
+  exit( test_failures > 0 ? EX_SOFTWARE : EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
@@ -92,6 +92,7 @@ char const L_returning[]                = "returning";
 char const L_rvalue[]                   = "rvalue";
 char const L_set[]                      = "set";
 char const L_show[]                     = "show";
+char const L_stats[]                    = "stats";
 char const L_to[]                       = "to";
 char const L_user[]                     = "user";
 char const L_vector[]                   = "vector";
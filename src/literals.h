@@ -119,6 +119,7 @@ extern char const L_returning[];
 extern char const L_rvalue[];
 extern char const L_set[];
 extern char const L_show[];
+extern char const L_stats[];
 extern char const L_to[];
 extern char const L_user[];
 extern char const L_vector[];             // synonym for "array"
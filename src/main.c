@@ -0,0 +1,97 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/main.c
+**
+**      Copyright (C) 2017-2023  Paul J. Lucas, et al.
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines main() for the **cdecl** program.  Everything else is in
+ * **libcdecl**.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "cdecl.h"
+#include "c_typedef_gen.h"
+#include "cdecl_session.h"
+#include "cli_options.h"
+#include "color.h"
+#include "conf_file.h"
+#include "jsonl.h"
+#include "options.h"
+#include "parse.h"
+#include "server.h"
+#include "symtab_gen.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stddef.h>                     /* for size_t */
+#include <stdlib.h>
+#include <string.h>
+
+/// @endcond
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The main entry point.
+ *
+ * @param argc The command-line argument count.
+ * @param argv The command-line argument values.
+ * @return Returns 0 on success, non-zero on failure.
+ */
+int main( int argc, char const *argv[] ) {
+  me = base_name( argv[0] );
+  cdecl_init();
+  cli_option_init( &argc, &argv );
+  if ( opt_client_path != NULL )
+    exit( cdecl_client( STATIC_CAST( size_t, argc ), argv ) );
+  color_init();
+#ifdef CDECL_PREDEF_GEN
+  if ( argc == 1 && strcmp( argv[0], "symtab" ) == 0 )
+    exit( symtab_gen_emit( stdout ) );
+  opt_typedefs = true;                  // generate all predefined types
+#endif /* CDECL_PREDEF_GEN */
+  //
+  // Everything above must come before cdecl_session_new() since loading the
+  // predefined types actually uses the parser.
+  //
+  PJL_IGNORE_RV( cdecl_session_set( cdecl_session_new() ) );
+#ifdef CDECL_PREDEF_GEN
+  exit( c_typedef_gen_emit( stdout ) );
+#endif /* CDECL_PREDEF_GEN */
+
+  if ( opt_read_conf )
+    conf_init();
+  cdecl_session->is_initialized = true;
+  if ( opt_serve_path != NULL )
+    exit( cdecl_serve() );
+  if ( opt_jsonl )
+    exit( cdecl_jsonl() );
+  //
+  // Note that cli_option_init() adjusts argv such that argv[0] becomes the
+  // first argument, if any, and no longer the program name.
+  //
+  exit( cdecl_parse_cli( STATIC_CAST( size_t, argc ), argv ) );
+}
+
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
@@ -45,53 +45,26 @@
 
 ///////////////////////////////////////////////////////////////////////////////
 
-/// @cond DOXYGEN_IGNORE
-/// Otherwise Doxygen generates two entries for each option.
-
-// extern option variables
-bool                opt_alt_tokens;
-#ifdef ENABLE_CDECL_DEBUG
-cdecl_debug_t       opt_cdecl_debug;
-#endif /* ENABLE_CDECL_DEBUG */
-color_when_t        opt_color_when = COLOR_NOT_FILE;
-char const         *opt_conf_path;
-bool                opt_east_const;
-bool                opt_echo_commands;
-bool                opt_english_types = true;
-bool                opt_explain;
-c_tid_t             opt_explicit_ecsu_btids = TB_struct | TB_union;
-c_graph_t           opt_graph;
-c_lang_id_t         opt_lang;
-bool                opt_prompt = true;
-bool                opt_read_conf = true;
-bool                opt_semicolon = true;
-bool                opt_trailing_ret;
-bool                opt_typedefs = true;
-bool                opt_using = true;
-c_ast_kind_t        opt_west_pointer_kinds = K_ANY_FUNCTION_RETURN;
-
-/// @endcond
+_Thread_local cdecl_options_t cdecl_opts = {
+  .color_when = COLOR_NOT_FILE,
+  .english_types = true,
+  .explicit_ecsu_btids = TB_struct | TB_union,
+  .explicit_int_btids = { TB_NONE, TB_NONE },
+  .jobs = 1,
+  .prompt = true,
+  .read_conf = true,
+  .semicolon = true,
+  .typedefs = true,
+  .using = true,
+  .west_pointer_kinds = K_ANY_FUNCTION_RETURN
+};
 
 /**
- * The integer type(s) that `int` shall be printed explicitly for in C/C++
- * declarations even when not needed because the type(s) contain at least one
- * integer modifier, e.g., `unsigned`.
- *
- * The elements are:
- *
- *  Idx | Contains type(s) for
- *  ----|---------------------
- *  `0` | signed integers
- *  `1` | unsigned integers
+ * Shorthand for the explicit `int` option.
  *
- * @remarks Due to non-trivial representation and special cases, this option's
- * variable is `static` and accessible only via `*_explicit_int()` functions.
- *
- * @sa any_explicit_int()
- * @sa is_explicit_int()
- * @sa parse_explicit_int()
+ * @sa cdecl_options::explicit_int_btids
  */
-static c_tid_t      opt_explicit_int_btids[] = { TB_NONE, TB_NONE };
+#define opt_explicit_int_btids    (cdecl_opts.explicit_int_btids)
 
 ////////// local functions ////////////////////////////////////////////////////
 
@@ -127,9 +100,11 @@ bool any_explicit_int( void ) {
 
 #ifdef ENABLE_CDECL_DEBUG
 char const* cdecl_debug_str( void ) {
-  static char buf[2];
+  static _Thread_local char buf[3];
   char *s = buf;
 
+  if ( (opt_cdecl_debug & CDECL_DEBUG_OPT_AST_MEMORY) != 0 )
+    *s++ = 'm';
   if ( (opt_cdecl_debug & CDECL_DEBUG_OPT_AST_UNIQUE_ID) != 0 )
     *s++ = 'u';
   *s = '\0';
@@ -138,8 +113,48 @@ char const* cdecl_debug_str( void ) {
 }
 #endif /* ENABLE_CDECL_DEBUG */
 
+bool cdecl_options_equal( cdecl_options_t const *i_opts,
+                          cdecl_options_t const *j_opts ) {
+  assert( i_opts != NULL );
+  assert( j_opts != NULL );
+
+  // Compared member-wise since memcmp() would also compare padding.
+  return  i_opts->alt_tokens == j_opts->alt_tokens &&
+          i_opts->batch == j_opts->batch &&
+          i_opts->cache_size == j_opts->cache_size &&
+          i_opts->client_path == j_opts->client_path &&
+#ifdef ENABLE_CDECL_DEBUG
+          i_opts->cdecl_debug == j_opts->cdecl_debug &&
+#endif /* ENABLE_CDECL_DEBUG */
+          i_opts->color_when == j_opts->color_when &&
+          i_opts->conf_path == j_opts->conf_path &&
+          i_opts->east_const == j_opts->east_const &&
+          i_opts->echo_commands == j_opts->echo_commands &&
+          i_opts->english_types == j_opts->english_types &&
+          i_opts->explain == j_opts->explain &&
+          i_opts->explicit_ecsu_btids == j_opts->explicit_ecsu_btids &&
+          i_opts->explicit_int_btids[0] == j_opts->explicit_int_btids[0] &&
+          i_opts->explicit_int_btids[1] == j_opts->explicit_int_btids[1] &&
+#ifdef ENABLE_FLEX_DEBUG
+          i_opts->flex_debug == j_opts->flex_debug &&
+#endif /* ENABLE_FLEX_DEBUG */
+          i_opts->graph == j_opts->graph &&
+          i_opts->jobs == j_opts->jobs &&
+          i_opts->jsonl == j_opts->jsonl &&
+          i_opts->lang == j_opts->lang &&
+          i_opts->prompt == j_opts->prompt &&
+          i_opts->read_conf == j_opts->read_conf &&
+          i_opts->semicolon == j_opts->semicolon &&
+          i_opts->serve_path == j_opts->serve_path &&
+          i_opts->trailing_ret == j_opts->trailing_ret &&
+          i_opts->typedefs == j_opts->typedefs &&
+          i_opts->using == j_opts->using &&
+          i_opts->west_pointer_kinds == j_opts->west_pointer_kinds &&
+          i_opts->zygote == j_opts->zygote;
+}
+
 char const* explicit_ecsu_str( void ) {
-  static char buf[5];
+  static _Thread_local char buf[5];
   char *s = buf;
 
   if ( (opt_explicit_ecsu_btids & TB_enum) != TB_NONE )
@@ -166,7 +181,7 @@ char const* explicit_int_str( void ) {
   bool const is_explicit_ul  = is_explicit_int( TB_unsigned | TB_long );
   bool const is_explicit_ull = is_explicit_int( TB_unsigned | TB_long_long );
 
-  static strbuf_t sbuf;
+  static _Thread_local strbuf_t sbuf;
   strbuf_reset( &sbuf );
 
   if ( is_explicit_s & is_explicit_i && is_explicit_l && is_explicit_ll ) {
@@ -221,11 +236,14 @@ bool parse_cdecl_debug( char const *debug_format ) {
     return true;
   }
 
-  set_all_or_none( &debug_format, "u" );
+  set_all_or_none( &debug_format, "mu" );
   cdecl_debug_t cdecl_debug = CDECL_DEBUG_YES;
 
   for ( char const *s = debug_format; *s != '\0'; ++s ) {
     switch ( tolower( *s ) ) {
+      case 'm':
+        cdecl_debug |= CDECL_DEBUG_OPT_AST_MEMORY;
+        break;
       case 'u':
         cdecl_debug |= CDECL_DEBUG_OPT_AST_UNIQUE_ID;
         break;
@@ -351,7 +369,7 @@ bool parse_west_pointer( char const *wp_format ) {
 }
 
 char const* west_pointer_str( void ) {
-  static char buf[6];
+  static _Thread_local char buf[6];
   char *s = buf;
 
   if ( (opt_west_pointer_kinds & K_APPLE_BLOCK) != 0 )
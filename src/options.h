@@ -68,60 +68,135 @@ enum cdecl_debug {
    *
    * @note May be used _only_ in combination with #CDECL_DEBUG_YES.
    */
-  CDECL_DEBUG_OPT_AST_UNIQUE_ID = (1u << 1)
+  CDECL_DEBUG_OPT_AST_UNIQUE_ID = (1u << 1),
+
+  /**
+   * Print AST memory usage after each command and each defined type.
+   *
+   * @note May be used _only_ in combination with #CDECL_DEBUG_YES.
+   */
+  CDECL_DEBUG_OPT_AST_MEMORY    = (1u << 2)
 };
 typedef enum cdecl_debug cdecl_debug_t;
 #endif /* ENABLE_CDECL_DEBUG */
 
-// extern option variables
-extern bool         opt_alt_tokens;     ///< Print alternative tokens?
+/**
+ * All of **cdecl**'s options.
+ *
+ * @remarks Each thread has its own options in \ref cdecl_opts that all
+ * `opt_*` macros refer to.  A \ref cdecl_session has its own options that
+ * are swapped in and out of \ref cdecl_opts by cdecl_session_set().
+ */
+struct cdecl_options {
+  bool          alt_tokens;             ///< Print alternative tokens?
+  bool          batch;                  ///< Read input in batch mode?
+  size_t        cache_size;             ///< Result cache entries or 0.
+  char const   *client_path;            ///< Socket path of server to use.
+#ifdef ENABLE_CDECL_DEBUG
+  cdecl_debug_t cdecl_debug;            ///< Print JSON5 debug output?
+#endif /* ENABLE_CDECL_DEBUG */
+  color_when_t  color_when;             ///< When to print color.
+  char const   *conf_path;              ///< Configuration file path.
+  bool          east_const;             ///< Print in "east const" form?
+  bool          echo_commands;          ///< Echo commands?
+  bool          english_types;          ///< Print types in English, not C/C++.
+  bool          explain;                ///< Assume `explain` if no command?
+
+  /// Explicit `enum` | `class` | `struct` | `union`?
+  c_tid_t       explicit_ecsu_btids;
+
+  /**
+   * The integer type(s) that `int` shall be printed explicitly for in C/C++
+   * declarations even when not needed because the type(s) contain at least
+   * one integer modifier, e.g., `unsigned`.
+   *
+   * The elements are:
+   *
+   *  Idx | Contains type(s) for
+   *  ----|---------------------
+   *  `0` | signed integers
+   *  `1` | unsigned integers
+   *
+   * @remarks Due to non-trivial representation and special cases, this
+   * option is accessible only via `*_explicit_int()` functions.
+   *
+   * @sa any_explicit_int()
+   * @sa is_explicit_int()
+   * @sa parse_explicit_int()
+   */
+  c_tid_t       explicit_int_btids[2];
+
+#ifdef ENABLE_FLEX_DEBUG
+  bool          flex_debug;             ///< Print Flex debug output?
+#endif /* ENABLE_FLEX_DEBUG */
+  c_graph_t     graph;                  ///< Di/Trigraph mode.
+  unsigned      jobs;                   ///< Batch mode worker processes.
+  bool          jsonl;                  ///< Read/write JSON lines?
+  c_lang_id_t   lang;                   ///< Current language.
+  bool          prompt;                 ///< Print the prompt?
+  bool          read_conf;              ///< Read configuration file?
+  bool          semicolon;              ///< Print `;` at end of gibberish?
+  char const   *serve_path;             ///< Socket path to serve on.
+  bool          trailing_ret;           ///< Print trailing return type?
+  bool          typedefs;               ///< Load C/C++ standard `typedef`s?
+  bool          using;                  ///< Print `using` in C++11 and later?
+
+  /// Kinds to print `*` and `&` "west" of the space.
+  c_ast_kind_t  west_pointer_kinds;
+
+  bool          zygote;                 ///< Fork a child per serve client?
+};
+
+/**
+ * The options of the calling thread.
+ *
+ * @remarks Every thread starts with the default options.
+ */
+extern _Thread_local cdecl_options_t cdecl_opts;
+
+// Each option "variable" is a member of cdecl_opts.
+#define opt_alt_tokens            (cdecl_opts.alt_tokens)
+#define opt_batch                 (cdecl_opts.batch)
+#define opt_cache_size            (cdecl_opts.cache_size)
 
 #ifdef ENABLE_BISON_DEBUG
 /// Print Bison debug output?
 ///
 /// @note This is an alias for \ref yydebug defined for consistency with the
-/// naming of **cdecl**'s other options.
-#define             opt_bison_debug     yydebug
+/// naming of **cdecl**'s other options.  Unlike the other options, it's
+/// shared by all threads.
+#define opt_bison_debug           yydebug
 #endif /* ENABLE_BISON_DEBUG */
 
 #ifdef ENABLE_CDECL_DEBUG
-extern cdecl_debug_t opt_cdecl_debug;   ///< Print JSON5 debug output?
+#define opt_cdecl_debug           (cdecl_opts.cdecl_debug)
 #endif /* ENABLE_CDECL_DEBUG */
-
-extern color_when_t opt_color_when;     ///< When to print color.
-extern char const  *opt_conf_path;      ///< Configuration file path.
-extern bool         opt_east_const;     ///< Print in "east const" form?
-extern bool         opt_echo_commands;  ///< Echo commands?
-extern bool         opt_english_types;  ///< Print types in English, not C/C++.
-extern bool         opt_explain;        ///< Assume `explain` if no command?
-
-/// Explicit `enum` | `class` | `struct` | `union`?
-extern c_tid_t      opt_explicit_ecsu_btids;
-
+#define opt_client_path           (cdecl_opts.client_path)
+#define opt_color_when            (cdecl_opts.color_when)
+#define opt_conf_path             (cdecl_opts.conf_path)
+#define opt_east_const            (cdecl_opts.east_const)
+#define opt_echo_commands         (cdecl_opts.echo_commands)
+#define opt_english_types         (cdecl_opts.english_types)
+#define opt_explain               (cdecl_opts.explain)
+#define opt_explicit_ecsu_btids   (cdecl_opts.explicit_ecsu_btids)
 #ifdef ENABLE_FLEX_DEBUG
-/// Print Flex debug output?
-///
-/// @note This is an alias for \ref yy_flex_debug defined for consistency with
-/// the naming of **cdecl**'s other options.
-#define             opt_flex_debug      yy_flex_debug
+#define opt_flex_debug            (cdecl_opts.flex_debug)
 #endif /* ENABLE_FLEX_DEBUG */
-
-extern c_graph_t    opt_graph;          ///< Di/Trigraph mode.
-extern c_lang_id_t  opt_lang;           ///< Current language.
-extern bool         opt_prompt;         ///< Print the prompt?
-extern bool         opt_read_conf;      ///< Read configuration file?
-extern bool         opt_semicolon;      ///< Print `;` at end of gibberish?
-extern bool         opt_trailing_ret;   ///< Print trailing return type?
-extern bool         opt_typedefs;       ///< Load C/C++ standard `typedef`s?
-extern bool         opt_using;          ///< Print `using` in C++11 and later?
-
-/// Kinds to print `*` and `&` "west" of the space.
-extern c_ast_kind_t opt_west_pointer_kinds;
+#define opt_graph                 (cdecl_opts.graph)
+#define opt_jobs                  (cdecl_opts.jobs)
+#define opt_jsonl                 (cdecl_opts.jsonl)
+#define opt_lang                  (cdecl_opts.lang)
+#define opt_prompt                (cdecl_opts.prompt)
+#define opt_read_conf             (cdecl_opts.read_conf)
+#define opt_semicolon             (cdecl_opts.semicolon)
+#define opt_serve_path            (cdecl_opts.serve_path)
+#define opt_trailing_ret          (cdecl_opts.trailing_ret)
+#define opt_typedefs              (cdecl_opts.typedefs)
+#define opt_using                 (cdecl_opts.using)
+#define opt_west_pointer_kinds    (cdecl_opts.west_pointer_kinds)
+#define opt_zygote                (cdecl_opts.zygote)
 
 // other extern variables
-#ifdef ENABLE_FLEX_DEBUG
-extern int          yy_flex_debug;      ///< Flex variable for debugging.
-#endif /* ENABLE_FLEX_DEBUG */
 #ifdef ENABLE_BISON_DEBUG
 extern int          yydebug;            ///< Bison variable for debugging.
 #endif /* ENABLE_BISON_DEBUG */
@@ -156,6 +231,18 @@ NODISCARD
 char const* cdecl_debug_str( void );
 #endif /* ENABLE_CDECL_DEBUG */
 
+/**
+ * Checks whether two \ref cdecl_options are equal.
+ *
+ * @param i_opts The first \ref cdecl_options.
+ * @param j_opts The second \ref cdecl_options.
+ * @return Returns `true` only if every option of \a i_opts equals that of \a
+ * j_opts.
+ */
+NODISCARD
+bool cdecl_options_equal( cdecl_options_t const *i_opts,
+                          cdecl_options_t const *j_opts );
+
 /**
  * Gets the string representation of the explicit `enum`, `class`, `struct`,
  * `union` option.
@@ -27,15 +27,18 @@
 #include "pjl_config.h"                 /* must go first */
 #include "parse.h"
 #include "cdecl.h"
+#include "cdecl_cache.h"
 #include "cdecl_command.h"
 #include "cdecl_parser.h"
+#include "cdecl_session.h"
 #include "cli_options.h"
 #include "help.h"
-#include "lexer.h"
+#include "literals.h"
 #include "options.h"
 #include "print.h"
 #include "prompt.h"
 #include "read_line.h"
+#include "sink.h"
 #include "strbuf.h"
 #include "util.h"
 
@@ -47,8 +50,9 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/wait.h>                   /* for waitpid(2) */
 #include <sysexits.h>
-#include <unistd.h>                     /* for isatty(3) */
+#include <unistd.h>                     /* for fork(2), isatty(3), lseek(2) */
 
 /// @endcond
 
@@ -57,9 +61,71 @@
  * @{
  */
 
+/**
+ * Initial size of the block of input read at once in batch mode.
+ *
+ * @sa cdecl_parse_batch()
+ */
+#define BATCH_BLOCK_SIZE          (256u * 1024u)
+
+/**
+ * Maximum number of commands given to each worker process per batch of
+ * commands when \ref opt_jobs &gt; 1.
+ *
+ * @sa batch_queue_push()
+ */
+#define BATCH_WORKER_COMMANDS_MAX 16384u
+
+/**
+ * Minimum number of commands given to each worker process: fewer aren't worth
+ * the cost of forking a process and so are parsed by the parent instead.
+ *
+ * @sa batch_queue_flush()
+ */
+#define BATCH_WORKER_COMMANDS_MIN 64u
+
+/**
+ * Commands queued in batch mode to be parsed in parallel by \ref opt_jobs
+ * worker processes.
+ *
+ * @sa batch_queue_flush()
+ */
+struct batch_queue {
+  strbuf_t  cmds_buf;                   ///< Queued commands, each `\0`-ended.
+  size_t   *cmd_offs;                   ///< Offset of each command.
+  size_t    cmd_len;                    ///< Number of queued commands.
+  size_t    cmd_cap;                    ///< Capacity of \ref cmd_offs.
+  int       status;                     ///< Status of the last command.
+};
+typedef struct batch_queue batch_queue_t;
+
+/**
+ * A worker process parsing a contiguous range of \ref batch_queue commands.
+ */
+struct batch_worker {
+  pid_t     pid;                        ///< Process ID.
+  FILE     *fout;                       ///< Captured standard output.
+  FILE     *ferr;                       ///< Captured standard error.
+  FILE     *fends;                      ///< Output ends of each command.
+};
+typedef struct batch_worker batch_worker_t;
+
+/**
+ * The offsets in \ref batch_worker::fout "fout" and \ref batch_worker::ferr
+ * "ferr" at which the output of a command ends so the output of the commands
+ * can be copied in order with each command's standard output and standard
+ * error interleaved.
+ */
+struct batch_cmd_ends {
+  off_t     out;                        ///< End offset in standard output.
+  off_t     err;                        ///< End offset in standard error.
+};
+typedef struct batch_cmd_ends batch_cmd_ends_t;
+
 // local functions
 NODISCARD
-static int cdecl_parse_stdin( void );
+static int cdecl_parse_batch( FILE* ),
+           cdecl_parse_stdin( void );
 
 ////////// local functions ////////////////////////////////////////////////////
 
@@ -75,11 +141,397 @@ static inline bool is_cdecl( void ) {
   return strcmp( me, CDECL ) == 0;
 }
 
+/**
+ * Copies the next \a n bytes of \a from to \a to.
+ *
+ * @param from The `FILE` to copy from.
+ * @param n The number of bytes to copy or `SIZE_MAX` to copy until EOF.
+ * @param to The \ref sink to copy to.
+ */
+static void batch_fcopy( FILE *from, size_t n, sink_t *to ) {
+  assert( from != NULL );
+  assert( to != NULL );
+
+  char buf[ 64 * 1024 ];
+
+  while ( n > 0 ) {
+    size_t const bytes_read =
+      fread( buf, 1, n < sizeof buf ? n : sizeof buf, from );
+    if ( bytes_read == 0 )
+      break;
+    sink_putsn( to, buf, bytes_read );
+    n -= bytes_read;
+  } // while
+  FERROR( from );
+}
+
+/**
+ * Copies the output of \a worker to standard output and standard error one
+ * command at a time, i.e., each command's standard output followed by its
+ * standard error, so they're interleaved the same as if the commands had been
+ * parsed serially.
+ *
+ * @param worker The \ref batch_worker whose output to copy.  It must have
+ * exited.
+ */
+static void batch_worker_copy( batch_worker_t *worker ) {
+  assert( worker != NULL );
+
+  rewind( worker->fout );
+  rewind( worker->ferr );
+  rewind( worker->fends );
+
+  batch_cmd_ends_t prev = { 0, 0 }, ends;
+  while ( fread( &ends, sizeof ends, 1, worker->fends ) == 1 ) {
+    batch_fcopy(
+      worker->fout, STATIC_CAST( size_t, ends.out - prev.out ), cdecl_fout
+    );
+    if ( ends.err > prev.err ) {
+      sink_flush( cdecl_fout );
+      batch_fcopy(
+        worker->ferr, STATIC_CAST( size_t, ends.err - prev.err ), cdecl_ferr
+      );
+      sink_flush( cdecl_ferr );
+    }
+    prev = ends;
+  } // while
+  FERROR( worker->fends );
+
+  // Copy whatever follows, e.g., a fatal error that ended the worker early.
+  batch_fcopy( worker->fout, SIZE_MAX, cdecl_fout );
+  sink_flush( cdecl_fout );
+  batch_fcopy( worker->ferr, SIZE_MAX, cdecl_ferr );
+}
+
+/**
+ * Checks whether \a s is a command that may change **cdecl**'s state, e.g.,
+ * define a type or set an option, and therefore must be parsed in order with
+ * respect to all other commands.
+ *
+ * @param s The null-terminated command to check.
+ * @return Returns `true` only if \a s is such a command.  Lines containing
+ * more than one command are conservatively always such commands.
+ */
+NODISCARD
+static bool batch_is_barrier( char const *s ) {
+  assert( s != NULL );
+
+  char const *const semi = strchr( s, ';' );
+  if ( semi != NULL && !str_is_empty( semi + 1 ) )
+    return true;
+
+  cdecl_command_t const *const command = cdecl_command_find( s );
+  if ( command == NULL )                // implicit explain or an error
+    return false;
+
+  // command->literal is set to L_* so == is OK
+  return  command->literal != L_cast &&
+          command->literal != L_const /*cast*/ &&
+          command->literal != L_declare &&
+          command->literal != L_dynamic /*cast*/ &&
+          command->literal != L_explain &&
+          command->literal != L_help &&
+          command->literal != L_reinterpret /*cast*/ &&
+          command->literal != L_show &&
+          command->literal != L_static /*cast*/;
+}
+
+/**
+ * Cleans up \a queue.
+ *
+ * @param queue The \ref batch_queue to clean up.
+ */
+static void batch_queue_cleanup( batch_queue_t *queue ) {
+  assert( queue != NULL );
+  strbuf_cleanup( &queue->cmds_buf );
+  FREE( queue->cmd_offs );
+}
+
+/**
+ * Parses the command having index \a i in \a queue.
+ *
+ * @param queue The \ref batch_queue to use.
+ * @param i The index of the command to parse.
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ */
+NODISCARD
+static int batch_queue_parse( batch_queue_t const *queue, size_t i ) {
+  assert( queue != NULL );
+  assert( i < queue->cmd_len );
+
+  size_t const cmd_off = queue->cmd_offs[i];
+  size_t const next_off = i + 1 < queue->cmd_len ?
+    queue->cmd_offs[ i + 1 ] : queue->cmds_buf.len;
+  return cdecl_parse_string(
+    queue->cmds_buf.str + cmd_off, next_off - cmd_off - 1/*\0*/
+  );
+}
+
+/**
+ * Parses all commands in \a queue by forking up to \ref opt_jobs worker
+ * processes each of which parses a contiguous range of the commands, then
+ * copies the output of each worker to standard output and standard error in
+ * order.
+ *
+ * @remarks Since each worker is forked, it starts with the state of the parent
+ * (all types defined and options set so far) without having to re-parse
+ * anything.  Commands that would change that state are never queued.
+ * @par
+ * Each worker is given at least #BATCH_WORKER_COMMANDS_MIN commands; if there
+ * aren't enough commands for at least two workers, the commands are instead
+ * parsed by the parent without forking.
+ *
+ * @param queue The \ref batch_queue to flush.  Upon return, it's empty.
+ *
+ * @sa batch_is_barrier()
+ */
+static void batch_queue_flush( batch_queue_t *queue ) {
+  assert( queue != NULL );
+  if ( queue->cmd_len == 0 )
+    return;
+
+  size_t n_workers = queue->cmd_len / BATCH_WORKER_COMMANDS_MIN;
+  if ( n_workers > opt_jobs )
+    n_workers = opt_jobs;
+
+  if ( n_workers < 2 ) {
+    for ( size_t i = 0; i < queue->cmd_len; ++i )
+      queue->status = batch_queue_parse( queue, i );
+    goto done;
+  }
+
+  size_t const cmds_per_worker =
+    (queue->cmd_len + n_workers - 1) / n_workers;
+  batch_worker_t *const workers = MALLOC( batch_worker_t, n_workers );
+
+  // Otherwise, each worker would inherit and re-print pending output.
+  sink_flush( cdecl_fout );
+  sink_flush( cdecl_ferr );
+
+  for ( size_t i = 0; i < n_workers; ++i ) {
+    batch_worker_t *const worker = &workers[i];
+    worker->fout = tmpfile();
+    PERROR_EXIT_IF( worker->fout == NULL, EX_CANTCREAT );
+    worker->ferr = tmpfile();
+    PERROR_EXIT_IF( worker->ferr == NULL, EX_CANTCREAT );
+    worker->fends = tmpfile();
+    PERROR_EXIT_IF( worker->fends == NULL, EX_CANTCREAT );
+
+    worker->pid = fork();
+    PERROR_EXIT_IF( worker->pid == -1, EX_OSERR );
+    if ( worker->pid != 0 )
+      continue;
+
+    //
+    // Worker process: parse our range of commands with stdout and stderr
+    // redirected to our own files, noting where each command's output ends.
+    //
+    DUP2( fileno( worker->fout ), STDOUT_FILENO );
+    DUP2( fileno( worker->ferr ), STDERR_FILENO );
+    size_t const first = i * cmds_per_worker;
+    size_t const end = first + cmds_per_worker < queue->cmd_len ?
+      first + cmds_per_worker : queue->cmd_len;
+    int status = EX_OK;
+    for ( size_t j = first; j < end; ++j ) {
+      status = batch_queue_parse( queue, j );
+      sink_flush( cdecl_fout );
+      sink_flush( cdecl_ferr );
+      batch_cmd_ends_t const ends = {
+        lseek( STDOUT_FILENO, 0, SEEK_CUR ),
+        lseek( STDERR_FILENO, 0, SEEK_CUR )
+      };
+      PERROR_EXIT_IF( ends.out == -1 || ends.err == -1, EX_IOERR );
+      PERROR_EXIT_IF(
+        fwrite( &ends, sizeof ends, 1, worker->fends ) != 1, EX_IOERR
+      );
+    } // for
+    FFLUSH( worker->fends );
+    _exit( status );                    // don't run the parent's atexit()s
+  } // for
+
+  for ( size_t i = 0; i < n_workers; ++i ) {
+    batch_worker_t *const worker = &workers[i];
+    int wstatus;
+    PERROR_EXIT_IF( waitpid( worker->pid, &wstatus, 0 ) == -1, EX_OSERR );
+    batch_worker_copy( worker );
+    PJL_IGNORE_RV( fclose( worker->fout ) );
+    PJL_IGNORE_RV( fclose( worker->ferr ) );
+    PJL_IGNORE_RV( fclose( worker->fends ) );
+    if ( !WIFEXITED( wstatus ) ) {
+      fatal_error( EX_SOFTWARE,
+        "batch worker %zu terminated abnormally\n", i + 1
+      );
+    }
+    queue->status = WEXITSTATUS( wstatus );
+  } // for
+
+  free( workers );
+
+done:
+  strbuf_reset( &queue->cmds_buf );
+  queue->cmd_len = 0;
+}
+
+/**
+ * Parses a **cdecl** command in batch mode: either immediately if \ref
+ * opt_jobs is 1 or \a s is a barrier command, or later by a worker process.
+ *
+ * @param queue The \ref batch_queue to use.
+ * @param s The null-terminated command to parse.
+ * @param s_len The length of \a s.
+ *
+ * @sa batch_is_barrier()
+ * @sa batch_queue_flush()
+ */
+static void batch_queue_push( batch_queue_t *queue, char const *s,
+                              size_t s_len ) {
+  assert( queue != NULL );
+  assert( s != NULL );
+
+  if ( opt_jobs <= 1 || batch_is_barrier( s ) ) {
+    //
+    // Every command queued before a barrier must be parsed before it and
+    // every command after it must be parsed by workers that have been forked
+    // after it so it's "replayed" to them by virtue of fork(2).
+    //
+    batch_queue_flush( queue );
+    queue->status = cdecl_parse_string( s, s_len );
+    return;
+  }
+
+  if ( queue->cmd_len == queue->cmd_cap ) {
+    queue->cmd_cap = queue->cmd_cap == 0 ? 1024 : queue->cmd_cap * 2;
+    REALLOC( queue->cmd_offs, size_t, queue->cmd_cap );
+  }
+  queue->cmd_offs[ queue->cmd_len++ ] = queue->cmds_buf.len;
+  strbuf_putsn( &queue->cmds_buf, s, s_len );
+  strbuf_putc( &queue->cmds_buf, '\0' );
+
+  if ( queue->cmd_len >= opt_jobs * BATCH_WORKER_COMMANDS_MAX )
+    batch_queue_flush( queue );
+}
+
+/**
+ * Parses **cdecl** commands from \a fin in batch mode until EOF.
+ *
+ * @remarks Unlike cdecl_parse_file_impl(), this reads \a fin in large blocks
+ * rather than a line at a time, never uses **readline**(3) nor prints prompts,
+ * and parses each line in place (without copying it) unless it's continued.
+ * Lines are otherwise handled the same way as by strbuf_read_line(): blank
+ * lines are ignored and a line ending in `\` is continued by the next line up
+ * to a blank line.
+ * @par
+ * If \ref opt_jobs &gt; 1, commands are parsed in parallel by worker processes
+ * via batch_queue_push().
+ * @par
+ * Upon EOF, prints the number of lines and lines per second to standard error.
+ *
+ * @param fin The `FILE` to read from.
+ * @return Returns `EX_OK` upon success of the last command or another value
+ * upon failure.
+ *
+ * @sa #BATCH_BLOCK_SIZE
+ */
+NODISCARD
+static int cdecl_parse_batch( FILE *fin ) {
+  assert( fin != NULL );
+
+  cdecl_interactive = false;
+  double const start_time = monotonic_now();
+
+  size_t  buf_cap = BATCH_BLOCK_SIZE;
+  char   *buf = MALLOC( char, buf_cap + 1/*\0*/ );
+  size_t  buf_len = 0;                  // number of bytes in buf
+  size_t  buf_pos = 0;                  // start of current line in buf
+  bool    is_eof = false;
+  size_t  line_count = 0;
+  strbuf_t cont_sbuf;                   // for continued lines
+  strbuf_init( &cont_sbuf );
+  batch_queue_t queue = { .status = EX_OK };
+  strbuf_init( &queue.cmds_buf );
+
+  for (;;) {
+    char *const line = buf + buf_pos;
+    char *nl = memchr( line, '\n', buf_len - buf_pos );
+
+    if ( nl == NULL ) {
+      if ( is_eof ) {
+        if ( buf_pos == buf_len )
+          break;
+        nl = buf + buf_len;             // last line has no newline
+      }
+      else {
+        //
+        // Move the partial line (if any) to the front of buf, grow buf if the
+        // partial line fills it, then read the next block after it.
+        //
+        buf_len -= buf_pos;
+        memmove( buf, line, buf_len );
+        buf_pos = 0;
+        if ( buf_len == buf_cap ) {
+          buf_cap *= 2;
+          REALLOC( buf, char, buf_cap + 1/*\0*/ );
+        }
+        size_t const bytes_read = fread( buf + buf_len, 1, buf_cap - buf_len,
+                                         fin );
+        if ( bytes_read == 0 ) {
+          FERROR( fin );
+          is_eof = true;
+        }
+        buf_len += bytes_read;
+        continue;
+      }
+    }
+
+    *nl = '\0';
+    size_t line_len = STATIC_CAST( size_t, nl - line );
+    buf_pos += line_len + 1;
+    if ( buf_pos > buf_len )
+      buf_pos = buf_len;
+    ++line_count;
+
+    if ( str_is_empty( line ) ) {
+      if ( cont_sbuf.len == 0 )
+        continue;                       // ignore blank lines
+      // A blank line ends continued lines: fall through to parse them.
+    }
+    else {
+      bool const is_cont_line = line[ line_len - 1 ] == '\\';
+      if ( is_cont_line ) {
+        strbuf_putsn( &cont_sbuf, line, line_len - 1/*\\*/ );
+        continue;
+      }
+      if ( cont_sbuf.len == 0 ) {
+        batch_queue_push( &queue, line, line_len );
+        continue;
+      }
+      strbuf_putsn( &cont_sbuf, line, line_len );
+    }
+
+    batch_queue_push( &queue, cont_sbuf.str, cont_sbuf.len );
+    strbuf_reset( &cont_sbuf );
+  } // for
+
+  batch_queue_flush( &queue );
+  batch_queue_cleanup( &queue );
+  strbuf_cleanup( &cont_sbuf );
+  free( buf );
+  sink_flush( cdecl_fout );
+
+  double const elapsed = monotonic_now() - start_time;
+  EPRINTF( "%s: %zu lines in %.3fs (%.0f lines/s)\n",
+    me, line_count, elapsed,
+    elapsed > 0 ? STATIC_CAST( double, line_count ) / elapsed : 0.0
+  );
+
+  return queue.status;
+}
+
 /**
  * Parses a **cdecl** command.
  *
- * @remarks If \a command is NULL and \a cli_count is 0, calls
- * cdecl_parse_stdin().
+ * @remarks If \a command is NULL and \a cli_count is 0, calls either
+ * cdecl_parse_batch() if \ref opt_batch is set or cdecl_parse_stdin().
  *
  * @param command The **cdecl** command to parse, but only if its \ref
  * cdecl_command::kind "kind" is #CDECL_COMMAND_PROG_NAME; NULL otherwise.
@@ -92,8 +544,12 @@ static inline bool is_cdecl( void ) {
 NODISCARD
 static int cdecl_parse_command( char const *command, size_t cli_count,
                                 char const *const cli_value[const] ) {
-  if ( command == NULL && cli_count == 0 ) // invoked as just cdecl or c++decl
+  if ( command == NULL && cli_count == 0 ) {
+    // invoked as just cdecl or c++decl
+    if ( opt_batch )
+      return cdecl_parse_batch( stdin );
     return cdecl_parse_stdin();
+  }
 
   strbuf_t sbuf;
   bool space;
@@ -129,7 +585,7 @@ static int cdecl_parse_file_impl( FILE *fin, bool return_on_error ) {
   int status = EX_OK;
 
   while ( strbuf_read_line( &sbuf, CDECL, fin, cdecl_prompt ) ) {
-    // We don't just call yyrestart( fin ) and yyparse() directly because
+    // We don't just call parser_parse( fin ) directly because
     // cdecl_parse_string() also inserts "explain " for opt_explain.
     status = cdecl_parse_string( sbuf.str, sbuf.len );
     if ( status != EX_OK && return_on_error )
@@ -141,6 +597,85 @@ static int cdecl_parse_file_impl( FILE *fin, bool return_on_error ) {
   return status;
 }
 
+/**
+ * Parses \a s via the parser of the current session.
+ *
+ * @param s The string to parse.
+ * @param s_len The length of \a s.
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ *
+ * @sa cdecl_parse_string_cached()
+ */
+NODISCARD
+static int cdecl_parse_string_impl( char const *s, size_t s_len ) {
+  FILE *const temp_file = fmemopen( CONST_CAST( void*, s ), s_len, "r" );
+  PERROR_EXIT_IF( temp_file == NULL, EX_IOERR );
+
+  int const rv_parse = parser_parse( cdecl_session->parser, temp_file );
+  PJL_IGNORE_RV( fclose( temp_file ) );
+  if ( unlikely( rv_parse == 2 ) )
+    fatal_error( EX_SOFTWARE, "yyparse(): out of memory\n" );
+  return rv_parse == 0 ? EX_OK : EX_DATAERR;
+}
+
+/**
+ * Parses \a s, but first looks up its output in the result cache of the
+ * current session: if found, prints the cached output instead.  Otherwise,
+ * parses \a s capturing its output and caches it, but only if parsing
+ * succeeded, printed nothing to standard error, and changed no state.
+ *
+ * @param s The null-terminated string to parse.  It _must not_ be a command
+ * that changes state.
+ * @param s_len The length of \a s.
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ *
+ * @sa batch_is_barrier()
+ * @sa cdecl_parse_string_impl()
+ */
+NODISCARD
+static int cdecl_parse_string_cached( char const *s, size_t s_len ) {
+  cdecl_session_t *const session = cdecl_session;
+  assert( session->cache != NULL );
+
+  size_t out_len;
+  char const *const out = cdecl_cache_find(
+    session->cache, session->gen, s, s_len, &out_len
+  );
+  if ( out != NULL ) {
+    sink_putsn( cdecl_fout, out, out_len );
+    return EX_OK;
+  }
+
+  strbuf_t out_sbuf, err_sbuf;
+  strbuf_init( &out_sbuf );
+  strbuf_init( &err_sbuf );
+  sink_t out_sink, err_sink;
+  sink_init_strbuf( &out_sink, &out_sbuf );
+  sink_init_strbuf( &err_sink, &err_sbuf );
+
+  sink_t *const prev_fout = cdecl_fout_redirect;
+  sink_t *const prev_ferr = cdecl_ferr_redirect;
+  cdecl_fout_redirect = &out_sink;
+  cdecl_ferr_redirect = &err_sink;
+  unsigned long const gen = session->gen;
+
+  int const status = cdecl_parse_string_impl( s, s_len );
+
+  cdecl_fout_redirect = prev_fout;
+  cdecl_ferr_redirect = prev_ferr;
+
+  if ( status == EX_OK && err_sbuf.len == 0 && session->gen == gen )
+    cdecl_cache_add( session->cache, out_sbuf.str, out_sbuf.len );
+  if ( err_sbuf.len > 0 )
+    sink_putsn( cdecl_ferr, err_sbuf.str, err_sbuf.len );
+  if ( out_sbuf.len > 0 )
+    sink_putsn( cdecl_fout, out_sbuf.str, out_sbuf.len );
+
+  strbuf_cleanup( &out_sbuf );
+  strbuf_cleanup( &err_sbuf );
+  return status;
+}
+
 /**
  * Parses **cdecl** commands from standard input until EOF.
  *
@@ -233,11 +768,8 @@ int cdecl_parse_string( char const *s, size_t s_len ) {
     s_len = explain_buf.len;
   }
 
-  FILE *const temp_file = fmemopen( CONST_CAST( void*, s ), s_len, "r" );
-  PERROR_EXIT_IF( temp_file == NULL, EX_IOERR );
-  yyrestart( temp_file );
-
-  if ( opt_echo_commands && !cdecl_interactive && cdecl_initialized ) {
+  if ( opt_echo_commands && !cdecl_interactive &&
+       cdecl_session->is_initialized ) {
     //
     // Echo the original command (without "explain" possibly having been
     // inserted) without a trailing newline (if any) so we can always print a
@@ -249,13 +781,14 @@ int cdecl_parse_string( char const *s, size_t s_len ) {
       "%s%.*s\n",
       cdecl_prompt[0], STATIC_CAST( int, echo_len ), print_params.command_line
     );
-    FFLUSH( stdout );
+    sink_flush( cdecl_fout );
   }
 
-  int const status = yyparse() == 0 ? EX_OK : EX_DATAERR;
-  PJL_IGNORE_RV( fclose( temp_file ) );
-  if ( unlikely( status == 2 ) )
-    fatal_error( EX_SOFTWARE, "yyparse(): out of memory\n" );
+  int const status =
+    cdecl_session->cache != NULL && cdecl_session->is_initialized &&
+    !batch_is_barrier( s ) ?
+      cdecl_parse_string_cached( s, s_len ) :
+      cdecl_parse_string_impl( s, s_len );
 
   if ( insert_explain ) {
     strbuf_cleanup( &explain_buf );
@@ -27,6 +27,8 @@
 /** @cond DOXYGEN_IGNORE */
 
 %define api.header.include { "parser.h" }
+%define api.pure full
+%param { parser_t *parser }
 %expect 17
 
 %{
@@ -45,7 +47,9 @@
 #include "c_type.h"
 #include "c_typedef.h"
 #include "cdecl.h"
+#include "cdecl_cache.h"
 #include "cdecl_keyword.h"
+#include "cdecl_session.h"
 #include "color.h"
 #include "decl_flags.h"
 #ifdef ENABLE_CDECL_DEBUG
@@ -55,12 +59,14 @@
 #include "english.h"
 #include "gibberish.h"
 #include "help.h"
+#include "intern.h"
 #include "lexer.h"
 #include "literals.h"
 #include "options.h"
 #include "print.h"
 #include "set_options.h"
 #include "show.h"
+#include "sink.h"
 #include "slist.h"
 #include "types.h"
 #include "util.h"
@@ -147,8 +153,10 @@
  * @sa keyword_expected()
  * @sa punct_expected()
  */
-#define elaborate_error_dym(DYM_KINDS,...) BLOCK( \
-  fl_elaborate_error( __FILE__, __LINE__, (DYM_KINDS), __VA_ARGS__ ); PARSE_ABORT(); )
+#define elaborate_error_dym(DYM_KINDS,...) BLOCK(                   \
+  fl_elaborate_error( __FILE__, __LINE__, parser, yychar, (DYM_KINDS), \
+                      __VA_ARGS__ );                                   \
+  PARSE_ABORT(); )
 
 /**
  * Checks whether the type currently being declared (`enum`, `struct`,
@@ -166,7 +174,7 @@
  * @sa fl_is_nested_type_ok()
  */
 #define is_nested_type_ok(TYPE_LOC) \
-  fl_is_nested_type_ok( __FILE__, __LINE__, (TYPE_LOC) )
+  fl_is_nested_type_ok( __FILE__, __LINE__, parser, (TYPE_LOC) )
 
 /**
  * Calls fl_keyword_expected() followed by #PARSE_ABORT().
@@ -186,16 +194,20 @@
  * @sa elaborate_error_dym()
  * @sa punct_expected()
  */
-#define keyword_expected(KEYWORD) BLOCK ( \
-  fl_keyword_expected( __FILE__, __LINE__, (KEYWORD) ); PARSE_ABORT(); )
+#define keyword_expected(KEYWORD) BLOCK (                              \
+  fl_keyword_expected( __FILE__, __LINE__, parser, yychar, (KEYWORD) ); \
+  PARSE_ABORT(); )
 
 /**
  * Aborts the current parse after an error message has been printed.
  *
+ * @note Like `YYABORT`, this (and every other macro that uses it) may be used
+ * only within a grammar action since it refers to Bison's `parser` parameter.
+ *
  * @sa #PARSE_ASSERT()
  */
 #define PARSE_ABORT() \
-  BLOCK( parse_cleanup( /*fatal_error=*/true ); YYABORT; )
+  BLOCK( parse_cleanup( parser, /*fatal_error=*/true ); YYABORT; )
 
 /**
  * Evaluates \a EXPR: if `false`, calls #PARSE_ABORT().
@@ -222,8 +234,8 @@
  * @sa elaborate_error_dym()
  * @sa keyword_expected()
  */
-#define punct_expected(PUNCT) BLOCK( \
-  fl_punct_expected( __FILE__, __LINE__, (PUNCT) ); PARSE_ABORT(); )
+#define punct_expected(PUNCT) BLOCK(                              \
+  fl_punct_expected( __FILE__, __LINE__, parser, (PUNCT) ); PARSE_ABORT(); )
 
 /** @} */
 
@@ -244,7 +256,7 @@
  * @param ALIGN The \ref c_alignas to dump.
  */
 #define DUMP_ALIGN(KEY,ALIGN) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); c_alignas_dump( &(ALIGN), stdout ); )
+  DUMP_KEY( KEY ": " ); c_alignas_dump( &(ALIGN), cdecl_fout ); )
 
 /**
  * Dumps an AST.
@@ -256,7 +268,7 @@
  * @sa #DUMP_AST_PAIR()
  */
 #define DUMP_AST(KEY,AST) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); c_ast_dump( (AST), stdout ); )
+  DUMP_KEY( KEY ": " ); c_ast_dump( (AST), cdecl_fout ); )
 
 /**
  * Dumps an s_list of AST.
@@ -268,7 +280,7 @@
  * @sa #DUMP_AST_PAIR()
  */
 #define DUMP_AST_LIST(KEY,AST_LIST) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); c_ast_list_dump( &(AST_LIST), stdout ); )
+  DUMP_KEY( KEY ": " ); c_ast_list_dump( &(AST_LIST), cdecl_fout ); )
 
 /**
  * Dump a \ref c_ast_pair.
@@ -279,7 +291,7 @@
  * @sa #DUMP_AST()
  */
 #define DUMP_AST_PAIR(KEY,ASTP) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); c_ast_pair_dump( &(ASTP), stdout ); )
+  DUMP_KEY( KEY ": " ); c_ast_pair_dump( &(ASTP), cdecl_fout ); )
 
 /**
  * Dumps a `bool`.
@@ -290,7 +302,7 @@
  * @sa #DUMP_KEY()
  */
 #define DUMP_BOOL(KEY,BOOL)  IF_CDECL_DEBUG(  \
-  DUMP_KEY( KEY ": " ); bool_dump( (BOOL), stdout ); )
+  DUMP_KEY( KEY ": " ); bool_dump( (BOOL), cdecl_fout ); )
 
 /**
  * Ends a dump block.
@@ -306,7 +318,7 @@
  * @param ... The `printf()` arguments.
  */
 #define DUMP_KEY(...) IF_CDECL_DEBUG(     \
-  fput_sep( ",\n", &dump_comma, stdout ); \
+  sink_put_sep( cdecl_fout, ",\n", &dump_comma ); \
   PRINTF( "  " __VA_ARGS__ ); )
 
 /**
@@ -357,7 +369,7 @@
  * @sa #DUMP_STR()
  */
 #define DUMP_SNAME(KEY,SNAME) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); c_sname_dump( &(SNAME), stdout ); )
+  DUMP_KEY( KEY ": " ); c_sname_dump( &(SNAME), cdecl_fout ); )
 
 /**
  * Dumps a list of scoped names.
@@ -369,7 +381,7 @@
  * @sa #DUMP_SNAME()
  */
 #define DUMP_SNAME_LIST(KEY,LIST) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); c_sname_list_dump( &(LIST), stdout ); )
+  DUMP_KEY( KEY ": " ); c_sname_list_dump( &(LIST), cdecl_fout ); )
 
 #ifdef ENABLE_CDECL_DEBUG
 /**
@@ -397,7 +409,7 @@
  * @sa #DUMP_SNAME()
  */
 #define DUMP_STR(KEY,STR) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); fputs_quoted( (STR), '"', stdout ); )
+  DUMP_KEY( KEY ": " ); sink_puts_quoted( cdecl_fout, (STR), '"' ); )
 
 /**
  * Dumps a \ref c_tid_t.
@@ -408,7 +420,7 @@
  * @sa #DUMP_TYPE()
  */
 #define DUMP_TID(KEY,TID) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); c_tid_dump( (TID), stdout ); )
+  DUMP_KEY( KEY ": " ); c_tid_dump( (TID), cdecl_fout ); )
 
 /**
  * Dumps a \ref c_type.
@@ -419,7 +431,7 @@
  * @sa #DUMP_TID()
  */
 #define DUMP_TYPE(KEY,TYPE) IF_CDECL_DEBUG( \
-  DUMP_KEY( KEY ": " ); c_type_dump( &(TYPE), stdout ); )
+  DUMP_KEY( KEY ": " ); c_type_dump( &(TYPE), cdecl_fout ); )
 
 /** @} */
 
@@ -494,48 +506,49 @@ struct in_attr {
 };
 typedef struct in_attr in_attr_t;
 
-// local functions
-PJL_PRINTF_LIKE_FUNC(4)
-static void fl_elaborate_error( char const*, int, dym_kind_t, char const*,
-                                ... );
+/**
+ * Parser state.
+ *
+ * @remarks All state of a parse is kept here (rather than in global variables)
+ * so that any number of parsers can be used independently, e.g., by different
+ * threads.  A pointer to it is passed to every grammar action and to `yylex()`
+ * via Bison's <code>\%param</code>.
+ *
+ * @sa parser_new()
+ * @sa parser_free()
+ */
+struct parser {
+  lexer_t         lexer;                ///< Lexer state.
+  c_ast_arena_t   gc_ast_arena;         ///< c_ast nodes freed after parse.
+  in_attr_t       in_attr;              ///< Inherited attributes.
+};
 
-// local variables
-static c_ast_list_t   gc_ast_list;      ///< c_ast nodes freed after parse.
-static in_attr_t      in_attr;          ///< Inherited attributes.
-static c_ast_list_t   typedef_ast_list; ///< List of ASTs for `typedef`s.
+// local functions
+PJL_PRINTF_LIKE_FUNC(6)
+static void fl_elaborate_error( char const*, int, parser_t const*, int,
+                                dym_kind_t, char const*, ... );
 
 ////////// inline functions ///////////////////////////////////////////////////
 
 /**
- * Duplicates \a ast and adds it to \ref gc_ast_list.
+ * Duplicates \a ast allocating it from \ref parser::gc_ast_arena
+ * "gc_ast_arena".
  *
+ * @param parser The \ref parser to use.
  * @param ast The AST to duplicate.
  * @return Returns the duplicated AST.
  *
  * @sa c_ast_new_gc()
  */
-static inline c_ast_t* c_ast_dup_gc( c_ast_t const *ast ) {
-  return c_ast_dup( ast, &gc_ast_list );
+static inline c_ast_t* c_ast_dup_gc( parser_t *parser, c_ast_t const *ast ) {
+  return c_ast_dup( ast, &parser->gc_ast_arena );
 }
 
 /**
- * Garbage-collects the AST nodes on \a ast_list but does _not_ free \a
- * ast_list itself.
- *
- * @param ast_list The AST list to free the nodes of.
- *
- * @sa c_ast_list_cleanup()
- * @sa c_ast_dup_gc()
- * @sa c_ast_new_gc()
- * @sa c_ast_pair_new_gc()
- */
-static inline void c_ast_list_cleanup_gc( c_ast_list_t *ast_list ) {
-  slist_cleanup( ast_list, POINTER_CAST( slist_free_fn_t, &c_ast_free ) );
-}
-
-/**
- * Creates a new AST and adds it to \ref gc_ast_list.
+ * Creates a new AST allocating it from \ref parser::gc_ast_arena
+ * "gc_ast_arena".
  *
+ * @param parser The \ref parser to use.
  * @param kind The kind of AST to create.
  * @param loc A pointer to the token location data.
  * @return Returns a pointer to a new AST.
@@ -544,69 +557,78 @@ static inline void c_ast_list_cleanup_gc( c_ast_list_t *ast_list ) {
  * @sa c_ast_pair_new_gc()
  */
 NODISCARD
-static inline c_ast_t* c_ast_new_gc( c_ast_kind_t kind, c_loc_t const *loc ) {
-  return c_ast_new( kind, in_attr.ast_depth, loc, &gc_ast_list );
+static inline c_ast_t* c_ast_new_gc( parser_t *parser, c_ast_kind_t kind,
+                                     c_loc_t const *loc ) {
+  return c_ast_new(
+    kind, parser->in_attr.ast_depth, loc, &parser->gc_ast_arena
+  );
 }
 
 /**
  * Set our mode to deciphering gibberish into English.
+ *
+ * @param parser The \ref parser to use.
  */
-static inline void gibberish_to_english( void ) {
+static inline void gibberish_to_english( parser_t *parser ) {
   cdecl_mode = CDECL_GIBBERISH_TO_ENGLISH;
-  lexer_find &= ~LEXER_FIND_CDECL_KEYWORDS;
+  parser->lexer.find &= ~LEXER_FIND_CDECL_KEYWORDS;
 }
 
 /**
  * Peeks at the type AST at the top of the
- * \ref in_attr.type_ast_stack "type AST inherited attribute stack".
+ * \ref in_attr::type_ast_stack "type AST inherited attribute stack".
  *
+ * @param parser The \ref parser to use.
  * @return Returns said AST.
  *
  * @sa ia_type_ast_pop()
  * @sa ia_type_ast_push()
  */
 NODISCARD
-static inline c_ast_t* ia_type_ast_peek( void ) {
-  return slist_front( &in_attr.type_ast_stack );
+static inline c_ast_t* ia_type_ast_peek( parser_t const *parser ) {
+  return slist_front( &parser->in_attr.type_ast_stack );
 }
 
 /**
  * Pops a type AST from the
- * \ref in_attr.type_ast_stack "type AST inherited attribute stack".
+ * \ref in_attr::type_ast_stack "type AST inherited attribute stack".
  *
+ * @param parser The \ref parser to use.
  * @return Returns said AST.
  *
  * @sa ia_type_ast_peek()
  * @sa ia_type_ast_push()
  */
 PJL_DISCARD
-static inline c_ast_t* ia_type_ast_pop( void ) {
-  return slist_pop_front( &in_attr.type_ast_stack );
+static inline c_ast_t* ia_type_ast_pop( parser_t *parser ) {
+  return slist_pop_front( &parser->in_attr.type_ast_stack );
 }
 
 /**
  * Pushes a type AST onto the
- * \ref in_attr.type_ast_stack "type AST inherited attribute  stack".
+ * \ref in_attr::type_ast_stack "type AST inherited attribute  stack".
  *
  * @remarks Additionally, if \a ast is #K_BUILTIN and \ref
  * in_attr::type_spec_ast "type_spec_ast" is NULL, sets \ref
  * in_attr::type_spec_ast "type_spec_ast" to \a ast.
  *
+ * @param parser The \ref parser to use.
  * @param ast The AST to push.
  *
  * @sa ia_type_ast_peek()
  * @sa ia_type_ast_pop()
  */
-static inline void ia_type_ast_push( c_ast_t *ast ) {
-  slist_push_front( &in_attr.type_ast_stack, ast );
-  if ( in_attr.type_spec_ast == NULL && ast->kind == K_BUILTIN )
-    in_attr.type_spec_ast = ast;
+static inline void ia_type_ast_push( parser_t *parser, c_ast_t *ast ) {
+  slist_push_front( &parser->in_attr.type_ast_stack, ast );
+  if ( parser->in_attr.type_spec_ast == NULL && ast->kind == K_BUILTIN )
+    parser->in_attr.type_spec_ast = ast;
 }
 
 /**
  * Given an AST for a type that is the "of type", return type, or "to type" of
  * a declaration, returns a duplicate of \a type_ast if necessary.
  *
+ * @param parser The \ref parser to use.
  * @param type_ast The AST of a type.
  * @return If \a type_ast `==` \ref in_attr::type_spec_ast "type_spec_ast",
  * returns a duplicate of \a type_ast; otherwise returns \a type_ast.
@@ -614,10 +636,11 @@ static inline void ia_type_ast_push( c_ast_t *ast ) {
  * @sa \ref in_attr::type_spec_ast
  */
 NODISCARD
-static inline c_ast_t* ia_type_spec_ast( c_ast_t *type_ast ) {
+static inline c_ast_t* ia_type_spec_ast( parser_t *parser,
+                                         c_ast_t *type_ast ) {
   // Yes, == is correct here: we mean the same AST node.
-  return type_ast == in_attr.type_spec_ast ?
-    c_ast_dup_gc( type_ast ) : type_ast;
+  return type_ast == parser->in_attr.type_spec_ast ?
+    c_ast_dup_gc( parser, type_ast ) : type_ast;
 }
 
 /**
@@ -631,7 +654,7 @@ static inline c_ast_t* ia_type_spec_ast( c_ast_t *type_ast ) {
  */
 NODISCARD
 static inline bool unsupported( c_lang_id_t lang_ids ) {
-  return !opt_lang_is_any( lang_ids ) && cdecl_initialized;
+  return !opt_lang_is_any( lang_ids ) && cdecl_session->is_initialized;
 }
 
 ////////// local functions ////////////////////////////////////////////////////
@@ -658,39 +681,6 @@ static void attr_syntax_not_supported( char const *keyword,
     EPUTC( '\n' );
 }
 
-/**
- * A predicate function for slist_free_if() that checks whether \a ast is one
- * that can be garbage collected: if so, c_ast_free()s it.
- *
- * @param ast_node The \ref slist_node pointing to the AST to check.
- * @param user_data Contains the AST of the type being declared.
- * @return Returns `true` only if \a ast should be removed from the list.
- */
-NODISCARD
-static bool c_ast_free_if_garbage( slist_node_t *ast_node,
-                                   user_data_t user_data ) {
-  assert( ast_node != NULL );
-  c_ast_t *const ast = ast_node->data;
-  assert( ast != NULL );
-  c_ast_t const *const type_ast = user_data.pc;
-  assert( type_ast != NULL );
-
-  if ( ast == type_ast || !c_ast_is_orphan( ast ) ) {
-    assert( ast->kind != K_PLACEHOLDER );
-    return false;
-  }
-
-  // We also need to ensure the AST isn't in the type_ast_stack.
-  FOREACH_SLIST_NODE( type_node, &in_attr.type_ast_stack ) {
-    c_ast_t const *const stack_type_ast = type_node->data;
-    if ( ast == stack_type_ast )
-      return false;
-  } // for
-
-  c_ast_free( ast );
-  return true;
-}
-
 /**
  * Checks whether `typename` is OK since the type's name is a qualified name.
  *
@@ -707,6 +697,36 @@ bool c_ast_is_typename_ok( c_ast_t const *ast ) {
   return true;
 }
 
+#ifdef ENABLE_CDECL_DEBUG
+/**
+ * Prints AST memory usage as JSON5 if #CDECL_DEBUG_OPT_AST_MEMORY is set.
+ *
+ * @param what What the memory was used for.
+ * @param name The name of the type defined or NULL for none.
+ * @param stats The \ref c_ast_arena_stats to print.
+ */
+static void dump_ast_memory( char const *what, char const *name,
+                             c_ast_arena_stats_t const *stats ) {
+  assert( what != NULL );
+  assert( stats != NULL );
+
+  if ( (opt_cdecl_debug & CDECL_DEBUG_OPT_AST_MEMORY) == 0 ||
+       stats->node_count == 0 ) {
+    return;
+  }
+
+  PRINTF( "ast_memory = { what: \"%s\", ", what );
+  if ( name != NULL )
+    PRINTF( "name: \"%s\", ", name );
+  PRINTF(
+    "nodes: %zu, bytes: %zu, full_bytes: %zu, saved_bytes: %zu }\n",
+    stats->node_count, stats->node_bytes, stats->full_bytes,
+    stats->full_bytes > stats->node_bytes ?
+      stats->full_bytes - stats->node_bytes : 0
+  );
+}
+#endif /* ENABLE_CDECL_DEBUG */
+
 /**
  * Defines a type by adding it to the global set.
  *
@@ -732,24 +752,32 @@ static bool define_type( c_ast_t const *type_ast, unsigned decl_flags ) {
   }
 
   rb_node_t const *const typedef_rb = c_typedef_add( type_ast, decl_flags );
-  c_typedef_t const *const tdef = typedef_rb->data;
+  c_typedef_t *const tdef = typedef_rb->data;
 
   if ( tdef->ast == type_ast ) {
     //
-    // Type was added: we have to move the AST from the gc_ast_list so it won't
-    // be garbage collected at the end of the parse to a separate
-    // typedef_ast_list that's freed only at program termination.
-    //
-    // But first, garbage collect all orphaned AST nodes.  (For a non-type-
-    // defining parse, this step isn't necessary since all nodes are freed at
-    // the end of the parse anyway.)
+    // Type was added: we have to copy the AST from gc_ast_arena (that's reset
+    // at the end of the parse) to a separate typedef arena that's freed only
+    // along with the session (or, for user-defined types, when the session is
+    // reset).  Only the nodes reachable from type_ast are copied, so orphaned
+    // nodes are garbage collected along with the rest of gc_ast_arena.
     //
-    slist_free_if(
-      &gc_ast_list,
-      &c_ast_free_if_garbage,
-      (user_data_t){ .pc = type_ast }
+    c_ast_arena_t *const typedef_ast_arena =
+      c_typedef_ast_arena( tdef->is_predefined );
+#ifdef ENABLE_CDECL_DEBUG
+    c_ast_arena_stats_t before, after;
+    c_ast_arena_stats( typedef_ast_arena, &before );
+#endif /* ENABLE_CDECL_DEBUG */
+    tdef->ast = c_ast_dup( type_ast, typedef_ast_arena );
+#ifdef ENABLE_CDECL_DEBUG
+    c_ast_arena_stats( typedef_ast_arena, &after );
+    after.node_count -= before.node_count;
+    after.node_bytes -= before.node_bytes;
+    after.full_bytes -= before.full_bytes;
+    dump_ast_memory(
+      "typedef", c_sname_full_name( &type_ast->sname ), &after
     );
-    slist_push_list_back( &typedef_ast_list, &gc_ast_list );
+#endif /* ENABLE_CDECL_DEBUG */
   }
   else {
     //
@@ -765,9 +793,9 @@ static bool define_type( c_ast_t const *type_ast, unsigned decl_flags ) {
     //
     if ( !c_ast_equal( type_ast, tdef->ast ) ) {
       print_error( &type_ast->loc, "type " );
-      print_ast_type_aka( type_ast, stderr );
+      print_ast_type_aka( type_ast, cdecl_ferr );
       EPUTS( " redefinition incompatible with original type \"" );
-      print_type_ast( tdef, stderr );
+      print_type_ast( tdef, cdecl_ferr );
       EPUTS( "\"\n" );
       return false;
     }
@@ -792,15 +820,17 @@ static bool define_type( c_ast_t const *type_ast, unsigned decl_flags ) {
  * @param file The name of the file where this function was called from.
  * @param line The line number within \a file where this function was called
  * from.
+ * @param parser The \ref parser to use.
  * @param type_loc The location of the type declaration.
  * @return Returns `true` only if the type currently being declared is either
  * not nested or the current language is C++.
  */
 NODISCARD
 static bool fl_is_nested_type_ok( char const *file, int line,
+                                  parser_t const *parser,
                                   c_loc_t const *type_loc ) {
   assert( type_loc != NULL );
-  if ( !c_sname_empty( &in_attr.scope_sname ) &&
+  if ( !c_sname_empty( &parser->in_attr.scope_sname ) &&
        !OPT_LANG_IS( NESTED_TYPES ) ) {
     fl_print_error( file, line, type_loc,
       "nested types not supported%s\n",
@@ -837,6 +867,8 @@ static bool fl_is_nested_type_ok( char const *file, int line,
  * @param file The name of the file where this function was called from.
  * @param line The line number within \a file where this function was called
  * from.
+ * @param parser The \ref parser to use.
+ * @param lookahead The lookahead token ID, i.e., Bison's `yychar`.
  * @param keyword A keyword literal.
  *
  * @sa fl_elaborate_error()
@@ -844,12 +876,13 @@ static bool fl_is_nested_type_ok( char const *file, int line,
  * @sa yyerror()
  */
 static void fl_keyword_expected( char const *file, int line,
+                                 parser_t const *parser, int lookahead,
                                  char const *keyword ) {
   assert( keyword != NULL );
 
   dym_kind_t dym_kinds = DYM_NONE;
 
-  char const *const error_token = lexer_printable_token();
+  char const *const error_token = lexer_printable_token( &parser->lexer );
   if ( error_token != NULL ) {
     if ( strcmp( error_token, keyword ) == 0 ) {
       //
@@ -874,7 +907,9 @@ static void fl_keyword_expected( char const *file, int line,
       DYM_CDECL_KEYWORDS : DYM_C_KEYWORDS;
   }
 
-  fl_elaborate_error( file, line, dym_kinds, "\"%s\" expected", keyword );
+  fl_elaborate_error(
+    file, line, parser, lookahead, dym_kinds, "\"%s\" expected", keyword
+  );
 }
 
 /**
@@ -898,17 +933,19 @@ static void fl_keyword_expected( char const *file, int line,
  * @param file The name of the file where this function was called from.
  * @param line The line number within \a file where this function was called
  * from.
+ * @param parser The \ref parser to use.
  * @param punct The punctuation character that was expected.
  *
  * @sa fl_elaborate_error()
  * @sa fl_keyword_expected()
  * @sa yyerror()
  */
-static void fl_punct_expected( char const *file, int line, char punct ) {
+static void fl_punct_expected( char const *file, int line,
+                               parser_t const *parser, char punct ) {
   EPUTS( ": " );
   print_debug_file_line( file, line );
 
-  char const *const error_token = lexer_printable_token();
+  char const *const error_token = lexer_printable_token( &parser->lexer );
   if ( error_token != NULL )
     EPRINTF( "\"%s\": ", error_token );
 
@@ -918,28 +955,32 @@ static void fl_punct_expected( char const *file, int line, char punct ) {
 
 /**
  * Cleans-up all resources used by \ref in_attr "inherited attributes".
+ *
+ * @param parser The \ref parser to use.
  */
-static void ia_cleanup( void ) {
-  c_sname_cleanup( &in_attr.scope_sname );
-  // Do _not_ pass &c_ast_free for the 2nd argument! All AST nodes were already
-  // free'd from the gc_ast_list in parse_cleanup(). Just free the slist nodes.
-  slist_cleanup( &in_attr.type_ast_stack, /*free_fn=*/NULL );
-  MEM_ZERO( &in_attr );
+static void ia_cleanup( parser_t *parser ) {
+  c_sname_cleanup( &parser->in_attr.scope_sname );
+  // Do _not_ free the AST nodes! All AST nodes were already freed by resetting
+  // gc_ast_arena in parse_cleanup(). Just free the slist nodes.
+  slist_cleanup( &parser->in_attr.type_ast_stack, /*free_fn=*/NULL );
+  MEM_ZERO( &parser->in_attr );
 }
 
 /**
  * Joins \a type_ast and \a decl_ast into a single AST.
  *
+ * @param parser The \ref parser to use.
  * @param type_ast The type AST.
  * @param decl_ast The declaration AST.
  * @return Returns the joined AST on success or NULL on error.
  */
 NODISCARD
-c_ast_t* join_type_decl( c_ast_t *type_ast, c_ast_t *decl_ast ) {
+c_ast_t* join_type_decl( parser_t *parser, c_ast_t *type_ast,
+                         c_ast_t *decl_ast ) {
   assert( type_ast != NULL );
   assert( decl_ast != NULL );
 
-  if ( in_attr.is_typename && !c_ast_is_typename_ok( type_ast ) )
+  if ( parser->in_attr.is_typename && !c_ast_is_typename_ok( type_ast ) )
     return NULL;
 
   c_type_t type = c_ast_take_type_any( type_ast, &T_TS_typedef );
@@ -963,9 +1004,9 @@ c_ast_t* join_type_decl( c_ast_t *type_ast, c_ast_t *decl_ast ) {
     //
     if ( !c_ast_equal( type_ast, raw_decl_ast ) ) {
       print_error( &decl_ast->loc, "type " );
-      print_ast_type_aka( type_ast, stderr );
+      print_ast_type_aka( type_ast, cdecl_ferr );
       EPUTS( " redefinition incompatible with original type " );
-      print_ast_type_aka( decl_ast, stderr );
+      print_ast_type_aka( decl_ast, cdecl_ferr );
       EPUTC( '\n' );
       return NULL;
     }
@@ -974,7 +1015,7 @@ c_ast_t* join_type_decl( c_ast_t *type_ast, c_ast_t *decl_ast ) {
     // Because the raw_decl_ast for the existing type is about to be combined
     // with type_ast, duplicate raw_decl_ast first.
     //
-    decl_ast = c_ast_dup_gc( raw_decl_ast );
+    decl_ast = c_ast_dup_gc( parser, raw_decl_ast );
   }
 
   c_ast_t *const ast = c_ast_patch_placeholder( type_ast, decl_ast );
@@ -982,15 +1023,15 @@ c_ast_t* join_type_decl( c_ast_t *type_ast, c_ast_t *decl_ast ) {
   c_type_or_eq( &type, &tdef_type );
   c_type_or_eq( &ast->type, &type );
 
-  if ( in_attr.align.kind != C_ALIGNAS_NONE ) {
-    ast->align = in_attr.align;
+  if ( parser->in_attr.align.kind != C_ALIGNAS_NONE ) {
+    c_ast_set_align( ast, &parser->in_attr.align );
     if ( c_tid_is_any( type.stids, TS_typedef ) ) {
       //
       // We check for illegal aligned typedef here rather than in c_ast_check.c
       // because the "typedef-ness" needed to be removed previously before the
       // eventual call to c_ast_check().
       //
-      print_error( &ast->align.loc, "typedef can not be aligned\n" );
+      print_error( &c_ast_align( ast )->loc, "typedef can not be aligned\n" );
       return NULL;
     }
   }
@@ -1011,11 +1052,12 @@ c_ast_t* join_type_decl( c_ast_t *type_ast, c_ast_t *decl_ast ) {
 /**
  * Cleans up individial parse data after each parse.
  *
+ * @param parser The \ref parser to use.
  * @param fatal_error Must be `true` only if a fatal semantic error has
  * occurred and `YYABORT` is about to be called to bail out of parsing by
  * returning from yyparse().
  */
-static void parse_cleanup( bool fatal_error ) {
+static void parse_cleanup( parser_t *parser, bool fatal_error ) {
   cdecl_mode = CDECL_ENGLISH_TO_GIBBERISH;
 
   //
@@ -1023,19 +1065,29 @@ static void parse_cleanup( bool fatal_error ) {
   // parse with a fatal error.  If so, do a "hard" reset that also resets the
   // EOF flag of the lexer.
   //
-  lexer_reset( /*hard_reset=*/fatal_error );
+  lexer_reset( &parser->lexer, /*hard_reset=*/fatal_error );
 
-  c_ast_list_cleanup_gc( &gc_ast_list );
-  ia_cleanup();
+#ifdef ENABLE_CDECL_DEBUG
+  c_ast_arena_stats_t stats;
+  c_ast_arena_stats( &parser->gc_ast_arena, &stats );
+  dump_ast_memory( "command", /*name=*/NULL, &stats );
+#endif /* ENABLE_CDECL_DEBUG */
+  c_ast_arena_reset( &parser->gc_ast_arena );
+  ia_cleanup( parser );
 }
 
 /**
  * Implements the **cdecl** `quit` command.
  *
  * @note This should be marked `noreturn` but isn't since that would generate a
- * warning that a `break` in the Bison-generated code won't be executed.
+ * warning that a `break` in the Bison-generated code won't be executed.  It
+ * also does return if cdecl_session::is_quit_deferred is set.
  */
 static void quit( void ) {
+  if ( cdecl_session->is_quit_deferred ) {
+    cdecl_session->is_quit = true;
+    return;
+  }
   exit( EX_OK );
 }
 
@@ -1064,6 +1116,9 @@ static void quit( void ) {
  *      |
  *      print_loc()
  *
+ * @param lloc The location of the lookahead token; unused since the lexer's
+ * idea of the current location is more accurate.
+ * @param parser The \ref parser to use.
  * @param msg The error message to print.  Bison invariably passes `syntax
  * error`.
  *
@@ -1072,15 +1127,16 @@ static void quit( void ) {
  * @sa fl_punct_expected()
  * @sa print_loc()
  */
-static void yyerror( char const *msg ) {
+static void yyerror( MAYBE_UNUSED YYLTYPE const *lloc, parser_t *parser,
+                     char const *msg ) {
   assert( msg != NULL );
 
-  c_loc_t const loc = lexer_loc();
+  c_loc_t const loc = lexer_loc( &parser->lexer );
   print_loc( &loc );
 
-  color_start( stderr, sgr_error );
+  color_start( cdecl_ferr, sgr_error );
   EPUTS( msg );                         // no newline
-  color_end( stderr, sgr_error );
+  color_end( cdecl_ferr, sgr_error );
 
   //
   // A syntax error has occurred, but syntax errors aren't fatal since Bison
@@ -1088,7 +1144,7 @@ static void yyerror( char const *msg ) {
   // called so we won't bail out of parsing by returning from yyparse(); hence,
   // parsing will continue.
   //
-  parse_cleanup( /*fatal_error=*/false );
+  parse_cleanup( parser, /*fatal_error=*/false );
 }
 
 /** @} */
@@ -1114,7 +1170,7 @@ static void yyerror( char const *msg ) {
   bool                flag;       // simple flag
   unsigned            flags;      // multipurpose bitwise flags
   char const         *literal;    // token L_* literal (for new-style casts)
-  char               *name;       // identifier name, cf. sname
+  char const         *name;       // interned identifier name, cf. sname
   c_func_member_t     member;     // member, non-member, or unspecified
   c_op_id_t           op_id;      // overloaded operator ID
   cdecl_show_t        show;       // which types to show
@@ -1127,6 +1183,21 @@ static void yyerror( char const *msg ) {
   unsigned            uint_val;   // unsigned integer value
 }
 
+%code {
+/**
+ * Bison: gets the next token ID from the lexer of \a parser.
+ *
+ * @param lval A pointer to the token's semantic value to set.
+ * @param lloc A pointer to the token's location to set.
+ * @param parser The \ref parser to use.
+ * @return Returns the token ID.
+ */
+NODISCARD
+static inline int yylex( YYSTYPE *lval, YYLTYPE *lloc, parser_t *parser ) {
+  return lexer_lex( lval, lloc, parser->lexer.scanner );
+}
+}
+
                     // cdecl commands
 %token              Y_cast
 //                  Y_class             // covered in C++
@@ -1146,6 +1217,7 @@ static void yyerror( char const *msg ) {
 %token              Y_set
 %token              Y_show
 //                  Y_static            // covered in K&R C
+%token              Y_stats
 //                  Y_struct            // covered in K&R C
 //                  Y_typedef           // covered in K&R C
 //                  Y_union             // covered in K&R C
@@ -1457,9 +1529,9 @@ static void yyerror( char const *msg ) {
 %token  <str_val>   Y_CHAR_LIT          // must be free'd
 %token              Y_END
 %token              Y_ERROR
-%token  <name>      Y_GLOB              // must be free'd
-%token  <name>      Y_NAME              // must be free'd
-%token  <name>      Y_SET_OPTION        // must be free'd
+%token  <str_val>   Y_GLOB              // must be free'd
+%token  <name>      Y_NAME              // interned: must NOT be free'd
+%token  <str_val>   Y_SET_OPTION        // must be free'd
 %token  <str_val>   Y_STR_LIT           // must be free'd
 %token  <tdef>      Y_TYPEDEF_NAME      // e.g., size_t
 %token  <tdef>      Y_TYPEDEF_SNAME     // e.g., std::string
@@ -1663,7 +1735,7 @@ static void yyerror( char const *msg ) {
 %type   <tid>         cv_qualifier_stid cv_qualifier_list_stid_opt
 %type   <tid>         enum_btids
 %type   <tid>         eval_expr_init_stid
-%type   <name>        glob glob_opt
+%type   <str_val>     glob glob_opt
 %type   <name>        help_what_opt
 %type   <tid>         inline_stid_opt
 %type   <ast>         name_ast
@@ -1688,10 +1760,9 @@ static void yyerror( char const *msg ) {
 //
 // Bison %destructors.
 //
-// Clean-up of AST nodes is done via garbage collection using gc_ast_list.
+// Clean-up of AST nodes is done via garbage collection using gc_ast_arena.
 //
 %destructor { DTRACE; c_ast_list_cleanup( &$$ ); }    <ast_list>
-%destructor { DTRACE; FREE( $$ ); }                   <name>
 %destructor { DTRACE; c_sname_cleanup( &$$ ); }       <sname>
 %destructor { DTRACE; c_sname_list_cleanup( &$$ ); }  <sname_list>
 %destructor { DTRACE; FREE( $$ ); }                   <str_val>
@@ -1705,7 +1776,7 @@ command_list
     { //
       // We get here only after a successful parse.
       //
-      parse_cleanup( /*fatal_error=*/false );
+      parse_cleanup( parser, /*fatal_error=*/false );
     }
   ;
 
@@ -1719,13 +1790,14 @@ command
   | scoped_command
   | set_command semi_or_end
   | show_command semi_or_end
+  | stats_command semi_or_end
   | template_command semi_or_end
   | typedef_command semi_or_end
   | using_command semi_or_end
   | semi_or_end                         // allows for blank lines
   | error
     {
-      if ( lexer_printable_token() != NULL )
+      if ( lexer_printable_token( &parser->lexer ) != NULL )
         elaborate_error_dym( DYM_COMMANDS, "unexpected token" );
       else
         elaborate_error( "unexpected end of command" );
@@ -1750,7 +1822,7 @@ cast_command
       DUMP_SNAME( "sname_english_opt", $sname );
       DUMP_AST( "decl_english_ast", $decl_ast );
 
-      c_ast_t *const cast_ast = c_ast_new_gc( K_CAST, &@$ );
+      c_ast_t *const cast_ast = c_ast_new_gc( parser, K_CAST, &@$ );
       cast_ast->sname = c_sname_move( &$sname );
       cast_ast->cast.kind = C_CAST_C;
       cast_ast->cast.to_ast = $decl_ast;
@@ -1759,7 +1831,7 @@ cast_command
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( cast_ast ) );
-      c_ast_gibberish( cast_ast, C_GIB_PRINT_CAST, stdout );
+      c_ast_gibberish( cast_ast, C_GIB_PRINT_CAST, cdecl_fout );
     }
 
     /*
@@ -1776,7 +1848,7 @@ cast_command
       DUMP_SNAME( "sname_english_exp", $sname );
       DUMP_AST( "decl_english_ast", $decl_ast );
 
-      c_ast_t *const cast_ast = c_ast_new_gc( K_CAST, &@$ );
+      c_ast_t *const cast_ast = c_ast_new_gc( parser, K_CAST, &@$ );
       cast_ast->sname = c_sname_move( &$sname );
       cast_ast->cast.kind = $cast_kind;
       cast_ast->cast.to_ast = $decl_ast;
@@ -1785,7 +1857,7 @@ cast_command
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( cast_ast ) );
-      c_ast_gibberish( cast_ast, C_GIB_PRINT_CAST, stdout );
+      c_ast_gibberish( cast_ast, C_GIB_PRINT_CAST, cdecl_fout );
     }
   ;
 
@@ -1862,7 +1934,7 @@ declare_command
               "\"%s\": previously declared as type \"",
               c_sname_full_name( sname )
             );
-            print_type_ast( tdef, stderr );
+            print_type_ast( tdef, cdecl_ferr );
             EPUTS( "\"\n" );
             ok = false;
             break;
@@ -1871,7 +1943,7 @@ declare_command
       }
 
       if ( ok )
-        c_sname_list_ast_gibberish( &$sname_list, $decl_ast, stdout );
+        c_sname_list_ast_gibberish( &$sname_list, $decl_ast, cdecl_fout );
 
       c_sname_list_cleanup( &$sname_list );
       PARSE_ASSERT( ok );
@@ -1923,7 +1995,7 @@ declare_command
       DUMP_AST( "returning_english_ast_opt", $ret_ast );
       DUMP_END();
 
-      c_ast_t *const oper_ast = c_ast_new_gc( K_OPERATOR, &@op_id );
+      c_ast_t *const oper_ast = c_ast_new_gc( parser, K_OPERATOR, &@op_id );
       c_sname_set( &oper_ast->sname, &$scope_sname );
       PARSE_ASSERT( c_type_add( &oper_ast->type, &$qual_type, &@qual_type ) );
       PARSE_ASSERT(
@@ -1939,7 +2011,7 @@ declare_command
       unsigned decl_flags = C_GIB_PRINT_DECL;
       if ( opt_semicolon )
         decl_flags |= C_GIB_OPT_SEMICOLON;
-      c_ast_gibberish( oper_ast, decl_flags, stdout );
+      c_ast_gibberish( oper_ast, decl_flags, cdecl_fout );
       PUTC( '\n' );
     }
 
@@ -1963,7 +2035,7 @@ declare_command
       DUMP_AST_LIST( "paren_param_decl_list_english_opt", $param_ast_list );
       DUMP_AST( "returning_english_ast_opt", $ret_ast );
 
-      c_ast_t *const lambda_ast = c_ast_new_gc( K_LAMBDA, &@$ );
+      c_ast_t *const lambda_ast = c_ast_new_gc( parser, K_LAMBDA, &@$ );
       lambda_ast->type = $store_type;
       c_ast_list_set_param_of( &$capture_ast_list, lambda_ast );
       lambda_ast->lambda.capture_ast_list = slist_move( &$capture_ast_list );
@@ -1975,7 +2047,7 @@ declare_command
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( lambda_ast ) );
-      c_ast_gibberish( lambda_ast, C_GIB_PRINT_DECL, stdout );
+      c_ast_gibberish( lambda_ast, C_GIB_PRINT_DECL, cdecl_fout );
       PUTC( '\n' );
     }
 
@@ -1999,7 +2071,7 @@ declare_command
       DUMP_SNAME( "of_scope_list_english_opt", $scope_sname );
       DUMP_AST( "decl_english_ast", $ret_ast );
 
-      c_ast_t *const udc_ast = c_ast_new_gc( K_UDEF_CONV, &@$ );
+      c_ast_t *const udc_ast = c_ast_new_gc( parser, K_UDEF_CONV, &@$ );
       c_sname_set( &udc_ast->sname, &$scope_sname );
       udc_ast->type = c_type_or( &$store_type, &C_TYPE_LIT_S( $cv_qual_stid ) );
       c_ast_set_parent( $ret_ast, udc_ast );
@@ -2011,7 +2083,7 @@ declare_command
       unsigned decl_flags = C_GIB_PRINT_DECL;
       if ( opt_semicolon )
         decl_flags |= C_GIB_OPT_SEMICOLON;
-      c_ast_gibberish( udc_ast, decl_flags, stdout );
+      c_ast_gibberish( udc_ast, decl_flags, cdecl_fout );
       PUTC( '\n' );
     }
 
@@ -2036,7 +2108,7 @@ alignas_or_width_decl_english_ast
       DUMP_ALIGN( "alignas_specifier_english", $align );
 
       $$ = $decl_ast;
-      $$->align = $align;
+      c_ast_set_align( $$, &$align );
       $$->loc = @$;
 
       DUMP_AST( "$$_ast", $$ );
@@ -2050,7 +2122,7 @@ alignas_or_width_decl_english_ast
       //
       if ( !c_ast_is_integral( $decl_ast ) ) {
         print_error( &@bit_width, "invalid bit-field type " );
-        print_ast_type_aka( $decl_ast, stderr );
+        print_ast_type_aka( $decl_ast, cdecl_ferr );
         EPRINTF( "; must be an integral %stype\n",
           OPT_LANG_IS( enum_BITFIELDS ) ? "or enumeration " : ""
         );
@@ -2158,17 +2230,17 @@ capture_decl_list_english
 capture_decl_english_ast
   : Y_copy capture_default_opt
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       $$->capture.kind = C_CAPTURE_COPY;
     }
   | Y_reference capture_default_opt
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       $$->capture.kind = C_CAPTURE_REFERENCE;
     }
   | Y_reference Y_to name_exp[name]
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       c_sname_append_name( &$$->sname, $name );
       $$->capture.kind = C_CAPTURE_REFERENCE;
     }
@@ -2375,7 +2447,7 @@ explain_command
   | explain pc99_pointer_decl_list_c[decl_ast_list]
     {
       PARSE_ASSERT( c_ast_list_check( &$decl_ast_list ) );
-      c_ast_list_english( &$decl_ast_list, stdout );
+      c_ast_list_english( &$decl_ast_list, cdecl_fout );
     }
 
     /*
@@ -2391,7 +2463,8 @@ explain_command
      * (We can't use typename_flag_opt because it would introduce more
      * shift/reduce conflicts.)
      */
-  | explain Y_typename { in_attr.is_typename = true; } typed_declaration_c
+  | explain Y_typename { parser->in_attr.is_typename = true; }
+    typed_declaration_c
 
     /*
      * User-defined conversion operator declaration without a storage-class-
@@ -2427,7 +2500,7 @@ explain_command
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( $decl_ast ) );
-      c_ast_english( $decl_ast, C_ENG_DECL, stdout );
+      c_ast_english( $decl_ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
 
@@ -2459,7 +2532,7 @@ explain
       //
       // would result in a parser error.
       //
-      gibberish_to_english();
+      gibberish_to_english( parser );
     }
   ;
 
@@ -2474,12 +2547,12 @@ help_command
       // as just strings so we don't have to enumerate all the possible tokens
       // in the grammar.
       //
-      lexer_find &= ~(LEXER_FIND_C_KEYWORDS | LEXER_FIND_CDECL_KEYWORDS);
+      parser->lexer.find &=
+        ~(LEXER_FIND_C_KEYWORDS | LEXER_FIND_CDECL_KEYWORDS);
     }
     help_what_opt[what]
     {
       bool const ok = print_help( $what, &@what );
-      free( $what );
       PARSE_ASSERT( ok );
     }
   ;
@@ -2552,7 +2625,7 @@ show_command
       DUMP_INT( "show_format_opt", $format );
       DUMP_END();
 
-      show_type( $tdef, $format, stdout );
+      show_type( $tdef, $format, cdecl_fout );
     }
 
   | Y_show any_typedef[tdef] Y_as show_format_exp[format]
@@ -2563,18 +2636,18 @@ show_command
       DUMP_INT( "show_format_exp", $format );
       DUMP_END();
 
-      show_type( $tdef, $format, stdout );
+      show_type( $tdef, $format, cdecl_fout );
     }
 
   | Y_show show_types_opt[show] glob_opt[glob_name] show_format_opt[format]
     {
-      show_types( $show, $glob_name, $format, stdout );
+      show_types( $show, $glob_name, $format, cdecl_fout );
       free( $glob_name );
     }
 
   | Y_show show_types_opt[show] glob_opt[glob_name] Y_as show_format_exp[format]
     {
-      show_types( $show, $glob_name, $format, stdout );
+      show_types( $show, $glob_name, $format, cdecl_fout );
       free( $glob_name );
     }
 
@@ -2600,10 +2673,9 @@ show_command
                                      TYPE_COMMANDS_CPP_WITHOUT_USING;
 
       print_error( &@name, "\"%s\": no such type defined via ", $name );
-      fput_list( stderr, type_commands, /*gets=*/NULL );
+      sink_put_list( cdecl_ferr, type_commands, /*gets=*/NULL );
       print_suggestions( DYM_C_TYPES, $name );
       EPUTC( '\n' );
-      free( $name );
       PARSE_ABORT();
     }
 
@@ -2666,6 +2738,15 @@ predefined_or_user_types_opt
   | Y_user                        { $$ = CDECL_SHOW_USER_DEFINED; }
   ;
 
+/// stats command /////////////////////////////////////////////////////////////
+
+stats_command
+  : Y_stats
+    {
+      cdecl_cache_print_stats( cdecl_session->cache, cdecl_fout );
+    }
+  ;
+
 /// template command //////////////////////////////////////////////////////////
 
 template_command
@@ -2693,11 +2774,11 @@ using_command
 c_style_cast_expr_c
   : '(' type_c_ast[type_ast]
     {
-      ia_type_ast_push( $type_ast );
+      ia_type_ast_push( parser, $type_ast );
     }
     cast_c_astp_opt[cast_astp] rparen_exp sname_c_opt[sname]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "explain_command",
@@ -2706,7 +2787,7 @@ c_style_cast_expr_c
       DUMP_AST_PAIR( "cast_c_astp_opt", $cast_astp );
       DUMP_SNAME( "sname_c_opt", $sname );
 
-      c_ast_t *const cast_ast = c_ast_new_gc( K_CAST, &@$ );
+      c_ast_t *const cast_ast = c_ast_new_gc( parser, K_CAST, &@$ );
       cast_ast->sname = c_sname_move( &$sname );
       cast_ast->cast.kind = C_CAST_C;
       cast_ast->cast.to_ast =
@@ -2716,7 +2797,7 @@ c_style_cast_expr_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( cast_ast ) );
-      c_ast_english( cast_ast, C_ENG_DECL, stdout );
+      c_ast_english( cast_ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
 
@@ -2732,7 +2813,7 @@ c_style_cast_expr_c
   | '(' pc99_pointer_decl_list_c[decl_ast_list] rparen_exp
     {
       PARSE_ASSERT( c_ast_list_check( &$decl_ast_list ) );
-      c_ast_list_english( &$decl_ast_list, stdout );
+      c_ast_list_english( &$decl_ast_list, cdecl_fout );
     }
   ;
 
@@ -2741,11 +2822,11 @@ c_style_cast_expr_c
 new_style_cast_expr_c
   : new_style_cast_c[cast_kind] lt_exp type_c_ast[type_ast]
     {
-      ia_type_ast_push( $type_ast );
+      ia_type_ast_push( parser, $type_ast );
     }
     cast_c_astp_opt[cast_astp] gt_exp lparen_exp sname_c_exp[sname] rparen_exp
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       char const *const cast_literal = c_cast_english( $cast_kind );
 
@@ -2758,7 +2839,7 @@ new_style_cast_expr_c
       DUMP_AST_PAIR( "cast_c_astp_opt", $cast_astp );
       DUMP_SNAME( "sname", $sname );
 
-      c_ast_t *const cast_ast = c_ast_new_gc( K_CAST, &@$ );
+      c_ast_t *const cast_ast = c_ast_new_gc( parser, K_CAST, &@$ );
       cast_ast->sname = c_sname_move( &$sname );
       cast_ast->cast.kind = $cast_kind;
       cast_ast->cast.to_ast =
@@ -2768,7 +2849,7 @@ new_style_cast_expr_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( cast_ast ) );
-      c_ast_english( cast_ast, C_ENG_DECL, stdout );
+      c_ast_english( cast_ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
   ;
@@ -2787,8 +2868,8 @@ new_style_cast_c
 /// Gibberish C/C++ aligned declaration ///////////////////////////////////////
 
 aligned_declaration_c
-  : alignas_specifier_c[align]    { in_attr.align = $align; }
-    typename_flag_opt[flag]       { in_attr.is_typename = $flag; }
+  : alignas_specifier_c[align]    { parser->in_attr.align = $align; }
+    typename_flag_opt[flag]       { parser->in_attr.is_typename = $flag; }
     typed_declaration_c
   ;
 
@@ -2807,10 +2888,13 @@ alignas_specifier_c
       DUMP_END();
     }
 
-  | alignas lparen_exp type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  | alignas lparen_exp type_c_ast[type_ast]
+    {
+      ia_type_ast_push( parser, $type_ast );
+    }
     cast_c_astp_opt[cast_astp] rparen_exp
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "alignas_specifier_c",
@@ -2863,14 +2947,15 @@ class_struct_union_declaration_c
   : class_struct_union_btid[csu_btid]
     {
       PARSE_ASSERT( is_nested_type_ok( &@csu_btid ) );
-      gibberish_to_english();           // see the comment in "explain"
+      gibberish_to_english( parser );           // see the comment in "explain"
     }
     any_sname_c_exp[sname]
     {
       c_type_t const *const cur_type =
-        c_sname_local_type( &in_attr.scope_sname );
+        c_sname_local_type( &parser->in_attr.scope_sname );
       if ( c_tid_is_any( cur_type->btids, TB_ANY_CLASS ) ) {
-        char const *const cur_name = c_sname_local_name( &in_attr.scope_sname );
+        char const *const cur_name =
+          c_sname_local_name( &parser->in_attr.scope_sname );
         char const *const mbr_name = c_sname_local_name( &$sname );
         if ( strcmp( mbr_name, cur_name ) == 0 ) {
           print_error( &@sname,
@@ -2887,21 +2972,22 @@ class_struct_union_declaration_c
                  "class_struct_union_btid sname '{' "
                  "in_scope_declaration_c_opt "
                  "'}' ';'" );
-      DUMP_SNAME( "in_attr__scope_sname", in_attr.scope_sname );
+      DUMP_SNAME( "in_attr__scope_sname", parser->in_attr.scope_sname );
       DUMP_TID( "class_struct_union_btid", $csu_btid );
       DUMP_SNAME( "any_sname_c", $sname );
 
-      c_sname_append_sname( &in_attr.scope_sname, &$sname );
+      c_sname_append_sname( &parser->in_attr.scope_sname, &$sname );
       c_sname_set_local_type(
-        &in_attr.scope_sname, &C_TYPE_LIT_B( $csu_btid )
+        &parser->in_attr.scope_sname, &C_TYPE_LIT_B( $csu_btid )
       );
-      PARSE_ASSERT( c_sname_check( &in_attr.scope_sname, &@sname ) );
+      PARSE_ASSERT( c_sname_check( &parser->in_attr.scope_sname, &@sname ) );
 
-      c_ast_t *const csu_ast = c_ast_new_gc( K_CLASS_STRUCT_UNION, &@sname );
-      csu_ast->sname = c_sname_dup( &in_attr.scope_sname );
+      c_ast_t *const csu_ast =
+        c_ast_new_gc( parser, K_CLASS_STRUCT_UNION, &@sname );
+      csu_ast->sname = c_sname_dup( &parser->in_attr.scope_sname );
       c_sname_append_name(
         &csu_ast->csu.csu_sname,
-        check_strdup( c_sname_local_name( &in_attr.scope_sname ) )
+        c_sname_local_name( &parser->in_attr.scope_sname )
       );
       csu_ast->type.btids = c_tid_check( $csu_btid, C_TPID_BASE );
 
@@ -2920,7 +3006,7 @@ enum_declaration_c
   : enum_btids
     {
       PARSE_ASSERT( is_nested_type_ok( &@enum_btids ) );
-      gibberish_to_english();           // see the comment in "explain"
+      gibberish_to_english( parser );           // see the comment in "explain"
     }
     any_sname_c_exp[sname] enum_fixed_type_c_ast_opt[fixed_type_ast]
     {
@@ -2930,7 +3016,7 @@ enum_declaration_c
       DUMP_SNAME( "any_sname_c", $sname );
       DUMP_AST( "enum_fixed_type_c_ast_opt", $fixed_type_ast );
 
-      c_sname_t enum_sname = c_sname_dup( &in_attr.scope_sname );
+      c_sname_t enum_sname = c_sname_dup( &parser->in_attr.scope_sname );
       c_sname_append_sname( &enum_sname, &$sname );
       c_sname_set_local_type( &enum_sname, &C_TYPE_LIT_B( $enum_btids ) );
       if ( !c_sname_check( &enum_sname, &@sname ) ) {
@@ -2938,13 +3024,12 @@ enum_declaration_c
         PARSE_ABORT();
       }
 
-      c_ast_t *const enum_ast = c_ast_new_gc( K_ENUM, &@sname );
+      c_ast_t *const enum_ast = c_ast_new_gc( parser, K_ENUM, &@sname );
       enum_ast->sname = enum_sname;
       enum_ast->type.btids = c_tid_check( $enum_btids, C_TPID_BASE );
       c_ast_set_parent( $fixed_type_ast, enum_ast );
       c_sname_append_name(
-        &enum_ast->enum_.enum_sname,
-        check_strdup( c_sname_local_name( &enum_sname ) )
+        &enum_ast->enum_.enum_sname, c_sname_local_name( &enum_sname )
       );
 
       DUMP_AST( "$$_ast", enum_ast );
@@ -2960,7 +3045,7 @@ namespace_declaration_c
      */
   : namespace_type
     {
-      gibberish_to_english();           // see the comment in "explain"
+      gibberish_to_english( parser );           // see the comment in "explain"
     }
     namespace_sname_c_exp[sname]
     {
@@ -2969,7 +3054,7 @@ namespace_declaration_c
                  "namespace_type sname '{' "
                  "in_scope_declaration_c_opt "
                  "'}' [';']" );
-      DUMP_SNAME( "in_attr__scope_sname", in_attr.scope_sname );
+      DUMP_SNAME( "in_attr__scope_sname", parser->in_attr.scope_sname );
       DUMP_TYPE( "namespace_type", $namespace_type );
       DUMP_SNAME( "any_sname_c", $sname );
 
@@ -3018,12 +3103,12 @@ namespace_declaration_c
         )
       );
 
-      c_sname_append_sname( &in_attr.scope_sname, &$sname );
+      c_sname_append_sname( &parser->in_attr.scope_sname, &$sname );
 
       DUMP_SNAME( "$$_sname", $sname );
       DUMP_END();
 
-      PARSE_ASSERT( c_sname_check( &in_attr.scope_sname, &@sname ) );
+      PARSE_ASSERT( c_sname_check( &parser->in_attr.scope_sname, &@sname ) );
     }
     brace_in_scope_declaration_c_exp
   ;
@@ -3212,7 +3297,7 @@ lambda_declaration_c
       DUMP_TYPE( "storage_class_subset_english_type_opt", $type );
       DUMP_AST( "lambda_return_type_c_ast_opt", $ret_ast );
 
-      c_ast_t *const lambda_ast = c_ast_new_gc( K_LAMBDA, &@$ );
+      c_ast_t *const lambda_ast = c_ast_new_gc( parser, K_LAMBDA, &@$ );
       lambda_ast->type = $type;
       c_ast_list_set_param_of( &$capture_ast_list, lambda_ast );
       lambda_ast->lambda.capture_ast_list = slist_move( &$capture_ast_list );
@@ -3224,7 +3309,7 @@ lambda_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( lambda_ast ) );
-      c_ast_english( lambda_ast, C_ENG_DECL, stdout );
+      c_ast_english( lambda_ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
   ;
@@ -3270,33 +3355,33 @@ capture_decl_list_c
 capture_decl_c_ast
   : '&'
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       $$->capture.kind = C_CAPTURE_REFERENCE;
     }
   | '&' Y_NAME[name]
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       c_sname_append_name( &$$->sname, $name );
       $$->capture.kind = C_CAPTURE_REFERENCE;
     }
   | '='
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       $$->capture.kind = C_CAPTURE_COPY;
     }
   | Y_NAME[name]
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       c_sname_append_name( &$$->sname, $name );
     }
   | Y_this
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       $$->capture.kind = C_CAPTURE_THIS;
     }
   | '*' this_exp
     {
-      $$ = c_ast_new_gc( K_CAPTURE, &@$ );
+      $$ = c_ast_new_gc( parser, K_CAPTURE, &@$ );
       $$->capture.kind = C_CAPTURE_STAR_THIS;
     }
   ;
@@ -3308,10 +3393,13 @@ lambda_param_c_ast_list_opt
 
 lambda_return_type_c_ast_opt
   : /* empty */                   { $$ = NULL; }
-  | Y_MINUS_GREATER type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  | Y_MINUS_GREATER type_c_ast[type_ast]
+    {
+      ia_type_ast_push( parser, $type_ast );
+    }
     cast_c_astp_opt[cast_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "lambda_return_type_c_ast_opt",
@@ -3341,9 +3429,13 @@ template_declaration_c
 /// Gibberish C/C++ typed declaration /////////////////////////////////////////
 
 typed_declaration_c
-  : type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); } decl_list_c_opt
+  : type_c_ast[type_ast]
     {
-      ia_type_ast_pop();
+      ia_type_ast_push( parser, $type_ast );
+    }
+    decl_list_c_opt
+    {
+      ia_type_ast_pop( parser );
     }
   ;
 
@@ -3353,21 +3445,23 @@ typedef_declaration_c
   : Y_typedef typename_flag_opt[flag]
     {
       PARSE_ASSERT( is_nested_type_ok( &@Y_typedef ) );
-      in_attr.is_typename = $flag;
-      gibberish_to_english();           // see the comment in "explain"
+      parser->in_attr.is_typename = $flag;
+      gibberish_to_english( parser );           // see the comment in "explain"
     }
     type_c_ast[type_ast]
     {
-      PARSE_ASSERT( !in_attr.is_typename || c_ast_is_typename_ok( $type_ast ) );
+      PARSE_ASSERT(
+        !parser->in_attr.is_typename || c_ast_is_typename_ok( $type_ast )
+      );
       // see the comment in "define_command" about TS_typedef
       PARSE_ASSERT(
         c_type_add_tid( &$type_ast->type, TS_typedef, &@type_ast )
       );
-      ia_type_ast_push( $type_ast );
+      ia_type_ast_push( parser, $type_ast );
     }
     typedef_decl_list_c
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
     }
   ;
 
@@ -3380,11 +3474,11 @@ typedef_decl_c
   : // in_attr: type_c_ast
     decl_c_astp[decl_astp]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "typedef_decl_c", "decl_c_astp" );
-      DUMP_SNAME( "in_attr__scope_sname", in_attr.scope_sname );
+      DUMP_SNAME( "in_attr__scope_sname", parser->in_attr.scope_sname );
       DUMP_AST( "in_attr__type_c_ast", type_ast );
       DUMP_AST_PAIR( "decl_c_astp", $decl_astp );
 
@@ -3432,7 +3526,7 @@ typedef_decl_c
         PARSE_ABORT();
       }
 
-      temp_sname = c_sname_dup( &in_attr.scope_sname );
+      temp_sname = c_sname_dup( &parser->in_attr.scope_sname );
       c_sname_prepend_sname( &typedef_ast->sname, &temp_sname );
 
       DUMP_AST( "$$_ast", typedef_ast );
@@ -3462,7 +3556,7 @@ user_defined_conversion_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( $decl_astp.ast ) );
-      c_ast_english( $decl_astp.ast, C_ENG_DECL, stdout );
+      c_ast_english( $decl_astp.ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
   ;
@@ -3498,27 +3592,26 @@ using_decl_c_ast
         PARSE_ABORT();
       }
 
-      gibberish_to_english();           // see the comment in "explain"
+      gibberish_to_english( parser );           // see the comment in "explain"
     }
     any_name_exp[name] attribute_specifier_list_c_atid_opt[atids] equals_exp
     type_c_ast[type_ast]
     {
       // see the comment in "define_command" about TS_typedef
-      if ( !c_type_add_tid( &$type_ast->type, TS_typedef, &@type_ast ) ) {
-        free( $name );
-        PARSE_ABORT();
-      }
-      ia_type_ast_push( $type_ast );
+      PARSE_ASSERT(
+        c_type_add_tid( &$type_ast->type, TS_typedef, &@type_ast )
+      );
+      ia_type_ast_push( parser, $type_ast );
     }
     cast_c_astp_opt[cast_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "using_decl_c_ast",
                  "USING any_name_exp attribute_specifier_list_c_atid_opt '=' "
                  "type_c_ast cast_c_astp_opt" );
-      DUMP_SNAME( "in_attr__scope_sname", in_attr.scope_sname );
+      DUMP_SNAME( "in_attr__scope_sname", parser->in_attr.scope_sname );
       DUMP_STR( "any_name_exp", $name );
       DUMP_TID( "attribute_specifier_list_c_atid_opt", $atids );
       DUMP_AST( "type_c_ast", $type_ast );
@@ -3537,11 +3630,10 @@ using_decl_c_ast
       c_sname_t const *const sname = c_ast_find_name( cast_ast, C_VISIT_DOWN );
       if ( sname != NULL ) {
         print_error( &cast_ast->loc, "\"using\" type can not have a name\n" );
-        FREE( $name );
         PARSE_ABORT();
       }
 
-      c_sname_t temp_sname = c_sname_dup( &in_attr.scope_sname );
+      c_sname_t temp_sname = c_sname_dup( &parser->in_attr.scope_sname );
       c_sname_append_name( &temp_sname, $name );
 
       $$ = c_ast_patch_placeholder( $type_ast, cast_ast );
@@ -3568,7 +3660,7 @@ decl_list_c_opt
   : // in_attr: type_c_ast
     /* empty */
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "decl_list_c_opt", "<empty>" );
@@ -3581,15 +3673,15 @@ decl_list_c_opt
         //
         //      int
         //
-        c_loc_t const loc = lexer_loc();
+        c_loc_t const loc = lexer_loc( &parser->lexer );
         print_error( &loc, "declaration expected" );
-        print_is_a_keyword( lexer_printable_token() );
+        print_is_a_keyword( lexer_printable_token( &parser->lexer ) );
         EPUTC( '\n' );
         PARSE_ABORT();
       }
 
-      if ( in_attr.align.kind != C_ALIGNAS_NONE ) {
-        print_error( &in_attr.align.loc,
+      if ( parser->in_attr.align.kind != C_ALIGNAS_NONE ) {
+        print_error( &parser->in_attr.align.loc,
           "\"%s\" invalid here\n",
           alignas_name()
         );
@@ -3613,14 +3705,14 @@ decl_list_c_opt
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( type_ast ) );
-      c_typedef_english( &C_TYPEDEF_LIT( type_ast, C_ENG_DECL ), stdout );
+      c_typedef_english( &C_TYPEDEF_LIT( type_ast, C_ENG_DECL ), cdecl_fout );
       PUTC( '\n' );
     }
 
   | decl_list_c[decl_ast_list]
     {
       PARSE_ASSERT( c_ast_list_check( &$decl_ast_list ) );
-      c_ast_list_english( &$decl_ast_list, stdout );
+      c_ast_list_english( &$decl_ast_list, cdecl_fout );
     }
   ;
 
@@ -3641,25 +3733,29 @@ decl_c
   : // in_attr: alignas_specifier_c typename_flag_opt type_c_ast
     decl_c_astp[decl_astp]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "decl_c", "decl_c_astp" );
-      switch ( in_attr.align.kind ) {
+      switch ( parser->in_attr.align.kind ) {
         case C_ALIGNAS_NONE:
           break;
         case C_ALIGNAS_BYTES:
-          DUMP_INT( "in_attr__alignas_bytes", in_attr.align.bytes );
+          DUMP_INT( "in_attr__alignas_bytes", parser->in_attr.align.bytes );
           break;
         case C_ALIGNAS_TYPE:
-          DUMP_AST( "in_attr__alignas_type_ast", in_attr.align.type_ast );
+          DUMP_AST(
+            "in_attr__alignas_type_ast", parser->in_attr.align.type_ast
+          );
           break;
       } // switch
-      DUMP_BOOL( "in_attr__typename_flag_opt", in_attr.is_typename );
+      DUMP_BOOL( "in_attr__typename_flag_opt", parser->in_attr.is_typename );
       DUMP_AST( "in_attr__type_c_ast", type_ast );
       DUMP_AST_PAIR( "decl_c_astp", $decl_astp );
 
-      $$ = join_type_decl( ia_type_spec_ast( type_ast ), $decl_astp.ast );
+      $$ = join_type_decl(
+        parser, ia_type_spec_ast( parser, type_ast ), $decl_astp.ast
+      );
       PARSE_ASSERT( $$ != NULL );
 
       DUMP_AST( "$$_ast", $$ );
@@ -3718,7 +3814,7 @@ array_decl_c_astp
     decl2_c_astp[decl_astp] array_size_c_ast[array_ast]
     gnu_attribute_specifier_list_c_opt
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "array_decl_c_astp", "decl2_c_astp array_size_c_ast" );
@@ -3727,10 +3823,10 @@ array_decl_c_astp
       DUMP_AST( "array_size_c_ast", $array_ast );
 
       c_ast_set_parent(
-        c_ast_new_gc( K_PLACEHOLDER, &@decl_astp ), $array_ast
+        c_ast_new_gc( parser, K_PLACEHOLDER, &@decl_astp ), $array_ast
       );
 
-      c_ast_t *const of_ast = ia_type_spec_ast( type_ast );
+      c_ast_t *const of_ast = ia_type_spec_ast( parser, type_ast );
       if ( $decl_astp.target_ast != NULL ) {
         // array-of or function-like-ret type
         $$ = (c_ast_pair_t){
@@ -3753,31 +3849,31 @@ array_decl_c_astp
 array_size_c_ast
   : '[' rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->array.kind = C_ARRAY_EMPTY_SIZE;
     }
   | '[' Y_UINT_LIT[size] rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->array.kind = C_ARRAY_INT_SIZE;
       $$->array.size_int = $size;
     }
   | '[' Y_NAME[name] rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->array.kind = C_ARRAY_NAMED_SIZE;
       $$->array.size_name = $name;
     }
   | '[' type_qualifier_list_c_stid[qual_stids] rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->type.stids = c_tid_check( $qual_stids, C_TPID_STORE );
       $$->array.kind = C_ARRAY_EMPTY_SIZE;
     }
   | '[' type_qualifier_list_c_stid[qual_stids] static_stid_opt[static_stid]
     Y_UINT_LIT[size] rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->type.stids = c_tid_check( $qual_stids | $static_stid, C_TPID_STORE );
       $$->array.kind = C_ARRAY_INT_SIZE;
       $$->array.size_int = $size;
@@ -3785,21 +3881,21 @@ array_size_c_ast
   | '[' type_qualifier_list_c_stid[qual_stids] static_stid_opt[static_stid]
     Y_NAME[name] rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->type.stids = c_tid_check( $qual_stids | $static_stid, C_TPID_STORE );
       $$->array.kind = C_ARRAY_NAMED_SIZE;
       $$->array.size_name = $name;
     }
   | '[' type_qualifier_list_c_stid_opt[qual_stids] '*' rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->type.stids = c_tid_check( $qual_stids, C_TPID_STORE );
       $$->array.kind = C_ARRAY_VLA_STAR;
     }
   | '[' Y_static type_qualifier_list_c_stid_opt[qual_stids] Y_UINT_LIT[size]
     rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->type.stids =
         c_tid_check( TS_NON_EMPTY_ARRAY | $qual_stids, C_TPID_STORE );
       $$->array.kind = C_ARRAY_INT_SIZE;
@@ -3808,7 +3904,7 @@ array_size_c_ast
   | '[' Y_static type_qualifier_list_c_stid_opt[qual_stids] Y_NAME[name]
     rbracket_exp
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->type.stids =
         c_tid_check( TS_NON_EMPTY_ARRAY | $qual_stids, C_TPID_STORE );
       $$->array.kind = C_ARRAY_NAMED_SIZE;
@@ -3829,14 +3925,14 @@ block_decl_c_astp                       // Apple extension
       // A block AST has to be the type inherited attribute for decl_c_astp so
       // we have to create it here.
       //
-      ia_type_ast_push( c_ast_new_gc( K_APPLE_BLOCK, &@$ ) );
+      ia_type_ast_push( parser, c_ast_new_gc( parser, K_APPLE_BLOCK, &@$ ) );
     }
     type_qualifier_list_c_stid_opt[qual_stids] decl_c_astp[decl_astp] rparen_exp
     lparen_exp param_c_ast_list_opt[param_ast_list] ')'
     gnu_attribute_specifier_list_c_opt
     {
-      c_ast_t *const block_ast = ia_type_ast_pop();
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const block_ast = ia_type_ast_pop( parser );
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "block_decl_c_astp",
@@ -3853,7 +3949,7 @@ block_decl_c_astp                       // Apple extension
       c_ast_list_set_param_of( &$param_ast_list, block_ast );
       block_ast->block.param_ast_list = slist_move( &$param_ast_list );
 
-      c_ast_t *const ret_ast = ia_type_spec_ast( type_ast );
+      c_ast_t *const ret_ast = ia_type_spec_ast( parser, type_ast );
       if ( $decl_astp.target_ast != NULL ) {
         $$ = (c_ast_pair_t){
           $decl_astp.ast,
@@ -3894,7 +3990,7 @@ destructor_declaration_c
       DUMP_TID( "noexcept_c_stid_opt", $noexcept_stid );
       DUMP_TID( "func_equals_c_stid_opt", $equals_stid );
 
-      c_ast_t *const dtor_ast = c_ast_new_gc( K_DESTRUCTOR, &@$ );
+      c_ast_t *const dtor_ast = c_ast_new_gc( parser, K_DESTRUCTOR, &@$ );
       c_sname_append_name( &dtor_ast->sname, $name );
       dtor_ast->type.stids = c_tid_check(
         $virtual_stid | $qual_stids | $noexcept_stid | $equals_stid,
@@ -3905,7 +4001,7 @@ destructor_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( dtor_ast ) );
-      c_ast_english( dtor_ast, C_ENG_DECL, stdout );
+      c_ast_english( dtor_ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
   ;
@@ -3930,7 +4026,7 @@ file_scope_constructor_declaration_c
 
       c_sname_set_scope_type( &$sname, &C_TYPE_LIT_B( TB_class ) );
 
-      c_ast_t *const ctor_ast = c_ast_new_gc( K_CONSTRUCTOR, &@$ );
+      c_ast_t *const ctor_ast = c_ast_new_gc( parser, K_CONSTRUCTOR, &@$ );
       ctor_ast->sname = c_sname_move( &$sname );
       ctor_ast->type.stids = c_tid_check(
         $inline_stid | $qual_stids | $noexcept_stid,
@@ -3943,7 +4039,7 @@ file_scope_constructor_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( ctor_ast ) );
-      c_ast_english( ctor_ast, C_ENG_DECL, stdout );
+      c_ast_english( ctor_ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
   ;
@@ -3966,7 +4062,7 @@ file_scope_destructor_declaration_c
 
       c_sname_set_scope_type( &$sname, &C_TYPE_LIT_B( TB_class ) );
 
-      c_ast_t *const dtor_ast = c_ast_new_gc( K_DESTRUCTOR, &@$ );
+      c_ast_t *const dtor_ast = c_ast_new_gc( parser, K_DESTRUCTOR, &@$ );
       dtor_ast->sname = c_sname_move( &$sname );
       dtor_ast->type.stids = c_tid_check(
         $inline_stid | $qual_stids | $noexcept_stid,
@@ -3977,7 +4073,7 @@ file_scope_destructor_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( dtor_ast ) );
-      c_ast_english( dtor_ast, C_ENG_DECL, stdout );
+      c_ast_english( dtor_ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
   ;
@@ -4000,7 +4096,7 @@ func_decl_c_astp
     trailing_return_type_c_ast_opt[trailing_ret_ast]
     func_equals_c_stid_opt[equals_stid]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "func_decl_c_astp",
@@ -4076,7 +4172,9 @@ func_decl_c_astp
         !c_tid_is_any( func_stids, TS_FUNC_LIKE_NOT_CTOR );
 
       c_ast_t *const func_ast =
-        c_ast_new_gc( assume_constructor ? K_CONSTRUCTOR : K_FUNCTION, &@$ );
+        c_ast_new_gc(
+          parser, assume_constructor ? K_CONSTRUCTOR : K_FUNCTION, &@$
+        );
       func_ast->type.stids = c_tid_check( func_stids, C_TPID_STORE );
       c_ast_list_set_param_of( &$param_ast_list, func_ast );
       func_ast->func.param_ast_list = slist_move( &$param_ast_list );
@@ -4089,7 +4187,7 @@ func_decl_c_astp
         };
       }
       else {
-        c_ast_t *const ret_ast = ia_type_spec_ast( type_ast );
+        c_ast_t *const ret_ast = ia_type_spec_ast( parser, type_ast );
         if ( $decl_astp.target_ast != NULL ) {
           $$ = (c_ast_pair_t){
             $decl_astp.ast,
@@ -4155,13 +4253,15 @@ pc99_func_or_constructor_declaration_c
         //
         // it'll be recognized as such.
         //
-        c_ast_t *const csu_ast = c_ast_new_gc( K_CLASS_STRUCT_UNION, &@name );
+        c_ast_t *const csu_ast =
+          c_ast_new_gc( parser, K_CLASS_STRUCT_UNION, &@name );
         csu_ast->type.btids = TB_class;
-        c_sname_init_name( &csu_ast->csu.csu_sname, check_strdup( $name ) );
+        c_sname_init_name( &csu_ast->csu.csu_sname, $name );
         csu_ast->sname = c_sname_dup( &csu_ast->csu.csu_sname );
 
-        in_attr.typedef_rb = c_typedef_add( csu_ast, C_GIB_TYPEDEF );
-        MAYBE_UNUSED c_typedef_t *const csu_tdef = in_attr.typedef_rb->data;
+        parser->in_attr.typedef_rb = c_typedef_add( csu_ast, C_GIB_TYPEDEF );
+        MAYBE_UNUSED c_typedef_t *const csu_tdef =
+          parser->in_attr.typedef_rb->data;
         assert( csu_tdef->ast == csu_ast );
       }
     }
@@ -4186,13 +4286,13 @@ pc99_func_or_constructor_declaration_c
         // Note that we free only the typedef and not its AST; its AST will be
         // garbage collected.
         //
-        free( c_typedef_remove( in_attr.typedef_rb ) );
+        free( c_typedef_remove( parser->in_attr.typedef_rb ) );
 
         //
         // In C++, encountering a name followed by '(' declares an in-class
         // constructor.
         //
-        ast = c_ast_new_gc( K_CONSTRUCTOR, &@$ );
+        ast = c_ast_new_gc( parser, K_CONSTRUCTOR, &@$ );
       }
       else {
         if ( UNSUPPORTED( IMPLICIT_int ) ) {
@@ -4206,7 +4306,6 @@ pc99_func_or_constructor_declaration_c
             c_tid_name_error( TB_int ),
             C_LANG_WHICH( IMPLICIT_int )
           );
-          FREE( $name );
           PARSE_ABORT();
         }
 
@@ -4216,10 +4315,10 @@ pc99_func_or_constructor_declaration_c
         //
         //      power(x, n)             /* raise x to n-th power; n > 0 */
         //
-        c_ast_t *const ret_ast = c_ast_new_gc( K_BUILTIN, &@name );
+        c_ast_t *const ret_ast = c_ast_new_gc( parser, K_BUILTIN, &@name );
         ret_ast->type.btids = TB_int;
 
-        ast = c_ast_new_gc( K_FUNCTION, &@$ );
+        ast = c_ast_new_gc( parser, K_FUNCTION, &@$ );
         c_ast_set_parent( ret_ast, ast );
       }
 
@@ -4233,7 +4332,7 @@ pc99_func_or_constructor_declaration_c
       DUMP_END();
 
       PARSE_ASSERT( c_ast_check( ast ) );
-      c_ast_english( ast, C_ENG_DECL, stdout );
+      c_ast_english( ast, C_ENG_DECL, cdecl_fout );
       PUTC( '\n' );
     }
   ;
@@ -4247,12 +4346,12 @@ rparen_func_qualifier_list_c_stid_opt
         // declarations.  Now that ')' has been parsed, we're within one, so
         // set the keyword context to C_KW_CTX_MBR_FUNC.
         //
-        lexer_keyword_ctx = C_KW_CTX_MBR_FUNC;
+        parser->lexer.keyword_ctx = C_KW_CTX_MBR_FUNC;
       }
     }
     func_qualifier_list_c_stid_opt[stids]
     {
-      lexer_keyword_ctx = C_KW_CTX_DEFAULT;
+      parser->lexer.keyword_ctx = C_KW_CTX_DEFAULT;
       $$ = $stids;
     }
   ;
@@ -4336,7 +4435,10 @@ noexcept_bool_stid_exp
 trailing_return_type_c_ast_opt
   : /* empty */                   { $$ = NULL; }
   | // in_attr: type_c_ast
-    Y_MINUS_GREATER type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+    Y_MINUS_GREATER type_c_ast[type_ast]
+    {
+      ia_type_ast_push( parser, $type_ast );
+    }
     cast_c_astp_opt[cast_astp]
     { //
       // The function trailing return-type syntax is supported only in C++11
@@ -4352,8 +4454,8 @@ trailing_return_type_c_ast_opt
         PARSE_ABORT();
       }
 
-      ia_type_ast_pop();
-      c_ast_t const *const ret_ast = ia_type_ast_peek();
+      ia_type_ast_pop( parser );
+      c_ast_t const *const ret_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "trailing_return_type_c_ast_opt",
@@ -4467,11 +4569,11 @@ param_c_ast
      */
   : this_stid_opt[this_stid] type_c_ast[type_ast]
     {
-      ia_type_ast_push( $type_ast );
+      ia_type_ast_push( parser, $type_ast );
     }
     cast_c_astp_opt[cast_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "param_c_ast", "this_stid_opt type_c_ast cast_c_astp_opt" );
@@ -4489,7 +4591,7 @@ param_c_ast
         //    converted to an expression that has type "pointer to function
         //    returning type."
         //
-        $$ = c_ast_pointer( $$, &gc_ast_list );
+        $$ = c_ast_pointer( $$, &parser->gc_ast_arena );
       }
 
       PARSE_ASSERT( c_type_add_tid( &$$->type, $this_stid, &@this_stid ) );
@@ -4511,7 +4613,7 @@ param_c_ast
       DUMP_START();
       DUMP_PROD( "param_c_ast", "..." );
 
-      $$ = c_ast_new_gc( K_VARIADIC, &@$ );
+      $$ = c_ast_new_gc( parser, K_VARIADIC, &@$ );
 
       DUMP_AST( "$$_ast", $$ );
       DUMP_END();
@@ -4531,13 +4633,13 @@ param_c_ast_exp
 nested_decl_c_astp
   : '('
     {
-      ia_type_ast_push( c_ast_new_gc( K_PLACEHOLDER, &@$ ) );
-      ++in_attr.ast_depth;
+      ia_type_ast_push( parser, c_ast_new_gc( parser, K_PLACEHOLDER, &@$ ) );
+      ++parser->in_attr.ast_depth;
     }
     decl_c_astp[decl_astp] rparen_exp
     {
-      ia_type_ast_pop();
-      --in_attr.ast_depth;
+      ia_type_ast_pop( parser );
+      --parser->in_attr.ast_depth;
 
       DUMP_START();
       DUMP_PROD( "nested_decl_c_astp", "'(' decl_c_astp ')'" );
@@ -4564,7 +4666,7 @@ oper_decl_c_astp
     func_equals_c_stid_opt[equals_stid]
     {
       c_operator_t const *const operator = c_op_get( $op_id );
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "oper_decl_c_astp",
@@ -4587,7 +4689,7 @@ oper_decl_c_astp
       c_tid_t const oper_stids =
         $qual_stids | $ref_qual_stid | $noexcept_stid | $equals_stid;
 
-      c_ast_t *const oper_ast = c_ast_new_gc( K_OPERATOR, &@$ );
+      c_ast_t *const oper_ast = c_ast_new_gc( parser, K_OPERATOR, &@$ );
       oper_ast->sname = c_sname_move( &$sname );
       oper_ast->type.stids = c_tid_check( oper_stids, C_TPID_STORE );
       c_ast_list_set_param_of( &$param_ast_list, oper_ast );
@@ -4595,7 +4697,7 @@ oper_decl_c_astp
       oper_ast->oper.operator = operator;
 
       c_ast_t *const ret_ast =
-        IF_ELSE( $trailing_ret_ast, ia_type_spec_ast( type_ast ) );
+        IF_ELSE( $trailing_ret_ast, ia_type_spec_ast( parser, type_ast ) );
 
       $$ = (c_ast_pair_t){
         c_ast_add_func( type_ast, oper_ast, ret_ast ),
@@ -4610,10 +4712,10 @@ oper_decl_c_astp
 /// Gibberish C/C++ pointer declaration ///////////////////////////////////////
 
 pointer_decl_c_astp
-  : pointer_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : pointer_type_c_ast[type_ast] { ia_type_ast_push( parser, $type_ast ); }
     decl_c_astp[decl_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "pointer_decl_c_astp", "pointer_type_c_ast decl_c_astp" );
@@ -4633,16 +4735,16 @@ pointer_type_c_ast
   : // in_attr: type_c_ast
     '*' type_qualifier_list_c_stid_opt[qual_stids]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "pointer_type_c_ast", "* type_qualifier_list_c_stid_opt" );
       DUMP_AST( "in_attr__type_c_ast", type_ast );
       DUMP_TID( "type_qualifier_list_c_stid_opt", $qual_stids );
 
-      $$ = c_ast_new_gc( K_POINTER, &@$ );
+      $$ = c_ast_new_gc( parser, K_POINTER, &@$ );
       $$->type.stids = c_tid_check( $qual_stids, C_TPID_STORE );
-      c_ast_set_parent( ia_type_spec_ast( type_ast ), $$ );
+      c_ast_set_parent( ia_type_spec_ast( parser, type_ast ), $$ );
 
       DUMP_AST( "$$_ast", $$ );
       DUMP_END();
@@ -4665,10 +4767,13 @@ pc99_pointer_decl_list_c
   ;
 
 pc99_pointer_decl_c
-  : pc99_pointer_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : pc99_pointer_type_c_ast[type_ast]
+    {
+      ia_type_ast_push( parser, $type_ast );
+    }
     decl_c_astp[decl_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "pc99_pointer_decl_c",
@@ -4702,7 +4807,7 @@ pc99_pointer_type_c_ast
         PARSE_ABORT();
       }
 
-      c_ast_t *type_ast = ia_type_ast_peek();
+      c_ast_t *type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "pc99_pointer_type_c_ast",
@@ -4711,12 +4816,14 @@ pc99_pointer_type_c_ast
       DUMP_TID( "type_qualifier_list_c_stid_opt", $qual_stids );
 
       if ( type_ast == NULL ) {
-        type_ast = c_ast_new_gc( K_BUILTIN, &@star );
+        type_ast = c_ast_new_gc( parser, K_BUILTIN, &@star );
         type_ast->type.btids = TB_int;
-        ia_type_ast_push( type_ast );
+        ia_type_ast_push( parser, type_ast );
       }
 
-      $$ = c_ast_pointer( ia_type_spec_ast( type_ast ), &gc_ast_list );
+      $$ = c_ast_pointer(
+        ia_type_spec_ast( parser, type_ast ), &parser->gc_ast_arena
+      );
       $$->type.stids = c_tid_check( $qual_stids, C_TPID_STORE );
 
       DUMP_AST( "$$_ast", $$ );
@@ -4727,10 +4834,13 @@ pc99_pointer_type_c_ast
 /// Gibberish C++ pointer-to-member declaration ///////////////////////////////
 
 pointer_to_member_decl_c_astp
-  : pointer_to_member_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : pointer_to_member_type_c_ast[type_ast]
+    {
+      ia_type_ast_push( parser, $type_ast );
+    }
     decl_c_astp[decl_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "pointer_to_member_decl_c_astp",
@@ -4750,7 +4860,7 @@ pointer_to_member_type_c_ast
   : // in_attr: type_c_ast
     any_sname_c[sname] Y_COLON2_STAR '*' cv_qualifier_list_stid_opt[qual_stids]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "pointer_to_member_type_c_ast",
@@ -4759,7 +4869,7 @@ pointer_to_member_type_c_ast
       DUMP_SNAME( "sname", $sname );
       DUMP_TID( "cv_qualifier_list_stid_opt", $qual_stids );
 
-      $$ = c_ast_new_gc( K_POINTER_TO_MEMBER, &@$ );
+      $$ = c_ast_new_gc( parser, K_POINTER_TO_MEMBER, &@$ );
 
       c_type_t scope_type = *c_sname_local_type( &$sname );
       if ( !c_tid_is_any( scope_type.btids, TB_ANY_SCOPE ) ) {
@@ -4777,7 +4887,7 @@ pointer_to_member_type_c_ast
       $$->type = c_type_or( &C_TYPE_LIT_S( $qual_stids ), &scope_type );
 
       $$->ptr_mbr.class_sname = c_sname_move( &$sname );
-      c_ast_set_parent( c_ast_dup_gc( type_ast ), $$ );
+      c_ast_set_parent( c_ast_dup_gc( parser, type_ast ), $$ );
 
       DUMP_AST( "$$_ast", $$ );
       DUMP_END();
@@ -4787,10 +4897,10 @@ pointer_to_member_type_c_ast
 /// Gibberish C++ reference declaration ///////////////////////////////////////
 
 reference_decl_c_astp
-  : reference_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : reference_type_c_ast[type_ast] { ia_type_ast_push( parser, $type_ast ); }
     decl_c_astp[decl_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "reference_decl_c_astp", "reference_type_c_ast decl_c_astp" );
@@ -4809,16 +4919,16 @@ reference_type_c_ast
   : // in_attr: type_c_ast
     '&' type_qualifier_list_c_stid_opt[qual_stids]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "reference_type_c_ast", "&" );
       DUMP_AST( "in_attr__type_c_ast", type_ast );
       DUMP_TID( "type_qualifier_list_c_stid_opt", $qual_stids );
 
-      $$ = c_ast_new_gc( K_REFERENCE, &@$ );
+      $$ = c_ast_new_gc( parser, K_REFERENCE, &@$ );
       $$->type.stids = c_tid_check( $qual_stids, C_TPID_STORE );
-      c_ast_set_parent( ia_type_spec_ast( type_ast ), $$ );
+      c_ast_set_parent( ia_type_spec_ast( parser, type_ast ), $$ );
 
       DUMP_AST( "$$_ast", $$ );
       DUMP_END();
@@ -4827,16 +4937,16 @@ reference_type_c_ast
   | // in_attr: type_c_ast
     Y_AMPER2 type_qualifier_list_c_stid_opt[qual_stids]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "reference_type_c_ast", "&&" );
       DUMP_AST( "in_attr__type_c_ast", type_ast );
       DUMP_TID( "type_qualifier_list_c_stid_opt", $qual_stids );
 
-      $$ = c_ast_new_gc( K_RVALUE_REFERENCE, &@$ );
+      $$ = c_ast_new_gc( parser, K_RVALUE_REFERENCE, &@$ );
       $$->type.stids = c_tid_check( $qual_stids, C_TPID_STORE );
-      c_ast_set_parent( ia_type_spec_ast( type_ast ), $$ );
+      c_ast_set_parent( ia_type_spec_ast( parser, type_ast ), $$ );
 
       DUMP_AST( "$$_ast", $$ );
       DUMP_END();
@@ -4849,7 +4959,7 @@ typedef_type_decl_c_ast
   : // in_attr: type_c_ast
     typedef_type_c_ast[tdef_ast]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "typedef_type_decl_c_ast", "typedef_type_c_ast" );
@@ -4921,7 +5031,7 @@ typedef_type_decl_c_ast
             "\"%s\": previously declared as type \"",
             c_sname_full_name( &raw_tdef_ast->sname )
           );
-          print_type_ast( tdef, stderr );
+          print_type_ast( tdef, cdecl_ferr );
           EPUTS( "\"\n" );
           PARSE_ABORT();
         }
@@ -4929,7 +5039,7 @@ typedef_type_decl_c_ast
         //
         // We have to duplicate the type to set the current location.
         //
-        $$ = c_ast_dup_gc( raw_tdef_ast );
+        $$ = c_ast_dup_gc( parser, raw_tdef_ast );
         $$->loc = $tdef_ast->loc;
       }
 
@@ -4944,15 +5054,15 @@ user_defined_conversion_decl_c_astp
   : // in_attr: type_c_ast
     oper_sname_c_opt[sname] Y_operator type_c_ast[to_ast]
     {
-      ia_type_ast_push( $to_ast );
+      ia_type_ast_push( parser, $to_ast );
     }
     udc_decl_c_ast_opt[decl_ast] lparen_exp
     rparen_func_qualifier_list_c_stid_opt[qual_stids]
     noexcept_c_stid_opt[noexcept_stid] func_equals_c_stid_opt[equals_stid]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "user_defined_conversion_decl_c_astp",
@@ -4968,7 +5078,7 @@ user_defined_conversion_decl_c_astp
       DUMP_TID( "noexcept_c_stid_opt", $noexcept_stid );
       DUMP_TID( "func_equals_c_stid_opt", $equals_stid );
 
-      c_ast_t *const udc_ast = c_ast_new_gc( K_UDEF_CONV, &@$ );
+      c_ast_t *const udc_ast = c_ast_new_gc( parser, K_UDEF_CONV, &@$ );
       udc_ast->sname = c_sname_move( &$sname );
       udc_ast->type.stids = c_tid_check(
         $qual_stids | $noexcept_stid | $equals_stid,
@@ -4994,7 +5104,7 @@ user_defined_literal_decl_c_astp
     noexcept_c_stid_opt[noexcept_stid]
     trailing_return_type_c_ast_opt[trailing_ret_ast]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "user_defined_literal_decl_c_astp",
@@ -5011,7 +5121,7 @@ user_defined_literal_decl_c_astp
       c_sname_set( &type_ast->sname, &$sname );
       c_sname_append_name( &type_ast->sname, $name );
 
-      c_ast_t *const udl_ast = c_ast_new_gc( K_UDEF_LIT, &@$ );
+      c_ast_t *const udl_ast = c_ast_new_gc( parser, K_UDEF_LIT, &@$ );
       udl_ast->type.stids = c_tid_check( $noexcept_stid, C_TPID_STORE );
       c_ast_list_set_param_of( &$param_ast_list, udl_ast );
       udl_ast->udef_lit.param_ast_list = slist_move( &$param_ast_list );
@@ -5064,7 +5174,7 @@ array_cast_c_astp
   : // in_attr: type_c_ast
     cast_c_astp_opt[cast_astp] array_size_c_ast[array_ast]
     {
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "array_cast_c_astp", "cast_c_astp_opt array_size_c_ast" );
@@ -5073,10 +5183,10 @@ array_cast_c_astp
       DUMP_AST( "array_size_c_ast", $array_ast );
 
       c_ast_set_parent(
-        c_ast_new_gc( K_PLACEHOLDER, &@cast_astp ), $array_ast
+        c_ast_new_gc( parser, K_PLACEHOLDER, &@cast_astp ), $array_ast
       );
 
-      c_ast_t *const of_ast = ia_type_spec_ast( type_ast );
+      c_ast_t *const of_ast = ia_type_spec_ast( parser, type_ast );
       if ( $cast_astp.target_ast != NULL ) {
         // array-of or function-like-ret type
         $$ = (c_ast_pair_t){
@@ -5105,13 +5215,13 @@ block_cast_c_astp                       // Apple extension
       // A block AST has to be the type inherited attribute for cast_c_astp_opt
       // so we have to create it here.
       //
-      ia_type_ast_push( c_ast_new_gc( K_APPLE_BLOCK, &@$ ) );
+      ia_type_ast_push( parser, c_ast_new_gc( parser, K_APPLE_BLOCK, &@$ ) );
     }
     type_qualifier_list_c_stid_opt[qual_stids] cast_c_astp_opt[cast_astp]
     rparen_exp lparen_exp param_c_ast_list_opt[param_ast_list] ')'
     {
-      c_ast_t *const block_ast = ia_type_ast_pop();
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const block_ast = ia_type_ast_pop( parser );
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "block_cast_c_astp",
@@ -5128,7 +5238,7 @@ block_cast_c_astp                       // Apple extension
       c_ast_list_set_param_of( &$param_ast_list, block_ast );
       block_ast->block.param_ast_list = slist_move( &$param_ast_list );
 
-      c_ast_t *const ret_ast = ia_type_spec_ast( type_ast );
+      c_ast_t *const ret_ast = ia_type_spec_ast( parser, type_ast );
       if ( $cast_astp.target_ast != NULL ) {
         $$ = (c_ast_pair_t){
           $cast_astp.ast,
@@ -5156,7 +5266,7 @@ func_cast_c_astp
     noexcept_c_stid_opt[noexcept_stid]
     trailing_return_type_c_ast_opt[trailing_ret_ast]
     {
-      c_ast_t *ret_ast = ia_type_ast_peek();
+      c_ast_t *ret_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "func_cast_c_astp",
@@ -5198,7 +5308,7 @@ func_cast_c_astp
         ret_ast = cast_ast;
       }
 
-      c_ast_t *const func_ast = c_ast_new_gc( K_FUNCTION, &@$ );
+      c_ast_t *const func_ast = c_ast_new_gc( parser, K_FUNCTION, &@$ );
       c_tid_t const func_stids = $ref_qual_stids | $noexcept_stid;
       func_ast->type.stids = c_tid_check( func_stids, C_TPID_STORE );
       c_ast_list_set_param_of( &$param_ast_list, func_ast );
@@ -5231,15 +5341,15 @@ func_cast_c_astp
 nested_cast_c_astp
   : '('
     {
-      ia_type_ast_push( c_ast_new_gc( K_PLACEHOLDER, &@$ ) );
-      ++in_attr.ast_depth;
+      ia_type_ast_push( parser, c_ast_new_gc( parser, K_PLACEHOLDER, &@$ ) );
+      ++parser->in_attr.ast_depth;
     }
     cast_c_astp_opt[cast_astp] rparen_exp
     {
-      ia_type_ast_pop();
-      --in_attr.ast_depth;
+      ia_type_ast_pop( parser );
+      --parser->in_attr.ast_depth;
 
-      c_ast_t *const type_ast = ia_type_ast_peek();
+      c_ast_t *const type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "nested_cast_c_astp", "'(' cast_c_astp_opt ')'" );
@@ -5259,7 +5369,7 @@ nested_cast_c_astp
         // param_c_ast, this will be converted into a "pointer to function
         // returning int".)
         //
-        $$.ast = c_ast_new_gc( K_FUNCTION, &@$ );
+        $$.ast = c_ast_new_gc( parser, K_FUNCTION, &@$ );
         c_ast_set_parent( type_ast, $$.ast );
       } else {
         $$.ast->loc = @$;
@@ -5273,10 +5383,10 @@ nested_cast_c_astp
 /// Gibberish C/C++ pointer cast //////////////////////////////////////////////
 
 pointer_cast_c_astp
-  : pointer_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : pointer_type_c_ast[type_ast] { ia_type_ast_push( parser, $type_ast ); }
     cast_c_astp_opt[cast_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "pointer_cast_c_astp", "pointer_type_c_ast cast_c_astp_opt" );
@@ -5296,10 +5406,13 @@ pointer_cast_c_astp
 /// Gibberish C/C++ pointer-to-member cast ////////////////////////////////////
 
 pointer_to_member_cast_c_astp
-  : pointer_to_member_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : pointer_to_member_type_c_ast[type_ast]
+    {
+      ia_type_ast_push( parser, $type_ast );
+    }
     cast_c_astp_opt[cast_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "pointer_to_member_cast_c_astp",
@@ -5320,10 +5433,10 @@ pointer_to_member_cast_c_astp
 /// Gibberish C/C++ reference cast ////////////////////////////////////////////
 
 reference_cast_c_astp
-  : reference_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : reference_type_c_ast[type_ast] { ia_type_ast_push( parser, $type_ast ); }
     cast_c_astp_opt[cast_astp]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "reference_cast_c_astp",
@@ -5362,10 +5475,10 @@ udc_decl_c_ast
   ;
 
 pointer_udc_decl_c_ast
-  : pointer_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : pointer_type_c_ast[type_ast] { ia_type_ast_push( parser, $type_ast ); }
     udc_decl_c_ast_opt[decl_ast]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "pointer_udc_decl_c_ast",
@@ -5381,10 +5494,13 @@ pointer_udc_decl_c_ast
   ;
 
 pointer_to_member_udc_decl_c_ast
-  : pointer_to_member_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : pointer_to_member_type_c_ast[type_ast]
+    {
+      ia_type_ast_push( parser, $type_ast );
+    }
     udc_decl_c_ast_opt[decl_ast]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "pointer_to_member_udc_decl_c_ast",
@@ -5400,10 +5516,10 @@ pointer_to_member_udc_decl_c_ast
   ;
 
 reference_udc_decl_c_ast
-  : reference_type_c_ast[type_ast] { ia_type_ast_push( $type_ast ); }
+  : reference_type_c_ast[type_ast] { ia_type_ast_push( parser, $type_ast ); }
     udc_decl_c_ast_opt[decl_ast]
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "reference_udc_decl_c_ast",
@@ -5452,7 +5568,7 @@ type_c_ast
 
       PARSE_ASSERT( c_type_add( &type, &$mod_list_type, &@mod_list_type ) );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@$ );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@$ );
       $$->type = type;
 
       DUMP_AST( "$$_ast", $$ );
@@ -5530,7 +5646,7 @@ type_modifier_c_type
       // see the comment in type_modifier_base_type about "register").
       //
       if ( $$.stids != TS_register )
-        lexer_find &= ~LEXER_FIND_TYPES;
+        parser->lexer.find &= ~LEXER_FIND_TYPES;
     }
   | type_qualifier_c_stid         { $$ = C_TYPE_LIT_S( $1 ); }
   | storage_class_c_type
@@ -5605,11 +5721,11 @@ atomic_builtin_typedef_type_c_ast
 atomic_specifier_type_c_ast
   : Y__Atomic_SPEC[atomic] lparen_exp type_c_ast[type_ast]
     {
-      ia_type_ast_push( $type_ast );
+      ia_type_ast_push( parser, $type_ast );
     }
     cast_c_astp_opt[cast_astp] rparen_exp
     {
-      ia_type_ast_pop();
+      ia_type_ast_pop( parser );
 
       DUMP_START();
       DUMP_PROD( "atomic_specifier_type_c_ast",
@@ -5658,7 +5774,7 @@ builtin_type_c_ast
       DUMP_PROD( "builtin_type_c_ast", "builtin_no_BitInt_c_btid" );
       DUMP_TID( "builtin_no_BitInt_c_btid", $btid );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@$ );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@$ );
       $$->type.btids = c_tid_check( $btid, C_TPID_BASE );
 
       DUMP_AST( "$$_ast", $$ );
@@ -5670,7 +5786,7 @@ builtin_type_c_ast
       DUMP_PROD( "builtin_type_c_ast", "_BitInt '(' uint_lit_exp ')'" );
       DUMP_INT( "int", $width );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@$ );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@$ );
       $$->type.btids = TB__BitInt;
       $$->builtin.BitInt.width = $width;
 
@@ -5730,7 +5846,7 @@ class_struct_union_c_ast
       DUMP_TID( "attribute_specifier_list_c_atid_opt", $atids );
       DUMP_SNAME( "any_sname_c", $sname );
 
-      $$ = c_ast_new_gc( K_CLASS_STRUCT_UNION, &@$ );
+      $$ = c_ast_new_gc( parser, K_CLASS_STRUCT_UNION, &@$ );
       $$->type.btids = c_tid_check( $csu_btid, C_TPID_BASE );
       $$->type.atids = c_tid_check( $atids, C_TPID_ATTR );
       $$->csu.csu_sname = c_sname_move( &$sname );
@@ -5764,7 +5880,7 @@ enum_c_ast
       DUMP_SNAME( "any_sname_c", $sname );
       DUMP_AST( "enum_fixed_type_c_ast_opt", $fixed_type_ast );
 
-      $$ = c_ast_new_gc( K_ENUM, &@$ );
+      $$ = c_ast_new_gc( parser, K_ENUM, &@$ );
       $$->type.btids = c_tid_check( $enum_btids, C_TPID_BASE );
       $$->type.atids = c_tid_check( $atids, C_TPID_ATTR );
       c_ast_set_parent( $fixed_type_ast, $$ );
@@ -5818,7 +5934,7 @@ enum_fixed_type_c_ast
                  "enum_fixed_type_modifier_list_btid" );
       DUMP_TID( "enum_fixed_type_modifier_list_btid", $btids );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@btids );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@btids );
       $$->type.btids = c_tid_check( $btids, C_TPID_BASE );
 
       DUMP_AST( "$$_ast", $$ );
@@ -6054,7 +6170,7 @@ storage_class_c_type
       if ( UNSUPPORTED( _Noreturn ) ) {
         print_error( &@_Noreturn_atid,
           "\"%s\" keyword not supported%s",
-          lexer_token, C_LANG_WHICH( _Noreturn )
+          parser->lexer.token, C_LANG_WHICH( _Noreturn )
         );
         print_hint(
           "%snoreturn%s", other_token_c( "[[" ), other_token_c( "]]" )
@@ -6064,7 +6180,7 @@ storage_class_c_type
       if ( !OPT_LANG_IS( _Noreturn_NOT_DEPRECATED ) ) {
         print_warning( &@_Noreturn_atid,
           "\"%s\" is deprecated%s",
-          lexer_token, C_LANG_WHICH( _Noreturn_NOT_DEPRECATED )
+          parser->lexer.token, C_LANG_WHICH( _Noreturn_NOT_DEPRECATED )
         );
         print_hint(
           "%snoreturn%s", other_token_c( "[[" ), other_token_c( "]]" )
@@ -6105,11 +6221,11 @@ attribute_specifier_list_c_atid
         );
         PARSE_ABORT();
       }
-      lexer_keyword_ctx = C_KW_CTX_ATTRIBUTE;
+      parser->lexer.keyword_ctx = C_KW_CTX_ATTRIBUTE;
     }
     using_opt attribute_list_c_atid_opt[atids] ']' rbracket_exp
     {
-      lexer_keyword_ctx = C_KW_CTX_DEFAULT;
+      parser->lexer.keyword_ctx = C_KW_CTX_DEFAULT;
 
       DUMP_START();
       DUMP_PROD( "attribute_specifier_list_c_atid",
@@ -6134,7 +6250,6 @@ using_opt
       print_warning( &@Y_using,
         "\"using\" in attributes not supported by %s (ignoring)\n", CDECL
       );
-      free( $name );
     }
   ;
 
@@ -6247,11 +6362,11 @@ gnu_attribute_specifier_c
       // Temporariy disabling finding keywords allows GNU attributes that are C
       // keywords (e.g., const) to be found as ordinary string literals.
       //
-      lexer_find &= ~LEXER_FIND_C_KEYWORDS;
+      parser->lexer.find &= ~LEXER_FIND_C_KEYWORDS;
     }
     lparen_exp lparen_exp gnu_attribute_list_c_opt ')' rparen_exp
     {
-      lexer_find |= LEXER_FIND_C_KEYWORDS;
+      parser->lexer.find |= LEXER_FIND_C_KEYWORDS;
     }
   ;
 
@@ -6266,10 +6381,7 @@ gnu_attribuet_list_c
   ;
 
 gnu_attribute_c_exp
-  : Y_NAME[name] gnu_attribute_decl_arg_list_c_opt
-    {
-      free( $name );
-    }
+  : Y_NAME gnu_attribute_decl_arg_list_c_opt
   | error
     {
       elaborate_error( "attribute name expected" );
@@ -6292,7 +6404,7 @@ gnu_attribute_arg_list_c
   ;
 
 gnu_attribute_arg_c
-  : Y_NAME                        { free( $1 ); }
+  : Y_NAME
   | Y_UINT_LIT
   | Y_CHAR_LIT                    { free( $1 ); }
   | Y_STR_LIT                     { free( $1 ); }
@@ -6313,11 +6425,11 @@ msc_attribute_specifier_c
     {
       attr_syntax_not_supported( L_MSC___declspec, &@1 );
       // See comment in gnu_attribute_specifier_c.
-      lexer_find &= ~LEXER_FIND_C_KEYWORDS;
+      parser->lexer.find &= ~LEXER_FIND_C_KEYWORDS;
     }
     lparen_exp msc_attribute_list_c_opt ')'
     {
-      lexer_find |= LEXER_FIND_C_KEYWORDS;
+      parser->lexer.find |= LEXER_FIND_C_KEYWORDS;
     }
   ;
 
@@ -6376,7 +6488,7 @@ array_decl_english_ast
       DUMP_STR( "name_opt", $name );
       DUMP_AST( "decl_english_ast", $decl_ast );
 
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       if ( $name == NULL ) {
         $$->array.kind = C_ARRAY_VLA_STAR;
       } else {
@@ -6393,24 +6505,24 @@ array_decl_english_ast
 array_size_decl_ast
   : /* empty */
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->array.kind = C_ARRAY_EMPTY_SIZE;
     }
   | Y_UINT_LIT[size]
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->array.kind = C_ARRAY_INT_SIZE;
       $$->array.size_int = $size;
     }
   | Y_NAME[name]
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->array.kind = C_ARRAY_NAMED_SIZE;
       $$->array.size_name = $name;
     }
   | '*'
     {
-      $$ = c_ast_new_gc( K_ARRAY, &@$ );
+      $$ = c_ast_new_gc( parser, K_ARRAY, &@$ );
       $$->array.kind = C_ARRAY_VLA_STAR;
     }
   ;
@@ -6434,7 +6546,7 @@ block_decl_english_ast                  // Apple extension
       DUMP_AST_LIST( "paren_param_decl_list_english_opt", $param_ast_list );
       DUMP_AST( "returning_english_ast_opt", $ret_ast );
 
-      $$ = c_ast_new_gc( K_APPLE_BLOCK, &@$ );
+      $$ = c_ast_new_gc( parser, K_APPLE_BLOCK, &@$ );
       c_ast_list_set_param_of( &$param_ast_list, $$ );
       $$->block.param_ast_list = slist_move( &$param_ast_list );
       c_ast_set_parent( $ret_ast, $$ );
@@ -6454,7 +6566,7 @@ constructor_decl_english_ast
                  "CONSTRUCTOR paren_param_decl_list_english_opt" );
       DUMP_AST_LIST( "paren_param_decl_list_english_opt", $param_ast_list );
 
-      $$ = c_ast_new_gc( K_CONSTRUCTOR, &@$ );
+      $$ = c_ast_new_gc( parser, K_CONSTRUCTOR, &@$ );
       c_ast_list_set_param_of( &$param_ast_list, $$ );
       $$->ctor.param_ast_list = slist_move( &$param_ast_list );
 
@@ -6471,7 +6583,7 @@ destructor_decl_english_ast
       DUMP_START();
       DUMP_PROD( "destructor_decl_english_ast", "DESTRUCTOR" );
 
-      $$ = c_ast_new_gc( K_DESTRUCTOR, &@$ );
+      $$ = c_ast_new_gc( parser, K_DESTRUCTOR, &@$ );
 
       DUMP_AST( "$$_ast", $$ );
       DUMP_END();
@@ -6502,7 +6614,7 @@ func_decl_english_ast
       DUMP_AST_LIST( "paren_param_decl_list_english_opt", $param_ast_list );
       DUMP_AST( "returning_english_ast_opt", $ret_ast );
 
-      $$ = c_ast_new_gc( K_FUNCTION, &@$ );
+      $$ = c_ast_new_gc( parser, K_FUNCTION, &@$ );
       $$->type = $qual_type;
       c_ast_list_set_param_of( &$param_ast_list, $$ );
       $$->func.param_ast_list = slist_move( &$param_ast_list );
@@ -6585,7 +6697,7 @@ param_decl_list_english
       DUMP_AST( "decl_english_ast", $decl_ast );
 
       if ( $decl_ast->kind == K_FUNCTION ) // see the comment in param_c_ast
-        $decl_ast = c_ast_pointer( $decl_ast, &gc_ast_list );
+        $decl_ast = c_ast_pointer( $decl_ast, &parser->gc_ast_arena );
 
       slist_init( &$$ );
       slist_push_back( &$$, $decl_ast );
@@ -6619,7 +6731,7 @@ returning_english_ast_opt
       DUMP_START();
       DUMP_PROD( "returning_english_ast_opt", "<empty>" );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@$ );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@$ );
       // see the comment in "type_c_ast"
       $$->type.btids = OPT_LANG_IS( IMPLICIT_int ) ? TB_int : TB_void;
 
@@ -6843,7 +6955,7 @@ pointer_decl_english_ast
         PARSE_ABORT();
       }
 
-      $$ = c_ast_new_gc( K_POINTER, &@$ );
+      $$ = c_ast_new_gc( parser, K_POINTER, &@$ );
       c_ast_set_parent( $decl_ast, $$ );
 
       DUMP_AST( "$$_ast", $$ );
@@ -6866,7 +6978,7 @@ pointer_decl_english_ast
       DUMP_SNAME( "sname_english_exp", $sname );
       DUMP_AST( "decl_english_ast", $decl_ast );
 
-      $$ = c_ast_new_gc( K_POINTER_TO_MEMBER, &@$ );
+      $$ = c_ast_new_gc( parser, K_POINTER_TO_MEMBER, &@$ );
       $$->ptr_mbr.class_sname = c_sname_move( &$sname );
       c_ast_set_parent( $decl_ast, $$ );
       PARSE_ASSERT( c_type_add_tid( &$$->type, $csu_btid, &@csu_btid ) );
@@ -6908,12 +7020,12 @@ reference_decl_english_ast
 reference_english_ast
   : Y_reference
     {
-      $$ = c_ast_new_gc( K_REFERENCE, &@$ );
+      $$ = c_ast_new_gc( parser, K_REFERENCE, &@$ );
     }
 
   | Y_rvalue reference_exp
     {
-      $$ = c_ast_new_gc( K_RVALUE_REFERENCE, &@$ );
+      $$ = c_ast_new_gc( parser, K_RVALUE_REFERENCE, &@$ );
     }
   ;
 
@@ -6946,7 +7058,7 @@ user_defined_literal_decl_english_ast
       DUMP_AST_LIST( "param_decl_list_english_opt", $param_ast_list );
       DUMP_AST( "returning_english_ast_opt", $ret_ast );
 
-      $$ = c_ast_new_gc( K_UDEF_LIT, &@$ );
+      $$ = c_ast_new_gc( parser, K_UDEF_LIT, &@$ );
       c_ast_list_set_param_of( &$param_ast_list, $$ );
       $$->udef_lit.param_ast_list = slist_move( &$param_ast_list );
       c_ast_set_parent( $ret_ast, $$ );
@@ -6997,7 +7109,7 @@ var_decl_english_ast
       DUMP_START();
       DUMP_PROD( "var_decl_english_ast", "..." );
 
-      $$ = c_ast_new_gc( K_VARIADIC, &@$ );
+      $$ = c_ast_new_gc( parser, K_VARIADIC, &@$ );
 
       DUMP_AST( "$$_ast", $$ );
       DUMP_END();
@@ -7045,7 +7157,7 @@ type_english_ast
 
       PARSE_ASSERT( c_type_add( &new_type, &$type, &@type ) );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@$ );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@$ );
       $$->type = new_type;
 
       DUMP_AST( "$$_ast", $$ );
@@ -7098,7 +7210,7 @@ builtin_type_english_ast
                  "builtin_no_BitInt_english_btid" );
       DUMP_TID( "builtin_no_BitInt_english_btid", $btid );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@$ );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@$ );
       $$->type.btids = c_tid_check( $btid, C_TPID_BASE );
 
       DUMP_AST( "$$_ast", $$ );
@@ -7110,7 +7222,7 @@ builtin_type_english_ast
       DUMP_PROD( "builtin_type_english_ast", "BitInt_english_int" );
       DUMP_INT( "int", $width );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@$ );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@$ );
       $$->type.btids = TB__BitInt;
       $$->builtin.BitInt.width = $width;
 
@@ -7188,7 +7300,7 @@ class_struct_union_english_ast
       DUMP_TID( "class_struct_union_btid", $csu_btid );
       DUMP_SNAME( "sname", $sname );
 
-      $$ = c_ast_new_gc( K_CLASS_STRUCT_UNION, &@$ );
+      $$ = c_ast_new_gc( parser, K_CLASS_STRUCT_UNION, &@$ );
       $$->type.btids = c_tid_check( $csu_btid, C_TPID_BASE );
       $$->csu.csu_sname = c_sname_move( &$sname );
 
@@ -7208,7 +7320,7 @@ enum_english_ast
       DUMP_SNAME( "sname", $sname );
       DUMP_AST( "enum_fixed_type_english_ast", $fixed_type_ast );
 
-      $$ = c_ast_new_gc( K_ENUM, &@$ );
+      $$ = c_ast_new_gc( parser, K_ENUM, &@$ );
       $$->type.btids = c_tid_check( $enum_btids, C_TPID_BASE );
       c_ast_set_parent( $fixed_type_ast, $$ );
       $$->enum_.enum_sname = c_sname_move( &$sname );
@@ -7253,7 +7365,7 @@ enum_fixed_type_english_ast
                  "enum_fixed_type_modifier_list_english_btid" );
       DUMP_TID( "enum_fixed_type_modifier_list_english_btid", $btids );
 
-      $$ = c_ast_new_gc( K_BUILTIN, &@$ );
+      $$ = c_ast_new_gc( parser, K_BUILTIN, &@$ );
       $$->type.btids = c_tid_check( $btids, C_TPID_BASE );
 
       DUMP_AST( "$$_ast", $$ );
@@ -7301,7 +7413,7 @@ any_name
   | Y_TYPEDEF_NAME[tdef]
     {
       assert( c_sname_count( &$tdef->ast->sname ) == 1 );
-      $$ = check_strdup( c_sname_local_name( &$tdef->ast->sname ) );
+      $$ = intern_str( c_sname_local_name( &$tdef->ast->sname ) );
     }
   ;
 
@@ -7345,7 +7457,7 @@ name_ast
       DUMP_PROD( "name_ast", "NAME" );
       DUMP_STR( "NAME", $name );
 
-      $$ = c_ast_new_gc( K_NAME, &@$ );
+      $$ = c_ast_new_gc( parser, K_NAME, &@$ );
       c_sname_append_name( &$$->sname, $name );
 
       DUMP_AST( "$$_ast", $$ );
@@ -7365,8 +7477,9 @@ name_exp
 name_cat
   : name_cat[dst] Y_NAME[src]
     {
-      $$ = str_realloc_cat( $dst, " ", $src );
-      free( $src );
+      char *const cat = str_realloc_cat( check_strdup( $dst ), " ", $src );
+      $$ = intern_str( cat );
+      free( cat );
     }
   | Y_NAME
   ;
@@ -7390,7 +7503,7 @@ oper_sname_c_opt
 typedef_type_c_ast
   : any_typedef[tdef] sub_scope_sname_c_opt[sname]
     {
-      c_ast_t *type_ast = ia_type_ast_peek();
+      c_ast_t *type_ast = ia_type_ast_peek( parser );
       c_ast_t const *type_for_ast = $tdef->ast;
 
       DUMP_START();
@@ -7400,7 +7513,7 @@ typedef_type_c_ast
       DUMP_SNAME( "sub_scope_sname_c_opt", $sname );
 
       if ( c_sname_empty( &$sname ) ) {
-ttntd:  $$ = c_ast_new_gc( K_TYPEDEF, &@$ );
+ttntd:  $$ = c_ast_new_gc( parser, K_TYPEDEF, &@$ );
         $$->type.btids = TB_typedef;
         $$->tdef.for_ast = type_for_ast;
       }
@@ -7419,7 +7532,7 @@ ttntd:  $$ = c_ast_new_gc( K_TYPEDEF, &@$ );
           // name used as a type. Just assume the T is some type, say int, and
           // create a name for it.
           //
-          type_ast = c_ast_new_gc( K_BUILTIN, &@sname );
+          type_ast = c_ast_new_gc( parser, K_BUILTIN, &@sname );
           type_ast->type.btids = TB_int;
           c_sname_set( &type_ast->sname, &temp_name );
           type_for_ast = type_ast;
@@ -7464,7 +7577,6 @@ sname_c
           C_LANG_WHICH( SCOPED_NAMES )
         );
         c_sname_cleanup( &$sname );
-        free( $name );
         PARSE_ABORT();
       }
 
@@ -7521,7 +7633,7 @@ sname_c_ast
   : // in_attr: type_c_ast
     sname_c[sname] bit_field_c_uint_opt[bit_width]
     {
-      c_ast_t *type_ast = ia_type_ast_peek();
+      c_ast_t *type_ast = ia_type_ast_peek( parser );
 
       DUMP_START();
       DUMP_PROD( "sname_c_ast", "sname_c" );
@@ -7529,7 +7641,7 @@ sname_c_ast
       DUMP_SNAME( "sname", $sname );
       DUMP_INT( "bit_field_c_uint_opt", $bit_width );
 
-      type_ast = ia_type_spec_ast( type_ast );
+      type_ast = ia_type_spec_ast( parser, type_ast );
       c_sname_set( &type_ast->sname, &$sname );
 
       if ( $bit_width != 0 ) {
@@ -7539,7 +7651,7 @@ sname_c_ast
         //
         if ( !c_ast_is_integral( type_ast ) ) {
           print_error( &@bit_width, "invalid bit-field type " );
-          print_ast_type_aka( type_ast, stderr );
+          print_ast_type_aka( type_ast, cdecl_ferr );
           EPRINTF( "; must be an integral %stype\n",
             OPT_LANG_IS( enum_BITFIELDS ) ? "or enumeration " : ""
           );
@@ -7591,12 +7703,16 @@ sname_english
       DUMP_SNAME( "any_sname_c", $sname );
       DUMP_SNAME( "of_scope_list_english_opt", $scope_sname );
 
-      c_type_t const *local_type = c_sname_local_type( &$scope_sname );
-      if ( c_type_is_none( local_type ) )
-        local_type = c_sname_local_type( &$sname );
+      //
+      // The local type must be copied since the scopes of both snames are
+      // (possibly) stored in place and so are moved by c_sname_append_sname().
+      //
+      c_type_t local_type = *c_sname_local_type( &$scope_sname );
+      if ( c_type_is_none( &local_type ) )
+        local_type = *c_sname_local_type( &$sname );
       $$ = $scope_sname;
       c_sname_append_sname( &$$, &$sname );
-      c_sname_set_local_type( &$$, local_type );
+      c_sname_set_local_type( &$$, &local_type );
 
       DUMP_SNAME( "$$_sname", $$ );
       DUMP_END();
@@ -7619,12 +7735,12 @@ sname_english_ast
       //
       c_typedef_t const *const tdef = c_typedef_find_sname( &sname );
       if ( tdef != NULL ) {
-        $$ = c_ast_new_gc( K_TYPEDEF, &@$ );
+        $$ = c_ast_new_gc( parser, K_TYPEDEF, &@$ );
         $$->type.btids = TB_typedef;
         $$->tdef.for_ast = tdef->ast;
         c_sname_cleanup( &sname );
       } else {
-        $$ = c_ast_new_gc( K_NAME, &@$ );
+        $$ = c_ast_new_gc( parser, K_NAME, &@$ );
         c_sname_set( &$$->sname, &sname );
       }
 
@@ -7766,7 +7882,7 @@ as_exp
         //      c++decl> declare f as final function
         //      void f() final;
         //
-        lexer_keyword_ctx = C_KW_CTX_MBR_FUNC;
+        parser->lexer.keyword_ctx = C_KW_CTX_MBR_FUNC;
       }
     }
   | error
@@ -8348,6 +8464,8 @@ virtual_stid_opt
  * @param file The name of the file where this function was called from.
  * @param line The line number within \a file where this function was called
  * from.
+ * @param parser The \ref parser to use.
+ * @param lookahead The lookahead token ID, i.e., Bison's `yychar`.
  * @param dym_kinds The bitwise-or of the kind(s) of things possibly meant.
  * @param format A `printf()` style format string.  It _must not_ end in a
  * newline since this function prints its own newline.
@@ -8359,8 +8477,10 @@ virtual_stid_opt
  * @sa fl_punct_expected()
  * @sa yyerror()
  */
-PJL_PRINTF_LIKE_FUNC(4)
+PJL_PRINTF_LIKE_FUNC(6)
 static void fl_elaborate_error( char const *file, int line,
+                                parser_t const *parser,
+                                MAYBE_UNUSED int lookahead,
                                 dym_kind_t dym_kinds, char const *format,
                                 ... ) {
   assert( format != NULL );
@@ -8368,12 +8488,12 @@ static void fl_elaborate_error( char const *file, int line,
   EPUTS( ": " );
   print_debug_file_line( file, line );
 
-  char const *const error_token = lexer_printable_token();
+  char const *const error_token = lexer_printable_token( &parser->lexer );
   if ( error_token != NULL ) {
     EPRINTF( "\"%s\"", error_token );
 #ifdef ENABLE_CDECL_DEBUG
     if ( opt_cdecl_debug != CDECL_DEBUG_NO ) {
-      switch ( yychar ) {
+      switch ( lookahead ) {
         case YYEMPTY:
           EPUTS( " [<empty>]" );
           break;
@@ -8381,7 +8501,7 @@ static void fl_elaborate_error( char const *file, int line,
           EPUTS( " [<EOF>]" );
           break;
         default:
-          EPRINTF( " [%d]", yychar );
+          EPRINTF( " [%d]", lookahead );
       } // switch
     }
 #endif /* ENABLE_CDECL_DEBUG */
@@ -8390,7 +8510,7 @@ static void fl_elaborate_error( char const *file, int line,
 
   va_list args;
   va_start( args, format );
-  vfprintf( stderr, format, args );
+  sink_vprintf( cdecl_ferr, format, args );
   va_end( args );
 
   if ( error_token != NULL ) {
@@ -8403,8 +8523,37 @@ static void fl_elaborate_error( char const *file, int line,
 
 ////////// extern functions ///////////////////////////////////////////////////
 
-void parser_cleanup( void ) {
-  c_ast_list_cleanup_gc( &typedef_ast_list );
+void parser_free( parser_t *parser ) {
+  if ( parser == NULL )
+    return;
+  ia_cleanup( parser );
+  c_ast_arena_cleanup( &parser->gc_ast_arena );
+  lexer_cleanup( &parser->lexer );
+  free( parser );
+}
+
+parser_t* parser_new( void ) {
+  parser_t *const parser = MALLOC( parser_t, 1 );
+  MEM_ZERO( parser );
+  lexer_init( &parser->lexer );
+  return parser;
+}
+
+int parser_parse( parser_t *parser, FILE *fin ) {
+  assert( parser != NULL );
+  assert( fin != NULL );
+
+  lexer_restart( &parser->lexer, fin );
+  lexer_t const *const orig_lexer = print_params.lexer;
+  print_params.lexer = &parser->lexer;
+  int const rv = yyparse( parser );
+  print_params.lexer = orig_lexer;
+  return rv;
+}
+
+void parser_reset( parser_t *parser ) {
+  assert( parser != NULL );
+  lexer_reset( &parser->lexer, /*hard_reset=*/true );
 }
 
 ///////////////////////////////////////////////////////////////////////////////
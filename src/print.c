@@ -33,6 +33,7 @@
 #include "c_typedef.h"
 #include "cdecl.h"
 #include "cdecl_keyword.h"
+#include "cdecl_session.h"
 #include "color.h"
 #include "decl_flags.h"
 #include "english.h"
@@ -40,6 +41,7 @@
 #include "lexer.h"
 #include "options.h"
 #include "prompt.h"
+#include "sink.h"
 #include "strbuf.h"
 #include "util.h"
 
@@ -93,7 +95,7 @@ static size_t             token_len( char const*, size_t, size_t );
 /// Otherwise Doxygen generates two entries for each option.
 
 // extern variables
-print_params_t            print_params;
+_Thread_local print_params_t print_params;
 
 /// @endcond
 
@@ -120,8 +122,8 @@ static unsigned check_tigetnum( char const *capname ) {
 #endif /* ENABLE_TERM_SIZE */
 
 /**
- * Helper function for print_suggestions() and fput_list() that gets the string
- * for a \ref did_you_mean literal.
+ * Helper function for print_suggestions() and sink_put_list() that gets the
+ * string for a \ref did_you_mean literal.
  *
  * @param ppelt A pointer to the pointer to the \ref did_you_mean element to
  * get the string of.  On return, it is advanced to the next element.
@@ -135,8 +137,8 @@ static char const* fput_list_dym_gets( void const **ppelt ) {
     return NULL;
   *ppelt = dym + 1;
 
-  static strbuf_t sbufs[2];
-  static unsigned buf_index;
+  static _Thread_local strbuf_t sbufs[2];
+  static _Thread_local unsigned buf_index;
 
   strbuf_t *const sbuf = &sbufs[ buf_index++ % ARRAY_SIZE( sbufs ) ];
   strbuf_reset( sbuf );
@@ -144,6 +146,38 @@ static char const* fput_list_dym_gets( void const **ppelt ) {
   return sbuf->str;
 }
 
+/**
+ * Begins collecting a new diagnostic in \ref print_params::diags.
+ *
+ * @param loc The location of the diagnostic or NULL if none.  Its columns are
+ * adjusted for \ref print_params::inserted_len, if any.
+ * @return Returns said diagnostic.
+ */
+PJL_DISCARD
+static print_diag_t* print_diag_begin( c_loc_t const *loc ) {
+  print_diags_t *const diags = print_params.diags;
+  assert( diags != NULL );
+
+  if ( diags->len == diags->cap ) {
+    diags->cap = diags->cap == 0 ? 4 : diags->cap * 2;
+    REALLOC( diags->diag, print_diag_t, diags->cap );
+  }
+  print_diag_t *const diag = &diags->diag[ diags->len++ ];
+  *diag = (print_diag_t){ .has_loc = loc != NULL };
+
+  if ( loc != NULL ) {
+    diag->loc = *loc;
+    int const inserted_len = STATIC_CAST( int, print_params.inserted_len );
+    if ( diag->loc.first_column >= inserted_len )
+      diag->loc.first_column -= inserted_len;
+    if ( diag->loc.last_column >= inserted_len )
+      diag->loc.last_column -= inserted_len;
+  }
+
+  EPUTC( PRINT_DIAG_SEP );
+  return diag;
+}
+
 /**
  * Gets the current input line.
  *
@@ -152,8 +186,10 @@ static char const* fput_list_dym_gets( void const **ppelt ) {
  */
 NODISCARD
 static char const* get_input_line( size_t *rv_len ) {
-  char const *input_line = lexer_input_line( rv_len );
-  assert( input_line != NULL );
+  char const *input_line = NULL;
+  *rv_len = 0;
+  if ( print_params.lexer != NULL )
+    input_line = lexer_input_line( print_params.lexer, rv_len );
   if ( *rv_len == 0 ) {                 // no input? try command line
     input_line = print_params.command_line;
     assert( input_line != NULL );
@@ -176,6 +212,11 @@ static char const* get_input_line( size_t *rv_len ) {
  * Gets the number of columns of the terminal.
  *
  * @return Returns the number of columns or 0 if can not be determined.
+ *
+ * @note If the current session is \ref cdecl_session::is_termless
+ * "termless", returns #TERM_COLUMNS_DEFAULT without querying the terminal.
+ * That's not only right, but also necessary since neither the terminal nor
+ * **setupterm**(3) may be used concurrently by sessions on other threads.
  */
 static unsigned get_term_columns( void ) {
   unsigned    cols = TERM_COLUMNS_DEFAULT;
@@ -184,6 +225,9 @@ static unsigned get_term_columns( void ) {
   char        reason_buf[ 128 ];
   char const *reason = NULL;
 
+  if ( cdecl_session != NULL && cdecl_session->is_termless )
+    return cols;
+
   char const *const term = getenv( "TERM" );
   if ( unlikely( term == NULL ) ) {
     // LCOV_EXCL_START
@@ -270,20 +314,20 @@ error:
  * @note A newline is _not_ printed.
  *
  * @param ast The \ref c_ast to print.
- * @param pout The `FILE` to print to.
+ * @param pout The \ref sink to print to.
  */
-static void print_ast_name_aka( c_ast_t const *ast, FILE *pout ) {
+static void print_ast_name_aka( c_ast_t const *ast, sink_t *pout ) {
   assert( ast != NULL );
   assert( ast->kind != K_TYPEDEF );
   assert( !c_sname_empty( &ast->sname ) );
   assert( pout != NULL );
 
-  FPRINTF( pout, "\"%s\" (aka, \"", c_sname_full_name( &ast->sname ) );
+  sink_printf( pout, "\"%s\" (aka, \"", c_sname_full_name( &ast->sname ) );
   // Look-up the type so we can print it how it was originally defined.
   c_typedef_t const *const tdef = c_typedef_find_sname( &ast->sname );
   assert( tdef != NULL );
   print_type_ast( tdef, pout );
-  FPUTS( "\")", pout );
+  sink_puts( pout, "\")" );
 }
 
 /**
@@ -318,10 +362,10 @@ static size_t print_caret( size_t error_column ) {
     caret_column = error_column;
   }
 
-  FPUTNSP( caret_column, stderr );
-  color_start( stderr, sgr_caret );
+  sink_putnsp( cdecl_ferr, caret_column );
+  color_start( cdecl_ferr, sgr_caret );
   EPUTC( '^' );
-  color_end( stderr, sgr_caret );
+  color_end( cdecl_ferr, sgr_caret );
   EPUTC( '\n' );
 
   return error_column;
@@ -472,11 +516,14 @@ void fl_print_error( char const *file, int line, c_loc_t const *loc,
                      char const *format, ... ) {
   assert( format != NULL );
 
-  if ( loc != NULL ) {
+  if ( print_params.diags != NULL ) {
+    print_diag_begin( loc );
+  }
+  else if ( loc != NULL ) {
     print_loc( loc );
-    color_start( stderr, sgr_error );
+    color_start( cdecl_ferr, sgr_error );
     EPUTS( "error" );
-    color_end( stderr, sgr_error );
+    color_end( cdecl_ferr, sgr_error );
     EPUTS( ": " );
   }
 
@@ -484,7 +531,7 @@ void fl_print_error( char const *file, int line, c_loc_t const *loc,
 
   va_list args;
   va_start( args, format );
-  vfprintf( stderr, format, args );
+  sink_vprintf( cdecl_ferr, format, args );
   va_end( args );
 }
 
@@ -543,46 +590,51 @@ void fl_print_warning( char const *file, int line, c_loc_t const *loc,
                        char const *format, ... ) {
   assert( format != NULL );
 
-  if ( loc != NULL )
-    print_loc( loc );
-  color_start( stderr, sgr_warning );
-  EPUTS( "warning" );
-  color_end( stderr, sgr_warning );
-  EPUTS( ": " );
+  if ( print_params.diags != NULL ) {
+    print_diag_begin( loc )->is_warning = true;
+  }
+  else {
+    if ( loc != NULL )
+      print_loc( loc );
+    color_start( cdecl_ferr, sgr_warning );
+    EPUTS( "warning" );
+    color_end( cdecl_ferr, sgr_warning );
+    EPUTS( ": " );
+  }
 
   print_debug_file_line( file, line );
 
   va_list args;
   va_start( args, format );
-  vfprintf( stderr, format, args );
+  sink_vprintf( cdecl_ferr, format, args );
   va_end( args );
 }
 
-void print_ast_kind_aka( c_ast_t const *ast, FILE *pout ) {
+void print_ast_kind_aka( c_ast_t const *ast, sink_t *pout ) {
   assert( ast != NULL );
   assert( pout != NULL );
 
   c_ast_t const *const raw_ast = c_ast_untypedef( ast );
-  FPUTS( c_kind_name( raw_ast->kind ), pout );
+  sink_puts( pout, c_kind_name( raw_ast->kind ) );
 
   if ( raw_ast != ast ) {
-    FPUTS( " type ", pout );
+    sink_puts( pout, " type " );
     print_ast_name_aka( raw_ast, pout );
   }
 }
 
-void print_ast_type_aka( c_ast_t const *ast, FILE *pout ) {
+void print_ast_type_aka( c_ast_t const *ast, sink_t *pout ) {
   assert( ast != NULL );
   assert( pout != NULL );
 
   c_ast_t const *const raw_ast = c_ast_untypedef( ast );
   if ( raw_ast == ast ) {               // not a typedef
-    FPUTC( '"', pout );
+    sink_putc( pout, '"' );
     if ( cdecl_mode == CDECL_ENGLISH_TO_GIBBERISH )
       c_ast_english( ast, C_ENG_DECL | C_ENG_OPT_OMIT_DECLARE, pout );
     else
       c_ast_gibberish( ast, C_GIB_USING, pout );
-    FPUTC( '"', pout );
+    sink_putc( pout, '"' );
   }
   else {
     print_ast_name_aka( raw_ast, pout );
@@ -601,12 +653,20 @@ void print_debug_file_line( char const *file, int line ) {
 #endif /* ENABLE_CDECL_DEBUG */
 }
 
+void print_diags_cleanup( print_diags_t *diags ) {
+  assert( diags != NULL );
+  for ( size_t i = 0; i < diags->len; ++i )
+    dym_free( diags->diag[i].dym );
+  free( diags->diag );
+  *diags = (print_diags_t){ 0 };
+}
+
 void print_hint( char const *format, ... ) {
   assert( format != NULL );
   EPUTS( "; did you mean " );
   va_list args;
   va_start( args, format );
-  vfprintf( stderr, format, args );
+  sink_vprintf( cdecl_ferr, format, args );
   va_end( args );
   EPUTS( "?\n" );
 }
@@ -638,12 +698,16 @@ void print_is_a_keyword( char const *error_token ) {
 
 void print_loc( c_loc_t const *loc ) {
   assert( loc != NULL );
+  if ( print_params.diags != NULL ) {
+    print_diag_begin( loc );
+    return;
+  }
   size_t const column = print_caret( STATIC_CAST( size_t, loc->first_column ) );
-  color_start( stderr, sgr_locus );
+  color_start( cdecl_ferr, sgr_locus );
   if ( print_params.conf_path != NULL )
     EPRINTF( "%s:%d,", print_params.conf_path, loc->first_line + 1 );
   EPRINTF( "%zu", column + 1 );
-  color_end( stderr, sgr_locus );
+  color_end( cdecl_ferr, sgr_locus );
   EPUTS( ": " );
 }
 
@@ -651,14 +715,22 @@ bool print_suggestions( dym_kind_t kinds, char const *unknown_token ) {
   did_you_mean_t const *const dym = dym_new( kinds, unknown_token );
   if ( dym == NULL )
     return false;
+
+  print_diags_t *const diags = print_params.diags;
+  if ( diags != NULL && diags->len > 0 &&
+       diags->diag[ diags->len - 1 ].dym == NULL ) {
+    diags->diag[ diags->len - 1 ].dym = dym;
+    return true;
+  }
+
   EPUTS( "; did you mean " );
-  fput_list( stderr, dym, &fput_list_dym_gets );
+  sink_put_list( cdecl_ferr, dym, &fput_list_dym_gets );
   EPUTC( '?' );
   dym_free( dym );
   return true;
 }
 
-void print_type_ast( c_typedef_t const *tdef, FILE *pout ) {
+void print_type_ast( c_typedef_t const *tdef, sink_t *pout ) {
   assert( tdef != NULL );
   assert( pout != NULL );
 
@@ -669,7 +741,7 @@ void print_type_ast( c_typedef_t const *tdef, FILE *pout ) {
 }
 
 void print_type_decl( c_typedef_t const *tdef, unsigned decl_flags,
-                      FILE *pout ) {
+                      sink_t *pout ) {
   assert( tdef != NULL );
   assert( is_1_bit_in_set( decl_flags, C_TYPE_DECL_ANY ) );
   assert( pout != NULL );
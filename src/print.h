@@ -92,19 +92,65 @@
 #define print_warning(...) \
   fl_print_warning( __FILE__, __LINE__, __VA_ARGS__ )
 
+/**
+ * When collecting diagnostics, the character printed to standard error
+ * (instead of the location) at the start of every error or warning message.
+ *
+ * @sa print_params::diags
+ */
+#define PRINT_DIAG_SEP            '\x1E' /* ASCII Record Separator */
+
+/**
+ * An error or warning collected rather than having its location printed.
+ *
+ * @sa print_params::diags
+ */
+struct print_diag {
+  c_loc_t               loc;            ///< Location, if \ref has_loc.
+  bool                  has_loc;        ///< Does it have a location?
+  bool                  is_warning;     ///< Warning (vs. error)?
+  did_you_mean_t const *dym;            ///< Suggestions, if any.
+};
+typedef struct print_diag print_diag_t;
+
+/**
+ * Collected errors and warnings.
+ *
+ * @sa print_diags_cleanup()
+ */
+struct print_diags {
+  print_diag_t *diag;                   ///< Array of diagnostics.
+  size_t        len;                    ///< Length of \ref diag.
+  size_t        cap;                    ///< Capacity of \ref diag.
+};
+typedef struct print_diags print_diags_t;
+
 /**
  * Parameters for the `print_*()` functions that would be too burdonsome to
  * pass to every function call.
+ *
+ * @remarks There is one set of these per thread so that parses in different
+ * threads don't clobber each other's parameters.
  */
 struct print_params {
-  char const *command_line;             ///< Command from command line, if any.
-  size_t      command_line_len;         ///< Length of `command_line`.
-  char const *conf_path;                ///< Configuration file path, if any.
-  size_t      inserted_len;             ///< Length of inserted string, if any.
+  char const    *command_line;          ///< Command from command line, if any.
+  size_t         command_line_len;      ///< Length of `command_line`.
+  char const    *conf_path;             ///< Configuration file path, if any.
+  size_t         inserted_len;          ///< Length of inserted string, if any.
+  lexer_t const *lexer;                 ///< Lexer of current parse, if any.
+
+  /**
+   * If not NULL, collect diagnostics here rather than printing the input
+   * line, caret, and column: every error or warning message is instead
+   * preceded by #PRINT_DIAG_SEP and any "did you mean ...?" suggestions for
+   * it are collected rather than printed.
+   */
+  print_diags_t *diags;
 };
 typedef struct print_params print_params_t;
 
-extern print_params_t print_params;     ///< Print parameters.
+/// Print parameters.
+extern _Thread_local print_params_t print_params;
 
 ////////// extern functions ///////////////////////////////////////////////////
 
@@ -177,6 +223,14 @@ PJL_PRINTF_LIKE_FUNC(4)
 void fl_print_warning( char const *file, int line, c_loc_t const *loc,
                        char const *format, ... );
 
+/**
+ * Frees all memory used by \a diags, but _not_ \a diags itself, and empties
+ * it.
+ *
+ * @param diags The \ref print_diags to clean up.
+ */
+void print_diags_cleanup( print_diags_t *diags );
+
 /**
  * If \ref opt_cdecl_debug is compiled in and enabled, prints \a file and \a
  * line to standard error in the form `"[<file>:<line>] "`; otherwise prints
@@ -252,10 +306,14 @@ void print_loc( c_loc_t const *loc );
  *
  * @note A newline is _not_ printed.
  *
+ * @note If \ref print_params::diags is set, the suggestions are instead
+ * collected for the most recent diagnostic that doesn't already have any.
+ *
  * @param kinds The bitwise-or of the kind(s) of things possibly meant by \a
  * unknown_token.
  * @param unknown_token The unknown token.
- * @return Returns `true` only if any suggestions were printed.
+ * @return Returns `true` only if any suggestions were printed (or
+ * collected).
  *
  * @sa print_hint()
  */
@@ -299,11 +357,11 @@ bool print_suggestions( dym_kind_t kinds, char const *unknown_token );
  * @note A newline is _not_ printed.
  *
  * @param ast The \ref c_ast to print.
- * @param pout The `FILE` to print to.
+ * @param pout The \ref sink to print to.
  *
  * @sa print_ast_type_aka()
  */
-void print_ast_kind_aka( c_ast_t const *ast, FILE *pout );
+void print_ast_kind_aka( c_ast_t const *ast, sink_t *pout );
 
 /**
  * If \a ast is:
@@ -332,7 +390,7 @@ void print_ast_kind_aka( c_ast_t const *ast, FILE *pout );
  * @note A newline is _not_ printed.
  *
  * @param ast The \ref c_ast to print.
- * @param pout The `FILE` to print to.
+ * @param pout The \ref sink to print to.
  *
  * @sa c_ast_english()
  * @sa c_ast_gibberish()
@@ -344,7 +402,7 @@ void print_ast_kind_aka( c_ast_t const *ast, FILE *pout );
  * @sa print_type_decl()
  * @sa show_type()
  */
-void print_ast_type_aka( c_ast_t const *ast, FILE *pout );
+void print_ast_type_aka( c_ast_t const *ast, sink_t *pout );
 
 /**
  * Prints _only_ the underlying type of \a tdef either as pseudo-English via
@@ -354,7 +412,7 @@ void print_ast_type_aka( c_ast_t const *ast, FILE *pout );
  * @note A newline is _not_ printed.
  *
  * @param tdef The \ref c_typedef whose \ref c_typedef::ast "ast" to print.
- * @param pout The `FILE` to print to.
+ * @param pout The \ref sink to print to.
  *
  * @sa c_ast_english()
  * @sa c_ast_gibberish()
@@ -364,7 +422,7 @@ void print_ast_type_aka( c_ast_t const *ast, FILE *pout );
  * @sa print_type_decl()
  * @sa show_type()
  */
-void print_type_ast( c_typedef_t const *tdef, FILE *pout );
+void print_type_ast( c_typedef_t const *tdef, sink_t *pout );
 
 /**
  * Prints \a tdef as a full type declaration either in pseudo-English via
@@ -376,7 +434,7 @@ void print_type_ast( c_typedef_t const *tdef, FILE *pout );
  * @param tdef The \ref c_typedef to print.
  * @param decl_flags The declaration flags to use (overriding \a tdef's \ref
  * c_typedef::decl_flags "decl_flags").
- * @param pout The `FILE` to print to.
+ * @param pout The \ref sink to print to.
  *
  * @sa c_typedef_english()
  * @sa c_typedef_gibberish()
@@ -385,7 +443,7 @@ void print_type_ast( c_typedef_t const *tdef, FILE *pout );
  * @sa show_type()
  */
 void print_type_decl( c_typedef_t const *tdef, unsigned decl_flags,
-                      FILE *pout );
+                      sink_t *pout );
 
 ///////////////////////////////////////////////////////////////////////////////
 
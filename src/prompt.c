@@ -80,12 +80,12 @@
 /// Otherwise Doxygen generates two entries for each option.
 
 // extern variable definitions
-char const         *cdecl_prompt[2];
+_Thread_local char const *cdecl_prompt[2];
 
 /// @endcond
 
 // local variable definitions
-static strbuf_t     prompt_buf[2];      ///< Buffers for prompts.
+static _Thread_local strbuf_t prompt_buf[2]; ///< Buffers for prompts.
 
 ////////// inline functions ///////////////////////////////////////////////////
 
@@ -105,14 +105,6 @@ static inline bool color_prompt( void ) {
 
 ////////// local functions ////////////////////////////////////////////////////
 
-/**
- * Cleans-up prompt strings.
- */
-static void prompt_cleanup( void ) {
-  strbuf_cleanup( &prompt_buf[0] );
-  strbuf_cleanup( &prompt_buf[1] );
-}
-
 /**
  * Creates a prompt.
  *
@@ -145,6 +137,11 @@ static void prompt_create( char suffix, strbuf_t *sbuf ) {
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+void cdecl_prompt_cleanup( void ) {
+  strbuf_cleanup( &prompt_buf[0] );
+  strbuf_cleanup( &prompt_buf[1] );
+}
+
 void cdecl_prompt_enable( void ) {
   if ( opt_prompt ) {
     cdecl_prompt[0] = prompt_buf[0].str;
@@ -155,8 +152,6 @@ void cdecl_prompt_enable( void ) {
 }
 
 void cdecl_prompt_init( void ) {
-  RUN_ONCE ATEXIT( &prompt_cleanup );
-
   prompt_create( '>', &prompt_buf[0] );
   prompt_create( '+', &prompt_buf[1] );
   cdecl_prompt_enable();
@@ -50,10 +50,19 @@
  * codes](https://en.wikipedia.org/wiki/ANSI_escape_code#SGR).  Do _not_ call
  * `strlen()` on them; use cdecl_prompt_len() instead.
  */
-extern char const  *cdecl_prompt[2];
+extern _Thread_local char const *cdecl_prompt[2];
 
 ////////// extern functions ///////////////////////////////////////////////////
 
+/**
+ * Cleans-up the prompt strings of the calling thread.
+ *
+ * @note This is called only by cdecl_init()'s clean-up upon exit.
+ *
+ * @sa cdecl_prompt_init()
+ */
+void cdecl_prompt_cleanup( void );
+
 /**
  * Enables or disables the prompt based on \ref opt_prompt.
  *
@@ -66,7 +75,9 @@ void cdecl_prompt_enable( void );
  *
  * @note This is called `cdecl_prompt_init` and not `prompt_init` so as not to
  * conflict with the latter function in `libedit`.
+ * @note This may be called on any thread since the prompts are per-thread.
  *
+ * @sa cdecl_prompt_cleanup()
  * @sa cdecl_prompt_enable()
  */
 void cdecl_prompt_init( void );
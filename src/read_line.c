@@ -30,6 +30,7 @@
 #ifdef WITH_READLINE
 #include "autocomplete.h"
 #endif /* WITH_READLINE */
+#include "sink.h"
 
 /// @cond DOXYGEN_IGNORE
 
@@ -21,6 +21,7 @@
 // local
 #include "pjl_config.h"                 /* must go first */
 #include "red_black.h"
+#include "sink.h"
 #include "util.h"
 #include "unit_test.h"
 
@@ -0,0 +1,279 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/serve_bench.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines main() for a latency benchmark comparing executing **cdecl** for
+ * every command to sending commands to a **cdecl** server.
+ *
+ * @remarks Usage: `serve_bench cdecl-path [iterations]`.  It measures the
+ * average latency of a single `explain` command when:
+ *
+ *  1. **cdecl** is executed for it ("cold").
+ *  2. It's sent over a new connection to `cdecl --serve`.
+ *  3. It's sent over a new connection to `cdecl --zygote`.
+ *  4. `cdecl --client` is executed for it (with `cdecl --zygote`).
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "cdecl.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <errno.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <spawn.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <sysexits.h>
+#include <unistd.h>
+
+/// @endcond
+
+/// Default number of iterations of each benchmark.
+#define BENCH_ITERATIONS_DEFAULT  200
+
+/// The command whose latency is measured.
+#define BENCH_COMMAND             "explain int (*f)(char const*)"
+
+///////////////////////////////////////////////////////////////////////////////
+
+static char const  *cdecl_path;         ///< Path of the cdecl executable.
+static char         sock_path[ 64 ];    ///< Path of the server's socket.
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Executes \a argv with standard output and standard error redirected to
+ * `/dev/null`.
+ *
+ * @param argv The null-terminated argument vector.
+ * @param do_wait If `true`, waits for the process to exit.
+ * @return Returns the process ID.
+ */
+static pid_t bench_spawn( char const *const argv[const], bool do_wait ) {
+  posix_spawn_file_actions_t actions;
+  PERROR_EXIT_IF( posix_spawn_file_actions_init( &actions ) != 0, EX_OSERR );
+  PERROR_EXIT_IF(
+    posix_spawn_file_actions_addopen(
+      &actions, STDOUT_FILENO, "/dev/null", O_WRONLY, 0
+    ) != 0,
+    EX_OSERR
+  );
+  PERROR_EXIT_IF(
+    posix_spawn_file_actions_adddup2(
+      &actions, STDOUT_FILENO, STDERR_FILENO
+    ) != 0,
+    EX_OSERR
+  );
+
+  pid_t pid;
+  int const err = posix_spawn(
+    &pid, cdecl_path, &actions, /*attrp=*/NULL,
+    CONST_CAST( char**, argv ), environ
+  );
+  if ( err != 0 )
+    fatal_error( EX_UNAVAILABLE, "\"%s\": %s\n", cdecl_path, strerror( err ) );
+  PJL_IGNORE_RV( posix_spawn_file_actions_destroy( &actions ) );
+
+  if ( do_wait ) {
+    int status;
+    PERROR_EXIT_IF( waitpid( pid, &status, 0 ) == -1, EX_OSERR );
+    if ( !WIFEXITED( status ) || WEXITSTATUS( status ) != EX_OK )
+      fatal_error( EX_SOFTWARE, "\"%s\": unexpected failure\n", cdecl_path );
+  }
+  return pid;
+}
+
+/**
+ * Connects to the server.
+ *
+ * @return Returns the socket file descriptor or -1 if the server isn't
+ * listening (yet).
+ */
+NODISCARD
+static int bench_connect( void ) {
+  struct sockaddr_un addr = { .sun_family = AF_UNIX };
+  strcpy( addr.sun_path, sock_path );
+  int const fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+  PERROR_EXIT_IF( fd == -1, EX_OSERR );
+  if ( connect( fd, POINTER_CAST( struct sockaddr*, &addr ),
+                sizeof addr ) == -1 ) {
+    PJL_IGNORE_RV( close( fd ) );
+    return -1;
+  }
+  return fd;
+}
+
+/**
+ * Sends #BENCH_COMMAND over a new connection and reads the reply.
+ */
+static void bench_request( void ) {
+  int const fd = bench_connect();
+  if ( fd == -1 )
+    fatal_error( EX_UNAVAILABLE, "\"%s\": %s\n", sock_path, STRERROR() );
+
+  static char const REQUEST[] = BENCH_COMMAND "\n";
+  PERROR_EXIT_IF(
+    write( fd, REQUEST, STRLITLEN( REQUEST ) ) == -1, EX_IOERR
+  );
+  PERROR_EXIT_IF( shutdown( fd, SHUT_WR ) == -1, EX_IOERR );
+
+  // Read until the server closes the connection.
+  char buf[ 512 ];
+  for (;;) {
+    ssize_t const n = read( fd, buf, sizeof buf );
+    PERROR_EXIT_IF( n == -1, EX_IOERR );
+    if ( n == 0 )
+      break;
+  } // for
+  PJL_IGNORE_RV( close( fd ) );
+}
+
+/**
+ * Starts a server.
+ *
+ * @param serve_opt Either `--serve` or `--zygote`.
+ * @return Returns the server's process ID.
+ */
+static pid_t bench_server_start( char const *serve_opt ) {
+  char opt_buf[ sizeof sock_path + 16 ];
+  snprintf( opt_buf, sizeof opt_buf, "%s=%s", serve_opt, sock_path );
+  char const *const argv[] = { cdecl_path, "--no-config", opt_buf, NULL };
+  pid_t const pid = bench_spawn( argv, /*wait=*/false );
+
+  for ( unsigned tries = 0; tries < 500; ++tries ) {
+    int const fd = bench_connect();
+    if ( fd != -1 ) {
+      PJL_IGNORE_RV( close( fd ) );
+      return pid;
+    }
+    PJL_IGNORE_RV( usleep( 10000 ) );
+  } // for
+  fatal_error( EX_UNAVAILABLE, "\"%s\": server didn't start\n", sock_path );
+}
+
+/**
+ * Stops a server.
+ *
+ * @param pid The server's process ID.
+ */
+static void bench_server_stop( pid_t pid ) {
+  PERROR_EXIT_IF( kill( pid, SIGTERM ) == -1, EX_OSERR );
+  PERROR_EXIT_IF( waitpid( pid, /*status=*/NULL, 0 ) == -1, EX_OSERR );
+}
+
+/**
+ * Prints a benchmark result.
+ *
+ * @param what What was measured.
+ * @param elapsed The total elapsed time in seconds.
+ * @param iterations The number of iterations.
+ */
+static void bench_print( char const *what, double elapsed,
+                         unsigned long iterations ) {
+  printf( "%-16s %10.1fus/request\n",
+    what, elapsed * 1e6 / STATIC_CAST( double, iterations )
+  );
+}
+
+// LCOV_EXCL_START
+_Noreturn
+static void usage( void ) {
+  fprintf( stderr, "usage: %s cdecl-path [iterations]\n", me );
+  exit( EX_USAGE );
+}
+// LCOV_EXCL_STOP
+
+////////// main ///////////////////////////////////////////////////////////////
+
+/**
+ * The main entry point.
+ *
+ * @param argc The command-line argument count.
+ * @param argv The command-line argument values.
+ * @return Returns 0 on success, non-zero on failure.
+ */
+int main( int argc, char const *argv[] ) {
+  me = base_name( argv[0] );
+
+  unsigned long iterations = BENCH_ITERATIONS_DEFAULT;
+  switch ( argc ) {
+    case 2:
+      break;
+    case 3:
+      iterations = strtoul( argv[2], /*endptr=*/NULL, 10 );
+      if ( iterations > 0 )
+        break;
+      FALLTHROUGH;
+    default:
+      usage();
+  } // switch
+  cdecl_path = argv[1];
+  snprintf(
+    sock_path, sizeof sock_path, "/tmp/serve_bench_%ld.sock",
+    STATIC_CAST( long, getpid() )
+  );
+
+  char const *const cold_argv[] = {
+    cdecl_path, "--no-config", BENCH_COMMAND, NULL
+  };
+  double start = monotonic_now();
+  for ( unsigned long i = 0; i < iterations; ++i )
+    bench_spawn( cold_argv, /*wait=*/true );
+  bench_print( "cold exec", monotonic_now() - start, iterations );
+
+  pid_t pid = bench_server_start( "--serve" );
+  start = monotonic_now();
+  for ( unsigned long i = 0; i < iterations; ++i )
+    bench_request();
+  bench_print( "serve", monotonic_now() - start, iterations );
+  bench_server_stop( pid );
+
+  pid = bench_server_start( "--zygote" );
+  start = monotonic_now();
+  for ( unsigned long i = 0; i < iterations; ++i )
+    bench_request();
+  bench_print( "zygote", monotonic_now() - start, iterations );
+
+  char client_opt[ sizeof sock_path + 16 ];
+  snprintf( client_opt, sizeof client_opt, "--client=%s", sock_path );
+  char const *const client_argv[] = {
+    cdecl_path, client_opt, BENCH_COMMAND, NULL
+  };
+  start = monotonic_now();
+  for ( unsigned long i = 0; i < iterations; ++i )
+    bench_spawn( client_argv, /*wait=*/true );
+  bench_print( "zygote + client", monotonic_now() - start, iterations );
+  bench_server_stop( pid );
+
+  exit( EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,680 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/server.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for serving **cdecl** commands over a Unix domain socket
+ * and for being a client of such a server.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "server.h"
+#include "cdecl.h"
+#include "cdecl_command.h"
+#include "cdecl_session.h"
+#include "conf_file.h"
+#include "libcdecl.h"
+#include "options.h"
+#include "read_line.h"
+#include "sink.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <sysexits.h>
+#include <unistd.h>
+
+/// @endcond
+
+/**
+ * @addtogroup server-group
+ * @{
+ */
+
+/**
+ * Size of the buffer used to read commands from a client.
+ */
+#define SERVE_READ_BUF_SIZE       4096u
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A connection to a client.
+ */
+struct serve_conn {
+  int               fd;                 ///< Socket file descriptor.
+  cdecl_session_t  *session;            ///< Session of the client.
+  strbuf_t          in_sbuf;            ///< Commands read but not executed.
+  strbuf_t          out_sbuf;           ///< Replies not yet sent.
+  size_t            out_sent;           ///< Bytes of \ref out_sbuf sent.
+  bool              is_eof;             ///< No more commands to read?
+};
+typedef struct serve_conn serve_conn_t;
+
+// local variables
+static serve_conn_t     *serve_conns;   ///< Client connections.
+static size_t            serve_conns_cap; ///< Capacity of \ref serve_conns.
+static size_t            serve_conns_len; ///< Length of \ref serve_conns.
+static cdecl_session_t **serve_pool;    ///< Sessions available for reuse.
+static size_t            serve_pool_len;  ///< Length of \ref serve_pool.
+
+static pid_t             serve_pid;     ///< Process ID of the server.
+
+/// Set by serve_signal_handler() to stop serving.
+static volatile sig_atomic_t serve_stop;
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Reads exactly \a buf_len bytes from \a fin into \a buf.
+ *
+ * @param fin The `FILE` to read from.
+ * @param buf The buffer to read into.
+ * @param buf_len The number of bytes to read.
+ * @return Returns `true` only if all bytes were read.
+ */
+NODISCARD
+static bool client_read( FILE *fin, char *buf, size_t buf_len ) {
+  return buf_len == 0 || fread( buf, 1, buf_len, fin ) == buf_len;
+}
+
+/**
+ * Sends \a command to the server and prints its reply.
+ *
+ * @param fin The `FILE` to read replies from the server from.
+ * @param fout The `FILE` to send commands to the server to.
+ * @param command The command to send.
+ * @param command_len The length of \a command.
+ * @param reply_sbuf The \ref strbuf to use for the reply.
+ * @param pstatus Set to the status of \a command.
+ * @return Returns `false` only if the server closed the connection (because
+ * of a previous `quit` command) before \a command was sent.
+ */
+NODISCARD
+static bool client_send( FILE *fin, FILE *fout, char const *command,
+                         size_t command_len, strbuf_t *reply_sbuf,
+                         int *pstatus ) {
+  if ( fwrite( command, 1, command_len, fout ) < command_len ||
+       putc( '\n', fout ) == EOF || fflush( fout ) != 0 ) {
+    if ( errno == EPIPE )
+      return false;
+    perror_exit( EX_IOERR );
+  }
+
+  size_t out_len, err_len;
+  switch ( fscanf( fin, "%d %zu %zu", pstatus, &out_len, &err_len ) ) {
+    case EOF:
+      // If the server closed the connection while the command was still
+      // unread, reading gets ECONNRESET rather than EOF.
+      if ( ferror( fin ) && errno != ECONNRESET )
+        perror_exit( EX_IOERR );
+      return false;
+    case 3:
+      if ( getc( fin ) == '\n' )
+        break;
+      FALLTHROUGH;
+    default:
+      goto protocol_error;
+  } // switch
+
+  strbuf_reset( reply_sbuf );
+  strbuf_reserve( reply_sbuf, out_len + err_len );
+  if ( !client_read( fin, reply_sbuf->str, out_len + err_len ) )
+    goto protocol_error;
+
+  // Print standard error first since warnings precede output.
+  if ( err_len > 0 )
+    sink_putsn( cdecl_ferr, reply_sbuf->str + out_len, err_len );
+  if ( out_len > 0 )
+    sink_putsn( cdecl_fout, reply_sbuf->str, out_len );
+  return true;
+
+protocol_error:
+  FERROR( fin );
+  fatal_error( EX_PROTOCOL,
+    "\"%s\": unexpected reply from server\n", opt_client_path
+  );
+}
+
+/**
+ * Reads the configuration file, if any, into \a session discarding any
+ * output.
+ *
+ * @param session The session to read the configuration file into.
+ */
+static void serve_session_conf( cdecl_session_t *session ) {
+  assert( session != NULL );
+  if ( !opt_read_conf )
+    return;
+
+  strbuf_t discard_sbuf;
+  strbuf_init( &discard_sbuf );
+  sink_t discard_sink;
+  sink_init_strbuf( &discard_sink, &discard_sbuf );
+
+  sink_t *const prev_fout = cdecl_fout_redirect;
+  sink_t *const prev_ferr = cdecl_ferr_redirect;
+  cdecl_fout_redirect = cdecl_ferr_redirect = &discard_sink;
+  cdecl_session_t *const prev_session = cdecl_session_set( session );
+
+  session->is_initialized = false;
+  PJL_IGNORE_RV( conf_read() );         // main() already read it OK once
+  session->is_initialized = true;
+
+  PJL_IGNORE_RV( cdecl_session_set( prev_session ) );
+  cdecl_fout_redirect = prev_fout;
+  cdecl_ferr_redirect = prev_ferr;
+  strbuf_cleanup( &discard_sbuf );
+}
+
+/**
+ * Creates a new session for a client.  It has the options of the current
+ * session and the types defined by the configuration file, if any.
+ *
+ * @return Returns said session.
+ */
+NODISCARD
+static cdecl_session_t* serve_session_new( void ) {
+  cdecl_session_t *const session = cdecl_session_new();
+  session->is_quit_deferred = true;
+  session->is_termless = true;          // output goes to the client
+  session->is_initialized = true;
+  serve_session_conf( session );
+  return session;
+}
+
+/**
+ * Closes \a conn and returns its session to \ref serve_pool.
+ *
+ * @param conn The \ref serve_conn to close.
+ */
+static void serve_conn_close( serve_conn_t *conn ) {
+  assert( conn != NULL );
+  PJL_IGNORE_RV( close( conn->fd ) );
+  strbuf_cleanup( &conn->in_sbuf );
+  strbuf_cleanup( &conn->out_sbuf );
+
+  cdecl_session_reset( conn->session );
+  serve_session_conf( conn->session );
+  REALLOC( serve_pool, cdecl_session_t*, serve_pool_len + 1 );
+  serve_pool[ serve_pool_len++ ] = conn->session;
+}
+
+/**
+ * Executes all complete commands in the input of \a conn and appends their
+ * replies to its output.
+ *
+ * @param conn The \ref serve_conn to execute commands for.
+ * @param cmd_out The \ref strbuf to use for each command's output.
+ * @param cmd_err The \ref strbuf to use for each command's errors.
+ */
+static void serve_conn_exec( serve_conn_t *conn, strbuf_t *cmd_out,
+                             strbuf_t *cmd_err ) {
+  assert( conn != NULL );
+  if ( conn->in_sbuf.len == 0 )
+    return;
+
+  char *command = conn->in_sbuf.str;
+  char const *const end = command + conn->in_sbuf.len;
+
+  while ( !conn->session->is_quit ) {
+    char *const nl =
+      memchr( command, '\n', STATIC_CAST( size_t, end - command ) );
+    if ( nl == NULL ) {
+      if ( !conn->is_eof || command == end )
+        break;
+      // The last command lacks a newline: execute it anyway.
+    }
+    else {
+      *nl = '\0';
+    }
+
+    strbuf_reset( cmd_out );
+    strbuf_reset( cmd_err );
+    int const status =
+      cdecl_lib_command( conn->session, command, cmd_out, cmd_err );
+    strbuf_printf( &conn->out_sbuf,
+      "%d %zu %zu\n", status, cmd_out->len, cmd_err->len
+    );
+    if ( cmd_out->len > 0 )
+      strbuf_putsn( &conn->out_sbuf, cmd_out->str, cmd_out->len );
+    if ( cmd_err->len > 0 )
+      strbuf_putsn( &conn->out_sbuf, cmd_err->str, cmd_err->len );
+
+    if ( nl == NULL ) {
+      command = CONST_CAST( char*, end );
+      break;
+    }
+    command = nl + 1;
+  } // while
+
+  if ( conn->session->is_quit ) {
+    conn->is_eof = true;                // ignore commands after quit
+    command = CONST_CAST( char*, end );
+  }
+
+  //
+  // Move any incomplete command to the front.
+  //
+  size_t const rest_len = STATIC_CAST( size_t, end - command );
+  memmove( conn->in_sbuf.str, command, rest_len );
+  conn->in_sbuf.len = rest_len;
+  conn->in_sbuf.str[ rest_len ] = '\0';
+}
+
+/**
+ * Reads commands from \a conn and executes all that are complete.
+ *
+ * @param conn The \ref serve_conn to read from.
+ * @param cmd_out The \ref strbuf to use for each command's output.
+ * @param cmd_err The \ref strbuf to use for each command's errors.
+ */
+static void serve_conn_read( serve_conn_t *conn, strbuf_t *cmd_out,
+                             strbuf_t *cmd_err ) {
+  assert( conn != NULL );
+
+  char buf[ SERVE_READ_BUF_SIZE ];
+  ssize_t const n = read( conn->fd, buf, sizeof buf );
+  switch ( n ) {
+    case -1:
+      if ( errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK )
+        return;
+      // The client is gone, so there's no one to reply to.
+      conn->is_eof = true;
+      strbuf_reset( &conn->out_sbuf );
+      return;
+    case 0:
+      conn->is_eof = true;
+      break;
+    default:
+      strbuf_putsn( &conn->in_sbuf, buf, STATIC_CAST( size_t, n ) );
+      break;
+  } // switch
+
+  serve_conn_exec( conn, cmd_out, cmd_err );
+}
+
+/**
+ * Writes as much of the pending output of \a conn as possible without
+ * blocking.
+ *
+ * @param conn The \ref serve_conn to write to.
+ */
+static void serve_conn_write( serve_conn_t *conn ) {
+  assert( conn != NULL );
+
+  while ( conn->out_sent < conn->out_sbuf.len ) {
+    ssize_t const n = write(
+      conn->fd, conn->out_sbuf.str + conn->out_sent,
+      conn->out_sbuf.len - conn->out_sent
+    );
+    if ( n == -1 ) {
+      if ( errno == EINTR )
+        continue;
+      if ( errno != EAGAIN && errno != EWOULDBLOCK ) {
+        // The client is gone, so there's no one to reply to.
+        conn->is_eof = true;
+        strbuf_reset( &conn->out_sbuf );
+        conn->out_sent = 0;
+      }
+      return;
+    }
+    conn->out_sent += STATIC_CAST( size_t, n );
+  } // while
+
+  strbuf_reset( &conn->out_sbuf );
+  conn->out_sent = 0;
+}
+
+/**
+ * Forks a child process to serve the client connected to \a fd using the
+ * current session.
+ *
+ * @remarks Since the child starts with a copy-on-write copy of the server's
+ * fully initialized state, it pays nothing for initialization and whatever it
+ * does affects no other client.
+ *
+ * @param listen_fd The listening socket file descriptor.
+ * @param fd The client socket file descriptor.
+ */
+static void serve_fork( int listen_fd, int fd ) {
+  pid_t const pid = fork();
+  if ( pid != 0 ) {                     // parent or fork() failed
+    PJL_IGNORE_RV( close( fd ) );
+    return;
+  }
+
+  //
+  // We're the child: don't use PERROR_EXIT_IF() or exit() since they'd run
+  // the server's atexit() functions.
+  //
+  PJL_IGNORE_RV( close( listen_fd ) );
+  if ( signal( SIGINT, SIG_DFL ) == SIG_ERR ||
+       signal( SIGTERM, SIG_DFL ) == SIG_ERR ||
+       fcntl( fd, F_SETFL, fcntl( fd, F_GETFL ) & ~O_NONBLOCK ) == -1 ) {
+    _exit( EX_OSERR );
+  }
+
+  cdecl_session->is_quit_deferred = true;
+  cdecl_session->is_termless = true;    // output goes to the client
+  serve_conn_t conn = { .fd = fd, .session = cdecl_session };
+  strbuf_init( &conn.in_sbuf );
+  strbuf_init( &conn.out_sbuf );
+  strbuf_t cmd_out, cmd_err;
+  strbuf_init( &cmd_out );
+  strbuf_init( &cmd_err );
+
+  do {
+    serve_conn_read( &conn, &cmd_out, &cmd_err );
+    serve_conn_write( &conn );
+  } while ( !conn.is_eof );
+
+  _exit( EX_OK );
+}
+
+/**
+ * Accepts a new client connection, if any, on \a listen_fd.
+ *
+ * @param listen_fd The listening socket file descriptor.
+ */
+static void serve_accept( int listen_fd ) {
+  int const fd = accept( listen_fd, /*addr=*/NULL, /*addrlen=*/NULL );
+  if ( fd == -1 ) {
+    // The client may have given up already or we're out of descriptors:
+    // either way, just keep serving the other clients.
+    return;
+  }
+  if ( opt_zygote ) {
+    serve_fork( listen_fd, fd );
+    return;
+  }
+  PERROR_EXIT_IF(
+    fcntl( fd, F_SETFL, fcntl( fd, F_GETFL ) | O_NONBLOCK ) == -1, EX_OSERR
+  );
+
+  if ( serve_conns_len == serve_conns_cap ) {
+    serve_conns_cap = serve_conns_cap == 0 ? 8 : serve_conns_cap * 2;
+    REALLOC( serve_conns, serve_conn_t, serve_conns_cap );
+  }
+
+  serve_conn_t *const conn = &serve_conns[ serve_conns_len++ ];
+  *conn = (serve_conn_t){
+    .fd = fd,
+    .session = serve_pool_len > 0 ?
+      serve_pool[ --serve_pool_len ] : serve_session_new()
+  };
+  strbuf_init( &conn->in_sbuf );
+  strbuf_init( &conn->out_sbuf );
+}
+
+/**
+ * Cleans up all server data.
+ */
+static void serve_cleanup( void ) {
+  if ( getpid() != serve_pid )          // a child calling exit()
+    return;
+  for ( size_t i = 0; i < serve_conns_len; ++i ) {
+    serve_conn_t *const conn = &serve_conns[i];
+    PJL_IGNORE_RV( close( conn->fd ) );
+    strbuf_cleanup( &conn->in_sbuf );
+    strbuf_cleanup( &conn->out_sbuf );
+    cdecl_session_free( conn->session );
+  } // for
+  FREE( serve_conns );
+  serve_conns_cap = serve_conns_len = 0;
+
+  while ( serve_pool_len > 0 )
+    cdecl_session_free( serve_pool[ --serve_pool_len ] );
+  FREE( serve_pool );
+
+  PJL_IGNORE_RV( unlink( opt_serve_path ) );
+}
+
+/**
+ * Creates a socket listening on the Unix domain socket \a path.
+ *
+ * @remarks If \a path exists and is a socket that no server is listening on
+ * any more, it's removed first.
+ * @par
+ * The socket is bound to a temporary path and renamed to \a path only once
+ * it's listening so that a client that sees \a path can always connect.
+ *
+ * @param path The path of the socket.
+ * @return Returns the listening socket file descriptor.
+ */
+NODISCARD
+static int serve_listen( char const *path ) {
+  assert( path != NULL );
+
+  static char const TMP_SUFFIX[] = ".tmp";
+  struct sockaddr_un addr = { .sun_family = AF_UNIX };
+  if ( strlen( path ) + STRLITLEN( TMP_SUFFIX ) >= sizeof addr.sun_path )
+    fatal_error( EX_USAGE, "\"%s\": socket path too long\n", path );
+  strcpy( addr.sun_path, path );
+
+  int const fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+  PERROR_EXIT_IF( fd == -1, EX_OSERR );
+
+  struct stat path_stat;
+  if ( lstat( path, &path_stat ) == 0 && S_ISSOCK( path_stat.st_mode ) ) {
+    if ( connect( fd, POINTER_CAST( struct sockaddr*, &addr ),
+                  sizeof addr ) == 0 ) {
+      fatal_error( EX_UNAVAILABLE, "\"%s\": server already running\n", path );
+    }
+    PJL_IGNORE_RV( unlink( path ) );    // stale
+  }
+
+  strcat( addr.sun_path, TMP_SUFFIX );
+  PJL_IGNORE_RV( unlink( addr.sun_path ) );
+  if ( bind( fd, POINTER_CAST( struct sockaddr*, &addr ), sizeof addr ) == -1 )
+    fatal_error( EX_CANTCREAT, "\"%s\": %s\n", addr.sun_path, STRERROR() );
+  if ( listen( fd, SOMAXCONN ) == -1 || rename( addr.sun_path, path ) == -1 ) {
+    int const listen_errno = errno;
+    PJL_IGNORE_RV( unlink( addr.sun_path ) );
+    fatal_error( EX_CANTCREAT, "\"%s\": %s\n", path, strerror( listen_errno ) );
+  }
+  serve_pid = getpid();
+  ATEXIT( &serve_cleanup );
+  PERROR_EXIT_IF(
+    fcntl( fd, F_SETFL, fcntl( fd, F_GETFL ) | O_NONBLOCK ) == -1, EX_OSERR
+  );
+  return fd;
+}
+
+/**
+ * Handles `SIGINT` and `SIGTERM` by stopping serving.
+ *
+ * @param sig_num The signal number.
+ */
+static void serve_signal_handler( int sig_num ) {
+  (void)sig_num;
+  serve_stop = 1;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+int cdecl_client( size_t cli_count, char const *const cli_value[const] ) {
+  assert( opt_client_path != NULL );
+
+  struct sockaddr_un addr = { .sun_family = AF_UNIX };
+  if ( strlen( opt_client_path ) >= sizeof addr.sun_path )
+    fatal_error( EX_USAGE, "\"%s\": socket path too long\n", opt_client_path );
+  strcpy( addr.sun_path, opt_client_path );
+
+  // A server closing the connection after quit must not kill the client.
+  PERROR_EXIT_IF( signal( SIGPIPE, SIG_IGN ) == SIG_ERR, EX_OSERR );
+
+  int const fd = socket( AF_UNIX, SOCK_STREAM, 0 );
+  PERROR_EXIT_IF( fd == -1, EX_OSERR );
+  if ( connect( fd, POINTER_CAST( struct sockaddr*, &addr ),
+                sizeof addr ) == -1 ) {
+    fatal_error( EX_UNAVAILABLE,
+      "\"%s\": %s\n", opt_client_path, STRERROR()
+    );
+  }
+  //
+  // Use separate FILEs for reading and writing since a stream open for both
+  // can't switch from reading to writing without seeking.
+  //
+  FILE *const fin = fdopen( fd, "r" );
+  PERROR_EXIT_IF( fin == NULL, EX_OSERR );
+  int const out_fd = dup( fd );
+  PERROR_EXIT_IF( out_fd == -1, EX_OSERR );
+  FILE *const fout = fdopen( out_fd, "w" );
+  PERROR_EXIT_IF( fout == NULL, EX_OSERR );
+
+  strbuf_t cmd_sbuf, reply_sbuf;
+  strbuf_init( &cmd_sbuf );
+  strbuf_init( &reply_sbuf );
+  int status = EX_OK;
+
+  if ( cli_count > 0 ) {
+    //
+    // Form the command the same way cdecl_parse_cli() does: if the program
+    // name itself is a command, e.g., explain, start with it.
+    //
+    cdecl_command_t const *const command = cdecl_command_find( me );
+    bool space = command != NULL &&
+                 command->kind == CDECL_COMMAND_PROG_NAME;
+    if ( space )
+      strbuf_puts( &cmd_sbuf, me );
+    for ( size_t i = 0; i < cli_count; ++i )
+      strbuf_sepc_puts( &cmd_sbuf, ' ', &space, cli_value[i] );
+    PJL_IGNORE_RV(
+      client_send(
+        fin, fout, cmd_sbuf.str, cmd_sbuf.len, &reply_sbuf, &status
+      )
+    );
+  }
+  else {
+    while ( strbuf_read_line( &cmd_sbuf, /*prog_name=*/NULL, stdin,
+                              /*prompts=*/NULL ) ) {
+      if ( !client_send( fin, fout, cmd_sbuf.str, cmd_sbuf.len, &reply_sbuf,
+                         &status ) ) {
+        break;
+      }
+      strbuf_reset( &cmd_sbuf );
+    } // while
+  }
+
+  PJL_IGNORE_RV( fclose( fout ) );
+  PJL_IGNORE_RV( fclose( fin ) );
+  strbuf_cleanup( &cmd_sbuf );
+  strbuf_cleanup( &reply_sbuf );
+  sink_flush( cdecl_fout );
+  return status;
+}
+
+int cdecl_serve( void ) {
+  assert( opt_serve_path != NULL );
+
+  //
+  // Install the signal handlers before the socket exists so that a signal
+  // sent as soon as the socket appears still makes us clean up.
+  //
+  struct sigaction sa = { .sa_handler = &serve_signal_handler };
+  PERROR_EXIT_IF( sigemptyset( &sa.sa_mask ) == -1, EX_OSERR );
+  PERROR_EXIT_IF( sigaction( SIGINT, &sa, /*oldact=*/NULL ) == -1, EX_OSERR );
+  PERROR_EXIT_IF( sigaction( SIGTERM, &sa, /*oldact=*/NULL ) == -1, EX_OSERR );
+
+  int const listen_fd = serve_listen( opt_serve_path );
+
+  // A client going away while being replied to must not kill the server.
+  PERROR_EXIT_IF( signal( SIGPIPE, SIG_IGN ) == SIG_ERR, EX_OSERR );
+  // Let the system reap child processes.
+  if ( opt_zygote )
+    PERROR_EXIT_IF( signal( SIGCHLD, SIG_IGN ) == SIG_ERR, EX_OSERR );
+
+  struct pollfd *pfds = NULL;
+  size_t pfds_cap = 0;
+  strbuf_t cmd_out, cmd_err;
+  strbuf_init( &cmd_out );
+  strbuf_init( &cmd_err );
+
+  while ( !serve_stop ) {
+    if ( pfds_cap < serve_conns_len + 1 ) {
+      pfds_cap = serve_conns_cap + 1;
+      REALLOC( pfds, struct pollfd, pfds_cap );
+    }
+    pfds[0] = (struct pollfd){ .fd = listen_fd, .events = POLLIN };
+    for ( size_t i = 0; i < serve_conns_len; ++i ) {
+      serve_conn_t const *const conn = &serve_conns[i];
+      pfds[ i + 1 ] = (struct pollfd){
+        .fd = conn->fd,
+        .events = STATIC_CAST( short,
+          (conn->is_eof ? 0 : POLLIN) |
+          (conn->out_sbuf.len > conn->out_sent ? POLLOUT : 0)
+        )
+      };
+    } // for
+
+    if ( poll( pfds, serve_conns_len + 1, /*timeout=*/-1 ) == -1 ) {
+      PERROR_EXIT_IF( errno != EINTR, EX_IOERR );
+      continue;
+    }
+
+    //
+    // Iterate backwards so that closing a connection (which moves the last
+    // connection into its place) doesn't skip any connection.
+    //
+    for ( size_t i = serve_conns_len; i-- > 0; ) {
+      serve_conn_t *const conn = &serve_conns[i];
+      short const revents = pfds[ i + 1 ].revents;
+      if ( (revents & (POLLIN | POLLHUP | POLLERR)) != 0 && !conn->is_eof )
+        serve_conn_read( conn, &cmd_out, &cmd_err );
+      serve_conn_write( conn );
+      if ( conn->is_eof && conn->out_sbuf.len == 0 ) {
+        serve_conn_close( conn );
+        *conn = serve_conns[ --serve_conns_len ];
+      }
+    } // for
+
+    // Accept after handling the others so pfds stays parallel to them.
+    if ( (pfds[0].revents & POLLIN) != 0 )
+      serve_accept( listen_fd );
+  } // while
+
+  free( pfds );
+  strbuf_cleanup( &cmd_out );
+  strbuf_cleanup( &cmd_err );
+  PJL_IGNORE_RV( close( listen_fd ) );
+  return EX_OK;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
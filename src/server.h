@@ -0,0 +1,109 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/server.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_server_H
+#define cdecl_server_H
+
+/**
+ * @file
+ * Declares functions for serving **cdecl** commands over a Unix domain socket
+ * and for being a client of such a server.
+ *
+ * @remarks Most of the time taken by a single invocation of **cdecl** is
+ * spent initializing.  A server initializes once, then executes commands for
+ * any number of concurrent clients, each in its own \ref cdecl_session.
+ * @par
+ * The protocol is:
+ *
+ *  + A client sends one command per line.
+ *  + For each command, the server replies with a line of the form:
+ *
+ *          <status> <out_len> <err_len>
+ *
+ *    where _status_ is the command's `EX_` status code followed by _out_len_
+ *    bytes of what would have been printed to standard output followed by
+ *    _err_len_ bytes of what would have been printed to standard error.
+ *  + After the `quit` command, the server closes the connection.
+ *
+ * @note Every distinct name any client of a server (not a zygote) uses is
+ * interned (see intern.h) and stays in memory until the server exits.  A
+ * zygote's children exit after each connection, so its memory doesn't grow.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stddef.h>                     /* for size_t */
+
+/// @endcond
+
+/**
+ * @defgroup server-group Server
+ * Functions for serving **cdecl** commands and being a client of a server.
+ * @{
+ */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Sends **cdecl** commands to the server listening on the Unix domain socket
+ * \ref opt_client_path and prints the results.
+ *
+ * @remarks If \a cli_count is 0, sends each line read from standard input;
+ * otherwise sends the single command formed by concatenating \a cli_value the
+ * same way cdecl_parse_cli() does.
+ *
+ * @param cli_count The size of \a cli_value.
+ * @param cli_value The command-line argument values, if any.
+ * @return Returns the status of the last command.
+ *
+ * @sa cdecl_serve()
+ */
+NODISCARD
+int cdecl_client( size_t cli_count, char const *const cli_value[const] );
+
+/**
+ * Serves **cdecl** commands on the Unix domain socket \ref opt_serve_path
+ * until either `SIGINT` or `SIGTERM` is received.
+ *
+ * @remarks Each client connection gets its own \ref cdecl_session having the
+ * options of the current session and the types defined by the configuration
+ * file, if any.  Sessions are reused for subsequent connections after being
+ * reset.
+ * @par
+ * If \ref opt_zygote is set, each client connection is instead served by a
+ * child process forked from the server that uses the current session.
+ *
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ *
+ * @sa cdecl_client()
+ */
+NODISCARD
+int cdecl_serve( void );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_server_H */
+/* vim:set et sw=2 ts=2: */
@@ -28,11 +28,13 @@
 #include "set_options.h"
 #include "c_lang.h"
 #include "c_type.h"
+#include "cdecl_session.h"
 #include "did_you_mean.h"
 #include "literals.h"
 #include "options.h"
 #include "print.h"
 #include "prompt.h"
+#include "sink.h"
 #include "slist.h"
 #include "types.h"
 #include "util.h"
@@ -287,7 +289,7 @@ static inline char const* po_bool_value( bool b ) {
 static void print_not_supported( unsigned chars, c_lang_id_t ok_lang_ids ) {
   assert( chars < OPTION_NOT_SUPPORTED_COLUMN - 1 );
   unsigned const align_spaces = OPTION_NOT_SUPPORTED_COLUMN - 1 - chars;
-  FPUTNSP( align_spaces, stdout );
+  sink_putnsp( cdecl_fout, align_spaces );
   PRINTF( "(Not supported%s.)", c_lang_which( ok_lang_ids ) );
 }
 
@@ -411,7 +413,7 @@ static bool set_debug( set_option_fn_args_t const *args ) {
     if ( !ok ) {
       print_error( args->opt_value_loc,
         "\"%s\": invalid value for debug;"
-        " must be *, -, or u\n",
+        " must be *, -, or {m|u}+\n",
         args->opt_value
       );
     }
@@ -728,7 +730,7 @@ static bool set_west_pointer( set_option_fn_args_t const *args ) {
 }
 
 /**
- * Helper function for fput_list() that, given a pointer to a pointer to an
+ * Helper function for sink_put_list() that, given a pointer to a pointer to an
  * slist_node whose data is a `set_option_t*`, returns the option's name.
  *
  * @param ppelt A pointer to the pointer to the element to get the string of.
@@ -766,10 +768,20 @@ static bool strn_nohyphen_equal( char const *s1, char const *s2, size_t n ) {
   return true;
 }
 
-////////// extern functions ///////////////////////////////////////////////////
-
-bool set_option( char const *opt_name, c_loc_t const *opt_name_loc,
-                 char const *opt_value, c_loc_t const *opt_value_loc ) {
+/**
+ * Implements set_option().
+ *
+ * @param opt_name The name of the option to set.
+ * @param opt_name_loc The location of \a opt_name.
+ * @param opt_value The option value, if any.
+ * @param opt_value_loc The location of \a opt_value.
+ * @return Returns `true` only if the option was set successfully.
+ */
+NODISCARD
+static bool set_option_impl( char const *opt_name,
+                             c_loc_t const *opt_name_loc,
+                             char const *opt_value,
+                             c_loc_t const *opt_value_loc ) {
   if ( opt_name == NULL || strcmp( opt_name, L_options ) == 0 ) {
     print_options();
     return true;
@@ -807,7 +819,7 @@ bool set_option( char const *opt_name, c_loc_t const *opt_name_loc,
       print_error( opt_name_loc,
         "\"%s\": ambiguous set option; could be ", orig_name
       );
-      fput_list( stderr, found_opt_list.head, &slist_set_option_gets );
+      sink_put_list( cdecl_ferr, found_opt_list.head, &slist_set_option_gets );
       EPUTC( '\n' );
       slist_cleanup( &found_opt_list, /*free_fn=*/NULL );
       return false;
@@ -865,6 +877,18 @@ bool set_option( char const *opt_name, c_loc_t const *opt_name_loc,
   return (*found_opt->set_fn)( &args );
 }
 
+////////// extern functions ///////////////////////////////////////////////////
+
+bool set_option( char const *opt_name, c_loc_t const *opt_name_loc,
+                 char const *opt_value, c_loc_t const *opt_value_loc ) {
+  cdecl_options_t const prev_opts = cdecl_opts;
+  bool const ok =
+    set_option_impl( opt_name, opt_name_loc, opt_value, opt_value_loc );
+  if ( !cdecl_options_equal( &prev_opts, &cdecl_opts ) )
+    ++cdecl_session->gen;               // invalidate the result cache
+  return ok;
+}
+
 set_option_t const* set_option_next( set_option_t const *opt ) {
   return opt == NULL ? SET_OPTIONS : (++opt)->name == NULL ? NULL : opt;
 }
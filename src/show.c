@@ -34,6 +34,7 @@
 #include "decl_flags.h"
 #include "options.h"
 #include "print.h"
+#include "sink.h"
 
 /// @cond DOXYGEN_IGNORE
 
@@ -58,7 +59,7 @@ struct show_info {
   cdecl_show_t  show;                   ///< Which types to show.
   c_sglob_t     sglob;                  ///< Scoped glob to match, if any.
   unsigned      decl_flags;             ///< Declaration flags.
-  FILE         *tout;                   ///< Where to print the types.
+  sink_t       *tout;                   ///< Where to print the types.
 };
 typedef struct show_info show_info_t;
 
@@ -105,7 +106,7 @@ no_show:
 
 ////////// extern functions ///////////////////////////////////////////////////
 
-void show_type( c_typedef_t const *tdef, unsigned decl_flags, FILE *tout ) {
+void show_type( c_typedef_t const *tdef, unsigned decl_flags, sink_t *tout ) {
   assert( tdef != NULL );
   assert( tout != NULL );
 
@@ -116,11 +117,11 @@ void show_type( c_typedef_t const *tdef, unsigned decl_flags, FILE *tout ) {
     decl_flags |= C_GIB_OPT_SEMICOLON;
 
   print_type_decl( tdef, decl_flags, tout );
-  FPUTC( '\n', tout );
+  sink_putc( tout, '\n' );
 }
 
 void show_types( cdecl_show_t show, char const *glob, unsigned decl_flags,
-                 FILE *tout ) {
+                 sink_t *tout ) {
   assert( tout != NULL );
 
   show_info_t si = {
@@ -30,9 +30,6 @@
 #include "pjl_config.h"                 /* must go first */
 #include "types.h"
 
-// standard
-#include <stdio.h>                      /* for FILE */
-
 /**
  * @defgroup showing-c-types-group Showing C/C++ Types
  * Functions for showing types for the **cdecl** `show` command.
@@ -48,7 +45,7 @@
  *
  * @param tdef The \ref c_typedef to show.
  * @param decl_flags The declaration flags to use.
- * @param tout The `FILE` to print to.
+ * @param tout The \ref sink to print to.
  *
  * @note A newline _is_ printed.
  *
@@ -58,7 +55,7 @@
  * @sa print_type_decl()
  * @sa show_types()
  */
-void show_type( c_typedef_t const *tdef, unsigned decl_flags, FILE *tout );
+void show_type( c_typedef_t const *tdef, unsigned decl_flags, sink_t *tout );
 
 /**
  * Shows (prints) the definition of defined types.
@@ -66,13 +63,13 @@ void show_type( c_typedef_t const *tdef, unsigned decl_flags, FILE *tout );
  * @param show Which types to show.
  * @param glob The glob string; may be NULL.
  * @param decl_flags The declaration flags to use.
- * @param tout The `FILE` to print to.
+ * @param tout The \ref sink to print to.
  *
  * @sa print_type_decl()
  * @sa show_type()
  */
 void show_types( cdecl_show_t show, char const *glob, unsigned decl_flags,
-                 FILE *tout );
+                 sink_t *tout );
 
 ///////////////////////////////////////////////////////////////////////////////
 
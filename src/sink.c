@@ -0,0 +1,484 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/sink.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for output sinks.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "sink.h"
+#include "strbuf.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <errno.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/uio.h>                    /* for writev(2) */
+#include <sysexits.h>
+#include <unistd.h>                     /* for write(2) */
+
+/// @endcond
+
+/**
+ * @addtogroup sink-group
+ * @{
+ */
+
+/**
+ * Size of each chunk of a #SINK_WRITEV \ref sink.
+ */
+#define SINK_WRITEV_CHUNK_SIZE    (64u * 1024u)
+
+/**
+ * Maximum number of full chunks of a #SINK_WRITEV \ref sink before it's
+ * flushed; must be less than `IOV_MAX`.
+ */
+#define SINK_WRITEV_CHUNKS_MAX    64u
+
+/**
+ * Size of the buffer on the stack used by sink_vprintf() for #SINK_FD and
+ * #SINK_WRITEV sinks when the formatted string doesn't fit into the sink's
+ * buffer.
+ */
+#define SINK_PRINTF_BUF_SIZE      256u
+
+///////////////////////////////////////////////////////////////////////////////
+
+// extern variable definitions
+_Thread_local sink_t *cdecl_ferr_redirect;
+_Thread_local sink_t *cdecl_fout_redirect;
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Helper function for sink_put_list() that, given a pointer to a pointer to
+ * an array of pointer to `char`, returns the pointer to the associated string.
+ *
+ * @param ppelt A pointer to the pointer to the element to get the string of.
+ * On return, it is incremented by the size of the element.
+ * @return Returns said string or NULL if none.
+ */
+NODISCARD
+static char const* sink_put_list_apc_gets( void const **ppelt ) {
+  char const *const *const ps = *ppelt;
+  *ppelt = ps + 1;
+  return *ps;
+}
+
+/**
+ * Writes all of \a buf to \a fd.
+ *
+ * @param fd The file descriptor to write to.
+ * @param buf The buffer to write.
+ * @param buf_len The number of bytes of \a buf to write.
+ */
+static void sink_write( int fd, char const *buf, size_t buf_len ) {
+  while ( buf_len > 0 ) {
+    ssize_t const n = write( fd, buf, buf_len );
+    if ( n == -1 ) {
+      PERROR_EXIT_IF( errno != EINTR, EX_IOERR );
+      continue;
+    }
+    buf += n;
+    buf_len -= STATIC_CAST( size_t, n );
+  } // while
+}
+
+/**
+ * Writes all of \a iov to \a fd.
+ *
+ * @param fd The file descriptor to write to.
+ * @param iov The I/O vectors to write.  They are modified.
+ * @param iov_len The number of \a iov.
+ */
+static void sink_writev( int fd, struct iovec *iov, size_t iov_len ) {
+  while ( iov_len > 0 ) {
+    ssize_t const raw_n = writev( fd, iov, STATIC_CAST( int, iov_len ) );
+    if ( raw_n == -1 ) {
+      PERROR_EXIT_IF( errno != EINTR, EX_IOERR );
+      continue;
+    }
+    size_t n = STATIC_CAST( size_t, raw_n );
+    for ( ; iov_len > 0 && n >= iov->iov_len; ++iov, --iov_len )
+      n -= iov->iov_len;
+    if ( iov_len > 0 ) {                // partial write
+      iov->iov_base = STATIC_CAST( char*, iov->iov_base ) + n;
+      iov->iov_len -= n;
+    }
+  } // while
+}
+
+/**
+ * Ensures that there are at least \a n bytes available in the buffer of a
+ * #SINK_FD or #SINK_WRITEV \a sink.
+ *
+ * @param sink The \ref sink to reserve bytes for.
+ * @param n The number of bytes to reserve.
+ * @return Returns `true` only if the bytes are available; `false` only if \a
+ * sink is a #SINK_FD and \a n is larger than its buffer, in which case it has
+ * been flushed.
+ */
+NODISCARD
+static bool sink_fd_reserve( sink_t *sink, size_t n ) {
+  if ( n <= sink->fd.cap - sink->fd.len )
+    return true;
+
+  if ( sink->kind == SINK_FD ) {
+    sink_flush( sink );
+    return n <= sink->fd.cap;
+  }
+
+  //
+  // SINK_WRITEV: retire the current chunk, if any, and start a new one
+  // (possibly larger than usual for n).
+  //
+  if ( sink->fd.len > 0 ) {
+    if ( sink->fd.iov_len == SINK_WRITEV_CHUNKS_MAX ) {
+      sink_flush( sink );               // also writes the current chunk
+    } else {
+      sink->fd.iov[ sink->fd.iov_len++ ] = (struct iovec){
+        .iov_base = sink->fd.buf,
+        .iov_len = sink->fd.len
+      };
+      sink->fd.buf = NULL;
+      sink->fd.len = sink->fd.cap = 0;
+    }
+  }
+  if ( n > sink->fd.cap - sink->fd.len ) {
+    sink->fd.cap = n > SINK_WRITEV_CHUNK_SIZE ? n : SINK_WRITEV_CHUNK_SIZE;
+    REALLOC( sink->fd.buf, char, sink->fd.cap );
+  }
+  return true;
+}
+
+////////// extern functions ///////////////////////////////////////////////////
+
+void sink_cleanup( sink_t *sink ) {
+  if ( sink == NULL )
+    return;
+  sink_flush( sink );
+  switch ( sink->kind ) {
+    case SINK_FILE:
+    case SINK_STRBUF:
+      break;
+    case SINK_WRITEV:
+      FREE( sink->fd.iov );
+      FALLTHROUGH;
+    case SINK_FD:
+      FREE( sink->fd.buf );
+      break;
+  } // switch
+  MEM_ZERO( sink );
+}
+
+void sink_flush( sink_t *sink ) {
+  assert( sink != NULL );
+  switch ( sink->kind ) {
+    case SINK_FILE:
+      FFLUSH( sink->file );
+      break;
+    case SINK_STRBUF:
+      break;
+    case SINK_FD:
+      sink_write( sink->fd.fd, sink->fd.buf, sink->fd.len );
+      sink->fd.len = 0;
+      break;
+    case SINK_WRITEV:
+      if ( sink->fd.len > 0 ) {
+        sink->fd.iov[ sink->fd.iov_len++ ] = (struct iovec){
+          .iov_base = sink->fd.buf,
+          .iov_len = sink->fd.len
+        };
+      }
+      if ( sink->fd.iov_len == 0 )
+        break;
+      //
+      // Remember the chunks to free since sink_writev() modifies iov.
+      //
+      char *chunks[ SINK_WRITEV_CHUNKS_MAX + 1 ];
+      for ( size_t i = 0; i < sink->fd.iov_len; ++i )
+        chunks[i] = sink->fd.iov[i].iov_base;
+      sink_writev( sink->fd.fd, sink->fd.iov, sink->fd.iov_len );
+      for ( size_t i = 0; i < sink->fd.iov_len; ++i ) {
+        if ( chunks[i] != sink->fd.buf )  // keep the current chunk
+          free( chunks[i] );
+      } // for
+      sink->fd.len = sink->fd.iov_len = 0;
+      break;
+  } // switch
+}
+
+void sink_init_fd( sink_t *sink, int fd, size_t buf_size ) {
+  assert( sink != NULL );
+  assert( fd >= 0 );
+  if ( buf_size == 0 )
+    buf_size = SINK_FD_BUF_SIZE_DEFAULT;
+  *sink = (sink_t){
+    .kind = SINK_FD,
+    .fd = { .fd = fd, .buf = MALLOC( char, buf_size ), .cap = buf_size }
+  };
+}
+
+void sink_init_file( sink_t *sink, FILE *file ) {
+  assert( sink != NULL );
+  assert( file != NULL );
+  *sink = (sink_t){ .kind = SINK_FILE, .file = file };
+}
+
+void sink_init_strbuf( sink_t *sink, strbuf_t *sbuf ) {
+  assert( sink != NULL );
+  assert( sbuf != NULL );
+  *sink = (sink_t){ .kind = SINK_STRBUF, .sbuf = sbuf };
+}
+
+void sink_init_writev( sink_t *sink, int fd ) {
+  assert( sink != NULL );
+  assert( fd >= 0 );
+  *sink = (sink_t){
+    .kind = SINK_WRITEV,
+    .fd = {
+      .fd = fd,
+      .buf = MALLOC( char, SINK_WRITEV_CHUNK_SIZE ),
+      .cap = SINK_WRITEV_CHUNK_SIZE,
+      .iov = MALLOC( struct iovec, SINK_WRITEV_CHUNKS_MAX + 1 )
+    }
+  };
+}
+
+void sink_printf( sink_t *sink, char const *format, ... ) {
+  va_list args;
+  va_start( args, format );
+  sink_vprintf( sink, format, args );
+  va_end( args );
+}
+
+void sink_put_list( sink_t *sink, void const *elt,
+                    char const* (*gets)( void const** ) ) {
+  assert( sink != NULL );
+  assert( elt != NULL );
+
+  if ( gets == NULL )
+    gets = &sink_put_list_apc_gets;
+
+  char const *s = (*gets)( &elt );
+  for ( size_t i = 0; s != NULL; ++i ) {
+    char const *const next_s = (*gets)( &elt );
+    if ( i > 0 )
+      sink_puts( sink, next_s != NULL ? ", " : i > 1 ? ", or " : " or " );
+    sink_puts( sink, s );
+    s = next_s;
+  } // for
+}
+
+void sink_put_sep( sink_t *sink, char const *sep, bool *sep_flag ) {
+  assert( sep_flag != NULL );
+  if ( true_or_set( sep_flag ) )
+    sink_puts( sink, sep );
+}
+
+void sink_putc( sink_t *sink, char c ) {
+  assert( sink != NULL );
+  switch ( sink->kind ) {
+    case SINK_FILE:
+      FPUTC( c, sink->file );
+      break;
+    case SINK_STRBUF:
+      strbuf_putc( sink->sbuf, c );
+      break;
+    case SINK_FD:
+    case SINK_WRITEV:
+      PJL_IGNORE_RV( sink_fd_reserve( sink, 1 ) );
+      sink->fd.buf[ sink->fd.len++ ] = c;
+      break;
+  } // switch
+}
+
+void sink_putnsp( sink_t *sink, size_t n ) {
+  static char const SPACES[] = "                                ";
+  while ( n > 0 ) {
+    size_t const n_put = n < STRLITLEN( SPACES ) ? n : STRLITLEN( SPACES );
+    sink_putsn( sink, SPACES, n_put );
+    n -= n_put;
+  } // while
+}
+
+void sink_puts( sink_t *sink, char const *s ) {
+  assert( s != NULL );
+  sink_putsn( sink, s, strlen( s ) );
+}
+
+void sink_puts_quoted( sink_t *sink, char const *s, char quote ) {
+  assert( quote == '\'' || quote == '"' );
+
+  if ( s == NULL ) {
+    sink_puts( sink, "null" );
+    return;
+  }
+
+  bool in_quote = false;
+  char const other_quote = quote == '\'' ? '"' : '\'';
+
+  sink_putc( sink, quote );
+  for ( char prev = '\0'; *s != '\0'; prev = *s++ ) {
+    switch ( *s ) {
+      case '\b': sink_puts( sink, "\\b" ); continue;
+      case '\f': sink_puts( sink, "\\f" ); continue;
+      case '\n': sink_puts( sink, "\\n" ); continue;
+      case '\r': sink_puts( sink, "\\r" ); continue;
+      case '\t': sink_puts( sink, "\\t" ); continue;
+      case '\v': sink_puts( sink, "\\v" ); continue;
+      case '\\':
+        if ( in_quote ) {
+          if ( prev != '\\' )
+            sink_puts( sink, "\\\\" );
+          continue;
+        }
+        break;
+    } // switch
+
+    if ( prev != '\\' ) {
+      if ( *s == quote ) {
+        sink_putc( sink, '\\' );
+        in_quote = !in_quote;
+      }
+      else if ( *s == other_quote ) {
+        in_quote = !in_quote;
+      }
+    }
+
+    sink_putc( sink, *s );
+  } // for
+  sink_putc( sink, quote );
+}
+
+void sink_puts_sp( sink_t *sink, char const *s ) {
+  assert( s != NULL );
+  if ( s[0] != '\0' ) {
+    sink_puts( sink, s );
+    sink_putc( sink, ' ' );
+  }
+}
+
+void sink_putsn( sink_t *sink, char const *s, size_t s_len ) {
+  assert( sink != NULL );
+  assert( s != NULL );
+  switch ( sink->kind ) {
+    case SINK_FILE:
+      PERROR_EXIT_IF(
+        fwrite( s, 1, s_len, sink->file ) < s_len, EX_IOERR
+      );
+      break;
+    case SINK_STRBUF:
+      strbuf_putsn( sink->sbuf, s, s_len );
+      break;
+    case SINK_FD:
+    case SINK_WRITEV:
+      if ( !sink_fd_reserve( sink, s_len ) ) {
+        sink_write( sink->fd.fd, s, s_len );
+        break;
+      }
+      memcpy( sink->fd.buf + sink->fd.len, s, s_len );
+      sink->fd.len += s_len;
+      break;
+  } // switch
+}
+
+sink_t* sink_stderr( void ) {
+  static _Thread_local sink_t sink;
+  if ( unlikely( sink.file == NULL ) )
+    sink_init_file( &sink, stderr );
+  return &sink;
+}
+
+sink_t* sink_stdout( void ) {
+  static _Thread_local sink_t sink;
+  if ( unlikely( sink.file == NULL ) )
+    sink_init_file( &sink, stdout );
+  return &sink;
+}
+
+#ifdef __GNUC__
+# pragma GCC diagnostic push
+# pragma GCC diagnostic ignored "-Wformat-nonliteral"
+#endif /* __GNUC__ */
+
+void sink_vprintf( sink_t *sink, char const *format, va_list args ) {
+  assert( sink != NULL );
+  assert( format != NULL );
+
+  switch ( sink->kind ) {
+    case SINK_FILE:
+      PERROR_EXIT_IF( vfprintf( sink->file, format, args ) < 0, EX_IOERR );
+      return;
+    case SINK_STRBUF:
+      strbuf_vprintf( sink->sbuf, format, args );
+      return;
+    case SINK_FD:
+    case SINK_WRITEV:
+      break;
+  } // switch
+
+  //
+  // Attempt to print directly into the sink's buffer: vsnprintf() returns the
+  // number of characters that _would_ have been printed if the buffer were
+  // unlimited.
+  //
+  size_t const buf_rem = sink->fd.cap - sink->fd.len;
+  va_list args_copy;
+  va_copy( args_copy, args );
+  int const raw_len =
+    vsnprintf( sink->fd.buf + sink->fd.len, buf_rem, format, args_copy );
+  va_end( args_copy );
+  PERROR_EXIT_IF( raw_len < 0, EX_IOERR );
+  size_t const len = STATIC_CAST( size_t, raw_len );
+
+  if ( len < buf_rem ) {                // < to leave room for the '\0'
+    sink->fd.len += len;
+    return;
+  }
+
+  char stack_buf[ SINK_PRINTF_BUF_SIZE ];
+  char *const buf = len < SINK_PRINTF_BUF_SIZE ?
+    stack_buf : MALLOC( char, len + 1/*\0*/ );
+  va_copy( args_copy, args );
+  PERROR_EXIT_IF( vsnprintf( buf, len + 1, format, args_copy ) < 0, EX_IOERR );
+  va_end( args_copy );
+  sink_putsn( sink, buf, len );
+  if ( buf != stack_buf )
+    free( buf );
+}
+
+#ifdef __GNUC__
+# pragma GCC diagnostic pop
+#endif /* __GNUC__ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,430 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/sink.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_sink_H
+#define cdecl_sink_H
+
+/**
+ * @file
+ * Declares a type and functions for output sinks as well as the per-thread
+ * sinks for output and errors.
+ *
+ * @remarks A _sink_ is where output is printed to.  All output of commands is
+ * printed to sinks rather than directly to `FILE`s so that:
+ *
+ *  + Library callers can receive output as strings directly.
+ *  + High-throughput runs can avoid stdio locking and reduce the number of
+ *    system calls.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "strbuf.h"
+#include "types.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>                     /* for size_t */
+#include <stdio.h>                      /* for FILE */
+
+/// @endcond
+
+/**
+ * @defgroup sink-group Output Sinks
+ * A type and functions for output sinks.
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Shorthand for printing to #cdecl_ferr.
+ *
+ * @param ... The `printf()` arguments.
+ *
+ * @sa #EPUTC()
+ * @sa #EPUTS()
+ * @sa #PRINTF()
+ */
+#define EPRINTF(...)              sink_printf( cdecl_ferr, __VA_ARGS__ )
+
+/**
+ * Shorthand for printing a character to #cdecl_ferr.
+ *
+ * @param C The character to print.
+ *
+ * @sa #EPRINTF()
+ * @sa #EPUTS()
+ * @sa #PUTC()
+ */
+#define EPUTC(C)                  sink_putc( cdecl_ferr, (C) )
+
+/**
+ * Shorthand for printing a C string to #cdecl_ferr.
+ *
+ * @param S The C string to print.
+ *
+ * @sa #EPRINTF()
+ * @sa #EPUTC()
+ * @sa #PUTS()
+ */
+#define EPUTS(S)                  sink_puts( cdecl_ferr, (S) )
+
+/**
+ * Shorthand for printing to #cdecl_fout.
+ *
+ * @param ... The `printf()` arguments.
+ *
+ * @sa #EPRINTF()
+ * @sa #PUTC()
+ * @sa #PUTS()
+ */
+#define PRINTF(...)               sink_printf( cdecl_fout, __VA_ARGS__ )
+
+/**
+ * Shorthand for printing a character to #cdecl_fout.
+ *
+ * @param C The character to print.
+ *
+ * @sa #EPUTC()
+ * @sa #PRINTF()
+ * @sa #PUTS()
+ */
+#define PUTC(C)                   sink_putc( cdecl_fout, (C) )
+
+/**
+ * Shorthand for printing a C string to #cdecl_fout.
+ *
+ * @param S The C string to print.
+ *
+ * @note Unlike **puts**(3), does _not_ print a newline.
+ *
+ * @sa #EPUTS()
+ * @sa #PRINTF()
+ * @sa #PUTC()
+ */
+#define PUTS(S)                   sink_puts( cdecl_fout, (S) )
+
+/**
+ * The \ref sink that errors and warnings are printed to by the calling
+ * thread: \ref cdecl_ferr_redirect if set; standard error otherwise.
+ *
+ * @sa #cdecl_fout
+ */
+#define cdecl_ferr \
+  (cdecl_ferr_redirect != NULL ? cdecl_ferr_redirect : sink_stderr())
+
+/**
+ * The \ref sink that output is printed to by the calling thread: \ref
+ * cdecl_fout_redirect if set; standard output otherwise.
+ *
+ * @sa #cdecl_ferr
+ */
+#define cdecl_fout \
+  (cdecl_fout_redirect != NULL ? cdecl_fout_redirect : sink_stdout())
+
+/**
+ * Size of the buffer of a #SINK_FD \ref sink when none is given.
+ */
+#define SINK_FD_BUF_SIZE_DEFAULT  (64u * 1024u)
+
+/**
+ * Kinds of \ref sink.
+ */
+enum sink_kind {
+  /**
+   * Prints to a `FILE` via stdio.
+   */
+  SINK_FILE,
+
+  /**
+   * Appends onto a \ref strbuf.
+   */
+  SINK_STRBUF,
+
+  /**
+   * Buffers output and **write**(2)s it to a file descriptor only when the
+   * buffer is full or flushed.
+   */
+  SINK_FD,
+
+  /**
+   * Buffers output in a list of chunks and **writev**(2)s all of them to a
+   * file descriptor at once only when the list is full or flushed.  Unlike
+   * #SINK_FD, the buffer grows by adding chunks rather than by copying.
+   */
+  SINK_WRITEV
+};
+typedef enum sink_kind sink_kind_t;
+
+/**
+ * An output sink.
+ *
+ * @remarks A sink that buffers output must be flushed via sink_flush() (or
+ * cleaned up via sink_cleanup()) for output to appear.
+ */
+struct sink {
+  sink_kind_t     kind;                 ///< Kind of sink.
+  union {
+    FILE         *file;                 ///< #SINK_FILE `FILE`.
+    strbuf_t     *sbuf;                 ///< #SINK_STRBUF string buffer.
+
+    /**
+     * #SINK_FD and #SINK_WRITEV members.
+     */
+    struct {
+      int           fd;                 ///< File descriptor to write to.
+      char         *buf;                ///< Buffer (current chunk).
+      size_t        len;                ///< Length of \ref buf.
+      size_t        cap;                ///< Capacity of \ref buf.
+      struct iovec *iov;                ///< #SINK_WRITEV full chunks.
+      size_t        iov_len;            ///< Number of \ref iov.
+    } fd;
+  };
+};
+
+///////////////////////////////////////////////////////////////////////////////
+
+// extern variables
+
+/**
+ * If not NULL, output the calling thread would print to standard output is
+ * printed here instead.
+ *
+ * @sa #cdecl_fout
+ */
+extern _Thread_local sink_t *cdecl_fout_redirect;
+
+/**
+ * If not NULL, errors and warnings the calling thread would print to standard
+ * error are printed here instead.
+ *
+ * @sa #cdecl_ferr
+ */
+extern _Thread_local sink_t *cdecl_ferr_redirect;
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Flushes \a sink, then frees all memory associated with it, but does _not_
+ * free \a sink itself nor close its `FILE` or file descriptor, if any.
+ *
+ * @param sink The \ref sink to clean up.  If NULL, does nothing.
+ *
+ * @sa sink_init_fd()
+ * @sa sink_init_writev()
+ */
+void sink_cleanup( sink_t *sink );
+
+/**
+ * Writes all output buffered by \a sink, if any.
+ *
+ * @param sink The \ref sink to flush.
+ */
+void sink_flush( sink_t *sink );
+
+/**
+ * Initializes a #SINK_FD \ref sink.
+ *
+ * @param sink The \ref sink to initialize.
+ * @param fd The file descriptor to write to.
+ * @param buf_size The size of the buffer or 0 for \ref
+ * SINK_FD_BUF_SIZE_DEFAULT.
+ *
+ * @sa sink_cleanup()
+ */
+void sink_init_fd( sink_t *sink, int fd, size_t buf_size );
+
+/**
+ * Initializes a #SINK_FILE \ref sink.
+ *
+ * @param sink The \ref sink to initialize.
+ * @param file The `FILE` to print to.
+ */
+void sink_init_file( sink_t *sink, FILE *file );
+
+/**
+ * Initializes a #SINK_STRBUF \ref sink.
+ *
+ * @param sink The \ref sink to initialize.
+ * @param sbuf The \ref strbuf to append onto.
+ */
+void sink_init_strbuf( sink_t *sink, strbuf_t *sbuf );
+
+/**
+ * Initializes a #SINK_WRITEV \ref sink.
+ *
+ * @param sink The \ref sink to initialize.
+ * @param fd The file descriptor to write to.
+ *
+ * @sa sink_cleanup()
+ */
+void sink_init_writev( sink_t *sink, int fd );
+
+/**
+ * Prints a zero-or-more element list of strings where for:
+ *
+ *  + A zero-element list, nothing is printed;
+ *  + A one-element list, the string for the element is printed;
+ *  + A two-element list, the strings for the elements are printed separated by
+ *    `or`;
+ *  + A three-or-more element list, the strings for the first N-1 elements are
+ *    printed separated by `,` and the N-1st and Nth elements are separated by
+ *    `, or`.
+ *
+ * @param sink The \ref sink to print to.
+ * @param elt A pointer to the first element to print.
+ * @param gets A pointer to a function to call to get the string for the
+ * element `**ppelt`: if the function returns NULL, it signals the end of the
+ * list; otherwise, the function returns the string for the element and must
+ * increment `*ppelt` to the next element.  If \a gets is NULL, it is assumed
+ * that \a elt points to the first element of an array of `char*` and that the
+ * array ends with NULL.
+ *
+ * @warning The string pointer returned by \a gets for a given element _must_
+ * remain valid at least until after the _next_ call to sink_put_list(), that
+ * is upon return, the previously returned string pointer must still be valid
+ * also.
+ */
+void sink_put_list( sink_t *sink, void const *elt,
+                    char const* (*gets)( void const **ppelt ) );
+
+/**
+ * Possibly prints the list separator \a sep based on \a sep_flag.
+ *
+ * @param sink The \ref sink to print to.
+ * @param sep The separator to print.
+ * @param sep_flag If `true`, prints \a sep; if `false`, prints nothing, but
+ * sets it to `true`.  The flag should be `false` initially.
+ */
+void sink_put_sep( sink_t *sink, char const *sep, bool *sep_flag );
+
+/**
+ * Prints \a c to \a sink.
+ *
+ * @param sink The \ref sink to print to.
+ * @param c The character to print.
+ *
+ * @sa sink_puts()
+ */
+void sink_putc( sink_t *sink, char c );
+
+/**
+ * Prints \a n spaces to \a sink.
+ *
+ * @param sink The \ref sink to print to.
+ * @param n The number of spaces to print.
+ */
+void sink_putnsp( sink_t *sink, size_t n );
+
+/**
+ * Prints \a s to \a sink.
+ *
+ * @param sink The \ref sink to print to.
+ * @param s The string to print.
+ *
+ * @sa sink_putc()
+ * @sa sink_putsn()
+ */
+void sink_puts( sink_t *sink, char const *s );
+
+/**
+ * Prints \a s as a quoted string with escaped characters.
+ *
+ * @param sink The \ref sink to print to.
+ * @param s The string to put.  If NULL, prints `null` (unquoted).
+ * @param quote The quote character to use, either <tt>'</tt> or <tt>"</tt>.
+ */
+void sink_puts_quoted( sink_t *sink, char const *s, char quote );
+
+/**
+ * If \a s is not empty, prints \a s followed by a space to \a sink; otherwise
+ * does nothing.
+ *
+ * @param sink The \ref sink to print to.
+ * @param s The string to print.
+ */
+void sink_puts_sp( sink_t *sink, char const *s );
+
+/**
+ * Prints \a s_len bytes of \a s to \a sink.
+ *
+ * @param sink The \ref sink to print to.
+ * @param s The string to print.  It need not be null-terminated.
+ * @param s_len The number of bytes of \a s to print.
+ *
+ * @sa sink_puts()
+ */
+void sink_putsn( sink_t *sink, char const *s, size_t s_len );
+
+/**
+ * Prints the `printf`-style arguments to \a sink.
+ *
+ * @param sink The \ref sink to print to.
+ * @param format The `printf()` style format string.
+ * @param ... The `printf()` arguments.
+ *
+ * @sa sink_vprintf()
+ */
+PJL_PRINTF_LIKE_FUNC(2)
+void sink_printf( sink_t *sink, char const *format, ... );
+
+/**
+ * Gets the calling thread's #SINK_FILE \ref sink for standard error.
+ *
+ * @return Returns said \ref sink.
+ *
+ * @sa #cdecl_ferr
+ * @sa sink_stdout()
+ */
+NODISCARD
+sink_t* sink_stderr( void );
+
+/**
+ * Gets the calling thread's #SINK_FILE \ref sink for standard output.
+ *
+ * @return Returns said \ref sink.
+ *
+ * @sa #cdecl_fout
+ * @sa sink_stderr()
+ */
+NODISCARD
+sink_t* sink_stdout( void );
+
+/**
+ * Like sink_printf() except takes a `va_list`.
+ *
+ * @param sink The \ref sink to print to.
+ * @param format The `printf()` style format string.
+ * @param args The `printf()` arguments.
+ *
+ * @sa sink_printf()
+ */
+void sink_vprintf( sink_t *sink, char const *format, va_list args );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_sink_H */
+/* vim:set et sw=2 ts=2: */
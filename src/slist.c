@@ -34,11 +34,136 @@
 
 // standard
 #include <assert.h>
+#include <stdatomic.h>
 #include <stddef.h>                     /* for NULL */
 #include <stdint.h>
+#include <stdlib.h>
 
 /// @endcond
 
+/**
+ * The number of nodes per block of the node pool.
+ */
+#define SLIST_POOL_BLOCK_SIZE     128
+
+/**
+ * A block of nodes of the node pool.
+ */
+struct slist_pool_block {
+  struct slist_pool_block  *next;       ///< Next block, if any.
+  slist_node_t              node[ SLIST_POOL_BLOCK_SIZE ];  ///< The nodes.
+};
+typedef struct slist_pool_block slist_pool_block_t;
+
+// local variables
+
+/// All blocks of the node pool.
+static slist_pool_block_t *pool_blocks;
+
+/// Free nodes of the node pool.
+static slist_node_t       *pool_free_nodes;
+
+/**
+ * Spin lock guarding the node pool.
+ *
+ * @remarks The pool is process-wide rather than per-thread since a list may
+ * outlive the thread that created it, e.g., a list belonging to a session
+ * used by one thread, then another.  A per-thread pool would then have a node
+ * of one thread's block on another's free list.  Each critical section is
+ * only a few instructions, so a spin lock suffices.
+ */
+static atomic_flag         pool_lock = ATOMIC_FLAG_INIT;
+
+/// Node pool statistics.
+static slist_pool_stats_t  pool_stats;
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Acquires \ref pool_lock.
+ *
+ * @sa pool_lock_release()
+ */
+static inline void pool_lock_acquire( void ) {
+  while ( atomic_flag_test_and_set_explicit( &pool_lock,
+                                             memory_order_acquire ) )
+    ;
+}
+
+/**
+ * Releases \ref pool_lock.
+ *
+ * @sa pool_lock_acquire()
+ */
+static inline void pool_lock_release( void ) {
+  atomic_flag_clear_explicit( &pool_lock, memory_order_release );
+}
+
+/**
+ * Gets a new node from the node pool.
+ *
+ * @return Returns a pointer to a new, uninitialized node.
+ *
+ * @sa pool_free_node()
+ * @sa pool_free_nodes_list()
+ */
+NODISCARD
+static slist_node_t* pool_alloc_node( void ) {
+  pool_lock_acquire();
+  if ( unlikely( pool_free_nodes == NULL ) ) {
+    slist_pool_block_t *const block = MALLOC( slist_pool_block_t, 1 );
+    block->next = pool_blocks;
+    pool_blocks = block;
+    ++pool_stats.block_allocs;
+    //
+    // Thread all of the block's nodes onto the free list.
+    //
+    for ( size_t i = 0; i < SLIST_POOL_BLOCK_SIZE - 1; ++i )
+      block->node[i].next = &block->node[i + 1];
+    block->node[ SLIST_POOL_BLOCK_SIZE - 1 ].next = NULL;
+    pool_free_nodes = &block->node[0];
+  }
+
+  slist_node_t *const node = pool_free_nodes;
+  pool_free_nodes = node->next;
+  ++pool_stats.node_allocs;
+  pool_lock_release();
+  return node;
+}
+
+/**
+ * Returns \a node to the node pool.
+ *
+ * @param node A pointer to the node to return.
+ *
+ * @sa pool_alloc_node()
+ * @sa pool_free_nodes_list()
+ */
+static inline void pool_free_node( slist_node_t *node ) {
+  pool_lock_acquire();
+  node->next = pool_free_nodes;
+  pool_free_nodes = node;
+  ++pool_stats.node_frees;
+  pool_lock_release();
+}
+
+/**
+ * Returns all nodes of \a list to the node pool in O(1).
+ *
+ * @param list A pointer to the \ref slist whose nodes to return.
+ *
+ * @sa pool_free_node()
+ */
+static void pool_free_nodes_list( slist_t const *list ) {
+  if ( list->head == NULL )
+    return;
+  pool_lock_acquire();
+  list->tail->next = pool_free_nodes;
+  pool_free_nodes = list->head;
+  pool_stats.node_frees += list->len;
+  pool_lock_release();
+}
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 void* slist_at_nocheck( slist_t const *list, size_t offset ) {
@@ -61,22 +186,12 @@ void slist_cleanup( slist_t *list, slist_free_fn_t free_fn ) {
   if ( list == NULL )
     return;
 
-  slist_node_t *curr = list->head, *next;
-
-  if ( free_fn == NULL ) {              // avoid repeated check in loop
-    for ( ; curr != NULL; curr = next ) {
-      next = curr->next;
-      free( curr );
-    } // for
-  }
-  else {
-    for ( ; curr != NULL; curr = next ) {
+  if ( free_fn != NULL ) {
+    FOREACH_SLIST_NODE( curr, list )
       (*free_fn)( curr->data );
-      next = curr->next;
-      free( curr );
-    } // for
   }
 
+  pool_free_nodes_list( list );
   slist_init( list );
 }
 
@@ -156,7 +271,7 @@ bool slist_free_if( slist_t *list, slist_pred_fn_t pred_fn,
     if ( list->tail == curr )
       list->tail = NULL;
     list->head = curr->next;
-    free( curr );
+    pool_free_node( curr );
     --list->len;
   } // for
 
@@ -177,7 +292,7 @@ bool slist_free_if( slist_t *list, slist_pred_fn_t pred_fn,
     if ( list->tail == curr )
       list->tail = prev;
     prev->next = curr->next;
-    free( curr );
+    pool_free_node( curr );
     --list->len;
   } // for
 
@@ -185,6 +300,22 @@ done:
   return list->len < len_orig;
 }
 
+void slist_pool_cleanup( void ) {
+  while ( pool_blocks != NULL ) {
+    slist_pool_block_t *const next = pool_blocks->next;
+    free( pool_blocks );
+    pool_blocks = next;
+  } // while
+  pool_free_nodes = NULL;
+}
+
+slist_pool_stats_t slist_pool_stats( void ) {
+  pool_lock_acquire();
+  slist_pool_stats_t const stats = pool_stats;
+  pool_lock_release();
+  return stats;
+}
+
 slist_t slist_move( slist_t *list ) {
   slist_t rv_list;
   if ( list != NULL ) {
@@ -202,7 +333,7 @@ void* slist_pop_front( slist_t *list ) {
     return NULL;
   void *const data = list->head->data;
   slist_node_t *const next = list->head->next;
-  free( list->head );
+  pool_free_node( list->head );
   list->head = next;
   if ( list->head == NULL )
     list->tail = NULL;
@@ -212,7 +343,7 @@ void* slist_pop_front( slist_t *list ) {
 
 void slist_push_back( slist_t *list, void *data ) {
   assert( list != NULL );
-  slist_node_t *const new_tail = MALLOC( slist_node_t, 1 );
+  slist_node_t *const new_tail = pool_alloc_node();
   new_tail->data = data;
   new_tail->next = NULL;
 
@@ -230,7 +361,7 @@ void slist_push_back( slist_t *list, void *data ) {
 
 void slist_push_front( slist_t *list, void *data ) {
   assert( list != NULL );
-  slist_node_t *const new_head = MALLOC( slist_node_t, 1 );
+  slist_node_t *const new_head = pool_alloc_node();
   new_head->data = data;
   new_head->next = list->head;
   list->head = new_head;
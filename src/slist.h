@@ -138,12 +138,29 @@ struct slist {
 
 /**
  * Singly-linked-list node.
+ *
+ * @note Nodes are allocated from and returned to a process-wide pool of nodes,
+ * so a node created by any slist function must never be freed via **free**(3)
+ * directly.  Since the pool is shared, a list may be created on one thread
+ * and cleaned up on another.
  */
 struct slist_node {
   slist_node_t *next;                   ///< Pointer to next node or NULL.
   void         *data;                   ///< Pointer to node's data.
 };
 
+/**
+ * Statistics for the pool of \ref slist_node objects.
+ *
+ * @sa slist_pool_stats()
+ */
+struct slist_pool_stats {
+  size_t  block_allocs;                 ///< Blocks of nodes **malloc**(3)'d.
+  size_t  node_allocs;                  ///< Nodes handed out from the pool.
+  size_t  node_frees;                   ///< Nodes returned to the pool.
+};
+typedef struct slist_pool_stats slist_pool_stats_t;
+
 ////////// extern functions ///////////////////////////////////////////////////
 
 /**
@@ -232,6 +249,26 @@ PJL_DISCARD
 bool slist_free_if( slist_t *list, slist_pred_fn_t pred_fn,
                     user_data_t user_data );
 
+/**
+ * Frees all memory used by the pool of \ref slist_node objects.
+ *
+ * @warning All nodes of all lists created by any thread are invalid upon
+ * return, so this must be called only just before the program terminates.
+ *
+ * @sa slist_pool_stats()
+ */
+void slist_pool_cleanup( void );
+
+/**
+ * Gets the statistics for the pool of \ref slist_node objects.
+ *
+ * @return Returns said statistics.
+ *
+ * @sa slist_pool_cleanup()
+ */
+NODISCARD
+slist_pool_stats_t slist_pool_stats( void );
+
 /**
  * Pops data from the front of \a list.
  *
@@ -21,6 +21,7 @@
 // local
 #include "pjl_config.h"                 /* must go first */
 #include "slist.h"
+#include "sink.h"
 #include "util.h"
 #include "unit_test.h"
 
@@ -30,6 +31,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sysexits.h>
+#include <time.h>
 
 ///////////////////////////////////////////////////////////////////////////////
 
@@ -318,6 +320,43 @@ static bool test_slist_pop_front( void ) {
   TEST_FN_END();
 }
 
+static bool test_slist_pool( void ) {
+  TEST_FN_BEGIN();
+  slist_t list;
+  slist_init( &list );
+
+  // warm up the pool so it has at least one block
+  slist_push_back( &list, (void*)"A" );
+  slist_cleanup( &list, /*free_fn=*/NULL );
+
+  slist_pool_stats_t const stats1 = slist_pool_stats();
+  TEST( stats1.node_allocs == stats1.node_frees );
+
+  // nodes returned by slist_cleanup() are reused
+  slist_push_back( &list, (void*)"A" );
+  slist_push_back( &list, (void*)"B" );
+  slist_push_front( &list, (void*)"C" );
+  slist_cleanup( &list, /*free_fn=*/NULL );
+  slist_push_back( &list, (void*)"A" );
+  slist_push_back( &list, (void*)"B" );
+  slist_push_back( &list, (void*)"C" );
+
+  // nodes returned by slist_pop_front() and slist_free_if() are reused
+  PJL_IGNORE_RV( slist_pop_front( &list ) );
+  str_equal_to = "B";
+  slist_free_if( &list, &slist_node_str_equal, USER_DATA_ZERO );
+  slist_push_back( &list, (void*)"D" );
+  slist_push_back( &list, (void*)"E" );
+  slist_cleanup( &list, /*free_fn=*/NULL );
+
+  slist_pool_stats_t const stats2 = slist_pool_stats();
+  TEST( stats2.block_allocs == stats1.block_allocs );
+  TEST( stats2.node_allocs == stats1.node_allocs + 8 );
+  TEST( stats2.node_frees == stats2.node_allocs );
+
+  TEST_FN_END();
+}
+
 static bool test_slist_push_front( void ) {
   TEST_FN_BEGIN();
   slist_t list;
@@ -643,6 +682,54 @@ static void usage( void ) {
 }
 // LCOV_EXCL_STOP
 
+/**
+ * Benchmarks pooled slist nodes against a **malloc**(3) and **free**(3) per
+ * node, the latter being how nodes were allocated before the pool, and prints
+ * the results.
+ */
+static void bench_slist_pool( void ) {
+  enum { ITERATIONS = 100000, LIST_LEN = 8 };
+  slist_pool_stats_t const stats1 = slist_pool_stats();
+
+  clock_t start = clock();
+  for ( unsigned i = 0; i < ITERATIONS; ++i ) {
+    slist_t list;
+    slist_init( &list );
+    for ( unsigned j = 0; j < LIST_LEN; ++j )
+      slist_push_back( &list, (void*)"A" );
+    slist_cleanup( &list, /*free_fn=*/NULL );
+  } // for
+  double const pool_ms =
+    (double)(clock() - start) * 1000 / (double)CLOCKS_PER_SEC;
+
+  slist_pool_stats_t const stats2 = slist_pool_stats();
+
+  start = clock();
+  for ( unsigned i = 0; i < ITERATIONS; ++i ) {
+    slist_node_t *head = NULL;
+    for ( unsigned j = 0; j < LIST_LEN; ++j ) {
+      slist_node_t *const node = MALLOC( slist_node_t, 1 );
+      *node = (slist_node_t){ head, (void*)"A" };
+      head = node;
+    } // for
+    while ( head != NULL ) {
+      slist_node_t *const next = head->next;
+      free( head );
+      head = next;
+    } // while
+  } // for
+  double const malloc_ms =
+    (double)(clock() - start) * 1000 / (double)CLOCKS_PER_SEC;
+
+  printf(
+    "%s: %zu nodes: %zu pooled block mallocs (%.2f ms)"
+    " vs. %zu unpooled mallocs (%.2f ms)\n",
+    me, stats2.node_allocs - stats1.node_allocs,
+    stats2.block_allocs - stats1.block_allocs, pool_ms,
+    STATIC_CAST( size_t, ITERATIONS * LIST_LEN ), malloc_ms
+  );
+}
+
 ////////// main ///////////////////////////////////////////////////////////////
 
 int main( int argc, char const *argv[const] ) {
@@ -660,8 +747,11 @@ int main( int argc, char const *argv[const] ) {
       test_slist_push_list_back();
     }
     test_slist_pop_front();
+    test_slist_pool();
   }
 
+  bench_slist_pool();
+
   printf( "%u failures\n", test_failures );
   exit( test_failures > 0 ? EX_SOFTWARE : EX_OK );
 }
@@ -96,54 +96,10 @@ void strbuf_paths( strbuf_t *sbuf, char const *component ) {
 }
 
 void strbuf_printf( strbuf_t *sbuf, char const *format, ... ) {
-  assert( sbuf != NULL );
-  assert( format != NULL );
-
-  char *buf;
-  size_t buf_rem;
-
-  if ( sbuf->str == NULL ) {
-    //
-    // Avoid the undefined behavior of adding an offset to a null pointer.  We
-    // have to check for this only in this function since we don't initially
-    // call strbuf_reserve() like in every other function.
-    //
-    buf = NULL;
-    buf_rem = 0;
-  } else {
-    buf = sbuf->str + sbuf->len;
-    buf_rem = sbuf->cap - sbuf->len;
-  }
-
-  //
-  // Attempt to concatenate onto the existing buffer: vsnprintf() returns the
-  // number of characters that _would_ have been printed if the buffer were
-  // unlimited.
-  //
   va_list args;
   va_start( args, format );
-  int raw_len = vsnprintf( buf, buf_rem, format, args );
+  strbuf_vprintf( sbuf, format, args );
   va_end( args );
-  PERROR_EXIT_IF( raw_len < 0, EX_IOERR );
-
-  //
-  // Then reserve that number of characters: if strbuf_reserve() returns false,
-  // it means the buffer was already big enough and so all the characters were
-  // put into it by vsnprintf() which means we're done; otherwise, it means the
-  // buffer wasn't big enough so all the characters didn't fit, but the buffer
-  // was grown so they _will_ fit if we vsnprintf() again.
-  //
-  size_t const args_len = STATIC_CAST( size_t, raw_len );
-  if ( strbuf_reserve( sbuf, args_len ) ) {
-    buf = sbuf->str + sbuf->len;
-    buf_rem = sbuf->cap - sbuf->len;
-    va_start( args, format );
-    raw_len = vsnprintf( buf, buf_rem, format, args );
-    va_end( args );
-    PERROR_EXIT_IF( raw_len < 0, EX_IOERR );
-  }
-
-  sbuf->len += args_len;
 }
 
 void strbuf_putsn( strbuf_t *sbuf, char const *s, size_t s_len ) {
@@ -193,6 +149,57 @@ void strbuf_sepsn_putsn( strbuf_t *sbuf, char const *sep, size_t sep_len,
   strbuf_putsn( sbuf, s, s_len );
 }
 
+void strbuf_vprintf( strbuf_t *sbuf, char const *format, va_list args ) {
+  assert( sbuf != NULL );
+  assert( format != NULL );
+
+  char *buf;
+  size_t buf_rem;
+
+  if ( sbuf->str == NULL ) {
+    //
+    // Avoid the undefined behavior of adding an offset to a null pointer.  We
+    // have to check for this only in this function since we don't initially
+    // call strbuf_reserve() like in every other function.
+    //
+    buf = NULL;
+    buf_rem = 0;
+  } else {
+    buf = sbuf->str + sbuf->len;
+    buf_rem = sbuf->cap - sbuf->len;
+  }
+
+  //
+  // Attempt to concatenate onto the existing buffer: vsnprintf() returns the
+  // number of characters that _would_ have been printed if the buffer were
+  // unlimited.
+  //
+  va_list args_copy;
+  va_copy( args_copy, args );
+  int raw_len = vsnprintf( buf, buf_rem, format, args_copy );
+  va_end( args_copy );
+  PERROR_EXIT_IF( raw_len < 0, EX_IOERR );
+
+  //
+  // Then reserve that number of characters: if strbuf_reserve() returns false,
+  // it means the buffer was already big enough and so all the characters were
+  // put into it by vsnprintf() which means we're done; otherwise, it means the
+  // buffer wasn't big enough so all the characters didn't fit, but the buffer
+  // was grown so they _will_ fit if we vsnprintf() again.
+  //
+  size_t const args_len = STATIC_CAST( size_t, raw_len );
+  if ( strbuf_reserve( sbuf, args_len ) ) {
+    buf = sbuf->str + sbuf->len;
+    buf_rem = sbuf->cap - sbuf->len;
+    va_copy( args_copy, args );
+    raw_len = vsnprintf( buf, buf_rem, format, args_copy );
+    va_end( args_copy );
+    PERROR_EXIT_IF( raw_len < 0, EX_IOERR );
+  }
+
+  sbuf->len += args_len;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
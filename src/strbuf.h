@@ -33,6 +33,7 @@
 /// @cond DOXYGEN_IGNORE
 
 // standard
+#include <stdarg.h>
 #include <stdbool.h>
 #include <stddef.h>                     /* for size_t */
 #include <string.h>                     /* for memset(3) */
@@ -116,6 +117,7 @@ void strbuf_paths( strbuf_t *sbuf, char const *component );
  * @sa strbuf_putc()
  * @sa strbuf_puts()
  * @sa strbuf_putsn()
+ * @sa strbuf_vprintf()
  */
 PJL_PRINTF_LIKE_FUNC(2)
 void strbuf_printf( strbuf_t *sbuf, char const *format, ... );
@@ -318,6 +320,17 @@ char* strbuf_take( strbuf_t *sbuf ) {
   return rv_str;
 }
 
+/**
+ * Like strbuf_printf() except takes a `va_list`.
+ *
+ * @param sbuf A pointer to the \ref strbuf to append onto.
+ * @param format The `printf()` style format string.
+ * @param args The `printf()` arguments.
+ *
+ * @sa strbuf_printf()
+ */
+void strbuf_vprintf( strbuf_t *sbuf, char const *format, va_list args );
+
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */
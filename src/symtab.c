@@ -0,0 +1,383 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/symtab.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+/**
+ * @file
+ * Defines functions for the symbol table that maps a literal to all of its
+ * keyword meanings.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+/// @cond DOXYGEN_IGNORE
+#define SYMTAB_H_INLINE _GL_EXTERN_INLINE
+/// @endcond
+#include "symtab.h"
+#include "symtab_gen.h"
+#include "c_keyword.h"
+#include "cdecl.h"
+#include "cdecl_keyword.h"
+#include "util.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <assert.h>
+#include <inttypes.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+/// @endcond
+
+/**
+ * @addtogroup symtab-group
+ * @{
+ */
+
+// local variables
+static uint16_t const     *symtab_disps;  ///< Displacement of each bucket.
+static size_t              symtab_size;   ///< Number of symbols and buckets.
+static symtab_sym_t const *symtab_syms;   ///< Symbols indexed by slot.
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Hashes \a s.
+ *
+ * @param s The null-terminated string to hash.
+ * @return Returns the 32-bit FNV-1a hash of \a s.
+ */
+NODISCARD
+static uint32_t symtab_hash( char const *s ) {
+  uint32_t hash = 2166136261u;
+  for ( ; *s != '\0'; ++s ) {
+    hash ^= STATIC_CAST( unsigned char, *s );
+    hash *= 16777619u;
+  } // for
+  return hash;
+}
+
+/**
+ * Maps \a n to [0,#symtab_size) without dividing.
+ *
+ * @param n The number to map.
+ * @return Returns said mapped number.
+ */
+NODISCARD
+static inline size_t symtab_range( uint32_t n ) {
+  return STATIC_CAST( size_t,
+    (STATIC_CAST( uint64_t, n ) * symtab_size) >> 32
+  );
+}
+
+/**
+ * Gets the bucket of a literal.
+ *
+ * @param hash The symtab_hash() of the literal.
+ * @return Returns the index into #symtab_disps of the literal's bucket.
+ */
+NODISCARD
+static inline size_t symtab_bucket( uint32_t hash ) {
+  return symtab_range( hash );
+}
+
+/**
+ * Gets the slot of a literal.
+ *
+ * @param hash The symtab_hash() of the literal.
+ * @param disp The displacement of the literal's bucket.
+ * @return Returns the index into #symtab_syms of the literal.
+ */
+NODISCARD
+static inline size_t symtab_slot( uint32_t hash, uint16_t disp ) {
+  uint32_t h = hash + STATIC_CAST( uint32_t, disp ) * 0x9E3779B9u;
+  // MurmurHash3's finalizer so every bit of h affects the slot.
+  h ^= h >> 16;
+  h *= 0x85EBCA6Bu;
+  h ^= h >> 13;
+  h *= 0xC2B2AE35u;
+  h ^= h >> 16;
+  return symtab_range( h );
+}
+
+#ifndef WITH_PREDEF_TABLE
+
+/**
+ * Frees all memory used by the symbol table.
+ */
+static void symtab_cleanup( void ) {
+  FREE( symtab_disps );
+  FREE( symtab_syms );
+  symtab_size = 0;
+}
+
+/**
+ * Gets the element of an open-addressing hash table for \a literal using
+ * linear probing, initializing it if it was empty.
+ *
+ * @param table The table.
+ * @param cap The capacity of \a table; must be a power of 2.
+ * @param literal The literal to get the element for.
+ * @param len A pointer to the number of used elements of \a table; it's
+ * incremented if an empty element was initialized.
+ * @return Returns said element.
+ */
+NODISCARD
+static symtab_sym_t* symtab_table_add( symtab_sym_t *table, size_t cap,
+                                       char const *literal, size_t *len ) {
+  uint32_t const hash = symtab_hash( literal );
+  for ( size_t i = hash & (cap - 1); ; i = (i + 1) & (cap - 1) ) {
+    symtab_sym_t *const sym = &table[i];
+    if ( sym->literal == NULL ) {
+      *sym = (symtab_sym_t){ .literal = literal, .hash = hash };
+      ++*len;
+      return sym;
+    }
+    if ( sym->hash == hash && strcmp( sym->literal, literal ) == 0 )
+      return sym;
+  } // for
+}
+
+/**
+ * Builds the symbol table.
+ *
+ * @remarks The minimal perfect hash function is built by "hash and displace":
+ * every literal is hashed into one of #symtab_size buckets; then, largest
+ * bucket first, each bucket is given the least displacement such that
+ * symtab_slot() puts each of its literals into a distinct, free slot.
+ */
+static void symtab_build( void ) {
+  size_t cap = 16;
+  {
+    size_t n = 0;
+    FOREACH_C_KEYWORD( ck )
+      ++n;
+    FOREACH_CDECL_KEYWORD( cdk )
+      ++n;
+    while ( cap < n * 2 )               // keep load factor <= 0.5
+      cap <<= 1;
+  }
+
+  //
+  // First, gather all keyword meanings of each literal.
+  //
+  symtab_sym_t *const table = MALLOC( symtab_sym_t, cap );
+  memset( table, 0, cap * sizeof *table );
+  size_t n = 0;
+
+  FOREACH_C_KEYWORD( ck ) {
+    symtab_sym_t *const sym = symtab_table_add( table, cap, ck->literal, &n );
+    size_t i = 0;
+    while ( i < SYMTAB_CK_MAX && sym->ck[i] != NULL )
+      ++i;
+    if ( unlikely( i == SYMTAB_CK_MAX ) ) {
+      INTERNAL_ERROR(                   // LCOV_EXCL_LINE
+        "\"%s\": more than SYMTAB_CK_MAX C/C++ keywords\n", ck->literal
+      );
+    }
+    sym->ck[i] = ck;
+    sym->ck_lang_ids |= ck->lang_ids;
+  } // for
+
+  FOREACH_CDECL_KEYWORD( cdk ) {
+    symtab_sym_t *const sym = symtab_table_add( table, cap, cdk->literal, &n );
+    assert( sym->cdk == NULL );
+    sym->cdk = cdk;
+  } // for
+
+  symtab_size = n;
+
+  //
+  // Next, group the symbols by bucket.
+  //
+  symtab_sym_t const **const by_bucket = MALLOC( symtab_sym_t const*, n );
+  size_t *const bucket_first = MALLOC( size_t, n + 1 );
+  memset( bucket_first, 0, (n + 1) * sizeof *bucket_first );
+
+  for ( size_t i = 0; i < cap; ++i ) {
+    if ( table[i].literal != NULL )
+      ++bucket_first[ symtab_bucket( table[i].hash ) + 1 ];
+  } // for
+  size_t max_bucket_len = 0;
+  for ( size_t b = 0; b < n; ++b ) {
+    if ( bucket_first[ b + 1 ] > max_bucket_len )
+      max_bucket_len = bucket_first[ b + 1 ];
+    bucket_first[ b + 1 ] += bucket_first[b];
+  } // for
+  {
+    size_t *const bucket_next = MALLOC( size_t, n );
+    memcpy( bucket_next, bucket_first, n * sizeof *bucket_next );
+    for ( size_t i = 0; i < cap; ++i ) {
+      if ( table[i].literal != NULL ) {
+        size_t const b = symtab_bucket( table[i].hash );
+        by_bucket[ bucket_next[b]++ ] = &table[i];
+      }
+    } // for
+    free( bucket_next );
+  }
+
+  //
+  // Finally, find a displacement for each bucket, largest first, that puts
+  // its symbols into free slots.
+  //
+  symtab_sym_t *const syms = MALLOC( symtab_sym_t, n );
+  memset( syms, 0, n * sizeof *syms );
+  uint16_t *const disps = MALLOC( uint16_t, n );
+  memset( disps, 0, n * sizeof *disps );
+  size_t *const slots = MALLOC( size_t, max_bucket_len );
+
+  for ( size_t len = max_bucket_len; len > 0; --len ) {
+    for ( size_t b = 0; b < n; ++b ) {
+      if ( bucket_first[ b + 1 ] - bucket_first[b] != len )
+        continue;
+      symtab_sym_t const *const *const bucket = &by_bucket[ bucket_first[b] ];
+      for ( uint32_t disp = 0; ; ++disp ) {
+        if ( unlikely( disp > UINT16_MAX ) ) {
+          INTERNAL_ERROR(               // LCOV_EXCL_LINE
+            "\"%s\": no displacement for bucket\n", bucket[0]->literal
+          );
+        }
+        size_t i = 0;
+        for ( ; i < len; ++i ) {
+          slots[i] =
+            symtab_slot( bucket[i]->hash, STATIC_CAST( uint16_t, disp ) );
+          if ( syms[ slots[i] ].literal != NULL )
+            break;
+          size_t j = 0;
+          while ( j < i && slots[j] != slots[i] )
+            ++j;
+          if ( j < i )
+            break;
+        } // for
+        if ( i == len ) {
+          disps[b] = STATIC_CAST( uint16_t, disp );
+          for ( i = 0; i < len; ++i )
+            syms[ slots[i] ] = *bucket[i];
+          break;
+        }
+      } // for
+    } // for
+  } // for
+
+  free( slots );
+  free( bucket_first );
+  free( by_bucket );
+  free( table );
+
+  symtab_disps = disps;
+  symtab_syms = syms;
+}
+
+#endif /* WITH_PREDEF_TABLE */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+symtab_sym_t const* symtab_find( char const *literal ) {
+  assert( literal != NULL );
+  assert( symtab_syms != NULL );
+  uint32_t const hash = symtab_hash( literal );
+  symtab_sym_t const *const sym =
+    &symtab_syms[ symtab_slot( hash, symtab_disps[ symtab_bucket( hash ) ] ) ];
+  return sym->hash == hash && strcmp( sym->literal, literal ) == 0 ?
+    sym : NULL;
+}
+
+#ifdef CDECL_PREDEF_GEN
+int symtab_gen_emit( FILE *fout ) {
+  assert( fout != NULL );
+
+  FPRINTF( fout,
+    "/*\n"
+    "** This file was generated by %s -- DO NOT EDIT.\n"
+    "*/\n"
+    "\n"
+    "// local\n"
+    "#include \"pjl_config.h\"                 /* must go first */\n"
+    "#include \"symtab_gen.h\"\n"
+    "#include \"c_keyword.h\"\n"
+    "#include \"cdecl_keyword.h\"\n"
+    "#include \"symtab.h\"\n"
+    "#include \"util.h\"\n"
+    "\n"
+    "// standard\n"
+    "#include <stddef.h>\n"
+    "#include <stdint.h>\n"
+    "\n"
+    "symtab_sym_t const SYMTAB_PREDEF[] = {\n",
+    me
+  );
+
+  for ( size_t i = 0; i < symtab_size; ++i ) {
+    symtab_sym_t const *const sym = &symtab_syms[i];
+    FPRINTF( fout, "  { \"%s\", ", sym->literal );
+    if ( sym->cdk == NULL )
+      FPUTS( "NULL", fout );
+    else
+      FPRINTF( fout, "&CDECL_KEYWORDS[%td]", sym->cdk - CDECL_KEYWORDS );
+    FPUTS( ", { ", fout );
+    for ( size_t j = 0; j < SYMTAB_CK_MAX; ++j ) {
+      if ( j > 0 )
+        FPUTS( ", ", fout );
+      if ( sym->ck[j] == NULL )
+        FPUTS( "NULL", fout );
+      else
+        FPRINTF( fout, "&C_KEYWORDS[%td]", sym->ck[j] - C_KEYWORDS );
+    } // for
+    FPRINTF( fout, " }, 0x%" PRIX32 "u, 0x%08" PRIX32 "u },\n",
+      sym->ck_lang_ids, sym->hash
+    );
+  } // for
+
+  FPUTS( "};\n\nuint16_t const SYMTAB_PREDEF_DISP[] = {", fout );
+  for ( size_t i = 0; i < symtab_size; ++i )
+    FPRINTF( fout, "%s%u,",
+      i % 12 == 0 ? "\n  " : " ", STATIC_CAST( unsigned, symtab_disps[i] )
+    );
+  FPUTS(
+    "\n};\n"
+    "\n"
+    "size_t const SYMTAB_PREDEF_SIZE = ARRAY_SIZE( SYMTAB_PREDEF );\n",
+    fout
+  );
+
+  return EX_OK;
+}
+#endif /* CDECL_PREDEF_GEN */
+
+void symtab_init( void ) {
+  ASSERT_RUN_ONCE();
+#ifdef WITH_PREDEF_TABLE
+  symtab_disps = SYMTAB_PREDEF_DISP;
+  symtab_size = SYMTAB_PREDEF_SIZE;
+  symtab_syms = SYMTAB_PREDEF;
+#else
+  symtab_build();
+  ATEXIT( &symtab_cleanup );
+#endif /* WITH_PREDEF_TABLE */
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,145 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/symtab.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_symtab_H
+#define cdecl_symtab_H
+
+/**
+ * @file
+ * Declares types and functions for the symbol table that maps a literal to
+ * all of its keyword meanings.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "c_keyword.h"
+#include "c_lang.h"
+#include "cdecl_keyword.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stdint.h>
+
+_GL_INLINE_HEADER_BEGIN
+#ifndef SYMTAB_H_INLINE
+# define SYMTAB_H_INLINE _GL_INLINE
+#endif /* SYMTAB_H_INLINE */
+
+/// @endcond
+
+/**
+ * @defgroup symtab-group Symbol Table
+ * Types and functions for the symbol table that maps a literal to all of its
+ * keyword meanings.
+ *
+ * @remarks Without it, every identifier would have to be looked up separately
+ * as a **cdecl** keyword and as a C/C++ keyword.  With it, a single look-up
+ * gets both.  Since the set of keywords is fixed, the table is built once and
+ * is thereafter only read, hence can be shared by all sessions on all threads.
+ * Filtering by language and keyword context is done by bitmask at look-up so
+ * the table doesn't depend on \ref opt_lang.
+ * @par
+ * The table is indexed by a minimal perfect hash function: every literal has
+ * a slot of its own and there are no empty slots, so a look-up is one hash of
+ * the identifier followed by at most one string comparison.  The table is
+ * either generated at build time (see symtab_gen.h) or, if not, built by
+ * symtab_init().
+ * @par
+ * `typedef`s aren't in the table since they're per-session and may be added
+ * or removed at any time.
+ *
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Maximum number of C/C++ keywords having the same literal.
+ *
+ * @sa #C_KEYWORDS for the only case, `auto`.
+ */
+#define SYMTAB_CK_MAX             2
+
+/**
+ * All keyword meanings of a literal.
+ */
+struct symtab_sym {
+  char const             *literal;      ///< The literal.
+  cdecl_keyword_t const  *cdk;          ///< The **cdecl** keyword, if any.
+
+  /**
+   * The C/C++ keywords having \ref literal in #C_KEYWORDS order, if any.
+   * Unused elements are NULL.
+   */
+  c_keyword_t const      *ck[ SYMTAB_CK_MAX ];
+
+  c_lang_id_t             ck_lang_ids;  ///< Union of languages of all \ref ck.
+  uint32_t                hash;         ///< Hash of \ref literal.
+};
+typedef struct symtab_sym symtab_sym_t;
+
+////////// extern functions ///////////////////////////////////////////////////
+
+/**
+ * Gets the C/C++ keyword meaning of \a sym, if any.
+ *
+ * @param sym The \ref symtab_sym to use.  May be NULL.
+ * @param lang_ids The bitwise-or of language(s) to look for the keyword in.
+ * @param kw_ctx The keyword context to limit to.
+ * @return Returns a pointer to the corresponding c_keyword or NULL if none.
+ *
+ * @sa c_keyword_find()
+ */
+NODISCARD SYMTAB_H_INLINE
+c_keyword_t const* symtab_c_keyword( symtab_sym_t const *sym,
+                                     c_lang_id_t lang_ids,
+                                     c_keyword_ctx_t kw_ctx ) {
+  return sym == NULL || (sym->ck_lang_ids & lang_ids) == LANG_NONE ?
+    NULL : c_keyword_find_in( sym->ck, SYMTAB_CK_MAX, lang_ids, kw_ctx );
+}
+
+/**
+ * Finds the keyword meanings of \a literal.
+ *
+ * @param literal The literal to find.
+ * @return Returns a pointer to said meanings or NULL if \a literal is not a
+ * keyword of any kind.
+ *
+ * @sa symtab_c_keyword()
+ */
+NODISCARD
+symtab_sym_t const* symtab_find( char const *literal );
+
+/**
+ * Initializes the symbol table.
+ *
+ * @note This function must be called exactly once.
+ */
+void symtab_init( void );
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+_GL_INLINE_HEADER_END
+
+#endif /* cdecl_symtab_H */
+/* vim:set et sw=2 ts=2: */
@@ -0,0 +1,95 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/symtab_gen.h
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+#ifndef cdecl_symtab_gen_H
+#define cdecl_symtab_gen_H
+
+/**
+ * @file
+ * Declares data and functions for the build-time symbol table of keywords.
+ *
+ * @remarks At build time, the same generator that emits the precompiled
+ * predefined types (when given the `symtab` argument) builds the symbol table
+ * in the usual way and then emits it as C source code of static initializers.
+ * That code is then compiled into the real **cdecl** so it need not build the
+ * table at start-up.
+ */
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "c_typedef_gen.h"              /* for WITH_PREDEF_TABLE */
+#include "symtab.h"
+
+/// @cond DOXYGEN_IGNORE
+
+// standard
+#include <stddef.h>                     /* for size_t */
+#include <stdint.h>
+#include <stdio.h>
+
+/// @endcond
+
+/**
+ * @addtogroup symtab-group
+ * @{
+ */
+
+///////////////////////////////////////////////////////////////////////////////
+
+#ifdef WITH_PREDEF_TABLE
+
+/**
+ * The symbols indexed by the minimal perfect hash function.
+ */
+extern symtab_sym_t const   SYMTAB_PREDEF[];
+
+/**
+ * The displacement of each bucket of the minimal perfect hash function.
+ */
+extern uint16_t const       SYMTAB_PREDEF_DISP[];
+
+/**
+ * The number of elements in both #SYMTAB_PREDEF and #SYMTAB_PREDEF_DISP.
+ */
+extern size_t const         SYMTAB_PREDEF_SIZE;
+
+#endif /* WITH_PREDEF_TABLE */
+
+////////// extern functions ///////////////////////////////////////////////////
+
+#ifdef CDECL_PREDEF_GEN
+
+/**
+ * Emits C source code for the symbol table built by symtab_init().
+ *
+ * @param fout The `FILE` to emit to.
+ * @return Returns `EX_OK` upon success or another value upon failure.
+ */
+NODISCARD
+int symtab_gen_emit( FILE *fout );
+
+#endif /* CDECL_PREDEF_GEN */
+
+///////////////////////////////////////////////////////////////////////////////
+
+/** @} */
+
+#endif /* cdecl_symtab_gen_H */
+/* vim:set et sw=2 ts=2: */
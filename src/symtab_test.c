@@ -0,0 +1,128 @@
+/*
+**      cdecl -- C gibberish translator
+**      src/symtab_test.c
+**
+**      Copyright (C) 2023  Paul J. Lucas
+**
+**      This program is free software: you can redistribute it and/or modify
+**      it under the terms of the GNU General Public License as published by
+**      the Free Software Foundation, either version 3 of the License, or
+**      (at your option) any later version.
+**
+**      This program is distributed in the hope that it will be useful,
+**      but WITHOUT ANY WARRANTY; without even the implied warranty of
+**      MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+**      GNU General Public License for more details.
+**
+**      You should have received a copy of the GNU General Public License
+**      along with this program.  If not, see <http://www.gnu.org/licenses/>.
+*/
+
+// local
+#include "pjl_config.h"                 /* must go first */
+#include "symtab.h"
+#include "c_keyword.h"
+#include "cdecl_keyword.h"
+#include "util.h"
+#include "unit_test.h"
+
+// standard
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sysexits.h>
+
+///////////////////////////////////////////////////////////////////////////////
+
+// local variables
+static unsigned     test_failures;
+
+////////// local functions ////////////////////////////////////////////////////
+
+/**
+ * Tests that the symbol found for \a literal has exactly the keyword meanings
+ * of \a literal in #C_KEYWORDS and #CDECL_KEYWORDS, i.e., what symtab_init()
+ * would build at run-time even if the table was generated at build time.
+ *
+ * @param literal The literal to test.
+ * @return Returns `true` only if all tests passed.
+ */
+static bool test_symtab_literal( char const *literal ) {
+  TEST_FN_BEGIN();
+
+  c_keyword_t const *ck[ SYMTAB_CK_MAX ] = { NULL };
+  c_lang_id_t ck_lang_ids = LANG_NONE;
+  size_t ck_len = 0;
+  FOREACH_C_KEYWORD( k ) {
+    if ( strcmp( k->literal, literal ) == 0 ) {
+      if ( TEST( ck_len < SYMTAB_CK_MAX ) )
+        ck[ ck_len++ ] = k;
+      ck_lang_ids |= k->lang_ids;
+    }
+  } // for
+
+  cdecl_keyword_t const *cdk = NULL;
+  FOREACH_CDECL_KEYWORD( k ) {
+    if ( strcmp( k->literal, literal ) == 0 ) {
+      TEST( cdk == NULL );
+      cdk = k;
+    }
+  } // for
+
+  symtab_sym_t const *const sym = symtab_find( literal );
+  if ( TEST( sym != NULL ) ) {
+    TEST( strcmp( sym->literal, literal ) == 0 );
+    TEST( sym->cdk == cdk );
+    for ( size_t i = 0; i < SYMTAB_CK_MAX; ++i )
+      TEST( sym->ck[i] == ck[i] );
+    TEST( sym->ck_lang_ids == ck_lang_ids );
+  }
+
+  TEST_FN_END();
+}
+
+static bool test_symtab_find( void ) {
+  TEST_FN_BEGIN();
+
+  FOREACH_C_KEYWORD( ck ) {
+    if ( !test_symtab_literal( ck->literal ) )
+      EPRINTF( "%s: \"%s\": symbol table disagrees\n", me, ck->literal );
+  } // for
+  FOREACH_CDECL_KEYWORD( cdk ) {
+    if ( !test_symtab_literal( cdk->literal ) )
+      EPRINTF( "%s: \"%s\": symbol table disagrees\n", me, cdk->literal );
+  } // for
+
+  TEST( symtab_find( "" ) == NULL );
+  TEST( symtab_find( "x" ) == NULL );
+  TEST( symtab_find( "Int" ) == NULL );
+  TEST( symtab_find( "size_t" ) == NULL );
+
+  TEST_FN_END();
+}
+
+// LCOV_EXCL_START
+_Noreturn
+static void usage( void ) {
+  EPRINTF( "usage: %s\n", me );
+  exit( EX_USAGE );
+}
+// LCOV_EXCL_STOP
+
+////////// main ///////////////////////////////////////////////////////////////
+
+int main( int argc, char const *argv[const] ) {
+  me = base_name( argv[0] );
+  if ( --argc != 0 )
+    usage();                            // LCOV_EXCL_LINE
+
+  symtab_init();
+  test_symtab_find();
+
+  printf( "%u failures\n", test_failures );
+  exit( test_failures > 0 ? EX_SOFTWARE : EX_OK );
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/* vim:set et sw=2 ts=2: */
@@ -223,6 +223,9 @@ typedef struct c_apple_block_ast  c_apple_block_ast_t;
 typedef struct c_array_ast        c_array_ast_t;
 typedef enum   c_array_kind       c_array_kind_t;
 typedef struct c_ast              c_ast_t;
+typedef struct c_ast_arena        c_ast_arena_t;
+typedef struct c_ast_arena_chunk  c_ast_arena_chunk_t;
+typedef struct c_ast_arena_stats  c_ast_arena_stats_t;
 typedef slist_t                   c_ast_list_t;   ///< AST list.
 typedef struct c_ast_pair         c_ast_pair_t;
 typedef struct c_bit_field_ast    c_bit_field_ast_t;
@@ -248,17 +251,25 @@ typedef slist_node_t              c_param_t;      ///< Function-like parameter.
 typedef struct c_parent_ast       c_parent_ast_t;
 typedef struct c_ptr_mbr_ast      c_ptr_mbr_ast_t;
 typedef struct c_ptr_ref_ast      c_ptr_ref_ast_t;
-typedef slist_node_t              c_scope_t;      ///< Scope in \ref c_sname_t.
+typedef struct c_scope_data      c_scope_t;      ///< Scope in \ref c_sname_t.
 typedef struct c_sglob            c_sglob_t;
-typedef slist_t                   c_sname_t;      ///< C++ scoped name.
+typedef struct c_sname            c_sname_t;      ///< C++ scoped name.
 typedef uint64_t                  c_tid_t;        ///< Type ID(s) bits.
 typedef struct c_typedef          c_typedef_t;
 typedef struct c_typedef_ast      c_typedef_ast_t;
+typedef struct c_typedefs         c_typedefs_t;
 typedef struct c_type             c_type_t;
 typedef struct c_udef_conv_ast    c_udef_conv_ast_t;
 typedef struct c_udef_lit_ast     c_udef_lit_ast_t;
 typedef enum   cdecl_mode         cdecl_mode_t;
+typedef struct cdecl_cache        cdecl_cache_t;
+typedef struct cdecl_cache_entry  cdecl_cache_entry_t;
+typedef struct cdecl_options      cdecl_options_t;
+typedef struct cdecl_session      cdecl_session_t;
 typedef enum   cdecl_show         cdecl_show_t;
+typedef struct lexer              lexer_t;
+typedef struct parser             parser_t;
+typedef struct sink               sink_t;
 typedef union  user_data          user_data_t;
 
 typedef c_loc_t YYLTYPE;                ///< Source location type for Bison.
@@ -267,6 +278,13 @@ typedef c_loc_t YYLTYPE;                ///< Source location type for Bison.
 #define YYLTYPE_IS_TRIVIAL        1
 /// @endcond
 
+#ifndef YY_TYPEDEF_YY_SCANNER_T
+/// @cond DOXYGEN_IGNORE
+#define YY_TYPEDEF_YY_SCANNER_T
+/// @endcond
+typedef void *yyscan_t;                 ///< Flex reentrant scanner type.
+#endif /* YY_TYPEDEF_YY_SCANNER_T */
+
 /**
  * The signature for a function passed to **qsort**(3).
  *
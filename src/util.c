@@ -43,6 +43,7 @@
 #include <string.h>
 #include <sys/stat.h>                   /* for fstat() */
 #include <sysexits.h>
+#include <time.h>
 
 /// @endcond
 
@@ -56,23 +57,6 @@
 // local variable definitions
 static slist_t free_later_list;         ///< List of stuff to free later.
 
-////////// local functions ////////////////////////////////////////////////////
-
-/**
- * Helper function for fput_list() that, given a pointer to a pointer to an
- * array of pointer to `char`, returns the pointer to the associated string.
- *
- * @param ppelt A pointer to the pointer to the element to get the string of.
- * On return, it is incremented by the size of the element.
- * @return Returns said string or NULL if none.
- */
-NODISCARD
-static char const* fput_list_apc_gets( void const **ppelt ) {
-  char const *const *const ps = *ppelt;
-  *ppelt = ps + 1;
-  return *ps;
-}
-
 ////////// extern functions ///////////////////////////////////////////////////
 
 char const* base_name( char const *path_name ) {
@@ -149,7 +133,7 @@ char* check_strndup( char const *s, size_t n ) {
 
 void fatal_error( int status, char const *format, ... ) {
   // LCOV_EXCL_START
-  EPRINTF( "%s: ", me );
+  fprintf( stderr, "%s: ", me );
   va_list args;
   va_start( args, format );
   vfprintf( stderr, format, args );
@@ -194,74 +178,6 @@ FILE* fmemopen( void *buf, size_t size, char const *mode ) {
 }
 #endif /* HAVE_FMEMOPEN */
 
-void fput_list( FILE *out, void const *elt,
-                char const* (*gets)( void const** ) ) {
-  assert( out != NULL );
-  assert( elt != NULL );
-
-  if ( gets == NULL )
-    gets = &fput_list_apc_gets;
-
-  char const *s = (*gets)( &elt );
-  for ( size_t i = 0; s != NULL; ++i ) {
-    char const *const next_s = (*gets)( &elt );
-    if ( i > 0 )
-      FPUTS( next_s != NULL ? ", " : i > 1 ? ", or " : " or ", out );
-    FPUTS( s, out );
-    s = next_s;
-  } // for
-}
-
-void fputs_quoted( char const *s, char quote, FILE *fout ) {
-  assert( quote == '\'' || quote == '"' );
-  assert( fout != NULL );
-
-  if ( s == NULL ) {
-    FPUTS( "null", fout );
-    return;
-  }
-
-  bool in_quote = false;
-  char const other_quote = quote == '\'' ? '"' : '\'';
-
-  FPUTC( quote, fout );
-  for ( char prev = '\0'; *s != '\0'; prev = *s++ ) {
-    switch ( *s ) {
-      case '\b': FPUTS( "\\b", fout ); continue;
-      case '\f': FPUTS( "\\f", fout ); continue;
-      case '\n': FPUTS( "\\n", fout ); continue;
-      case '\r': FPUTS( "\\r", fout ); continue;
-      case '\t': FPUTS( "\\t", fout ); continue;
-      case '\v': FPUTS( "\\v", fout ); continue;
-      case '\\':
-        if ( in_quote ) {
-          if ( prev != '\\' )
-            FPUTS( "\\\\", fout );
-          continue;
-        }
-        break;
-    } // switch
-
-    if ( prev != '\\' ) {
-      if ( *s == quote ) {
-        FPUTC( '\\', fout );
-        in_quote = !in_quote;
-      }
-      else if ( *s == other_quote ) {
-        in_quote = !in_quote;
-      }
-    }
-
-    FPUTC( *s, fout );
-  } // for
-  FPUTC( quote, fout );
-}
-
-void fputs_sp( char const *s, FILE *out ) {
-  if ( s[0] != '\0' )
-    FPRINTF( out, "%s ", s );
-}
-
 void* free_later( void *p ) {
   assert( p != NULL );
   slist_push_back( &free_later_list, p );
@@ -301,6 +217,13 @@ uint32_t ms_bit1_32( uint32_t n ) {
   return 0;
 }
 
+double monotonic_now( void ) {
+  struct timespec ts;
+  PERROR_EXIT_IF( clock_gettime( CLOCK_MONOTONIC, &ts ) != 0, EX_OSERR );
+  return STATIC_CAST( double, ts.tv_sec ) +
+         STATIC_CAST( double, ts.tv_nsec ) / 1e9;
+}
+
 char const* parse_identifier( char const *s ) {
   assert( s != NULL );
   if ( !is_ident_first( s[0] ) )
@@ -274,46 +274,6 @@ _GL_INLINE_HEADER_BEGIN
 #define DUP2(OLD_FD,NEW_FD) \
   PERROR_EXIT_IF( dup2( (OLD_FD), (NEW_FD) ) != (NEW_FD), EX_OSERR )
 
-/**
- * Shorthand for printing to standard error.
- *
- * @param ... The `printf()` arguments.
- *
- * @sa #EPUTC()
- * @sa #EPUTS()
- * @sa #FPRINTF()
- * @sa #PRINTF()
- * @sa #PUTC()
- * @sa #PUTS()
- */
-#define EPRINTF(...)              fprintf( stderr, __VA_ARGS__ )
-
-/**
- * Shorthand for printing a character to standard error.
- *
- * @param C The character to print.
- *
- * @sa #EPRINTF()
- * @sa #EPUTS()
- * @sa #FPUTC()
- * @sa #PRINTF()
- * @sa #PUTC()
- */
-#define EPUTC(C)                  fputc( (C), stderr )
-
-/**
- * Shorthand for printing a C string to standard error.
- *
- * @param S The C string to print.
- *
- * @sa #EPRINTF()
- * @sa #EPUTC()
- * @sa #FPUTS()
- * @sa #PRINTF()
- * @sa #PUTS()
- */
-#define EPUTS(S)                  fputs( (S), stderr )
-
 /**
  * Calls **ferror**(3) and exits if there was an error on \a STREAM.
  *
@@ -627,44 +587,6 @@ _GL_INLINE_HEADER_BEGIN
  */
 #define POINTER_CAST(T,EXPR)      ((T)(uintptr_t)(EXPR))
 
-/**
- * Calls #FPRINTF() with `stdout`.
- *
- * @param ... The `fprintf()` arguments.
- *
- * @sa #EPRINTF()
- * @sa #FPRINTF()
- * @sa #PUTC()
- * @sa #PUTS()
- */
-#define PRINTF(...)               FPRINTF( stdout, __VA_ARGS__ )
-
-/**
- * Calls #FPUTC() with `stdout`.
- *
- * @param C The character to print.
- *
- * @sa #EPUTC()
- * @sa #FPUTC()
- * @sa #PRINTF()
- * @sa #PUTS()
- */
-#define PUTC(C)                   FPUTC( (C), stdout )
-
-/**
- * Calls #FPUTS() with `stdout`.
- *
- * @param S The C string to print.
- *
- * @note Unlike **puts**(3), does _not_ print a newline.
- *
- * @sa #EPUTS()
- * @sa #FPUTS()
- * @sa #PRINTF()
- * @sa #PUTC()
- */
-#define PUTS(S)                   FPUTS( (S), stdout )
-
 /**
  * Convenience macro for calling check_realloc().
  *
@@ -990,52 +912,6 @@ NODISCARD
 FILE* fmemopen( void *buf, size_t size, char const *mode );
 #endif /* HAVE_FMEMOPEN */
 
-/**
- * Prints a zero-or-more element list of strings where for:
- *
- *  + A zero-element list, nothing is printed;
- *  + A one-element list, the string for the element is printed;
- *  + A two-element list, the strings for the elements are printed separated by
- *    `or`;
- *  + A three-or-more element list, the strings for the first N-1 elements are
- *    printed separated by `,` and the N-1st and Nth elements are separated by
- *    `, or`.
- *
- * @param out The `FILE` to print to.
- * @param elt A pointer to the first element to print.
- * @param gets A pointer to a function to call to get the string for the
- * element `**ppelt`: if the function returns NULL, it signals the end of the
- * list; otherwise, the function returns the string for the element and must
- * increment `*ppelt` to the next element.  If \a gets is NULL, it is assumed
- * that \a elt points to the first element of an array of `char*` and that the
- * array ends with NULL.
- *
- * @warning The string pointer returned by \a gets for a given element _must_
- * remain valid at least until after the _next_ call to fput_list(), that is
- * upon return, the previously returned string pointer must still be valid
- * also.
- */
-void fput_list( FILE *out, void const *elt,
-                char const* (*gets)( void const **ppelt ) );
-
-/**
- * Prints \a s as a quoted string with escaped characters.
- *
- * @param s The string to put.  If NULL, prints `null` (unquoted).
- * @param quote The quote character to use, either <tt>'</tt> or <tt>"</tt>.
- * @param fout The `FILE` to print to.
- */
-void fputs_quoted( char const *s, char quote, FILE *fout );
-
-/**
- * If \a s is not empty, prints \a s followed by a space to \a out; otherwise
- * does nothing.
- *
- * @param s The string to print.
- * @param out The `FILE` to print to.
- */
-void fputs_sp( char const *s, FILE *out );
-
 /**
  * Adds a pointer to the head of the free-later-list.
  *
@@ -1269,6 +1145,14 @@ uint32_t ls_bit1_32( uint32_t n );
 NODISCARD
 uint32_t ms_bit1_32( uint32_t n );
 
+/**
+ * Gets the current value of a monotonic clock.
+ *
+ * @return Returns said value in seconds.
+ */
+NODISCARD
+double monotonic_now( void );
+
 /**
  * Parses a C/C++ identifier.
  *
@@ -1409,20 +1293,6 @@ bool true_clear( bool *flag ) {
   return *flag && !(*flag = false);
 }
 
-/**
- * Possibly prints the list separator \a sep based on \a sep_flag.
- *
- * @param sep The separator to print.
- * @param sep_flag If `true`, prints \a sep; if `false`, prints nothing, but
- * sets it to `true`.  The flag should be `false` initially.
- * @param sout The `FILE` to print to.
- */
-C_UTIL_H_INLINE
-void fput_sep( char const *sep, bool *sep_flag, FILE *sout ) {
-  if ( true_or_set( sep_flag ) )
-    FPUTS( sep, sout );
-}
-
 ///////////////////////////////////////////////////////////////////////////////
 
 /** @} */